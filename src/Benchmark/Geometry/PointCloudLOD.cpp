@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloudLOD.h"
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+
+// A flight over the cloud, ending close to its corner.
+std::vector<open3d::camera::PinholeCameraParameters> CreateCameraPath(
+        int num_frames) {
+    std::vector<open3d::camera::PinholeCameraParameters> path(num_frames);
+    for (int i = 0; i < num_frames; i++) {
+        double t = double(i) / num_frames;
+        Eigen::Vector3d position(10.0 - 9.0 * t, 5.0, 15.0 - 14.0 * t);
+        Eigen::Vector3d z =
+                (Eigen::Vector3d(1.0, 2.0, 0.0) - position).normalized();
+        Eigen::Vector3d x = z.cross(Eigen::Vector3d(0, 0, 1)).normalized();
+        Eigen::Vector3d y = z.cross(x);
+        Eigen::Matrix3d R;
+        R << x.transpose(), y.transpose(), z.transpose();
+        path[i].intrinsic_.SetIntrinsics(1280, 960, 1000.0, 1000.0, 639.5,
+                                         479.5);
+        path[i].extrinsic_ = Eigen::Matrix4d::Identity();
+        path[i].extrinsic_.block<3, 3>(0, 0) = R;
+        path[i].extrinsic_.block<3, 1>(0, 3) = -R * position;
+    }
+    return path;
+}
+
+}  // unnamed namespace
+
+class PointCloudLODFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        pointcloud.points_.resize(size_t(state.range(0)));
+        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+            pointcloud.points_[i] = Eigen::Vector3d(
+                    10.0 * double(rand()) / RAND_MAX,
+                    10.0 * double(rand()) / RAND_MAX,
+                    0.5 * double(rand()) / RAND_MAX);
+        }
+    }
+
+    void TearDown(const benchmark::State& state) { pointcloud.Clear(); }
+    open3d::geometry::PointCloud pointcloud;
+};
+
+BENCHMARK_DEFINE_F(PointCloudLODFixture, Create)(benchmark::State& state) {
+    for (auto _ : state) {
+        open3d::geometry::PointCloudLOD::CreateFromPointCloud(pointcloud);
+    }
+    state.SetItemsProcessed(state.iterations() * pointcloud.points_.size());
+}
+
+BENCHMARK_REGISTER_F(PointCloudLODFixture, Create)
+        ->Args({1 << 20})
+        ->Args({1 << 23})
+        ->Unit(benchmark::kMillisecond);
+
+// Reports the average number of selected points per frame of the path.
+BENCHMARK_DEFINE_F(PointCloudLODFixture, SelectNodes)
+(benchmark::State& state) {
+    auto lod = open3d::geometry::PointCloudLOD::CreateFromPointCloud(
+            pointcloud);
+    auto path = CreateCameraPath(100);
+    size_t budget = size_t(state.range(1));
+    size_t num_frames = 0, num_points = 0;
+    for (auto _ : state) {
+        for (const auto& camera : path) {
+            auto nodes = lod->SelectNodes(camera, budget);
+            num_points += lod->GetPointCount(nodes);
+            num_frames++;
+        }
+    }
+    state.counters["frames"] = benchmark::Counter(
+            double(num_frames), benchmark::Counter::kIsRate);
+    state.counters["points_per_frame"] =
+            double(num_points) / double(std::max<size_t>(num_frames, 1));
+}
+
+BENCHMARK_REGISTER_F(PointCloudLODFixture, SelectNodes)
+        ->Args({1 << 23, 1000000})
+        ->Args({1 << 23, 4000000})
+        ->Unit(benchmark::kMillisecond);
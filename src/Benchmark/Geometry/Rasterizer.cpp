@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/Rasterizer.h"
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "benchmark/benchmark.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+class RasterizerFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        sphere = open3d::geometry::TriangleMesh::CreateSphere(1.0, 400);
+        sphere->ComputeVertexNormals();
+        sphere->PaintUniformColor(Eigen::Vector3d(0.5, 0.5, 0.5));
+        pointcloud = sphere->SamplePointsUniformly(1000000);
+        camera.intrinsic_.SetIntrinsics(1280, 960, 1000.0, 1000.0, 639.5,
+                                        479.5);
+        camera.extrinsic_ = Eigen::Matrix4d::Identity();
+        camera.extrinsic_(2, 3) = 3.0;
+#ifdef _OPENMP
+        max_threads = omp_get_max_threads();
+        omp_set_num_threads(int(state.range(0)));
+#endif
+    }
+
+    void TearDown(const benchmark::State& state) {
+#ifdef _OPENMP
+        omp_set_num_threads(max_threads);
+#endif
+    }
+    std::shared_ptr<open3d::geometry::TriangleMesh> sphere;
+    std::shared_ptr<open3d::geometry::PointCloud> pointcloud;
+    open3d::camera::PinholeCameraParameters camera;
+    int max_threads = 1;
+};
+
+BENCHMARK_DEFINE_F(RasterizerFixture, TriangleMesh)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        open3d::geometry::RasterizeTriangleMesh(*sphere, camera);
+    }
+    state.SetItemsProcessed(state.iterations() * sphere->triangles_.size());
+}
+
+BENCHMARK_REGISTER_F(RasterizerFixture, TriangleMesh)
+        ->Args({1})
+        ->Args({2})
+        ->Args({4})
+        ->Args({8})
+        ->UseRealTime();
+
+BENCHMARK_DEFINE_F(RasterizerFixture, PointCloud)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        open3d::geometry::RasterizePointCloud(*pointcloud, camera);
+    }
+    state.SetItemsProcessed(state.iterations() * pointcloud->points_.size());
+}
+
+BENCHMARK_REGISTER_F(RasterizerFixture, PointCloud)
+        ->Args({1})
+        ->Args({2})
+        ->Args({4})
+        ->Args({8})
+        ->UseRealTime();
@@ -0,0 +1,71 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "Open3D/Utility/Console.h"
+#include "benchmark/benchmark.h"
+
+// Reconstructs the knot from points sampled uniformly on its surface. Range 0
+// is the number of points; the radii are derived from the point spacing.
+class BallPivotingFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Error);
+        auto mesh = open3d::io::CreateMeshFromFile(
+                std::string(TEST_DATA_DIR) + "/knot.ply");
+        mesh->ComputeVertexNormals();
+        pcd = mesh->SamplePointsUniformly(size_t(state.range(0)));
+        double spacing =
+                std::sqrt(mesh->GetSurfaceArea() / pcd->points_.size());
+        radii = {spacing, 2 * spacing, 4 * spacing};
+    }
+
+    void TearDown(const benchmark::State& state) {
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Info);
+    }
+    std::shared_ptr<open3d::geometry::PointCloud> pcd;
+    std::vector<double> radii;
+};
+
+BENCHMARK_DEFINE_F(BallPivotingFixture, Knot)(benchmark::State& state) {
+    std::shared_ptr<open3d::geometry::TriangleMesh> mesh;
+    for (auto _ : state) {
+        mesh = open3d::geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+                *pcd, radii);
+    }
+    state.SetItemsProcessed(state.iterations() * pcd->points_.size());
+    state.counters["triangles"] = double(mesh->triangles_.size());
+}
+
+BENCHMARK_REGISTER_F(BallPivotingFixture, Knot)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshDeformation.h"
+#include "Open3D/Utility/Console.h"
+#include "benchmark/benchmark.h"
+
+class DeformAsRigidAsPossibleFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Error);
+        mesh = open3d::geometry::TriangleMesh::CreateSphere(
+                1.0, int(state.range(0)));
+        constraint_ids.clear();
+        constraint_pos.clear();
+        for (int i = 0; i < int(mesh->vertices_.size()); ++i) {
+            if (mesh->vertices_[i](2) < -0.9) {
+                constraint_ids.push_back(i);
+                constraint_pos.push_back(mesh->vertices_[i]);
+            }
+        }
+        // The north pole is the handle.
+        constraint_ids.push_back(0);
+        constraint_pos.push_back(mesh->vertices_[0]);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Info);
+    }
+
+    // Handle position in frame \p frame of a drag.
+    Eigen::Vector3d Handle(size_t frame) const {
+        return mesh->vertices_[0] +
+               Eigen::Vector3d(0.005 * double(frame % 100), 0, 0);
+    }
+
+    std::shared_ptr<open3d::geometry::TriangleMesh> mesh;
+    std::vector<int> constraint_ids;
+    std::vector<Eigen::Vector3d> constraint_pos;
+};
+
+// One frame of a drag, deforming from scratch.
+BENCHMARK_DEFINE_F(DeformAsRigidAsPossibleFixture, Mesh)
+(benchmark::State& state) {
+    size_t frame = 0;
+    for (auto _ : state) {
+        constraint_pos.back() = Handle(frame++);
+        mesh->DeformAsRigidAsPossible(constraint_ids, constraint_pos, 5);
+    }
+    state.SetItemsProcessed(state.iterations() * mesh->vertices_.size());
+}
+
+BENCHMARK_REGISTER_F(DeformAsRigidAsPossibleFixture, Mesh)
+        ->Args({50})
+        ->Args({200})
+        ->Unit(benchmark::kMillisecond);
+
+// One frame of a drag, warm-started from the previous frame.
+BENCHMARK_DEFINE_F(DeformAsRigidAsPossibleFixture, Session)
+(benchmark::State& state) {
+    open3d::geometry::DeformAsRigidAsPossibleSession session(*mesh,
+                                                             constraint_ids);
+    size_t frame = 0;
+    for (auto _ : state) {
+        constraint_pos.back() = Handle(frame++);
+        session.Deform(constraint_pos, 5);
+    }
+    state.SetItemsProcessed(state.iterations() * mesh->vertices_.size());
+    double iteration_time = 0;
+    for (double t : session.GetIterationTimes()) {
+        iteration_time += t;
+    }
+    state.counters["ms_per_iteration"] =
+            iteration_time / double(session.GetIterationTimes().size());
+}
+
+BENCHMARK_REGISTER_F(DeformAsRigidAsPossibleFixture, Session)
+        ->Args({50})
+        ->Args({200})
+        ->Unit(benchmark::kMillisecond);
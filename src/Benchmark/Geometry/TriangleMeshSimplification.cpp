@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+
+// Largest distance of a vertex or triangle center to the unit sphere.
+double MaxDeviation(const open3d::geometry::TriangleMesh& mesh) {
+    double deviation = 0;
+    for (const auto& tria : mesh.triangles_) {
+        Eigen::Vector3d center = (mesh.vertices_[tria(0)] +
+                                  mesh.vertices_[tria(1)] +
+                                  mesh.vertices_[tria(2)]) /
+                                 3.0;
+        deviation = std::max(deviation, std::abs(center.norm() - 1.0));
+        deviation = std::max(deviation,
+                             std::abs(mesh.vertices_[tria(0)].norm() - 1.0));
+    }
+    return deviation;
+}
+
+}  // unnamed namespace
+
+// Decimates a sphere to 1/20 of its triangles. Range 0 is the sphere
+// resolution, range 1 the partition size, with -1 for the serial decimation.
+class SimplifyQuadricDecimationFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Error);
+        sphere = open3d::geometry::TriangleMesh::CreateSphere(
+                1.0, int(state.range(0)));
+    }
+
+    void TearDown(const benchmark::State& state) {
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Info);
+    }
+    std::shared_ptr<open3d::geometry::TriangleMesh> sphere;
+};
+
+BENCHMARK_DEFINE_F(SimplifyQuadricDecimationFixture, Sphere)
+(benchmark::State& state) {
+    int target = int(sphere->triangles_.size() / 20);
+    int partition_size = int(state.range(1));
+    std::shared_ptr<open3d::geometry::TriangleMesh> mesh;
+    for (auto _ : state) {
+        if (partition_size < 0) {
+            mesh = sphere->SimplifyQuadricDecimation(target);
+        } else {
+            mesh = sphere->SimplifyQuadricDecimation(
+                    target,
+                    open3d::geometry::QuadricDecimationOption(partition_size));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * sphere->triangles_.size());
+    state.counters["triangles"] = double(mesh->triangles_.size());
+    state.counters["max_deviation"] = MaxDeviation(*mesh);
+}
+
+BENCHMARK_REGISTER_F(SimplifyQuadricDecimationFixture, Sphere)
+        ->Args({200, -1})
+        ->Args({200, 0})
+        ->Args({200, 100000})
+        ->Args({200, 10000})
+        ->Args({500, 100000})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
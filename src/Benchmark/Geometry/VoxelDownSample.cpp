@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "benchmark/benchmark.h"
+
+class VoxelDownSampleFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        pcd = open3d::io::CreatePointCloudFromFile(TEST_DATA_DIR
+                                                   "/fragment.pcd");
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<open3d::geometry::PointCloud> pcd;
+};
+
+BENCHMARK_DEFINE_F(VoxelDownSampleFixture, VoxelDownSample)
+(benchmark::State& state) {
+    double voxel_size = 0.001 * state.range(0);
+    for (auto _ : state) {
+        pcd->VoxelDownSample(voxel_size);
+    }
+    state.SetItemsProcessed(state.iterations() * pcd->points_.size());
+}
+
+BENCHMARK_REGISTER_F(VoxelDownSampleFixture, VoxelDownSample)
+        ->Args({5})
+        ->Args({20});
+
+BENCHMARK_DEFINE_F(VoxelDownSampleFixture, VoxelDownSampleAndTrace)
+(benchmark::State& state) {
+    double voxel_size = 0.001 * state.range(0);
+    Eigen::Vector3d min_bound = pcd->GetMinBound();
+    Eigen::Vector3d max_bound = pcd->GetMaxBound();
+    for (auto _ : state) {
+        pcd->VoxelDownSampleAndTrace(voxel_size, min_bound, max_bound);
+    }
+    state.SetItemsProcessed(state.iterations() * pcd->points_.size());
+}
+
+BENCHMARK_REGISTER_F(VoxelDownSampleFixture, VoxelDownSampleAndTrace)
+        ->Args({5})
+        ->Args({20});
@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/VoxelGrid.h"
+#include "benchmark/benchmark.h"
+
+class VoxelGridFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        sphere = open3d::geometry::TriangleMesh::CreateSphere(1.0, 200);
+        torus = open3d::geometry::TriangleMesh::CreateTorus(1.0, 0.3, 300,
+                                                            100);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<open3d::geometry::TriangleMesh> sphere;
+    std::shared_ptr<open3d::geometry::TriangleMesh> torus;
+};
+
+BENCHMARK_DEFINE_F(VoxelGridFixture, CreateFromTriangleMeshSphere)
+(benchmark::State& state) {
+    double voxel_size = 1.0 / state.range(0);
+    for (auto _ : state) {
+        open3d::geometry::VoxelGrid::CreateFromTriangleMesh(*sphere,
+                                                            voxel_size);
+    }
+    state.SetItemsProcessed(state.iterations() * sphere->triangles_.size());
+}
+
+BENCHMARK_REGISTER_F(VoxelGridFixture, CreateFromTriangleMeshSphere)
+        ->Args({50})
+        ->Args({200});
+
+BENCHMARK_DEFINE_F(VoxelGridFixture, CreateFromTriangleMeshTorus)
+(benchmark::State& state) {
+    double voxel_size = 1.0 / state.range(0);
+    for (auto _ : state) {
+        open3d::geometry::VoxelGrid::CreateFromTriangleMesh(*torus,
+                                                            voxel_size);
+    }
+    state.SetItemsProcessed(state.iterations() * torus->triangles_.size());
+}
+
+BENCHMARK_REGISTER_F(VoxelGridFixture, CreateFromTriangleMeshTorus)
+        ->Args({50})
+        ->Args({200});
+
+BENCHMARK_DEFINE_F(VoxelGridFixture, CreateFromTriangleMeshSolid)
+(benchmark::State& state) {
+    double voxel_size = 1.0 / state.range(0);
+    for (auto _ : state) {
+        open3d::geometry::VoxelGrid::CreateFromTriangleMesh(*sphere,
+                                                            voxel_size, true);
+    }
+    state.SetItemsProcessed(state.iterations() * sphere->triangles_.size());
+}
+
+BENCHMARK_REGISTER_F(VoxelGridFixture, CreateFromTriangleMeshSolid)
+        ->Args({50});
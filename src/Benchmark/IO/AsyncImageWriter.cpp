@@ -0,0 +1,109 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/IO/ClassIO/AsyncImageWriter.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+
+const int kNumFrames = 32;
+
+std::vector<std::shared_ptr<const open3d::geometry::Image>> LoadDepthFrames() {
+    open3d::geometry::Image depth;
+    open3d::io::ReadImage(
+            std::string(TEST_DATA_DIR) + "/RGBD/depth/00000.png", depth);
+    return std::vector<std::shared_ptr<const open3d::geometry::Image>>(
+            kNumFrames, std::make_shared<open3d::geometry::Image>(depth));
+}
+
+open3d::io::PNGWriteOption GetPNGWriteOption(int64_t fast) {
+    return fast ? open3d::io::PNGWriteOption::FastDepth()
+                : open3d::io::PNGWriteOption();
+}
+
+std::string GetFilename(int frame) {
+    return "tmp_benchmark_depth_" + std::to_string(frame) + ".png";
+}
+
+}  // unnamed namespace
+
+// Range 0 selects the default (0) or fast depth (1) PNG settings.
+static void BM_WriteDepthSync(benchmark::State& state) {
+    auto frames = LoadDepthFrames();
+    auto option = GetPNGWriteOption(state.range(0));
+    for (auto _ : state) {
+        for (int i = 0; i < kNumFrames; i++) {
+            open3d::io::WriteImageToPNG(GetFilename(i), *frames[i], option);
+        }
+    }
+    state.counters["frames_per_second"] = benchmark::Counter(
+            kNumFrames, benchmark::Counter::kIsIterationInvariantRate);
+    for (int i = 0; i < kNumFrames; i++) {
+        std::remove(GetFilename(i).c_str());
+    }
+}
+
+// Range 0 selects the PNG settings as above, range 1 is the number of
+// threads.
+static void BM_WriteDepthAsync(benchmark::State& state) {
+    auto frames = LoadDepthFrames();
+    open3d::io::AsyncImageWriter writer(
+            8, int(state.range(1)), GetPNGWriteOption(state.range(0)));
+    for (auto _ : state) {
+        for (int i = 0; i < kNumFrames; i++) {
+            writer.WriteImage(GetFilename(i), frames[i]);
+        }
+        writer.Flush();
+    }
+    state.counters["frames_per_second"] = benchmark::Counter(
+            kNumFrames, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["producer_stalls"] =
+            double(writer.GetStatistics().num_producer_stalls_);
+    for (int i = 0; i < kNumFrames; i++) {
+        std::remove(GetFilename(i).c_str());
+    }
+}
+
+BENCHMARK(BM_WriteDepthSync)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+BENCHMARK(BM_WriteDepthAsync)
+        ->Args({0, 1})
+        ->Args({0, 4})
+        ->Args({1, 1})
+        ->Args({1, 4})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
@@ -0,0 +1,175 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+#include "Open3D/Geometry/Octree.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/IO/ClassIO/OctreeIO.h"
+#include "Open3D/IO/ClassIO/VoxelGridIO.h"
+#include "Open3D/Utility/Console.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+
+// Points on a wavy surface, which gives surface-like octrees and voxel grids.
+open3d::geometry::PointCloud CreateSurfaceCloud(int n) {
+    open3d::geometry::PointCloud pointcloud;
+    for (int y = 0; y < n; y++) {
+        for (int x = 0; x < n; x++) {
+            double u = double(x) / n, v = double(y) / n;
+            pointcloud.points_.push_back(Eigen::Vector3d(
+                    u, v, 0.5 + 0.2 * std::sin(u * 12.0) * std::cos(v * 9.0)));
+            pointcloud.colors_.push_back(Eigen::Vector3d(u, v, 0.5));
+        }
+    }
+    return pointcloud;
+}
+
+}  // unnamed namespace
+
+// Range 0 is the octree depth, range 1 selects JSON (0) or BIN (1).
+class OctreeBINFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Error);
+        int depth = int(state.range(0));
+        filename = std::string("tmp_benchmark_octree.") +
+                   (state.range(1) ? "bin" : "json");
+        octree = open3d::geometry::Octree(depth);
+        octree.ConvertFromPointCloud(CreateSurfaceCloud(1 << depth), 0.01);
+        open3d::io::WriteOctree(filename, octree);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        std::remove(filename.c_str());
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Info);
+    }
+
+    std::string filename;
+    open3d::geometry::Octree octree;
+};
+
+BENCHMARK_DEFINE_F(OctreeBINFixture, Write)(benchmark::State& state) {
+    for (auto _ : state) {
+        open3d::io::WriteOctree(filename, octree);
+    }
+}
+
+BENCHMARK_DEFINE_F(OctreeBINFixture, Read)(benchmark::State& state) {
+    size_t num_nodes = 0;
+    for (auto _ : state) {
+        open3d::geometry::Octree read_octree;
+        if (state.range(1)) {
+            open3d::io::ReadOctreeFromBIN(filename, read_octree, &num_nodes);
+        } else {
+            open3d::io::ReadOctree(filename, read_octree);
+        }
+    }
+    if (!state.range(1)) {
+        octree.Traverse(
+                [&num_nodes](
+                        const std::shared_ptr<open3d::geometry::OctreeNode>&,
+                        const std::shared_ptr<
+                                open3d::geometry::OctreeNodeInfo>&) {
+                    num_nodes++;
+                });
+    }
+    state.counters["nodes"] = double(num_nodes);
+    state.counters["nodes_per_second"] = benchmark::Counter(
+            double(num_nodes), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK_REGISTER_F(OctreeBINFixture, Write)
+        ->Args({8, 0})
+        ->Args({8, 1})
+        ->Args({9, 0})
+        ->Args({9, 1})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(OctreeBINFixture, Read)
+        ->Args({8, 0})
+        ->Args({8, 1})
+        ->Args({9, 0})
+        ->Args({9, 1})
+        ->Unit(benchmark::kMillisecond);
+
+// Range 0 is the number of voxels along x and y, range 1 selects PLY (0) or
+// BIN (1).
+class VoxelGridBINFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Error);
+        int n = int(state.range(0));
+        filename = std::string("tmp_benchmark_voxel_grid.") +
+                   (state.range(1) ? "bin" : "ply");
+        voxelgrid = *open3d::geometry::VoxelGrid::CreateFromPointCloud(
+                CreateSurfaceCloud(n), 1.0 / n);
+        open3d::io::WriteVoxelGrid(filename, voxelgrid);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        std::remove(filename.c_str());
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Info);
+    }
+
+    std::string filename;
+    open3d::geometry::VoxelGrid voxelgrid;
+};
+
+BENCHMARK_DEFINE_F(VoxelGridBINFixture, Write)(benchmark::State& state) {
+    for (auto _ : state) {
+        open3d::io::WriteVoxelGrid(filename, voxelgrid);
+    }
+    state.counters["voxels"] = double(voxelgrid.voxels_.size());
+}
+
+BENCHMARK_DEFINE_F(VoxelGridBINFixture, Read)(benchmark::State& state) {
+    size_t num_voxels = 0;
+    for (auto _ : state) {
+        open3d::geometry::VoxelGrid read_voxelgrid;
+        open3d::io::ReadVoxelGrid(filename, read_voxelgrid);
+        num_voxels = read_voxelgrid.voxels_.size();
+    }
+    state.counters["voxels"] = double(num_voxels);
+}
+
+BENCHMARK_REGISTER_F(VoxelGridBINFixture, Write)
+        ->Args({512, 0})
+        ->Args({512, 1})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(VoxelGridBINFixture, Read)
+        ->Args({512, 0})
+        ->Args({512, 1})
+        ->Unit(benchmark::kMillisecond);
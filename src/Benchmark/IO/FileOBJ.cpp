@@ -0,0 +1,82 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "Open3D/Utility/Console.h"
+#include "benchmark/benchmark.h"
+
+// OBJ file of a sphere with vertex normals and triangle uvs. Range 0 is the
+// sphere resolution.
+class OBJFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Error);
+        auto mesh = open3d::geometry::TriangleMesh::CreateSphere(
+                1.0, int(state.range(0)));
+        mesh->ComputeVertexNormals();
+        mesh->triangle_uvs_.resize(3 * mesh->triangles_.size());
+        for (size_t i = 0; i < mesh->triangle_uvs_.size(); i++) {
+            const Eigen::Vector3i& triangle = mesh->triangles_[i / 3];
+            mesh->triangle_uvs_[i] = mesh->vertices_[triangle(i % 3)].head<2>();
+        }
+        num_triangles = mesh->triangles_.size();
+        open3d::io::WriteTriangleMesh(filename, *mesh);
+        FILE* file = fopen(filename, "rb");
+        fseek(file, 0, SEEK_END);
+        file_size = ftell(file);
+        fclose(file);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        std::remove(filename);
+        std::remove("tmp_benchmark.mtl");
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Info);
+    }
+
+    const char* filename = "tmp_benchmark.obj";
+    size_t num_triangles;
+    int64_t file_size;
+};
+
+BENCHMARK_DEFINE_F(OBJFixture, Read)(benchmark::State& state) {
+    for (auto _ : state) {
+        open3d::geometry::TriangleMesh mesh;
+        open3d::io::ReadTriangleMesh(filename, mesh);
+    }
+    state.SetItemsProcessed(state.iterations() * num_triangles);
+    state.SetBytesProcessed(state.iterations() * file_size);
+}
+
+BENCHMARK_REGISTER_F(OBJFixture, Read)
+        ->Arg(200)
+        ->Arg(1000)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
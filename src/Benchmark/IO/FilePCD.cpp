@@ -0,0 +1,103 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <cstdio>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/Utility/Console.h"
+#include "benchmark/benchmark.h"
+
+// Lidar-like cloud with normals and colors. Range 0 is the number of points,
+// range 1 enables chunked compression.
+class PCDFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Error);
+        int num_points = int(state.range(0));
+        pointcloud_.points_.resize(num_points);
+        pointcloud_.normals_.resize(num_points);
+        pointcloud_.colors_.resize(num_points);
+        for (int i = 0; i < num_points; i++) {
+            double angle = 0.001 * i;
+            double range = 10.0 + (i % 1024) * 0.01;
+            pointcloud_.points_[i] = Eigen::Vector3d(
+                    range * std::cos(angle), range * std::sin(angle),
+                    (i % 64) * 0.05 - 1.6);
+            pointcloud_.normals_[i] =
+                    Eigen::Vector3d(std::cos(angle), std::sin(angle), 0.0);
+            double t = (i % 64) / 63.0;
+            pointcloud_.colors_[i] = Eigen::Vector3d(t, 0.5, 1.0 - t);
+        }
+        option_ = open3d::io::PCDWriteOption(false, true, state.range(1) != 0);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        std::remove(filename);
+        pointcloud_.Clear();
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Info);
+    }
+
+    const char* filename = "tmp_benchmark.pcd";
+    open3d::geometry::PointCloud pointcloud_;
+    open3d::io::PCDWriteOption option_;
+};
+
+BENCHMARK_DEFINE_F(PCDFixture, Write)(benchmark::State& state) {
+    for (auto _ : state) {
+        open3d::io::WritePointCloudToPCD(filename, pointcloud_, option_);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_DEFINE_F(PCDFixture, Read)(benchmark::State& state) {
+    open3d::io::WritePointCloudToPCD(filename, pointcloud_, option_);
+    for (auto _ : state) {
+        open3d::geometry::PointCloud pointcloud;
+        open3d::io::ReadPointCloudFromPCD(filename, pointcloud);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 1M and 10M points.
+BENCHMARK_REGISTER_F(PCDFixture, Write)
+        ->Args({1000000, 0})
+        ->Args({1000000, 1})
+        ->Args({10000000, 0})
+        ->Args({10000000, 1})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+BENCHMARK_REGISTER_F(PCDFixture, Read)
+        ->Args({1000000, 0})
+        ->Args({1000000, 1})
+        ->Args({10000000, 0})
+        ->Args({10000000, 1})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "Open3D/Utility/Console.h"
+#include "benchmark/benchmark.h"
+
+// Binary STL of a wavy height field with 2 * n * n triangles, written record
+// by record so that the fixture itself does not hold a mesh. Range 0 is n,
+// range 1 enables vertex welding.
+class STLFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Error);
+        int n = int(state.range(0));
+        FILE* file = fopen(filename, "wb");
+        char header[80] = "Open3D benchmark";
+        uint32_t num_triangles = uint32_t(2 * n * n);
+        fwrite(header, 1, 80, file);
+        fwrite(&num_triangles, 4, 1, file);
+        auto vertex = [n](int x, int y) {
+            float u = float(x) / n, v = float(y) / n;
+            return Eigen::Vector3f(u, v, 0.1f * std::sin(20 * u) * v);
+        };
+        for (int y = 0; y < n; y++) {
+            for (int x = 0; x < n; x++) {
+                Eigen::Vector3f quad[4] = {vertex(x, y), vertex(x + 1, y),
+                                           vertex(x + 1, y + 1),
+                                           vertex(x, y + 1)};
+                WriteRecord(file, quad[0], quad[1], quad[2]);
+                WriteRecord(file, quad[0], quad[2], quad[3]);
+            }
+        }
+        fclose(file);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        std::remove(filename);
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Info);
+    }
+
+    static void WriteRecord(FILE* file,
+                            const Eigen::Vector3f& v0,
+                            const Eigen::Vector3f& v1,
+                            const Eigen::Vector3f& v2) {
+        char record[50] = {0};
+        Eigen::Vector3f normal = (v1 - v0).cross(v2 - v0).normalized();
+        std::memcpy(record, normal.data(), 12);
+        std::memcpy(record + 12, v0.data(), 12);
+        std::memcpy(record + 24, v1.data(), 12);
+        std::memcpy(record + 36, v2.data(), 12);
+        fwrite(record, 1, 50, file);
+    }
+
+    const char* filename = "tmp_benchmark.stl";
+};
+
+BENCHMARK_DEFINE_F(STLFixture, Read)(benchmark::State& state) {
+    bool weld_vertices = state.range(1) != 0;
+    size_t num_vertices = 0;
+    for (auto _ : state) {
+        open3d::geometry::TriangleMesh mesh;
+        open3d::io::ReadTriangleMeshFromSTL(filename, mesh, weld_vertices,
+                                            false);
+        num_vertices = mesh.vertices_.size();
+    }
+    int64_t num_triangles = 2 * state.range(0) * state.range(0);
+    state.SetItemsProcessed(state.iterations() * num_triangles);
+    state.SetBytesProcessed(state.iterations() * (84 + 50 * num_triangles));
+    state.counters["vertices"] = double(num_vertices);
+#ifndef _WIN32
+    // Peak resident memory of the whole process so far.
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    state.counters["peak_rss_mb"] = double(usage.ru_maxrss) / (1 << 20);
+#else
+    state.counters["peak_rss_mb"] = double(usage.ru_maxrss) / (1 << 10);
+#endif
+#endif
+}
+
+// 2M and 10M triangles.
+BENCHMARK_REGISTER_F(STLFixture, Read)
+        ->Args({1000, 0})
+        ->Args({1000, 1})
+        ->Args({2237, 0})
+        ->Args({2237, 1})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
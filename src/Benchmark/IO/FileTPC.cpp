@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <cstdio>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/Utility/Console.h"
+#include "benchmark/benchmark.h"
+
+// Terrain-like cloud of n * n points with colors on a 1000 x 1000 area. Range
+// 0 is n.
+class TPCFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Error);
+        int n = int(state.range(0));
+        open3d::geometry::PointCloud pointcloud;
+        pointcloud.points_.resize(size_t(n) * n);
+        pointcloud.colors_.resize(size_t(n) * n);
+        for (int y = 0; y < n; y++) {
+            for (int x = 0; x < n; x++) {
+                double u = 1000.0 * x / n, v = 1000.0 * y / n;
+                double h = 20.0 * std::sin(u * 0.01) * std::cos(v * 0.013);
+                pointcloud.points_[size_t(y) * n + x] =
+                        Eigen::Vector3d(u, v, h);
+                pointcloud.colors_[size_t(y) * n + x] =
+                        Eigen::Vector3d(0.5 + h / 40.0, 0.5, 0.5 - h / 40.0);
+            }
+        }
+        open3d::io::WritePointCloudToTPC(filename, pointcloud);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        std::remove(filename);
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Info);
+    }
+
+    const char* filename = "tmp_benchmark.tpc";
+};
+
+BENCHMARK_DEFINE_F(TPCFixture, ReadAll)(benchmark::State& state) {
+    size_t num_points = 0;
+    for (auto _ : state) {
+        open3d::geometry::PointCloud pointcloud;
+        open3d::io::ReadPointCloudFromTPC(filename, pointcloud);
+        num_points = pointcloud.points_.size();
+    }
+    state.counters["points"] = double(num_points);
+}
+
+// A 100 x 100 region, 1% of the area.
+BENCHMARK_DEFINE_F(TPCFixture, ReadRegion)(benchmark::State& state) {
+    open3d::geometry::AxisAlignedBoundingBox bbox(
+            Eigen::Vector3d(450, 450, -100), Eigen::Vector3d(550, 550, 100));
+    size_t num_points = 0;
+    for (auto _ : state) {
+        open3d::geometry::PointCloud pointcloud;
+        open3d::io::ReadPointCloudFromTPC(filename, pointcloud, bbox);
+        num_points = pointcloud.points_.size();
+    }
+    state.counters["points"] = double(num_points);
+}
+
+BENCHMARK_DEFINE_F(TPCFixture, ReadLevel0)(benchmark::State& state) {
+    size_t num_points = 0;
+    for (auto _ : state) {
+        open3d::geometry::PointCloud pointcloud;
+        open3d::io::ReadPointCloudFromTPC(filename, pointcloud, 0);
+        num_points = pointcloud.points_.size();
+    }
+    state.counters["points"] = double(num_points);
+}
+
+// 1M and 10M points.
+BENCHMARK_REGISTER_F(TPCFixture, ReadAll)
+        ->Arg(1000)
+        ->Arg(3163)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+BENCHMARK_REGISTER_F(TPCFixture, ReadRegion)
+        ->Arg(1000)
+        ->Arg(3163)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+BENCHMARK_REGISTER_F(TPCFixture, ReadLevel0)
+        ->Arg(1000)
+        ->Arg(3163)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
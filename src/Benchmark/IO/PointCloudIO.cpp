@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+
+const char* kTextExtensions[] = {"xyz", "xyzn", "xyzrgb", "pts"};
+
+}  // unnamed namespace
+
+// Text point cloud formats with 1M random points. Range 0 selects the format
+// from kTextExtensions.
+class PointCloudTextIOFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Error);
+        filename = std::string("tmp_benchmark.") +
+                   kTextExtensions[state.range(0)];
+        pcd = std::make_shared<open3d::geometry::PointCloud>();
+        pcd->points_.resize(1000000);
+        pcd->normals_.resize(pcd->points_.size());
+        pcd->colors_.resize(pcd->points_.size());
+        for (size_t i = 0; i < pcd->points_.size(); i++) {
+            pcd->points_[i] = Eigen::Vector3d::Random() * 100.0;
+            pcd->normals_[i] = Eigen::Vector3d::Random().normalized();
+            pcd->colors_[i] =
+                    (Eigen::Vector3d::Random() + Eigen::Vector3d::Ones()) / 2;
+        }
+        open3d::io::WritePointCloud(filename, *pcd);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        std::remove(filename.c_str());
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Info);
+    }
+
+    int64_t FileSize() const {
+        FILE* file = open3d::utility::filesystem::FOpen(filename, "rb");
+        fseek(file, 0, SEEK_END);
+        int64_t size = ftell(file);
+        fclose(file);
+        return size;
+    }
+
+    std::string filename;
+    std::shared_ptr<open3d::geometry::PointCloud> pcd;
+};
+
+BENCHMARK_DEFINE_F(PointCloudTextIOFixture, Read)(benchmark::State& state) {
+    open3d::geometry::PointCloud result;
+    for (auto _ : state) {
+        open3d::io::ReadPointCloud(filename, result);
+    }
+    state.SetBytesProcessed(state.iterations() * FileSize());
+    state.SetLabel(kTextExtensions[state.range(0)]);
+}
+
+BENCHMARK_DEFINE_F(PointCloudTextIOFixture, Write)(benchmark::State& state) {
+    for (auto _ : state) {
+        open3d::io::WritePointCloud(filename, *pcd);
+    }
+    state.SetBytesProcessed(state.iterations() * FileSize());
+    state.SetLabel(kTextExtensions[state.range(0)]);
+}
+
+BENCHMARK_REGISTER_F(PointCloudTextIOFixture, Read)
+        ->DenseRange(0, 3)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+BENCHMARK_REGISTER_F(PointCloudTextIOFixture, Write)
+        ->DenseRange(0, 3)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
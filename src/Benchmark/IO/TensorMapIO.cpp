@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/TensorMapIO.h"
+#include "Open3D/Utility/Console.h"
+#include "benchmark/benchmark.h"
+
+// Lidar-like scan with intensity, ring and timestamp attributes. Range 0 is
+// the number of points, range 1 selects PLY (0) or PCD (1).
+class TensorMapFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Error);
+        int num_points = int(state.range(0));
+        std::vector<float> x(num_points), y(num_points), z(num_points);
+        std::vector<float> intensity(num_points);
+        std::vector<uint8_t> ring(num_points);
+        std::vector<double> timestamp(num_points);
+        for (int i = 0; i < num_points; i++) {
+            double angle = 0.001 * i;
+            double range = 10.0 + (i % 1024) * 0.01;
+            x[i] = float(range * std::cos(angle));
+            y[i] = float(range * std::sin(angle));
+            z[i] = float((i % 64) * 0.05 - 1.6);
+            intensity[i] = float(i % 256) / 255.0f;
+            ring[i] = uint8_t(i % 64);
+            timestamp[i] = 1.5e9 + i * 1e-6;
+        }
+        const open3d::SizeVector shape({num_points});
+        tensor_map_["x"] = open3d::Tensor(x, shape, open3d::Dtype::Float32);
+        tensor_map_["y"] = open3d::Tensor(y, shape, open3d::Dtype::Float32);
+        tensor_map_["z"] = open3d::Tensor(z, shape, open3d::Dtype::Float32);
+        tensor_map_["intensity"] =
+                open3d::Tensor(intensity, shape, open3d::Dtype::Float32);
+        tensor_map_["ring"] =
+                open3d::Tensor(ring, shape, open3d::Dtype::UInt8);
+        tensor_map_["timestamp"] =
+                open3d::Tensor(timestamp, shape, open3d::Dtype::Float64);
+        filename_ = state.range(1) == 0 ? "tmp_benchmark.ply"
+                                        : "tmp_benchmark.pcd";
+    }
+
+    void TearDown(const benchmark::State& state) {
+        std::remove(filename_.c_str());
+        tensor_map_.clear();
+        open3d::utility::SetVerbosityLevel(
+                open3d::utility::VerbosityLevel::Info);
+    }
+
+    std::string filename_;
+    open3d::io::TensorMap tensor_map_;
+};
+
+BENCHMARK_DEFINE_F(TensorMapFixture, Write)(benchmark::State& state) {
+    for (auto _ : state) {
+        open3d::io::WriteTensorMap(filename_, tensor_map_);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_DEFINE_F(TensorMapFixture, Read)(benchmark::State& state) {
+    open3d::io::WriteTensorMap(filename_, tensor_map_);
+    for (auto _ : state) {
+        open3d::io::TensorMap tensor_map;
+        open3d::io::ReadTensorMap(filename_, tensor_map);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Reads only the points of the same file into a PointCloud for comparison.
+BENCHMARK_DEFINE_F(TensorMapFixture, ReadPointCloud)
+(benchmark::State& state) {
+    open3d::io::WriteTensorMap(filename_, tensor_map_);
+    for (auto _ : state) {
+        open3d::geometry::PointCloud pointcloud;
+        open3d::io::ReadPointCloud(filename_, pointcloud);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 1M and 10M points.
+BENCHMARK_REGISTER_F(TensorMapFixture, Write)
+        ->Args({1000000, 0})
+        ->Args({1000000, 1})
+        ->Args({10000000, 0})
+        ->Args({10000000, 1})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+BENCHMARK_REGISTER_F(TensorMapFixture, Read)
+        ->Args({1000000, 0})
+        ->Args({1000000, 1})
+        ->Args({10000000, 0})
+        ->Args({10000000, 1})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+BENCHMARK_REGISTER_F(TensorMapFixture, ReadPointCloud)
+        ->Args({1000000, 0})
+        ->Args({1000000, 1})
+        ->Args({10000000, 0})
+        ->Args({10000000, 1})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/FeatureMatching.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/IO/ClassIO/FeatureIO.h"
+#include "Open3D/Registration/Feature.h"
+#include "benchmark/benchmark.h"
+
+// Matches the FPFH features of two TestData fragments. The exact KD-tree
+// result is the reference for the recall counter.
+class FeatureMatchingFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        if (!reference_.empty()) return;
+        open3d::io::ReadFeature(TEST_DATA_DIR "/Feature/cloud_bin_0.fpfh.bin",
+                                source_);
+        open3d::io::ReadFeature(TEST_DATA_DIR "/Feature/cloud_bin_1.fpfh.bin",
+                                target_);
+        open3d::geometry::KDTreeFlann kdtree(target_);
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        reference_.resize(source_.Num());
+        for (size_t i = 0; i < source_.Num(); i++) {
+            kdtree.SearchKNN(Eigen::VectorXd(source_.data_.col(i)), 1,
+                             indices, distance2);
+            reference_[i] = indices[0];
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    double Recall(const Eigen::MatrixXi& indices) const {
+        size_t hit = 0;
+        for (size_t i = 0; i < reference_.size(); i++) {
+            if (indices(0, i) == reference_[i]) hit++;
+        }
+        return double(hit) / double(reference_.size());
+    }
+
+    open3d::registration::Feature source_;
+    open3d::registration::Feature target_;
+    std::vector<int> reference_;
+};
+
+BENCHMARK_DEFINE_F(FeatureMatchingFixture, ExactKDTree)
+(benchmark::State& state) {
+    open3d::geometry::KDTreeFlann kdtree(target_);
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    for (auto _ : state) {
+        for (size_t i = 0; i < source_.Num(); i++) {
+            kdtree.SearchKNN(Eigen::VectorXd(source_.data_.col(i)), 1,
+                             indices, distance2);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * source_.Num());
+}
+
+BENCHMARK_REGISTER_F(FeatureMatchingFixture, ExactKDTree)
+        ->Unit(benchmark::kMillisecond);
+
+// Arguments are the number of randomized trees and the number of checks.
+BENCHMARK_DEFINE_F(FeatureMatchingFixture, FeatureIndex)
+(benchmark::State& state) {
+    open3d::registration::FeatureIndex index(target_, int(state.range(0)));
+    Eigen::MatrixXi indices;
+    Eigen::MatrixXd distance2;
+    for (auto _ : state) {
+        index.SearchKNNBatch(source_, 1, indices, distance2,
+                             int(state.range(1)));
+    }
+    state.SetItemsProcessed(state.iterations() * source_.Num());
+    state.counters["recall"] = Recall(indices);
+}
+
+BENCHMARK_REGISTER_F(FeatureMatchingFixture, FeatureIndex)
+        ->Unit(benchmark::kMillisecond)
+        ->Args({4, 16})
+        ->Args({4, 64})
+        ->Args({4, 128})
+        ->Args({4, 512})
+        ->Args({8, 128})
+        ->Args({8, 512});
+
+BENCHMARK_DEFINE_F(FeatureMatchingFixture, MutualCorrespondences)
+(benchmark::State& state) {
+    open3d::registration::FeatureMatchingOption option(4, int(state.range(0)),
+                                                        true);
+    size_t num_corres = 0;
+    for (auto _ : state) {
+        num_corres = open3d::registration::ComputeFeatureCorrespondences(
+                             source_, target_, option)
+                             .size();
+    }
+    state.counters["correspondences"] = double(num_corres);
+}
+
+BENCHMARK_REGISTER_F(FeatureMatchingFixture, MutualCorrespondences)
+        ->Unit(benchmark::kMillisecond)
+        ->Args({64})
+        ->Args({512});
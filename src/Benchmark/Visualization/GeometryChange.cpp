@@ -0,0 +1,95 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Utility/GeometryChange.h"
+#include "benchmark/benchmark.h"
+
+// Preparation of the vertex buffer update of a large map to which a frame of
+// points is appended, compared to converting the whole map again.
+class GeometryChangeFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        points.resize(4000000);
+        for (size_t i = 0; i < points.size(); i++) {
+            points[i] = Eigen::Vector3d(double(i % 1000), double(i / 1000),
+                                        1.0);
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::vector<Eigen::Vector3d> points;
+};
+
+BENCHMARK_DEFINE_F(GeometryChangeFixture, All)(benchmark::State& state) {
+    std::vector<Eigen::Vector3f> converted;
+    for (auto _ : state) {
+        auto ranges = open3d::visualization::GeometryChange().GetDirtyRanges(
+                points.size(), points.size());
+        open3d::visualization::ConvertDirtyElements(points, ranges,
+                                                    converted);
+    }
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+
+BENCHMARK_REGISTER_F(GeometryChangeFixture, All);
+
+BENCHMARK_DEFINE_F(GeometryChangeFixture, Appended)
+(benchmark::State& state) {
+    size_t uploaded_size = points.size() - size_t(state.range(0));
+    std::vector<Eigen::Vector3f> converted;
+    for (auto _ : state) {
+        auto ranges = open3d::visualization::GeometryChange::Appended(
+                              uploaded_size)
+                              .GetDirtyRanges(uploaded_size, points.size());
+        open3d::visualization::ConvertDirtyElements(points, ranges,
+                                                    converted);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(GeometryChangeFixture, Appended)
+        ->Args({5000})
+        ->Args({100000});
+
+BENCHMARK_DEFINE_F(GeometryChangeFixture, Modified)
+(benchmark::State& state) {
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < points.size(); i += size_t(state.range(0))) {
+        indices.push_back(i);
+    }
+    std::vector<Eigen::Vector3f> converted;
+    for (auto _ : state) {
+        auto ranges = open3d::visualization::GeometryChange::Modified(indices)
+                              .GetDirtyRanges(points.size(), points.size());
+        open3d::visualization::ConvertDirtyElements(points, ranges,
+                                                    converted);
+    }
+    state.SetItemsProcessed(state.iterations() * indices.size());
+}
+
+BENCHMARK_REGISTER_F(GeometryChangeFixture, Modified)->Args({1000});
@@ -26,9 +26,12 @@
 
 #include "Open3D/ColorMap/ColorMapOptimization.h"
 
+#include <algorithm>
+
 #include "Open3D/Camera/PinholeCameraTrajectory.h"
 #include "Open3D/ColorMap/ColorMapOptimizationJacobian.h"
 #include "Open3D/ColorMap/ImageWarpingField.h"
+#include "Open3D/ColorMap/KeyframeProvider.h"
 #include "Open3D/ColorMap/TriangleMeshAndImageUtilities.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
@@ -44,228 +47,292 @@ namespace open3d {
 namespace {
 
 using namespace color_map;
+
+/// Number of cameras processed together; 0 or less means all of them.
+int GetBatchSize(const ColorMapOptimizationOption& option, int n_camera) {
+    if (option.keyframe_batch_size_ <= 0) return std::max(n_camera, 1);
+    return option.keyframe_batch_size_;
+}
+
+/// Fetches the gradients of cameras [begin, end) from the cache.
+std::vector<std::shared_ptr<const KeyframeGradients>> GetGradientBatch(
+        KeyframeGradientCache& cache, int begin, int end) {
+    std::vector<std::shared_ptr<const KeyframeGradients>> gradients(end -
+                                                                    begin);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int c = begin; c < end; c++) {
+        gradients[c - begin] = cache.GetGradients(c);
+    }
+    return gradients;
+}
+
+std::vector<std::shared_ptr<geometry::Image>> GetGrayImages(
+        const std::vector<std::shared_ptr<const KeyframeGradients>>&
+                gradients) {
+    std::vector<std::shared_ptr<geometry::Image>> images_gray;
+    for (const auto& g : gradients) {
+        images_gray.push_back(g->gray_);
+    }
+    return images_gray;
+}
+
+/// Loads the keyframes of cameras [begin, end) from the provider.
+std::vector<std::shared_ptr<geometry::RGBDImage>> LoadKeyframeBatch(
+        const KeyframeProvider& keyframes, int begin, int end) {
+    std::vector<std::shared_ptr<geometry::RGBDImage>> images_rgbd(end - begin);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int c = begin; c < end; c++) {
+        images_rgbd[c - begin] = keyframes.LoadKeyframe(c);
+    }
+    return images_rgbd;
+}
+
 void OptimizeImageCoorNonrigid(
         const geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_dx,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_dy,
+        KeyframeGradientCache& cache,
         std::vector<ImageWarpingField>& warping_fields,
         const std::vector<ImageWarpingField>& warping_fields_init,
         camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visiblity_vertex_to_image,
-        const std::vector<std::vector<int>>& visiblity_image_to_vertex,
+        const VisibilityCSR& visiblity_vertex_to_image,
+        const VisibilityCSR& visiblity_image_to_vertex,
         std::vector<double>& proxy_intensity,
         const ColorMapOptimizationOption& option) {
     auto n_vertex = mesh.vertices_.size();
     int n_camera = int(camera.parameters_.size());
-    SetProxyIntensityForVertex(mesh, images_gray, warping_fields, camera,
-                               visiblity_vertex_to_image, proxy_intensity,
-                               option.image_boundary_margin_);
+    int batch_size = GetBatchSize(option, n_camera);
+    std::vector<int> proxy_count(n_vertex, 0);
+    proxy_intensity.assign(n_vertex, 0.0);
+    for (int begin = 0; begin < n_camera; begin += batch_size) {
+        int end = std::min(begin + batch_size, n_camera);
+        AccumulateProxyIntensityForVertex(
+                mesh, GetGrayImages(GetGradientBatch(cache, begin, end)),
+                warping_fields, camera, visiblity_vertex_to_image, begin,
+                proxy_intensity, proxy_count, option.image_boundary_margin_);
+    }
+    NormalizeProxyIntensityForVertex(proxy_intensity, proxy_count);
     for (int itr = 0; itr < option.maximum_iteration_; itr++) {
         utility::LogDebug("[Iteration {:04d}] ", itr + 1);
         double residual = 0.0;
         double residual_reg = 0.0;
+        // The proxy intensity of the next iteration is accumulated batch by
+        // batch as soon as the cameras of a batch have been updated.
+        std::vector<double> next_proxy_intensity(n_vertex, 0.0);
+        std::fill(proxy_count.begin(), proxy_count.end(), 0);
+        for (int begin = 0; begin < n_camera; begin += batch_size) {
+            int end = std::min(begin + batch_size, n_camera);
+            auto gradients = GetGradientBatch(cache, begin, end);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-        for (int c = 0; c < n_camera; c++) {
-            int nonrigidval = warping_fields[c].anchor_w_ *
-                              warping_fields[c].anchor_h_ * 2;
-            double rr_reg = 0.0;
+            for (int c = begin; c < end; c++) {
+                const KeyframeGradients& g = *gradients[c - begin];
+                int nonrigidval = warping_fields[c].anchor_w_ *
+                                  warping_fields[c].anchor_h_ * 2;
+                double rr_reg = 0.0;
 
-            Eigen::Matrix4d pose;
-            pose = camera.parameters_[c].extrinsic_;
+                Eigen::Matrix4d pose;
+                pose = camera.parameters_[c].extrinsic_;
 
-            auto intrinsic = camera.parameters_[c].intrinsic_.intrinsic_matrix_;
-            auto extrinsic = camera.parameters_[c].extrinsic_;
-            ColorMapOptimizationJacobian jac;
-            Eigen::Matrix4d intr = Eigen::Matrix4d::Zero();
-            intr.block<3, 3>(0, 0) = intrinsic;
-            intr(3, 3) = 1.0;
+                auto intrinsic =
+                        camera.parameters_[c].intrinsic_.intrinsic_matrix_;
+                auto extrinsic = camera.parameters_[c].extrinsic_;
+                ColorMapOptimizationJacobian jac;
+                Eigen::Matrix4d intr = Eigen::Matrix4d::Zero();
+                intr.block<3, 3>(0, 0) = intrinsic;
+                intr(3, 3) = 1.0;
 
-            auto f_lambda = [&](int i, Eigen::Vector14d& J_r, double& r,
-                                Eigen::Vector14i& pattern) {
-                jac.ComputeJacobianAndResidualNonRigid(
-                        i, J_r, r, pattern, mesh, proxy_intensity,
-                        images_gray[c], images_dx[c], images_dy[c],
-                        warping_fields[c], warping_fields_init[c], intr,
-                        extrinsic, visiblity_image_to_vertex[c],
-                        option.image_boundary_margin_);
-            };
-            Eigen::MatrixXd JTJ;
-            Eigen::VectorXd JTr;
-            double r2;
-            std::tie(JTJ, JTr, r2) =
-                    ComputeJTJandJTrNonRigid<Eigen::Vector14d, Eigen::Vector14i,
-                                             Eigen::MatrixXd, Eigen::VectorXd>(
-                            f_lambda, int(visiblity_image_to_vertex[c].size()),
-                            nonrigidval, false);
+                auto f_lambda = [&](int i, Eigen::Vector14d& J_r, double& r,
+                                    Eigen::Vector14i& pattern) {
+                    jac.ComputeJacobianAndResidualNonRigid(
+                            i, J_r, r, pattern, mesh, proxy_intensity, g.gray_,
+                            g.dx_, g.dy_, warping_fields[c],
+                            warping_fields_init[c], intr, extrinsic,
+                            visiblity_image_to_vertex.RowBegin(c),
+                            option.image_boundary_margin_);
+                };
+                Eigen::MatrixXd JTJ;
+                Eigen::VectorXd JTr;
+                double r2;
+                std::tie(JTJ, JTr, r2) = ComputeJTJandJTrNonRigid<
+                        Eigen::Vector14d, Eigen::Vector14i, Eigen::MatrixXd,
+                        Eigen::VectorXd>(
+                        f_lambda, int(visiblity_image_to_vertex.RowSize(c)),
+                        nonrigidval, false);
 
-            double weight = option.non_rigid_anchor_point_weight_ *
-                            visiblity_image_to_vertex[c].size() / n_vertex;
-            for (int j = 0; j < nonrigidval; j++) {
-                double r = weight * (warping_fields[c].flow_(j) -
-                                     warping_fields_init[c].flow_(j));
-                JTJ(6 + j, 6 + j) += weight * weight;
-                JTr(6 + j) += weight * r;
-                rr_reg += r * r;
-            }
+                double weight = option.non_rigid_anchor_point_weight_ *
+                                visiblity_image_to_vertex.RowSize(c) /
+                                n_vertex;
+                for (int j = 0; j < nonrigidval; j++) {
+                    double r = weight * (warping_fields[c].flow_(j) -
+                                         warping_fields_init[c].flow_(j));
+                    JTJ(6 + j, 6 + j) += weight * weight;
+                    JTr(6 + j) += weight * r;
+                    rr_reg += r * r;
+                }
 
-            bool success;
-            Eigen::VectorXd result;
-            std::tie(success, result) = utility::SolveLinearSystemPSD(
-                    JTJ, -JTr, /*prefer_sparse=*/false,
-                    /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
-            Eigen::Vector6d result_pose;
-            result_pose << result.block(0, 0, 6, 1);
-            auto delta = utility::TransformVector6dToMatrix4d(result_pose);
-            pose = delta * pose;
+                bool success;
+                Eigen::VectorXd result;
+                std::tie(success, result) = utility::SolveLinearSystemPSD(
+                        JTJ, -JTr, /*prefer_sparse=*/false,
+                        /*check_symmetric=*/false,
+                        /*check_det=*/false, /*check_psd=*/false);
+                Eigen::Vector6d result_pose;
+                result_pose << result.block(0, 0, 6, 1);
+                auto delta = utility::TransformVector6dToMatrix4d(result_pose);
+                pose = delta * pose;
 
-            for (int j = 0; j < nonrigidval; j++) {
-                warping_fields[c].flow_(j) += result(6 + j);
-            }
-            camera.parameters_[c].extrinsic_ = pose;
+                for (int j = 0; j < nonrigidval; j++) {
+                    warping_fields[c].flow_(j) += result(6 + j);
+                }
+                camera.parameters_[c].extrinsic_ = pose;
 
 #ifdef _OPENMP
 #pragma omp critical
 #endif
-            {
-                residual += r2;
-                residual_reg += rr_reg;
+                {
+                    residual += r2;
+                    residual_reg += rr_reg;
+                }
             }
+            AccumulateProxyIntensityForVertex(
+                    mesh, GetGrayImages(gradients), warping_fields, camera,
+                    visiblity_vertex_to_image, begin, next_proxy_intensity,
+                    proxy_count, option.image_boundary_margin_);
         }
         utility::LogDebug("Residual error : {:.6f}, reg : {:.6f}", residual,
                           residual_reg);
-        SetProxyIntensityForVertex(mesh, images_gray, warping_fields, camera,
-                                   visiblity_vertex_to_image, proxy_intensity,
-                                   option.image_boundary_margin_);
+        NormalizeProxyIntensityForVertex(next_proxy_intensity, proxy_count);
+        proxy_intensity.swap(next_proxy_intensity);
     }
 }
 
-void OptimizeImageCoorRigid(
-        const geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_dx,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_dy,
-        camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visiblity_vertex_to_image,
-        const std::vector<std::vector<int>>& visiblity_image_to_vertex,
-        std::vector<double>& proxy_intensity,
-        const ColorMapOptimizationOption& option) {
+void OptimizeImageCoorRigid(const geometry::TriangleMesh& mesh,
+                            KeyframeGradientCache& cache,
+                            camera::PinholeCameraTrajectory& camera,
+                            const VisibilityCSR& visiblity_vertex_to_image,
+                            const VisibilityCSR& visiblity_image_to_vertex,
+                            std::vector<double>& proxy_intensity,
+                            const ColorMapOptimizationOption& option) {
+    auto n_vertex = mesh.vertices_.size();
     int total_num_ = 0;
     int n_camera = int(camera.parameters_.size());
-    SetProxyIntensityForVertex(mesh, images_gray, camera,
-                               visiblity_vertex_to_image, proxy_intensity,
-                               option.image_boundary_margin_);
+    int batch_size = GetBatchSize(option, n_camera);
+    std::vector<int> proxy_count(n_vertex, 0);
+    proxy_intensity.assign(n_vertex, 0.0);
+    for (int begin = 0; begin < n_camera; begin += batch_size) {
+        int end = std::min(begin + batch_size, n_camera);
+        AccumulateProxyIntensityForVertex(
+                mesh, GetGrayImages(GetGradientBatch(cache, begin, end)),
+                camera, visiblity_vertex_to_image, begin, proxy_intensity,
+                proxy_count, option.image_boundary_margin_);
+    }
+    NormalizeProxyIntensityForVertex(proxy_intensity, proxy_count);
     for (int itr = 0; itr < option.maximum_iteration_; itr++) {
         utility::LogDebug("[Iteration {:04d}] ", itr + 1);
         double residual = 0.0;
         total_num_ = 0;
+        std::vector<double> next_proxy_intensity(n_vertex, 0.0);
+        std::fill(proxy_count.begin(), proxy_count.end(), 0);
+        for (int begin = 0; begin < n_camera; begin += batch_size) {
+            int end = std::min(begin + batch_size, n_camera);
+            auto gradients = GetGradientBatch(cache, begin, end);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-        for (int c = 0; c < n_camera; c++) {
-            Eigen::Matrix4d pose;
-            pose = camera.parameters_[c].extrinsic_;
+            for (int c = begin; c < end; c++) {
+                const KeyframeGradients& g = *gradients[c - begin];
+                Eigen::Matrix4d pose;
+                pose = camera.parameters_[c].extrinsic_;
 
-            auto intrinsic = camera.parameters_[c].intrinsic_.intrinsic_matrix_;
-            auto extrinsic = camera.parameters_[c].extrinsic_;
-            ColorMapOptimizationJacobian jac;
-            Eigen::Matrix4d intr = Eigen::Matrix4d::Zero();
-            intr.block<3, 3>(0, 0) = intrinsic;
-            intr(3, 3) = 1.0;
+                auto intrinsic =
+                        camera.parameters_[c].intrinsic_.intrinsic_matrix_;
+                auto extrinsic = camera.parameters_[c].extrinsic_;
+                ColorMapOptimizationJacobian jac;
+                Eigen::Matrix4d intr = Eigen::Matrix4d::Zero();
+                intr.block<3, 3>(0, 0) = intrinsic;
+                intr(3, 3) = 1.0;
 
-            auto f_lambda = [&](int i, Eigen::Vector6d& J_r, double& r) {
-                jac.ComputeJacobianAndResidualRigid(
-                        i, J_r, r, mesh, proxy_intensity, images_gray[c],
-                        images_dx[c], images_dy[c], intr, extrinsic,
-                        visiblity_image_to_vertex[c],
-                        option.image_boundary_margin_);
-            };
-            Eigen::Matrix6d JTJ;
-            Eigen::Vector6d JTr;
-            double r2;
-            std::tie(JTJ, JTr, r2) =
-                    utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                            f_lambda, int(visiblity_image_to_vertex[c].size()),
-                            false);
+                auto f_lambda = [&](int i, Eigen::Vector6d& J_r, double& r) {
+                    jac.ComputeJacobianAndResidualRigid(
+                            i, J_r, r, mesh, proxy_intensity, g.gray_, g.dx_,
+                            g.dy_, intr, extrinsic,
+                            visiblity_image_to_vertex.RowBegin(c),
+                            option.image_boundary_margin_);
+                };
+                Eigen::Matrix6d JTJ;
+                Eigen::Vector6d JTr;
+                double r2;
+                std::tie(JTJ, JTr, r2) = utility::ComputeJTJandJTr<
+                        Eigen::Matrix6d, Eigen::Vector6d>(
+                        f_lambda, int(visiblity_image_to_vertex.RowSize(c)),
+                        false);
 
-            bool is_success;
-            Eigen::Matrix4d delta;
-            std::tie(is_success, delta) =
-                    utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ,
-                                                                         JTr);
-            pose = delta * pose;
-            camera.parameters_[c].extrinsic_ = pose;
+                bool is_success;
+                Eigen::Matrix4d delta;
+                std::tie(is_success, delta) =
+                        utility::SolveJacobianSystemAndObtainExtrinsicMatrix(
+                                JTJ, JTr);
+                pose = delta * pose;
+                camera.parameters_[c].extrinsic_ = pose;
 #ifdef _OPENMP
 #pragma omp critical
 #endif
-            {
-                residual += r2;
-                total_num_ += int(visiblity_image_to_vertex[c].size());
+                {
+                    residual += r2;
+                    total_num_ += int(visiblity_image_to_vertex.RowSize(c));
+                }
             }
+            AccumulateProxyIntensityForVertex(
+                    mesh, GetGrayImages(gradients), camera,
+                    visiblity_vertex_to_image, begin, next_proxy_intensity,
+                    proxy_count, option.image_boundary_margin_);
         }
         utility::LogDebug("Residual error : {:.6f} (avg : {:.6f})", residual,
                           residual / total_num_);
-        SetProxyIntensityForVertex(mesh, images_gray, camera,
-                                   visiblity_vertex_to_image, proxy_intensity,
-                                   option.image_boundary_margin_);
+        NormalizeProxyIntensityForVertex(next_proxy_intensity, proxy_count);
+        proxy_intensity.swap(next_proxy_intensity);
     }
 }
 
-std::tuple<std::vector<std::shared_ptr<geometry::Image>>,
-           std::vector<std::shared_ptr<geometry::Image>>,
-           std::vector<std::shared_ptr<geometry::Image>>,
-           std::vector<std::shared_ptr<geometry::Image>>,
-           std::vector<std::shared_ptr<geometry::Image>>>
-CreateGradientImages(
-        const std::vector<std::shared_ptr<geometry::RGBDImage>>& images_rgbd) {
-    std::vector<std::shared_ptr<geometry::Image>> images_gray;
-    std::vector<std::shared_ptr<geometry::Image>> images_dx;
-    std::vector<std::shared_ptr<geometry::Image>> images_dy;
-    std::vector<std::shared_ptr<geometry::Image>> images_color;
-    std::vector<std::shared_ptr<geometry::Image>> images_depth;
-    for (size_t i = 0; i < images_rgbd.size(); i++) {
-        auto gray_image = images_rgbd[i]->color_.CreateFloatImage();
-        auto gray_image_filtered =
-                gray_image->Filter(geometry::Image::FilterType::Gaussian3);
-        images_gray.push_back(gray_image_filtered);
-        images_dx.push_back(gray_image_filtered->Filter(
-                geometry::Image::FilterType::Sobel3Dx));
-        images_dy.push_back(gray_image_filtered->Filter(
-                geometry::Image::FilterType::Sobel3Dy));
-        auto color = std::make_shared<geometry::Image>(images_rgbd[i]->color_);
-        auto depth = std::make_shared<geometry::Image>(images_rgbd[i]->depth_);
-        images_color.push_back(color);
-        images_depth.push_back(depth);
-    }
-    return std::make_tuple(images_gray, images_dx, images_dy, images_color,
-                           images_depth);
-}
-
-std::vector<std::shared_ptr<geometry::Image>> CreateDepthBoundaryMasks(
-        const std::vector<std::shared_ptr<geometry::Image>>& images_depth,
+std::tuple<VisibilityCSR, VisibilityCSR> CreateVisibilityFromKeyframes(
+        const geometry::TriangleMesh& mesh,
+        const KeyframeProvider& keyframes,
+        const camera::PinholeCameraTrajectory& camera,
         const ColorMapOptimizationOption& option) {
-    auto n_images = images_depth.size();
-    std::vector<std::shared_ptr<geometry::Image>> masks;
-    for (size_t i = 0; i < n_images; i++) {
-        utility::LogDebug("[MakeDepthMasks] geometry::Image {:d}/{:d}", i,
-                          n_images);
-        masks.push_back(images_depth[i]->CreateDepthBoundaryMask(
-                option.depth_threshold_for_discontinuity_check_,
-                option.half_dilation_kernel_size_for_discontinuity_map_));
+    int n_camera = int(camera.parameters_.size());
+    int batch_size = GetBatchSize(option, n_camera);
+    std::vector<std::vector<int>> visible(n_camera);
+    for (int begin = 0; begin < n_camera; begin += batch_size) {
+        int end = std::min(begin + batch_size, n_camera);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int c = begin; c < end; c++) {
+            auto rgbd = keyframes.LoadKeyframe(c);
+            auto mask = rgbd->depth_.CreateDepthBoundaryMask(
+                    option.depth_threshold_for_discontinuity_check_,
+                    option.half_dilation_kernel_size_for_discontinuity_map_);
+            visible[c] = ComputeVisibleVertices(
+                    mesh, rgbd->depth_, *mask, camera, c,
+                    option.maximum_allowable_depth_,
+                    option.depth_threshold_for_visiblity_check_,
+                    option.use_zbuffer_for_visibility_check_);
+        }
     }
-    return masks;
+    return CreateVisibilityFromImageRows(visible, mesh.vertices_.size());
 }
 
 std::vector<ImageWarpingField> CreateWarpingFields(
-        const std::vector<std::shared_ptr<geometry::Image>>& images,
+        const KeyframeProvider& keyframes,
         const ColorMapOptimizationOption& option) {
     std::vector<ImageWarpingField> fields;
-    for (size_t i = 0; i < images.size(); i++) {
-        int width = images[i]->width_;
-        int height = images[i]->height_;
+    for (size_t i = 0; i < keyframes.NumKeyframes(); i++) {
+        int width, height;
+        keyframes.GetKeyframeSize(i, width, height);
         fields.push_back(ImageWarpingField(width, height,
                                            option.number_of_vertical_anchors_));
     }
@@ -281,48 +348,76 @@ void ColorMapOptimization(
         camera::PinholeCameraTrajectory& camera,
         const ColorMapOptimizationOption& option
         /* = ColorMapOptimizationOption()*/) {
-    utility::LogDebug("[ColorMapOptimization]");
-    std::vector<std::shared_ptr<geometry::Image>> images_gray, images_dx,
-            images_dy, images_color, images_depth;
-    std::tie(images_gray, images_dx, images_dy, images_color, images_depth) =
-            CreateGradientImages(images_rgbd);
+    InMemoryKeyframeProvider keyframes(images_rgbd);
+    ColorMapOptimization(mesh, keyframes, camera, option);
+}
 
-    utility::LogDebug("[ColorMapOptimization] :: MakingMasks");
-    auto images_mask = CreateDepthBoundaryMasks(images_depth, option);
+void ColorMapOptimization(
+        geometry::TriangleMesh& mesh,
+        const KeyframeProvider& keyframes,
+        camera::PinholeCameraTrajectory& camera,
+        const ColorMapOptimizationOption& option
+        /* = ColorMapOptimizationOption()*/) {
+    utility::LogDebug("[ColorMapOptimization]");
+    if (keyframes.NumKeyframes() != camera.parameters_.size()) {
+        utility::LogError(
+                "[ColorMapOptimization] {:d} keyframes do not match {:d} "
+                "cameras.",
+                keyframes.NumKeyframes(), camera.parameters_.size());
+    }
+    int n_camera = int(camera.parameters_.size());
+    int batch_size = GetBatchSize(option, n_camera);
+    KeyframeGradientCache cache(
+            keyframes, size_t(option.keyframe_cache_size_mb_ * 1024 * 1024));
 
     utility::LogDebug("[ColorMapOptimization] :: VisibilityCheck");
-    std::vector<std::vector<int>> visiblity_vertex_to_image;
-    std::vector<std::vector<int>> visiblity_image_to_vertex;
+    VisibilityCSR visiblity_vertex_to_image;
+    VisibilityCSR visiblity_image_to_vertex;
     std::tie(visiblity_vertex_to_image, visiblity_image_to_vertex) =
-            CreateVertexAndImageVisibility(
-                    mesh, images_depth, images_mask, camera,
-                    option.maximum_allowable_depth_,
-                    option.depth_threshold_for_visiblity_check_);
+            CreateVisibilityFromKeyframes(mesh, keyframes, camera, option);
 
     std::vector<double> proxy_intensity;
+    std::vector<ImageWarpingField> warping_uv_;
     if (option.non_rigid_camera_coordinate_) {
         utility::LogDebug("[ColorMapOptimization] :: Non-Rigid Optimization");
-        auto warping_uv_ = CreateWarpingFields(images_gray, option);
-        auto warping_uv_init_ = CreateWarpingFields(images_gray, option);
-        OptimizeImageCoorNonrigid(
-                mesh, images_gray, images_dx, images_dy, warping_uv_,
-                warping_uv_init_, camera, visiblity_vertex_to_image,
-                visiblity_image_to_vertex, proxy_intensity, option);
-        SetGeometryColorAverage(mesh, images_color, warping_uv_, camera,
-                                visiblity_vertex_to_image,
-                                option.image_boundary_margin_,
-                                option.invisible_vertex_color_knn_);
+        warping_uv_ = CreateWarpingFields(keyframes, option);
+        auto warping_uv_init_ = warping_uv_;
+        OptimizeImageCoorNonrigid(mesh, cache, warping_uv_, warping_uv_init_,
+                                  camera, visiblity_vertex_to_image,
+                                  visiblity_image_to_vertex, proxy_intensity,
+                                  option);
     } else {
         utility::LogDebug("[ColorMapOptimization] :: Rigid Optimization");
-        OptimizeImageCoorRigid(mesh, images_gray, images_dx, images_dy, camera,
-                               visiblity_vertex_to_image,
+        OptimizeImageCoorRigid(mesh, cache, camera, visiblity_vertex_to_image,
                                visiblity_image_to_vertex, proxy_intensity,
                                option);
-        SetGeometryColorAverage(mesh, images_color, camera,
-                                visiblity_vertex_to_image,
-                                option.image_boundary_margin_,
-                                option.invisible_vertex_color_knn_);
     }
+    utility::LogDebug("[ColorMapOptimization] :: {:d} keyframe loads",
+                      cache.GetNumLoads());
+
+    mesh.vertex_colors_.assign(mesh.vertices_.size(),
+                               Eigen::Vector3d::Zero());
+    std::vector<int> color_count(mesh.vertices_.size(), 0);
+    for (int begin = 0; begin < n_camera; begin += batch_size) {
+        int end = std::min(begin + batch_size, n_camera);
+        std::vector<std::shared_ptr<geometry::Image>> images_color;
+        for (const auto& rgbd : LoadKeyframeBatch(keyframes, begin, end)) {
+            // Aliases the color image of the keyframe without copying it.
+            images_color.push_back(
+                    std::shared_ptr<geometry::Image>(rgbd, &rgbd->color_));
+        }
+        if (option.non_rigid_camera_coordinate_) {
+            AccumulateGeometryColor(mesh, images_color, warping_uv_, camera,
+                                    visiblity_vertex_to_image, begin,
+                                    color_count, option.image_boundary_margin_);
+        } else {
+            AccumulateGeometryColor(mesh, images_color, camera,
+                                    visiblity_vertex_to_image, begin,
+                                    color_count, option.image_boundary_margin_);
+        }
+    }
+    SetGeometryColorAverage(mesh, color_count,
+                            option.invisible_vertex_color_knn_);
 }
 }  // namespace color_map
 }  // namespace open3d
@@ -46,6 +46,8 @@ class PinholeCameraTrajectory;
 
 namespace color_map {
 
+class KeyframeProvider;
+
 /// \class ColorMapOptimizationOption
 ///
 /// \brief Defines options for color map optimization.
@@ -63,7 +65,10 @@ public:
             double depth_threshold_for_discontinuity_check = 0.1,
             int half_dilation_kernel_size_for_discontinuity_map = 3,
             int image_boundary_margin = 10,
-            int invisible_vertex_color_knn = 3)
+            int invisible_vertex_color_knn = 3,
+            bool use_zbuffer_for_visibility_check = false,
+            int keyframe_batch_size = 64,
+            double keyframe_cache_size_mb = 0.0)
         : non_rigid_camera_coordinate_(non_rigid_camera_coordinate),
           number_of_vertical_anchors_(number_of_vertical_anchors),
           non_rigid_anchor_point_weight_(non_rigid_anchor_point_weight),
@@ -76,7 +81,11 @@ public:
           half_dilation_kernel_size_for_discontinuity_map_(
                   half_dilation_kernel_size_for_discontinuity_map),
           image_boundary_margin_(image_boundary_margin),
-          invisible_vertex_color_knn_(invisible_vertex_color_knn) {}
+          invisible_vertex_color_knn_(invisible_vertex_color_knn),
+          use_zbuffer_for_visibility_check_(
+                  use_zbuffer_for_visibility_check),
+          keyframe_batch_size_(keyframe_batch_size),
+          keyframe_cache_size_mb_(keyframe_cache_size_mb) {}
     ~ColorMapOptimizationOption() {}
 
 public:
@@ -131,6 +140,20 @@ public:
     ///  of the k nearest visible vertices to fill the invisible vertex. Set to
     ///  0 to disable this feature and all invisible vertices will be black.
     int invisible_vertex_color_knn_;
+    ///  Parameter to check the visibility of a point. If true, the mesh is
+    ///  rendered into a z-buffer for every camera and vertices occluded by the
+    ///  mesh itself are marked as invisible, in addition to the depth image
+    ///  check.
+    bool use_zbuffer_for_visibility_check_;
+    ///  Number of keyframes that are loaded and processed together. Only this
+    ///  many keyframes are decoded at a time. Set to 0 to process all
+    ///  keyframes in one batch.
+    int keyframe_batch_size_;
+    ///  Budget in megabytes for the cache of keyframe gradient images that
+    ///  are reused across optimization iterations. Least recently used
+    ///  keyframes are evicted and reloaded from the keyframe provider when
+    ///  needed again. Set to 0 for an unlimited cache.
+    double keyframe_cache_size_mb_;
 };
 
 /// \brief Function for color mapping of reconstructed scenes via optimization.
@@ -151,5 +174,23 @@ void ColorMapOptimization(
         camera::PinholeCameraTrajectory& camera,
         const ColorMapOptimizationOption& option =
                 ColorMapOptimizationOption());
+
+/// \brief Function for color mapping of reconstructed scenes via optimization
+/// with keyframes loaded on demand.
+///
+/// Keyframes are requested from \p keyframes in batches of
+/// ColorMapOptimizationOption::keyframe_batch_size_, so only a bounded number
+/// of them is resident at any time. The result is identical to the overload
+/// taking all RGBD images in memory.
+///
+/// \param mesh The input geometry mesh.
+/// \param keyframes Source of the RGBD images seen by cameras.
+/// \param camera Cameras' parameters.
+/// \param option Color map optimization options.
+void ColorMapOptimization(geometry::TriangleMesh& mesh,
+                          const KeyframeProvider& keyframes,
+                          camera::PinholeCameraTrajectory& camera,
+                          const ColorMapOptimizationOption& option =
+                                  ColorMapOptimizationOption());
 }  // namespace color_map
 }  // namespace open3d
@@ -0,0 +1,222 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/ColorMap/KeyframeProvider.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+
+namespace {
+
+int ReadBigEndian16(const unsigned char* ptr) { return (ptr[0] << 8) | ptr[1]; }
+
+// Reads the image size from the IHDR chunk of a PNG file or the start of
+// frame segment of a JPEG file without decoding the image.
+bool ReadImageSizeFromHeader(const std::string& filename,
+                             int& width,
+                             int& height) {
+    FILE* file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    bool success = false;
+    unsigned char header[24];
+    const unsigned char png_signature[8] = {0x89, 'P',  'N',  'G',
+                                            '\r', '\n', 0x1a, '\n'};
+    if (fread(header, 1, 2, file) == 2 && header[0] == 0xff &&
+        header[1] == 0xd8) {
+        // JPEG: walk the marker segments up to the first start of frame.
+        unsigned char segment[7];
+        while (fread(segment, 1, 4, file) == 4 && segment[0] == 0xff) {
+            int marker = segment[1];
+            int length = ReadBigEndian16(segment + 2);
+            bool is_sof = marker >= 0xc0 && marker <= 0xcf &&
+                          marker != 0xc4 && marker != 0xc8 && marker != 0xcc;
+            if (is_sof) {
+                if (fread(segment, 1, 5, file) == 5) {
+                    height = ReadBigEndian16(segment + 1);
+                    width = ReadBigEndian16(segment + 3);
+                    success = true;
+                }
+                break;
+            }
+            if (length < 2 || fseek(file, length - 2, SEEK_CUR) != 0) {
+                break;
+            }
+        }
+    } else if (fread(header + 2, 1, 22, file) == 22 &&
+               std::equal(png_signature, png_signature + 8, header) &&
+               std::equal(header + 12, header + 16, "IHDR")) {
+        // PNG: the IHDR chunk follows the signature, with 32-bit sizes.
+        width = (ReadBigEndian16(header + 16) << 16) |
+                ReadBigEndian16(header + 18);
+        height = (ReadBigEndian16(header + 20) << 16) |
+                 ReadBigEndian16(header + 22);
+        success = true;
+    }
+    fclose(file);
+    return success;
+}
+
+}  // unnamed namespace
+
+namespace color_map {
+
+void KeyframeProvider::GetKeyframeSize(size_t index,
+                                       int& width,
+                                       int& height) const {
+    auto rgbd = LoadKeyframe(index);
+    width = rgbd->color_.width_;
+    height = rgbd->color_.height_;
+}
+
+void InMemoryKeyframeProvider::GetKeyframeSize(size_t index,
+                                               int& width,
+                                               int& height) const {
+    width = images_rgbd_[index]->color_.width_;
+    height = images_rgbd_[index]->color_.height_;
+}
+
+RGBDImageFileKeyframeProvider::RGBDImageFileKeyframeProvider(
+        const std::vector<std::string>& color_filenames,
+        const std::vector<std::string>& depth_filenames,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 3.0*/)
+    : color_filenames_(color_filenames),
+      depth_filenames_(depth_filenames),
+      depth_scale_(depth_scale),
+      depth_trunc_(depth_trunc) {
+    if (color_filenames_.size() != depth_filenames_.size()) {
+        utility::LogError(
+                "[RGBDImageFileKeyframeProvider] {:d} color files do not "
+                "match {:d} depth files.",
+                color_filenames_.size(), depth_filenames_.size());
+    }
+}
+
+void RGBDImageFileKeyframeProvider::GetKeyframeSize(size_t index,
+                                                    int& width,
+                                                    int& height) const {
+    if (!ReadImageSizeFromHeader(color_filenames_[index], width, height)) {
+        KeyframeProvider::GetKeyframeSize(index, width, height);
+    }
+}
+
+std::shared_ptr<geometry::RGBDImage>
+RGBDImageFileKeyframeProvider::LoadKeyframe(size_t index) const {
+    geometry::Image color, depth;
+    if (!io::ReadImage(color_filenames_[index], color)) {
+        utility::LogError("[RGBDImageFileKeyframeProvider] Failed to read {}.",
+                          color_filenames_[index]);
+    }
+    if (!io::ReadImage(depth_filenames_[index], depth)) {
+        utility::LogError("[RGBDImageFileKeyframeProvider] Failed to read {}.",
+                          depth_filenames_[index]);
+    }
+    return geometry::RGBDImage::CreateFromColorAndDepth(
+            color, depth, depth_scale_, depth_trunc_,
+            /*convert_rgb_to_intensity=*/false);
+}
+
+size_t KeyframeGradients::ByteSize() const {
+    size_t bytes = 0;
+    for (const auto& image : {gray_, dx_, dy_}) {
+        if (image) bytes += image->data_.size();
+    }
+    return bytes;
+}
+
+std::shared_ptr<KeyframeGradients> KeyframeGradients::CreateFromRGBDImage(
+        const geometry::RGBDImage& rgbd) {
+    auto gradients = std::make_shared<KeyframeGradients>();
+    auto gray = rgbd.color_.CreateFloatImage();
+    gradients->gray_ = gray->Filter(geometry::Image::FilterType::Gaussian3);
+    gradients->dx_ =
+            gradients->gray_->Filter(geometry::Image::FilterType::Sobel3Dx);
+    gradients->dy_ =
+            gradients->gray_->Filter(geometry::Image::FilterType::Sobel3Dy);
+    return gradients;
+}
+
+std::shared_ptr<const KeyframeGradients> KeyframeGradientCache::GetGradients(
+        size_t index) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto found = entries_.find(index);
+        if (found != entries_.end()) {
+            lru_.splice(lru_.begin(), lru_, found->second.second);
+            return found->second.first;
+        }
+        num_loads_++;
+    }
+
+    auto rgbd = provider_.LoadKeyframe(index);
+    std::shared_ptr<const KeyframeGradients> gradients =
+            KeyframeGradients::CreateFromRGBDImage(*rgbd);
+    size_t bytes = gradients->ByteSize();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto found = entries_.find(index);
+    if (found != entries_.end()) {
+        // Another thread loaded the same keyframe in the meantime.
+        lru_.splice(lru_.begin(), lru_, found->second.second);
+        return found->second.first;
+    }
+    if (max_bytes_ > 0 && bytes > max_bytes_) {
+        return gradients;
+    }
+    lru_.push_front(index);
+    entries_[index] = Entry(gradients, lru_.begin());
+    resident_bytes_ += bytes;
+    while (max_bytes_ > 0 && resident_bytes_ > max_bytes_) {
+        auto evicted = entries_.find(lru_.back());
+        resident_bytes_ -= evicted->second.first->ByteSize();
+        entries_.erase(evicted);
+        lru_.pop_back();
+    }
+    return gradients;
+}
+
+size_t KeyframeGradientCache::GetResidentBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return resident_bytes_;
+}
+
+size_t KeyframeGradientCache::GetNumLoads() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_loads_;
+}
+
+}  // namespace color_map
+}  // namespace open3d
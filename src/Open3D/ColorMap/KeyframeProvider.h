@@ -0,0 +1,194 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace open3d {
+
+namespace geometry {
+class Image;
+class RGBDImage;
+}  // namespace geometry
+
+namespace color_map {
+
+/// \class KeyframeProvider
+///
+/// \brief Interface for sources of RGBD keyframes used by color map
+/// optimization.
+///
+/// Keyframes are requested by index whenever they are needed, so an
+/// implementation may keep them on disk and decode them on demand.
+/// LoadKeyframe may be called concurrently from several threads.
+class KeyframeProvider {
+public:
+    virtual ~KeyframeProvider() {}
+
+public:
+    /// Returns the number of keyframes.
+    virtual size_t NumKeyframes() const = 0;
+    /// Returns keyframe \p index. The color image is expected to have three
+    /// 1-byte channels and the depth image one float channel in meters.
+    virtual std::shared_ptr<geometry::RGBDImage> LoadKeyframe(
+            size_t index) const = 0;
+    /// Returns the size of the color image of keyframe \p index. The default
+    /// implementation loads the keyframe, providers that know the size
+    /// without decoding should override it.
+    virtual void GetKeyframeSize(size_t index, int& width, int& height) const;
+};
+
+/// \class InMemoryKeyframeProvider
+///
+/// \brief Keyframe provider serving RGBD images that are already in memory.
+class InMemoryKeyframeProvider : public KeyframeProvider {
+public:
+    explicit InMemoryKeyframeProvider(
+            const std::vector<std::shared_ptr<geometry::RGBDImage>>&
+                    images_rgbd)
+        : images_rgbd_(images_rgbd) {}
+    ~InMemoryKeyframeProvider() override {}
+
+public:
+    size_t NumKeyframes() const override { return images_rgbd_.size(); }
+    std::shared_ptr<geometry::RGBDImage> LoadKeyframe(
+            size_t index) const override {
+        return images_rgbd_[index];
+    }
+    void GetKeyframeSize(size_t index,
+                         int& width,
+                         int& height) const override;
+
+private:
+    std::vector<std::shared_ptr<geometry::RGBDImage>> images_rgbd_;
+};
+
+/// \class RGBDImageFileKeyframeProvider
+///
+/// \brief Keyframe provider reading color and depth image files on demand.
+///
+/// Each call to LoadKeyframe reads and decodes the two files and converts
+/// them with RGBDImage::CreateFromColorAndDepth, keeping the color channels.
+class RGBDImageFileKeyframeProvider : public KeyframeProvider {
+public:
+    /// \param color_filenames Color image file of every keyframe.
+    /// \param depth_filenames Depth image file of every keyframe.
+    /// \param depth_scale Ratio to scale raw depth values to meters.
+    /// \param depth_trunc Depth values larger than depth_trunc (in meters)
+    /// are set to 0.
+    RGBDImageFileKeyframeProvider(
+            const std::vector<std::string>& color_filenames,
+            const std::vector<std::string>& depth_filenames,
+            double depth_scale = 1000.0,
+            double depth_trunc = 3.0);
+    ~RGBDImageFileKeyframeProvider() override {}
+
+public:
+    size_t NumKeyframes() const override { return color_filenames_.size(); }
+    std::shared_ptr<geometry::RGBDImage> LoadKeyframe(
+            size_t index) const override;
+    /// Reads the size from the header of the PNG or JPEG color file, and
+    /// only loads the keyframe for other formats.
+    void GetKeyframeSize(size_t index,
+                         int& width,
+                         int& height) const override;
+
+public:
+    std::vector<std::string> color_filenames_;
+    std::vector<std::string> depth_filenames_;
+    double depth_scale_;
+    double depth_trunc_;
+};
+
+/// \class KeyframeGradients
+///
+/// \brief Smoothed intensity image of a keyframe and its derivatives.
+class KeyframeGradients {
+public:
+    KeyframeGradients() {}
+    ~KeyframeGradients() {}
+
+public:
+    /// Memory held by the three images in bytes.
+    size_t ByteSize() const;
+    /// Computes the gradients of the color image of \p rgbd.
+    static std::shared_ptr<KeyframeGradients> CreateFromRGBDImage(
+            const geometry::RGBDImage& rgbd);
+
+public:
+    /// Gaussian filtered intensity image.
+    std::shared_ptr<geometry::Image> gray_;
+    /// Sobel derivative of gray_ along x.
+    std::shared_ptr<geometry::Image> dx_;
+    /// Sobel derivative of gray_ along y.
+    std::shared_ptr<geometry::Image> dy_;
+};
+
+/// \class KeyframeGradientCache
+///
+/// \brief Thread-safe LRU cache of keyframe gradients under a byte budget.
+///
+/// Missing entries are loaded from the provider and derived outside the
+/// lock, so concurrent misses on different keyframes proceed in parallel.
+class KeyframeGradientCache {
+public:
+    /// \param provider Source of the keyframes. Must outlive the cache.
+    /// \param max_bytes Budget for resident gradients; 0 means unlimited.
+    KeyframeGradientCache(const KeyframeProvider& provider, size_t max_bytes)
+        : provider_(provider), max_bytes_(max_bytes) {}
+    ~KeyframeGradientCache() {}
+
+public:
+    /// Returns the gradients of keyframe \p index, loading them if needed.
+    std::shared_ptr<const KeyframeGradients> GetGradients(size_t index);
+    /// Memory held by resident entries in bytes.
+    size_t GetResidentBytes() const;
+    /// Number of times a keyframe was loaded from the provider.
+    size_t GetNumLoads() const;
+
+private:
+    typedef std::pair<std::shared_ptr<const KeyframeGradients>,
+                      std::list<size_t>::iterator>
+            Entry;
+
+    const KeyframeProvider& provider_;
+    size_t max_bytes_;
+    mutable std::mutex mutex_;
+    /// Keyframe indices, most recently used first.
+    std::list<size_t> lru_;
+    std::unordered_map<size_t, Entry> entries_;
+    size_t resident_bytes_ = 0;
+    size_t num_loads_ = 0;
+};
+
+}  // namespace color_map
+}  // namespace open3d
@@ -26,10 +26,13 @@
 
 #include "Open3D/ColorMap/TriangleMeshAndImageUtilities.h"
 
+#include <algorithm>
+
 #include "Open3D/Camera/PinholeCameraTrajectory.h"
 #include "Open3D/ColorMap/ImageWarpingField.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/Rasterizer.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 
@@ -51,53 +54,158 @@ inline std::tuple<float, float, float> Project3DPointAndGetUVDepth(
     return std::make_tuple(u, v, z);
 }
 
-std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>>
-CreateVertexAndImageVisibility(
+namespace {
+
+/// Calls \p visit(col, row) for every entry of \p csr whose column lies in
+/// [\p lo, \p hi). Rows are sorted, so each row's slice is found by binary
+/// search.
+template <typename Visitor>
+void ForEachEntryInColumnRange(const VisibilityCSR& csr,
+                               int lo,
+                               int hi,
+                               const Visitor& visit) {
+    for (size_t r = 0; r < csr.NumRows(); r++) {
+        const int* begin = std::lower_bound(csr.RowBegin(r), csr.RowEnd(r), lo);
+        const int* end = std::lower_bound(begin, csr.RowEnd(r), hi);
+        for (const int* it = begin; it != end; it++) {
+            visit(*it, int(r));
+        }
+    }
+}
+
+/// Builds the transpose of \p csr, which has \p n_cols columns. Columns are
+/// partitioned into contiguous blocks that are processed independently, so
+/// both the counting and the filling pass are free of write conflicts and the
+/// output rows come out sorted.
+VisibilityCSR TransposeVisibility(const VisibilityCSR& csr, size_t n_cols) {
+    const int block_size = 16384;
+    int n_blocks = int((n_cols + block_size - 1) / block_size);
+    VisibilityCSR transpose;
+    transpose.offsets_.assign(n_cols + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int b = 0; b < n_blocks; b++) {
+        int lo = b * block_size;
+        int hi = int(std::min(n_cols, size_t(lo) + block_size));
+        ForEachEntryInColumnRange(csr, lo, hi, [&](int col, int) {
+            transpose.offsets_[col + 1]++;
+        });
+    }
+    for (size_t i = 0; i < n_cols; i++) {
+        transpose.offsets_[i + 1] += transpose.offsets_[i];
+    }
+    transpose.indices_.resize(transpose.offsets_[n_cols]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int b = 0; b < n_blocks; b++) {
+        int lo = b * block_size;
+        int hi = int(std::min(n_cols, size_t(lo) + block_size));
+        std::vector<size_t> cursor(transpose.offsets_.begin() + lo,
+                                   transpose.offsets_.begin() + hi);
+        ForEachEntryInColumnRange(csr, lo, hi, [&](int col, int row) {
+            transpose.indices_[cursor[col - lo]++] = row;
+        });
+    }
+    return transpose;
+}
+
+}  // unnamed namespace
+
+std::vector<int> ComputeVisibleVertices(
         const geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_depth,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_mask,
+        const geometry::Image& depth,
+        const geometry::Image& mask,
         const camera::PinholeCameraTrajectory& camera,
+        int camid,
         double maximum_allowable_depth,
-        double depth_threshold_for_visiblity_check) {
-    auto n_camera = camera.parameters_.size();
+        double depth_threshold_for_visiblity_check,
+        bool use_zbuffer /* = false*/) {
     auto n_vertex = mesh.vertices_.size();
-    std::vector<std::vector<int>> visiblity_vertex_to_image;
-    std::vector<std::vector<int>> visiblity_image_to_vertex;
-    visiblity_vertex_to_image.resize(n_vertex);
-    visiblity_image_to_vertex.resize(n_camera);
+    std::shared_ptr<geometry::Image> zbuffer;
+    if (use_zbuffer) {
+        camera::PinholeCameraParameters parameters = camera.parameters_[camid];
+        parameters.intrinsic_.width_ = depth.width_;
+        parameters.intrinsic_.height_ = depth.height_;
+        zbuffer = std::get<0>(
+                geometry::RasterizeTriangleMesh(mesh, parameters));
+    }
+    std::vector<int> visible;
+    for (size_t vertex_id = 0; vertex_id < n_vertex; vertex_id++) {
+        Eigen::Vector3d X = mesh.vertices_[vertex_id];
+        float u, v, d;
+        std::tie(u, v, d) = Project3DPointAndGetUVDepth(X, camera, camid);
+        int u_d = int(round(u)), v_d = int(round(v));
+        if (d < 0.0 || !depth.TestImageBoundary(u_d, v_d)) continue;
+        float d_sensor = *depth.PointerAt<float>(u_d, v_d);
+        if (d_sensor > maximum_allowable_depth) continue;
+        if (*mask.PointerAt<unsigned char>(u_d, v_d) == 255) continue;
+        if (std::fabs(d - d_sensor) >= depth_threshold_for_visiblity_check)
+            continue;
+        if (use_zbuffer) {
+            // Pixels not covered by any triangle have depth 0.
+            float d_render = *zbuffer->PointerAt<float>(u_d, v_d);
+            if (d_render > 0 &&
+                d - d_render >= depth_threshold_for_visiblity_check)
+                continue;
+        }
+        visible.push_back(int(vertex_id));
+    }
+    utility::LogDebug("[cam {:d}] {:.5f} percents are visible", camid,
+                      double(visible.size()) / n_vertex * 100);
+    return visible;
+}
+
+std::tuple<VisibilityCSR, VisibilityCSR> CreateVisibilityFromImageRows(
+        std::vector<std::vector<int>>& visible_vertices, size_t n_vertex) {
+    size_t n_camera = visible_vertices.size();
+    VisibilityCSR visiblity_image_to_vertex;
+    visiblity_image_to_vertex.offsets_.resize(n_camera + 1);
+    for (size_t c = 0; c < n_camera; c++) {
+        visiblity_image_to_vertex.offsets_[c + 1] =
+                visiblity_image_to_vertex.offsets_[c] +
+                visible_vertices[c].size();
+    }
+    visiblity_image_to_vertex.indices_.resize(
+            visiblity_image_to_vertex.offsets_[n_camera]);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
     for (int c = 0; c < int(n_camera); c++) {
-        int viscnt = 0;
-        for (size_t vertex_id = 0; vertex_id < n_vertex; vertex_id++) {
-            Eigen::Vector3d X = mesh.vertices_[vertex_id];
-            float u, v, d;
-            std::tie(u, v, d) = Project3DPointAndGetUVDepth(X, camera, c);
-            int u_d = int(round(u)), v_d = int(round(v));
-            if (d < 0.0 || !images_depth[c]->TestImageBoundary(u_d, v_d))
-                continue;
-            float d_sensor = *images_depth[c]->PointerAt<float>(u_d, v_d);
-            if (d_sensor > maximum_allowable_depth) continue;
-            if (*images_mask[c]->PointerAt<unsigned char>(u_d, v_d) == 255)
-                continue;
-            if (std::fabs(d - d_sensor) < depth_threshold_for_visiblity_check) {
+        std::copy(visible_vertices[c].begin(), visible_vertices[c].end(),
+                  visiblity_image_to_vertex.indices_.begin() +
+                          visiblity_image_to_vertex.offsets_[c]);
+        std::vector<int>().swap(visible_vertices[c]);
+    }
+    VisibilityCSR visiblity_vertex_to_image =
+            TransposeVisibility(visiblity_image_to_vertex, n_vertex);
+    return std::make_tuple(std::move(visiblity_vertex_to_image),
+                           std::move(visiblity_image_to_vertex));
+}
+
+std::tuple<VisibilityCSR, VisibilityCSR> CreateVertexAndImageVisibility(
+        const geometry::TriangleMesh& mesh,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_depth,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_mask,
+        const camera::PinholeCameraTrajectory& camera,
+        double maximum_allowable_depth,
+        double depth_threshold_for_visiblity_check,
+        bool use_zbuffer /* = false*/) {
+    auto n_camera = camera.parameters_.size();
+    // Every camera collects its visible vertices privately; the rows are
+    // then laid out contiguously and transposed without shared writes.
+    std::vector<std::vector<int>> visible(n_camera);
 #ifdef _OPENMP
-#pragma omp critical
+#pragma omp parallel for schedule(dynamic)
 #endif
-                {
-                    visiblity_vertex_to_image[vertex_id].push_back(c);
-                    visiblity_image_to_vertex[c].push_back(int(vertex_id));
-                    viscnt++;
-                }
-            }
-        }
-        utility::LogDebug("[cam {:d}] {:.5f} percents are visible", c,
-                          double(viscnt) / n_vertex * 100);
-        fflush(stdout);
+    for (int c = 0; c < int(n_camera); c++) {
+        visible[c] = ComputeVisibleVertices(
+                mesh, *images_depth[c], *images_mask[c], camera, c,
+                maximum_allowable_depth, depth_threshold_for_visiblity_check,
+                use_zbuffer);
     }
-    return std::make_tuple(visiblity_vertex_to_image,
-                           visiblity_image_to_vertex);
+    return CreateVisibilityFromImageRows(visible, mesh.vertices_.size());
 }
 
 template <typename T>
@@ -153,205 +261,203 @@ std::tuple<bool, T> QueryImageIntensity(
     return std::make_tuple(false, 0);
 }
 
-void SetProxyIntensityForVertex(
+namespace {
+
+/// Calls \p visit(j) for every camera j in [\p camera_begin, \p camera_end)
+/// that sees vertex \p i, in increasing order of j.
+template <typename Visitor>
+void ForEachVisibleCamera(const VisibilityCSR& visiblity_vertex_to_image,
+                          int i,
+                          int camera_begin,
+                          int camera_end,
+                          const Visitor& visit) {
+    const int* begin =
+            std::lower_bound(visiblity_vertex_to_image.RowBegin(i),
+                             visiblity_vertex_to_image.RowEnd(i), camera_begin);
+    for (const int* it = begin;
+         it != visiblity_vertex_to_image.RowEnd(i) && *it < camera_end; it++) {
+        visit(*it);
+    }
+}
+
+}  // unnamed namespace
+
+void AccumulateProxyIntensityForVertex(
         const geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
         const std::vector<ImageWarpingField>& warping_field,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visiblity_vertex_to_image,
+        const VisibilityCSR& visiblity_vertex_to_image,
+        int camera_begin,
         std::vector<double>& proxy_intensity,
+        std::vector<int>& proxy_count,
         int image_boundary_margin) {
-    auto n_vertex = mesh.vertices_.size();
-    proxy_intensity.resize(n_vertex);
-
+    int camera_end = camera_begin + int(images_gray.size());
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int i = 0; i < int(n_vertex); i++) {
-        proxy_intensity[i] = 0.0;
-        float sum = 0.0;
-        for (size_t iter = 0; iter < visiblity_vertex_to_image[i].size();
-             iter++) {
-            int j = visiblity_vertex_to_image[i][iter];
-            float gray;
-            bool valid = false;
-            std::tie(valid, gray) = QueryImageIntensity<float>(
-                    *images_gray[j], warping_field[j], mesh.vertices_[i],
-                    camera, j, -1, image_boundary_margin);
-            if (valid) {
-                sum += 1.0;
-                proxy_intensity[i] += gray;
-            }
-        }
-        if (sum > 0) {
-            proxy_intensity[i] /= sum;
-        }
+    for (int i = 0; i < int(mesh.vertices_.size()); i++) {
+        ForEachVisibleCamera(
+                visiblity_vertex_to_image, i, camera_begin, camera_end,
+                [&](int j) {
+                    float gray;
+                    bool valid = false;
+                    std::tie(valid, gray) = QueryImageIntensity<float>(
+                            *images_gray[j - camera_begin], warping_field[j],
+                            mesh.vertices_[i], camera, j, -1,
+                            image_boundary_margin);
+                    if (valid) {
+                        proxy_count[i]++;
+                        proxy_intensity[i] += gray;
+                    }
+                });
     }
 }
 
-void SetProxyIntensityForVertex(
+void AccumulateProxyIntensityForVertex(
         const geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visiblity_vertex_to_image,
+        const VisibilityCSR& visiblity_vertex_to_image,
+        int camera_begin,
         std::vector<double>& proxy_intensity,
+        std::vector<int>& proxy_count,
         int image_boundary_margin) {
-    auto n_vertex = mesh.vertices_.size();
-    proxy_intensity.resize(n_vertex);
-
+    int camera_end = camera_begin + int(images_gray.size());
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int i = 0; i < int(n_vertex); i++) {
-        proxy_intensity[i] = 0.0;
-        float sum = 0.0;
-        for (size_t iter = 0; iter < visiblity_vertex_to_image[i].size();
-             iter++) {
-            int j = visiblity_vertex_to_image[i][iter];
-            float gray;
-            bool valid = false;
-            std::tie(valid, gray) = QueryImageIntensity<float>(
-                    *images_gray[j], mesh.vertices_[i], camera, j, -1,
-                    image_boundary_margin);
-            if (valid) {
-                sum += 1.0;
-                proxy_intensity[i] += gray;
-            }
-        }
-        if (sum > 0) {
-            proxy_intensity[i] /= sum;
-        }
+    for (int i = 0; i < int(mesh.vertices_.size()); i++) {
+        ForEachVisibleCamera(
+                visiblity_vertex_to_image, i, camera_begin, camera_end,
+                [&](int j) {
+                    float gray;
+                    bool valid = false;
+                    std::tie(valid, gray) = QueryImageIntensity<float>(
+                            *images_gray[j - camera_begin], mesh.vertices_[i],
+                            camera, j, -1, image_boundary_margin);
+                    if (valid) {
+                        proxy_count[i]++;
+                        proxy_intensity[i] += gray;
+                    }
+                });
     }
 }
 
-void SetGeometryColorAverage(
-        geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_color,
-        const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visiblity_vertex_to_image,
-        int image_boundary_margin /*= 10*/,
-        int invisible_vertex_color_knn /*= 3*/) {
-    size_t n_vertex = mesh.vertices_.size();
-    mesh.vertex_colors_.clear();
-    mesh.vertex_colors_.resize(n_vertex);
-    std::vector<size_t> valid_vertices;
-    std::vector<size_t> invalid_vertices;
+void NormalizeProxyIntensityForVertex(std::vector<double>& proxy_intensity,
+                                      const std::vector<int>& proxy_count) {
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int i = 0; i < (int)n_vertex; i++) {
-        mesh.vertex_colors_[i] = Eigen::Vector3d::Zero();
-        double sum = 0.0;
-        for (size_t iter = 0; iter < visiblity_vertex_to_image[i].size();
-             iter++) {
-            int j = visiblity_vertex_to_image[i][iter];
-            unsigned char r_temp, g_temp, b_temp;
-            bool valid = false;
-            std::tie(valid, r_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], mesh.vertices_[i], camera, j, 0,
-                    image_boundary_margin);
-            std::tie(valid, g_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], mesh.vertices_[i], camera, j, 1,
-                    image_boundary_margin);
-            std::tie(valid, b_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], mesh.vertices_[i], camera, j, 2,
-                    image_boundary_margin);
-            float r = (float)r_temp / 255.0f;
-            float g = (float)g_temp / 255.0f;
-            float b = (float)b_temp / 255.0f;
-            if (valid) {
-                mesh.vertex_colors_[i] += Eigen::Vector3d(r, g, b);
-                sum += 1.0;
-            }
-        }
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        {
-            if (sum > 0.0) {
-                mesh.vertex_colors_[i] /= sum;
-                valid_vertices.push_back(i);
-            } else {
-                invalid_vertices.push_back(i);
-            }
+    for (int i = 0; i < int(proxy_intensity.size()); i++) {
+        if (proxy_count[i] > 0) {
+            proxy_intensity[i] /= proxy_count[i];
         }
     }
-    if (invisible_vertex_color_knn > 0) {
-        std::shared_ptr<geometry::TriangleMesh> valid_mesh =
-                mesh.SelectByIndex(valid_vertices);
-        geometry::KDTreeFlann kd_tree(*valid_mesh);
+}
+
+void AccumulateGeometryColor(
+        geometry::TriangleMesh& mesh,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_color,
+        const camera::PinholeCameraTrajectory& camera,
+        const VisibilityCSR& visiblity_vertex_to_image,
+        int camera_begin,
+        std::vector<int>& color_count,
+        int image_boundary_margin /*= 10*/) {
+    int camera_end = camera_begin + int(images_color.size());
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-        for (int i = 0; i < (int)invalid_vertices.size(); ++i) {
-            size_t invalid_vertex = invalid_vertices[i];
-            std::vector<int> indices;  // indices to valid_mesh
-            std::vector<double> dists;
-            kd_tree.SearchKNN(mesh.vertices_[invalid_vertex],
-                              invisible_vertex_color_knn, indices, dists);
-            Eigen::Vector3d new_color(0, 0, 0);
-            for (const int& index : indices) {
-                new_color += valid_mesh->vertex_colors_[index];
-            }
-            if (indices.size() > 0) {
-                new_color /= static_cast<double>(indices.size());
-            }
-            mesh.vertex_colors_[invalid_vertex] = new_color;
-        }
+    for (int i = 0; i < int(mesh.vertices_.size()); i++) {
+        ForEachVisibleCamera(
+                visiblity_vertex_to_image, i, camera_begin, camera_end,
+                [&](int j) {
+                    const geometry::Image& image =
+                            *images_color[j - camera_begin];
+                    unsigned char r_temp, g_temp, b_temp;
+                    bool valid = false;
+                    std::tie(valid, r_temp) =
+                            QueryImageIntensity<unsigned char>(
+                                    image, mesh.vertices_[i], camera, j, 0,
+                                    image_boundary_margin);
+                    std::tie(valid, g_temp) =
+                            QueryImageIntensity<unsigned char>(
+                                    image, mesh.vertices_[i], camera, j, 1,
+                                    image_boundary_margin);
+                    std::tie(valid, b_temp) =
+                            QueryImageIntensity<unsigned char>(
+                                    image, mesh.vertices_[i], camera, j, 2,
+                                    image_boundary_margin);
+                    float r = (float)r_temp / 255.0f;
+                    float g = (float)g_temp / 255.0f;
+                    float b = (float)b_temp / 255.0f;
+                    if (valid) {
+                        mesh.vertex_colors_[i] += Eigen::Vector3d(r, g, b);
+                        color_count[i]++;
+                    }
+                });
     }
 }
 
-void SetGeometryColorAverage(
+void AccumulateGeometryColor(
         geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_color,
         const std::vector<ImageWarpingField>& warping_fields,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visiblity_vertex_to_image,
-        int image_boundary_margin /*= 10*/,
-        int invisible_vertex_color_knn /*= 3*/) {
-    size_t n_vertex = mesh.vertices_.size();
-    mesh.vertex_colors_.clear();
-    mesh.vertex_colors_.resize(n_vertex);
-    std::vector<size_t> valid_vertices;
-    std::vector<size_t> invalid_vertices;
+        const VisibilityCSR& visiblity_vertex_to_image,
+        int camera_begin,
+        std::vector<int>& color_count,
+        int image_boundary_margin /*= 10*/) {
+    int camera_end = camera_begin + int(images_color.size());
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int i = 0; i < (int)n_vertex; i++) {
-        mesh.vertex_colors_[i] = Eigen::Vector3d::Zero();
-        double sum = 0.0;
-        for (size_t iter = 0; iter < visiblity_vertex_to_image[i].size();
-             iter++) {
-            int j = visiblity_vertex_to_image[i][iter];
-            unsigned char r_temp, g_temp, b_temp;
-            bool valid = false;
-            std::tie(valid, r_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], warping_fields[j], mesh.vertices_[i],
-                    camera, j, 0, image_boundary_margin);
-            std::tie(valid, g_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], warping_fields[j], mesh.vertices_[i],
-                    camera, j, 1, image_boundary_margin);
-            std::tie(valid, b_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], warping_fields[j], mesh.vertices_[i],
-                    camera, j, 2, image_boundary_margin);
-            float r = (float)r_temp / 255.0f;
-            float g = (float)g_temp / 255.0f;
-            float b = (float)b_temp / 255.0f;
-            if (valid) {
-                mesh.vertex_colors_[i] += Eigen::Vector3d(r, g, b);
-                sum += 1.0;
-            }
-        }
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        {
-            if (sum > 0.0) {
-                mesh.vertex_colors_[i] /= sum;
-                valid_vertices.push_back(i);
-            } else {
-                invalid_vertices.push_back(i);
-            }
+    for (int i = 0; i < int(mesh.vertices_.size()); i++) {
+        ForEachVisibleCamera(
+                visiblity_vertex_to_image, i, camera_begin, camera_end,
+                [&](int j) {
+                    const geometry::Image& image =
+                            *images_color[j - camera_begin];
+                    unsigned char r_temp, g_temp, b_temp;
+                    bool valid = false;
+                    std::tie(valid, r_temp) =
+                            QueryImageIntensity<unsigned char>(
+                                    image, warping_fields[j],
+                                    mesh.vertices_[i], camera, j, 0,
+                                    image_boundary_margin);
+                    std::tie(valid, g_temp) =
+                            QueryImageIntensity<unsigned char>(
+                                    image, warping_fields[j],
+                                    mesh.vertices_[i], camera, j, 1,
+                                    image_boundary_margin);
+                    std::tie(valid, b_temp) =
+                            QueryImageIntensity<unsigned char>(
+                                    image, warping_fields[j],
+                                    mesh.vertices_[i], camera, j, 2,
+                                    image_boundary_margin);
+                    float r = (float)r_temp / 255.0f;
+                    float g = (float)g_temp / 255.0f;
+                    float b = (float)b_temp / 255.0f;
+                    if (valid) {
+                        mesh.vertex_colors_[i] += Eigen::Vector3d(r, g, b);
+                        color_count[i]++;
+                    }
+                });
+    }
+}
+
+void SetGeometryColorAverage(geometry::TriangleMesh& mesh,
+                             const std::vector<int>& color_count,
+                             int invisible_vertex_color_knn /*= 3*/) {
+    size_t n_vertex = mesh.vertices_.size();
+    std::vector<size_t> valid_vertices;
+    std::vector<size_t> invalid_vertices;
+    for (size_t i = 0; i < n_vertex; i++) {
+        if (color_count[i] > 0) {
+            mesh.vertex_colors_[i] /= double(color_count[i]);
+            valid_vertices.push_back(i);
+        } else {
+            invalid_vertices.push_back(i);
         }
     }
     if (invisible_vertex_color_knn > 0) {
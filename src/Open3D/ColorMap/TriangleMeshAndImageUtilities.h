@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -51,19 +52,84 @@ namespace color_map {
 class ImageWarpingField;
 class ColorMapOptimizationOption;
 
+/// \class VisibilityCSR
+///
+/// \brief Sparse visibility relation stored in compressed sparse row form.
+///
+/// Row `i` holds the sorted column indices
+/// `indices_[offsets_[i]] ... indices_[offsets_[i + 1] - 1]`. The relation is
+/// used both as vertex-to-image (rows are vertices, columns are cameras) and
+/// as image-to-vertex (rows are cameras, columns are vertices).
+class VisibilityCSR {
+public:
+    VisibilityCSR() : offsets_(1, 0) {}
+    ~VisibilityCSR() {}
+
+public:
+    /// Number of rows in the relation.
+    size_t NumRows() const { return offsets_.size() - 1; }
+    /// Number of entries in row \p row.
+    size_t RowSize(size_t row) const {
+        return offsets_[row + 1] - offsets_[row];
+    }
+    /// Pointer to the first entry of row \p row.
+    const int* RowBegin(size_t row) const {
+        return indices_.data() + offsets_[row];
+    }
+    /// Pointer past the last entry of row \p row.
+    const int* RowEnd(size_t row) const {
+        return indices_.data() + offsets_[row + 1];
+    }
+
+public:
+    /// Row offsets into indices_, of size NumRows() + 1.
+    std::vector<size_t> offsets_;
+    /// Column indices of all rows, concatenated.
+    std::vector<int> indices_;
+};
+
 inline std::tuple<float, float, float> Project3DPointAndGetUVDepth(
         const Eigen::Vector3d X,
         const camera::PinholeCameraTrajectory& camera,
         int camid);
 
-std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>>
-CreateVertexAndImageVisibility(
+/// \brief Function to compute the vertices visible from camera \p camid.
+///
+/// Returns the visible vertex indices in increasing order. See
+/// CreateVertexAndImageVisibility for the visibility criteria.
+std::vector<int> ComputeVisibleVertices(
+        const geometry::TriangleMesh& mesh,
+        const geometry::Image& depth,
+        const geometry::Image& mask,
+        const camera::PinholeCameraTrajectory& camera,
+        int camid,
+        double maximum_allowable_depth,
+        double depth_threshold_for_visiblity_check,
+        bool use_zbuffer = false);
+
+/// \brief Function to build the vertex-to-image and image-to-vertex
+/// relations from the visible vertices of every camera.
+///
+/// \p visible_vertices is consumed to bound peak memory.
+std::tuple<VisibilityCSR, VisibilityCSR> CreateVisibilityFromImageRows(
+        std::vector<std::vector<int>>& visible_vertices, size_t n_vertex);
+
+/// \brief Function to compute which vertices are visible from which camera.
+///
+/// Returns the vertex-to-image and the image-to-vertex relations. A vertex is
+/// visible from a camera if it projects onto a valid, unmasked pixel of the
+/// depth image whose depth agrees with the vertex depth up to
+/// \p depth_threshold_for_visiblity_check. If \p use_zbuffer is true, the
+/// mesh is additionally rasterized for every camera and vertices occluded by
+/// the mesh itself are rejected.
+std::tuple<VisibilityCSR, VisibilityCSR> CreateVertexAndImageVisibility(
         const geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_rgbd,
         const std::vector<std::shared_ptr<geometry::Image>>& images_mask,
         const camera::PinholeCameraTrajectory& camera,
         double maximum_allowable_depth,
-        double depth_threshold_for_visiblity_check);
+        double depth_threshold_for_visiblity_check,
+        bool use_zbuffer = false);
 
 template <typename T>
 std::tuple<bool, T> QueryImageIntensity(
@@ -84,38 +150,68 @@ std::tuple<bool, T> QueryImageIntensity(
         int ch = -1,
         int image_boundary_margin = 10);
 
-void SetProxyIntensityForVertex(
+/// \brief Function to add the intensities seen by a batch of cameras to the
+/// per-vertex proxy intensity.
+///
+/// \p images_gray holds the images of cameras
+/// `camera_begin ... camera_begin + images_gray.size() - 1`. Calling this for
+/// consecutive batches in increasing camera order and then
+/// NormalizeProxyIntensityForVertex yields the average over all cameras.
+/// \p proxy_intensity and \p proxy_count must start zeroed.
+void AccumulateProxyIntensityForVertex(
         const geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
         const std::vector<ImageWarpingField>& warping_field,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visiblity_vertex_to_image,
+        const VisibilityCSR& visiblity_vertex_to_image,
+        int camera_begin,
         std::vector<double>& proxy_intensity,
+        std::vector<int>& proxy_count,
         int image_boundary_margin);
 
-void SetProxyIntensityForVertex(
+void AccumulateProxyIntensityForVertex(
         const geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visiblity_vertex_to_image,
+        const VisibilityCSR& visiblity_vertex_to_image,
+        int camera_begin,
         std::vector<double>& proxy_intensity,
+        std::vector<int>& proxy_count,
         int image_boundary_margin);
 
-void SetGeometryColorAverage(
+/// \brief Function to turn accumulated proxy intensities into averages.
+void NormalizeProxyIntensityForVertex(std::vector<double>& proxy_intensity,
+                                      const std::vector<int>& proxy_count);
+
+/// \brief Function to add the colors seen by a batch of cameras to the
+/// vertex colors of \p mesh, which must start zeroed.
+///
+/// \p images_color holds the images of cameras
+/// `camera_begin ... camera_begin + images_color.size() - 1`.
+void AccumulateGeometryColor(
         geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_rgbd,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_color,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visiblity_vertex_to_image,
-        int image_boundary_margin = 10,
-        int invisible_vertex_color_knn = 3);
+        const VisibilityCSR& visiblity_vertex_to_image,
+        int camera_begin,
+        std::vector<int>& color_count,
+        int image_boundary_margin = 10);
 
-void SetGeometryColorAverage(
+void AccumulateGeometryColor(
         geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_rgbd,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_color,
         const std::vector<ImageWarpingField>& warping_fields,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visiblity_vertex_to_image,
-        int image_boundary_margin = 10,
-        int invisible_vertex_color_knn = 3);
+        const VisibilityCSR& visiblity_vertex_to_image,
+        int camera_begin,
+        std::vector<int>& color_count,
+        int image_boundary_margin = 10);
+
+/// \brief Function to turn accumulated vertex colors into averages. Vertices
+/// seen by no camera get the average color of their
+/// \p invisible_vertex_color_knn nearest visible vertices.
+void SetGeometryColorAverage(geometry::TriangleMesh& mesh,
+                             const std::vector<int>& color_count,
+                             int invisible_vertex_color_knn = 3);
 }  // namespace color_map
 }  // namespace open3d
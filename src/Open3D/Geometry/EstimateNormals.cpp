@@ -25,6 +25,9 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <numeric>
+#include <queue>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
@@ -258,6 +261,212 @@ Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
     }
 }
 
+// Disjoint-set forest with union by rank. Find does not compress paths, so it
+// can be called concurrently once all unions are done.
+class DisjointSet {
+public:
+    explicit DisjointSet(size_t size) : parent_(size), rank_(size, 0) {
+        std::iota(parent_.begin(), parent_.end(), 0);
+    }
+
+    int Find(int x) const {
+        while (parent_[x] != x) {
+            x = parent_[x];
+        }
+        return x;
+    }
+
+    bool Union(int x, int y) {
+        x = Find(x);
+        y = Find(y);
+        if (x == y) {
+            return false;
+        }
+        if (rank_[x] < rank_[y]) {
+            std::swap(x, y);
+        }
+        parent_[y] = x;
+        if (rank_[x] == rank_[y]) {
+            rank_[x]++;
+        }
+        return true;
+    }
+
+private:
+    std::vector<int> parent_;
+    std::vector<int> rank_;
+};
+
+// Builds the symmetric k-nearest-neighbor graph of the cloud in compressed
+// sparse row form. Edges found from both endpoints are stored once per
+// endpoint.
+void BuildKNNGraph(const PointCloud &cloud,
+                   size_t k,
+                   std::vector<size_t> &offsets,
+                   std::vector<int> &neighbors) {
+    const int num_points = (int)cloud.points_.size();
+    std::vector<int> knn(num_points * k, -1);
+    KDTreeFlann kdtree;
+    kdtree.SetGeometry(cloud);
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        std::vector<int> indices;
+        std::vector<double> distance2;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int i = 0; i < num_points; i++) {
+            kdtree.SearchKNN(cloud.points_[i], int(k + 1), indices, distance2);
+            size_t cnt = 0;
+            for (size_t j = 0; j < indices.size() && cnt < k; j++) {
+                if (indices[j] != i) {
+                    knn[i * k + cnt++] = indices[j];
+                }
+            }
+        }
+#ifdef _OPENMP
+    }
+#endif
+
+    // An edge i -> j needs the reverse edge j -> i unless i is also among the
+    // nearest neighbors of j.
+    std::vector<uint8_t> needs_reverse(knn.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_points; i++) {
+        for (size_t a = 0; a < k; a++) {
+            int j = knn[i * k + a];
+            if (j < 0) {
+                continue;
+            }
+            const int *knn_j = knn.data() + j * k;
+            needs_reverse[i * k + a] = std::find(knn_j, knn_j + k, i) ==
+                                       knn_j + k;
+        }
+    }
+
+    offsets.assign(num_points + 1, 0);
+    for (int i = 0; i < num_points; i++) {
+        for (size_t a = 0; a < k; a++) {
+            int j = knn[i * k + a];
+            if (j >= 0) {
+                offsets[i + 1]++;
+                if (needs_reverse[i * k + a]) {
+                    offsets[j + 1]++;
+                }
+            }
+        }
+    }
+    for (int i = 0; i < num_points; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    neighbors.resize(offsets[num_points]);
+    std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+    for (int i = 0; i < num_points; i++) {
+        for (size_t a = 0; a < k; a++) {
+            int j = knn[i * k + a];
+            if (j >= 0) {
+                neighbors[fill[i]++] = j;
+                if (needs_reverse[i * k + a]) {
+                    neighbors[fill[j]++] = i;
+                }
+            }
+        }
+    }
+}
+
+// Computes the minimum spanning forest of the graph with Boruvka's algorithm,
+// using 1 - |n_i . n_j| as the weight of edge (i, j). Ties are broken by the
+// vertex ids so that all components agree on a strict order of the edges.
+// The neighbors of every vertex are reordered in place.
+std::vector<Eigen::Vector2i> ComputeMinimumSpanningForest(
+        const PointCloud &cloud,
+        const std::vector<size_t> &offsets,
+        std::vector<int> &neighbors) {
+    const int num_points = (int)cloud.points_.size();
+    auto Weight = [&cloud](int i, int j) {
+        return 1.0 - std::abs(cloud.normals_[i].dot(cloud.normals_[j]));
+    };
+    auto Less = [&Weight](int a0, int a1, int b0, int b1) {
+        double wa = Weight(a0, a1);
+        double wb = Weight(b0, b1);
+        if (wa != wb) {
+            return wa < wb;
+        }
+        return std::make_pair(std::min(a0, a1), std::max(a0, a1)) <
+               std::make_pair(std::min(b0, b1), std::max(b0, b1));
+    };
+
+    std::vector<Eigen::Vector2i> tree_edges;
+    DisjointSet components(num_points);
+    std::vector<int> component(num_points);
+    std::iota(component.begin(), component.end(), 0);
+    // Edges inside a component are moved past ends[i] and never looked at
+    // again.
+    std::vector<size_t> ends(offsets.begin() + 1, offsets.end());
+    // Cheapest outgoing edge of every vertex and of every component, stored
+    // as the other endpoint, or -1 if there is none.
+    std::vector<int> vertex_best(num_points);
+    std::vector<Eigen::Vector2i> component_best(num_points);
+    bool merged = true;
+    while (merged) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < num_points; i++) {
+            int best = -1;
+            double best_weight = 0.0;
+            for (size_t e = offsets[i]; e < ends[i];) {
+                int j = neighbors[e];
+                if (component[j] == component[i]) {
+                    std::swap(neighbors[e], neighbors[--ends[i]]);
+                    continue;
+                }
+                double weight = Weight(i, j);
+                if (best < 0 || weight < best_weight ||
+                    (weight == best_weight && Less(i, j, i, best))) {
+                    best = j;
+                    best_weight = weight;
+                }
+                e++;
+            }
+            vertex_best[i] = best;
+        }
+
+        std::fill(component_best.begin(), component_best.end(),
+                  Eigen::Vector2i(-1, -1));
+        for (int i = 0; i < num_points; i++) {
+            int j = vertex_best[i];
+            if (j < 0) {
+                continue;
+            }
+            Eigen::Vector2i &best = component_best[component[i]];
+            if (best(0) < 0 || Less(i, j, best(0), best(1))) {
+                best = Eigen::Vector2i(i, j);
+            }
+        }
+
+        merged = false;
+        for (int c = 0; c < num_points; c++) {
+            const Eigen::Vector2i &best = component_best[c];
+            if (best(0) >= 0 && components.Union(best(0), best(1))) {
+                tree_edges.push_back(best);
+                merged = true;
+            }
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < num_points; i++) {
+            component[i] = components.Find(i);
+        }
+    }
+    return tree_edges;
+}
+
 }  // unnamed namespace
 
 namespace geometry {
@@ -347,5 +556,84 @@ bool PointCloud::OrientNormalsTowardsCameraLocation(
     }
     return true;
 }
+
+bool PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
+    if (HasNormals() == false) {
+        utility::LogWarning(
+                "[OrientNormalsConsistentTangentPlane] No normals in the "
+                "PointCloud. Call EstimateNormals() first.");
+        return false;
+    }
+    if (k == 0) {
+        utility::LogWarning(
+                "[OrientNormalsConsistentTangentPlane] k must be positive.");
+        return false;
+    }
+    const int num_points = (int)points_.size();
+    std::vector<size_t> offsets;
+    std::vector<int> neighbors;
+    BuildKNNGraph(*this, k, offsets, neighbors);
+    std::vector<Eigen::Vector2i> tree_edges =
+            ComputeMinimumSpanningForest(*this, offsets, neighbors);
+    std::vector<int>().swap(neighbors);
+
+    // Adjacency of the spanning forest.
+    std::vector<size_t> tree_offsets(num_points + 1, 0);
+    for (const auto &edge : tree_edges) {
+        tree_offsets[edge(0) + 1]++;
+        tree_offsets[edge(1) + 1]++;
+    }
+    for (int i = 0; i < num_points; i++) {
+        tree_offsets[i + 1] += tree_offsets[i];
+    }
+    std::vector<int> tree_neighbors(tree_offsets[num_points]);
+    std::vector<size_t> fill(tree_offsets.begin(), tree_offsets.end() - 1);
+    for (const auto &edge : tree_edges) {
+        tree_neighbors[fill[edge(0)]++] = edge(1);
+        tree_neighbors[fill[edge(1)]++] = edge(0);
+    }
+
+    // Each tree is rooted at its highest point, whose normal is flipped to
+    // point upwards, and the orientation is propagated along the tree edges.
+    DisjointSet trees(num_points);
+    for (const auto &edge : tree_edges) {
+        trees.Union(edge(0), edge(1));
+    }
+    std::vector<int> root(num_points, -1);
+    for (int i = 0; i < num_points; i++) {
+        int &r = root[trees.Find(i)];
+        if (r < 0 || points_[i](2) > points_[r](2)) {
+            r = i;
+        }
+    }
+    std::vector<bool> visited(num_points, false);
+    std::queue<int> queue;
+    for (int t = 0; t < num_points; t++) {
+        if (root[t] < 0) {
+            continue;
+        }
+        int r = root[t];
+        if (normals_[r](2) < 0.0) {
+            normals_[r] *= -1.0;
+        }
+        visited[r] = true;
+        queue.push(r);
+        while (!queue.empty()) {
+            int i = queue.front();
+            queue.pop();
+            for (size_t e = tree_offsets[i]; e < tree_offsets[i + 1]; e++) {
+                int j = tree_neighbors[e];
+                if (!visited[j]) {
+                    visited[j] = true;
+                    if (normals_[i].dot(normals_[j]) < 0.0) {
+                        normals_[j] *= -1.0;
+                    }
+                    queue.push(j);
+                }
+            }
+        }
+    }
+    return true;
+}
 }  // namespace geometry
 }  // namespace open3d
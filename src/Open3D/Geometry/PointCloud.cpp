@@ -29,11 +29,13 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <numeric>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/Qhull.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/RadixSort.h"
 
 namespace open3d {
 namespace geometry {
@@ -173,17 +175,31 @@ PointCloud &PointCloud::RemoveNonFinitePoints(bool remove_nan,
 
 std::shared_ptr<PointCloud> PointCloud::SelectByIndex(
         const std::vector<size_t> &indices, bool invert /* = false */) const {
+    std::vector<bool> mask = std::vector<bool>(points_.size(), false);
+    for (size_t i : indices) {
+        mask[i] = true;
+    }
+    return SelectByMask(mask, invert);
+}
+
+std::shared_ptr<PointCloud> PointCloud::SelectByMask(
+        const std::vector<bool> &mask, bool invert /* = false */) const {
+    if (mask.size() != points_.size()) {
+        utility::LogError(
+                "[SelectByMask] Mask size {:d} does not match the number of "
+                "points {:d}.",
+                mask.size(), points_.size());
+    }
     auto output = std::make_shared<PointCloud>();
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
 
-    std::vector<bool> mask = std::vector<bool>(points_.size(), invert);
-    for (size_t i : indices) {
-        mask[i] = !invert;
-    }
-
+    size_t num_selected = std::count(mask.begin(), mask.end(), !invert);
+    output->points_.reserve(num_selected);
+    if (has_normals) output->normals_.reserve(num_selected);
+    if (has_colors) output->colors_.reserve(num_selected);
     for (size_t i = 0; i < points_.size(); i++) {
-        if (mask[i]) {
+        if (mask[i] != invert) {
             output->points_.push_back(points_[i]);
             if (has_normals) output->normals_.push_back(normals_[i]);
             if (has_colors) output->colors_.push_back(colors_[i]);
@@ -280,7 +296,10 @@ public:
         int max_class = -1;
         int max_count = -1;
         for (auto it = classes.begin(); it != classes.end(); it++) {
-            if (it->second > max_count) {
+            // Ties go to the smallest class so the result does not depend
+            // on the hash map iteration order.
+            if (it->second > max_count ||
+                (it->second == max_count && it->first < max_class)) {
                 max_count = it->second;
                 max_class = it->first;
             }
@@ -295,6 +314,83 @@ private:
     std::vector<point_cubic_id> original_id;
     std::unordered_map<int, int> classes;
 };
+
+// Computes the integer voxel coordinates of every point.
+std::vector<Eigen::Vector3i> ComputeVoxelIndices(
+        const std::vector<Eigen::Vector3d> &points,
+        const Eigen::Vector3d &voxel_min_bound,
+        double voxel_size) {
+    std::vector<Eigen::Vector3i> voxel_indices(points.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)points.size(); i++) {
+        Eigen::Vector3d ref_coord = (points[i] - voxel_min_bound) / voxel_size;
+        voxel_indices[i] << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+                int(floor(ref_coord(2)));
+    }
+    return voxel_indices;
+}
+
+// Orders the points so that the points of each voxel are contiguous. Points
+// within a voxel keep their original relative order, and voxels are ordered
+// by (z, y, x). On return, the points of the k-th voxel are
+// order[segments[k]] ... order[segments[k + 1] - 1].
+void SortPointsByVoxel(const std::vector<Eigen::Vector3i> &voxel_indices,
+                       std::vector<size_t> &order,
+                       std::vector<size_t> &segments) {
+    const int n = (int)voxel_indices.size();
+    order.clear();
+    segments.clear();
+    if (n == 0) {
+        segments.push_back(0);
+        return;
+    }
+    Eigen::Vector3i index_min = voxel_indices[0];
+    Eigen::Vector3i index_max = voxel_indices[0];
+    for (const auto &voxel_index : voxel_indices) {
+        index_min = index_min.cwiseMin(voxel_index);
+        index_max = index_max.cwiseMax(voxel_index);
+    }
+    uint64_t extent[3];
+    for (int c = 0; c < 3; c++) {
+        extent[c] = uint64_t(int64_t(index_max(c)) - int64_t(index_min(c))) + 1;
+    }
+    const uint64_t max_key = std::numeric_limits<uint64_t>::max();
+    if (extent[1] <= max_key / extent[0] &&
+        extent[2] <= max_key / (extent[0] * extent[1])) {
+        // Linearized voxel keys fit in 64 bits, radix sort them.
+        std::vector<uint64_t> keys(voxel_indices.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < n; i++) {
+            const Eigen::Vector3i &v = voxel_indices[i];
+            keys[i] = uint64_t(int64_t(v(0)) - index_min(0)) +
+                      extent[0] * (uint64_t(int64_t(v(1)) - index_min(1)) +
+                                   extent[1] * uint64_t(int64_t(v(2)) -
+                                                        index_min(2)));
+        }
+        utility::RadixSortWithIndices(keys, order);
+    } else {
+        order.resize(voxel_indices.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+                         [&voxel_indices](size_t a, size_t b) {
+                             const Eigen::Vector3i &va = voxel_indices[a];
+                             const Eigen::Vector3i &vb = voxel_indices[b];
+                             return std::make_tuple(va(2), va(1), va(0)) <
+                                    std::make_tuple(vb(2), vb(1), vb(0));
+                         });
+    }
+    segments.push_back(0);
+    for (int i = 1; i < n; i++) {
+        if (voxel_indices[order[i]] != voxel_indices[order[i - 1]]) {
+            segments.push_back(size_t(i));
+        }
+    }
+    segments.push_back(size_t(n));
+}
 }  // namespace
 
 std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
@@ -311,27 +407,36 @@ std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
+    std::vector<size_t> order;
+    std::vector<size_t> segments;
+    SortPointsByVoxel(
+            ComputeVoxelIndices(points_, voxel_min_bound, voxel_size), order,
+            segments);
 
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
-    }
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    int num_voxels = (int)segments.size() - 1;
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int k = 0; k < num_voxels; k++) {
+        AccumulatedPoint accpoint;
+        for (size_t j = segments[k]; j < segments[k + 1]; j++) {
+            accpoint.AddPoint(*this, (int)order[j]);
+        }
+        output->points_[k] = accpoint.GetAveragePoint();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[k] = accpoint.GetAverageNormal();
         }
         if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
+            output->colors_[k] = accpoint.GetAverageColor();
         }
     }
     utility::LogDebug(
@@ -360,51 +465,62 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPointForTrace,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    int cid_temp[3] = {1, 2, 4};
-    for (size_t i = 0; i < points_.size(); i++) {
-        auto ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        auto voxel_index = Eigen::Vector3i(int(floor(ref_coord(0))),
-                                           int(floor(ref_coord(1))),
-                                           int(floor(ref_coord(2))));
-        int cid = 0;
-        for (int c = 0; c < 3; c++) {
-            if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
-                cid += cid_temp[c];
-            }
-        }
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i, cid,
-                                                     approximate_class);
-    }
+    std::vector<Eigen::Vector3i> voxel_indices =
+            ComputeVoxelIndices(points_, voxel_min_bound, voxel_size);
+    std::vector<size_t> order;
+    std::vector<size_t> segments;
+    SortPointsByVoxel(voxel_indices, order, segments);
+
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    int cnt = 0;
-    cubic_id.resize(voxelindex_to_accpoint.size(), 8);
+    int num_voxels = (int)segments.size() - 1;
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+    cubic_id.resize(num_voxels, 8);
     cubic_id.setConstant(-1);
-    std::vector<std::vector<int>> original_indices(
-            voxelindex_to_accpoint.size());
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    std::vector<std::vector<int>> original_indices(num_voxels);
+    int cid_temp[3] = {1, 2, 4};
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int k = 0; k < num_voxels; k++) {
+        AccumulatedPointForTrace accpoint;
+        for (size_t j = segments[k]; j < segments[k + 1]; j++) {
+            size_t i = order[j];
+            Eigen::Vector3d ref_coord =
+                    (points_[i] - voxel_min_bound) / voxel_size;
+            int cid = 0;
+            for (int c = 0; c < 3; c++) {
+                if ((ref_coord(c) - voxel_indices[i](c)) >= 0.5) {
+                    cid += cid_temp[c];
+                }
+            }
+            accpoint.AddPoint(*this, i, cid, approximate_class);
+        }
+        output->points_[k] = accpoint.GetAveragePoint();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[k] = accpoint.GetAverageNormal();
         }
         if (has_colors) {
             if (approximate_class) {
-                output->colors_.push_back(accpoint.second.GetMaxClass());
+                output->colors_[k] = accpoint.GetMaxClass();
             } else {
-                output->colors_.push_back(accpoint.second.GetAverageColor());
+                output->colors_[k] = accpoint.GetAverageColor();
             }
         }
-        auto original_id = accpoint.second.GetOriginalID();
+        auto original_id = accpoint.GetOriginalID();
+        original_indices[k].reserve(original_id.size());
         for (int i = 0; i < (int)original_id.size(); i++) {
             size_t pid = original_id[i].point_id;
             int cid = original_id[i].cubic_id;
-            cubic_id(cnt, cid) = int(pid);
-            original_indices[cnt].push_back(int(pid));
+            cubic_id(k, cid) = int(pid);
+            original_indices[k].push_back(int(pid));
         }
-        cnt++;
     }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
@@ -443,91 +559,135 @@ std::shared_ptr<PointCloud> PointCloud::Crop(
     return SelectByIndex(bbox.GetPointIndicesWithinBoundingBox(points_));
 }
 
-std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
-PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
+std::vector<bool> PointCloud::ComputeRadiusOutlierMask(
+        size_t nb_points, double search_radius) const {
     if (nb_points < 1 || search_radius <= 0) {
         utility::LogError(
-                "[RemoveRadiusOutliers] Illegal input parameters,"
+                "[ComputeRadiusOutlierMask] Illegal input parameters,"
                 "number of points and radius must be positive");
     }
+    if (points_.size() == 0) {
+        return std::vector<bool>();
+    }
     KDTreeFlann kdtree;
     kdtree.SetGeometry(*this);
-    std::vector<bool> mask = std::vector<bool>(points_.size());
+    // std::vector<bool> packs bits and cannot be written concurrently.
+    std::vector<uint8_t> inlier(points_.size(), 0);
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static)
+#pragma omp parallel
+    {
 #endif
-    for (int i = 0; i < int(points_.size()); i++) {
+        // Scratch buffers are reused by all queries of a thread.
         std::vector<int> tmp_indices;
         std::vector<double> dist;
-        size_t nb_neighbors = kdtree.SearchRadius(points_[i], search_radius,
-                                                  tmp_indices, dist);
-        mask[i] = (nb_neighbors > nb_points);
-    }
-    std::vector<size_t> indices;
-    for (size_t i = 0; i < mask.size(); i++) {
-        if (mask[i]) {
-            indices.push_back(i);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int i = 0; i < int(points_.size()); i++) {
+            // Only the first nb_points + 1 neighbors decide the outcome, so
+            // the hybrid search stops there instead of collecting the whole
+            // sphere.
+            int nb_neighbors = kdtree.SearchHybrid(points_[i], search_radius,
+                                                   int(nb_points) + 1,
+                                                   tmp_indices, dist);
+            inlier[i] = nb_neighbors > int(nb_points) ? 1 : 0;
         }
+#ifdef _OPENMP
     }
-    return std::make_tuple(SelectByIndex(indices), indices);
+#endif
+    return std::vector<bool>(inlier.begin(), inlier.end());
 }
 
-std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
-PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
-                                      double std_ratio) const {
+std::vector<bool> PointCloud::ComputeStatisticalOutlierMask(
+        size_t nb_neighbors, double std_ratio) const {
     if (nb_neighbors < 1 || std_ratio <= 0) {
         utility::LogError(
-                "[RemoveStatisticalOutliers] Illegal input parameters, number "
-                "of neighbors and standard deviation ratio must be positive");
+                "[ComputeStatisticalOutlierMask] Illegal input parameters, "
+                "number of neighbors and standard deviation ratio must be "
+                "positive");
     }
     if (points_.size() == 0) {
-        return std::make_tuple(std::make_shared<PointCloud>(),
-                               std::vector<size_t>());
+        return std::vector<bool>();
     }
     KDTreeFlann kdtree;
     kdtree.SetGeometry(*this);
     std::vector<double> avg_distances = std::vector<double>(points_.size());
-    std::vector<size_t> indices;
     size_t valid_distances = 0;
+    double cloud_sum = 0.0;
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static)
+#pragma omp parallel reduction(+ : valid_distances, cloud_sum)
+    {
 #endif
-    for (int i = 0; i < int(points_.size()); i++) {
         std::vector<int> tmp_indices;
         std::vector<double> dist;
-        kdtree.SearchKNN(points_[i], int(nb_neighbors), tmp_indices, dist);
-        double mean = -1.0;
-        if (dist.size() > 0u) {
-            valid_distances++;
-            std::for_each(dist.begin(), dist.end(),
-                          [](double &d) { d = std::sqrt(d); });
-            mean = std::accumulate(dist.begin(), dist.end(), 0.0) / dist.size();
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int i = 0; i < int(points_.size()); i++) {
+            kdtree.SearchKNN(points_[i], int(nb_neighbors), tmp_indices, dist);
+            double mean = -1.0;
+            if (dist.size() > 0u) {
+                valid_distances++;
+                double sum = 0.0;
+                for (double d : dist) {
+                    sum += std::sqrt(d);
+                }
+                mean = sum / dist.size();
+                cloud_sum += mean;
+            }
+            avg_distances[i] = mean;
         }
-        avg_distances[i] = mean;
+#ifdef _OPENMP
     }
+#endif
     if (valid_distances == 0) {
-        return std::make_tuple(std::make_shared<PointCloud>(),
-                               std::vector<size_t>());
-    }
-    double cloud_mean = std::accumulate(
-            avg_distances.begin(), avg_distances.end(), 0.0,
-            [](double const &x, double const &y) { return y > 0 ? x + y : x; });
-    cloud_mean /= valid_distances;
-    double sq_sum = std::inner_product(
-            avg_distances.begin(), avg_distances.end(), avg_distances.begin(),
-            0.0, [](double const &x, double const &y) { return x + y; },
-            [cloud_mean](double const &x, double const &y) {
-                return x > 0 ? (x - cloud_mean) * (y - cloud_mean) : 0;
-            });
+        return std::vector<bool>(points_.size(), false);
+    }
+    double cloud_mean = cloud_sum / valid_distances;
+    double sq_sum = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : sq_sum) schedule(static)
+#endif
+    for (int i = 0; i < int(avg_distances.size()); i++) {
+        if (avg_distances[i] > 0) {
+            double d = avg_distances[i] - cloud_mean;
+            sq_sum += d * d;
+        }
+    }
     // Bessel's correction
     double std_dev = std::sqrt(sq_sum / (valid_distances - 1));
     double distance_threshold = cloud_mean + std_ratio * std_dev;
+    std::vector<bool> mask(points_.size());
     for (size_t i = 0; i < avg_distances.size(); i++) {
-        if (avg_distances[i] > 0 && avg_distances[i] < distance_threshold) {
+        mask[i] = avg_distances[i] > 0 && avg_distances[i] < distance_threshold;
+    }
+    return mask;
+}
+
+std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
+    std::vector<bool> mask = ComputeRadiusOutlierMask(nb_points, search_radius);
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < mask.size(); i++) {
+        if (mask[i]) {
+            indices.push_back(i);
+        }
+    }
+    return std::make_tuple(SelectByMask(mask), indices);
+}
+
+std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
+                                      double std_ratio) const {
+    std::vector<bool> mask =
+            ComputeStatisticalOutlierMask(nb_neighbors, std_ratio);
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < mask.size(); i++) {
+        if (mask[i]) {
             indices.push_back(i);
         }
     }
-    return std::make_tuple(SelectByIndex(indices), indices);
+    return std::make_tuple(SelectByMask(mask), indices);
 }
 
 std::tuple<Eigen::Vector3d, Eigen::Matrix3d>
@@ -128,6 +128,16 @@ public:
     std::shared_ptr<PointCloud> SelectByIndex(
             const std::vector<size_t> &indices, bool invert = false) const;
 
+    /// \brief Function to select points from \p input pointcloud into
+    /// \p output pointcloud.
+    ///
+    /// Points whose entry in \p mask is `true` are selected.
+    ///
+    /// \param mask Mask with one entry per point.
+    /// \param invert Set to `True` to invert the selection of the mask.
+    std::shared_ptr<PointCloud> SelectByMask(const std::vector<bool> &mask,
+                                             bool invert = false) const;
+
     /// \brief Function to downsample input pointcloud into output pointcloud
     /// with a voxel.
     ///
@@ -195,6 +205,24 @@ public:
     std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
     RemoveStatisticalOutliers(size_t nb_neighbors, double std_ratio) const;
 
+    /// \brief Function to compute the inlier mask of RemoveRadiusOutliers
+    /// without copying the point cloud.
+    ///
+    /// \param nb_points Number of points within the radius.
+    /// \param search_radius Radius of the sphere.
+    /// \return Mask that is `true` for inliers.
+    std::vector<bool> ComputeRadiusOutlierMask(size_t nb_points,
+                                               double search_radius) const;
+
+    /// \brief Function to compute the inlier mask of
+    /// RemoveStatisticalOutliers without copying the point cloud.
+    ///
+    /// \param nb_neighbors Number of neighbors around the target point.
+    /// \param std_ratio Standard deviation ratio.
+    /// \return Mask that is `true` for inliers.
+    std::vector<bool> ComputeStatisticalOutlierMask(size_t nb_neighbors,
+                                                    double std_ratio) const;
+
     /// \brief Function to compute the normals of a point cloud.
     ///
     /// Normals are oriented with respect to the input point cloud if normals
@@ -223,6 +251,17 @@ public:
     bool OrientNormalsTowardsCameraLocation(
             const Eigen::Vector3d &camera_location = Eigen::Vector3d::Zero());
 
+    /// \brief Function to consistently orient the normals of a point cloud
+    /// based on tangent planes.
+    ///
+    /// Builds a Riemannian graph of the k nearest neighbors of every point,
+    /// weighted by the angle between normals, and propagates the orientation
+    /// along its minimum spanning tree (Hoppe et al., 1992). The normal of the
+    /// highest point of each connected component is oriented upwards.
+    ///
+    /// \param k Number of neighbors used to build the graph.
+    bool OrientNormalsConsistentTangentPlane(size_t k);
+
     /// \brief Function to compute the point to point distances between point
     /// clouds.
     ///
@@ -0,0 +1,321 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloudLOD.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <queue>
+
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/RadixSort.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Points are sorted by Morton codes of this many bits per axis.
+const int kMortonDepth = 21;
+
+uint64_t SpreadBits(uint64_t x) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffffULL;
+    x = (x | x << 16) & 0x1f0000ff0000ffULL;
+    x = (x | x << 8) & 0x100f00f00f00f00fULL;
+    x = (x | x << 4) & 0x10c30c30c30c30c3ULL;
+    x = (x | x << 2) & 0x1249249249249249ULL;
+    return x;
+}
+
+/// Returns the Morton code of the cell of depth \p depth containing the point
+/// with Morton code \p code.
+uint64_t CellCode(uint64_t code, int depth) {
+    if (depth >= kMortonDepth) return code;
+    return code >> (3 * (kMortonDepth - depth));
+}
+
+/// Keeps the first point of every sampling cell in \p node and creates the
+/// children holding the other points. [begin_, end_) of \p node spans its
+/// whole subtree on input and its own points on output. Points in the range
+/// are sorted by Morton code, so the points of a cell are contiguous; the
+/// partition is stable so that the children stay sorted.
+void SplitNode(PointCloudLODNode &node,
+               int node_index,
+               size_t max_points_per_node,
+               int sampling_depth,
+               int max_depth,
+               std::vector<uint64_t> &codes,
+               std::vector<size_t> &indices,
+               std::vector<PointCloudLODNode> &children) {
+    const size_t begin = node.begin_, end = node.end_;
+    if (end - begin <= max_points_per_node || node.depth_ >= max_depth) {
+        return;
+    }
+    const int sample_depth = node.depth_ + sampling_depth;
+    std::vector<uint64_t> rest_codes;
+    std::vector<size_t> rest_indices;
+    size_t own_end = begin;
+    uint64_t previous_cell = 0;
+    for (size_t k = begin; k < end; k++) {
+        uint64_t cell = CellCode(codes[k], sample_depth);
+        if (k == begin || cell != previous_cell) {
+            codes[own_end] = codes[k];
+            indices[own_end] = indices[k];
+            own_end++;
+        } else {
+            rest_codes.push_back(codes[k]);
+            rest_indices.push_back(indices[k]);
+        }
+        previous_cell = cell;
+    }
+    std::copy(rest_codes.begin(), rest_codes.end(), codes.begin() + own_end);
+    std::copy(rest_indices.begin(), rest_indices.end(),
+              indices.begin() + own_end);
+    node.end_ = own_end;
+
+    const double half = node.size_ / 2;
+    for (size_t k = own_end; k < end;) {
+        uint64_t cell = CellCode(codes[k], node.depth_ + 1);
+        size_t child_end = k + 1;
+        while (child_end < end &&
+               CellCode(codes[child_end], node.depth_ + 1) == cell) {
+            child_end++;
+        }
+        Eigen::Vector3d offset(double(cell & 1), double((cell >> 1) & 1),
+                               double((cell >> 2) & 1));
+        PointCloudLODNode child(node.min_bound_ + half * offset, half,
+                                node.depth_ + 1, node_index);
+        child.begin_ = k;
+        child.end_ = child_end;
+        children.push_back(child);
+        k = child_end;
+    }
+}
+
+}  // unnamed namespace
+
+std::shared_ptr<PointCloudLOD> PointCloudLOD::CreateFromPointCloud(
+        const PointCloud &pointcloud,
+        size_t max_points_per_node /* = 20000*/,
+        int sampling_depth /* = 7*/,
+        int max_depth /* = 14*/) {
+    if (max_points_per_node == 0) {
+        utility::LogError(
+                "[CreateFromPointCloud] max_points_per_node must be "
+                "positive.");
+    }
+    if (sampling_depth < 0 || max_depth < 0 || max_depth >= kMortonDepth) {
+        utility::LogError(
+                "[CreateFromPointCloud] max_depth must be in [0, {:d}) and "
+                "sampling_depth non-negative.",
+                kMortonDepth);
+    }
+    auto lod = std::make_shared<PointCloudLOD>();
+    lod->sampling_depth_ = sampling_depth;
+    if (pointcloud.HasPoints() == false) {
+        utility::LogWarning("[CreateFromPointCloud] PointCloud is empty.");
+        return lod;
+    }
+    const size_t n = pointcloud.points_.size();
+    const Eigen::Vector3d min_bound = pointcloud.GetMinBound();
+    double size = (pointcloud.GetMaxBound() - min_bound).maxCoeff();
+    if (size <= 0) size = 1;
+    const int64_t max_coordinate = (int64_t(1) << kMortonDepth) - 1;
+    const double scale = double(int64_t(1) << kMortonDepth) / size;
+    std::vector<uint64_t> codes(n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(n); i++) {
+        Eigen::Vector3d q = (pointcloud.points_[i] - min_bound) * scale;
+        uint64_t code = 0;
+        for (int axis = 0; axis < 3; axis++) {
+            int64_t c = std::min(max_coordinate,
+                                 std::max(int64_t(0), int64_t(q(axis))));
+            code |= SpreadBits(uint64_t(c)) << axis;
+        }
+        codes[i] = code;
+    }
+    std::vector<size_t> indices;
+    utility::RadixSortWithIndices(codes, indices);
+
+    // Nodes are split level by level. Nodes of one level own disjoint ranges
+    // of the sorted points and are split in parallel.
+    lod->nodes_.push_back(PointCloudLODNode(min_bound, size, 0, -1));
+    lod->nodes_[0].end_ = n;
+    std::vector<int> level(1, 0);
+    while (!level.empty()) {
+        std::vector<std::vector<PointCloudLODNode>> children(level.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int i = 0; i < int(level.size()); i++) {
+            SplitNode(lod->nodes_[level[i]], level[i], max_points_per_node,
+                      sampling_depth, max_depth, codes, indices, children[i]);
+        }
+        std::vector<int> next_level;
+        for (size_t i = 0; i < level.size(); i++) {
+            if (children[i].empty()) continue;
+            PointCloudLODNode &node = lod->nodes_[level[i]];
+            node.first_child_ = int(lod->nodes_.size());
+            node.num_children_ = int(children[i].size());
+            for (const auto &child : children[i]) {
+                next_level.push_back(int(lod->nodes_.size()));
+                lod->nodes_.push_back(child);
+            }
+        }
+        level.swap(next_level);
+    }
+
+    PointCloud &reordered = lod->pointcloud_;
+    reordered.points_.resize(n);
+    if (pointcloud.HasColors()) reordered.colors_.resize(n);
+    if (pointcloud.HasNormals()) reordered.normals_.resize(n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(n); i++) {
+        reordered.points_[i] = pointcloud.points_[indices[i]];
+        if (pointcloud.HasColors()) {
+            reordered.colors_[i] = pointcloud.colors_[indices[i]];
+        }
+        if (pointcloud.HasNormals()) {
+            reordered.normals_[i] = pointcloud.normals_[indices[i]];
+        }
+    }
+    lod->indices_.swap(indices);
+    utility::LogDebug("[CreateFromPointCloud] {:d} points in {:d} nodes.", n,
+                      lod->nodes_.size());
+    return lod;
+}
+
+std::vector<int> PointCloudLOD::SelectNodes(
+        const camera::PinholeCameraParameters &camera,
+        size_t point_budget,
+        double min_pixel_spacing /* = 1.0*/) const {
+    std::vector<int> selected;
+    if (nodes_.empty()) return selected;
+    const Eigen::Matrix3d R = camera.extrinsic_.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = camera.extrinsic_.block<3, 1>(0, 3);
+    const Eigen::Matrix3d &K = camera.intrinsic_.intrinsic_matrix_;
+    const double width = camera.intrinsic_.width_;
+    const double height = camera.intrinsic_.height_;
+    // Inward normals of the side planes of the view frustum in camera space.
+    const Eigen::Vector3d planes[4] = {
+            Eigen::Vector3d(K(0, 0), 0, K(0, 2)).normalized(),
+            Eigen::Vector3d(-K(0, 0), 0, width - K(0, 2)).normalized(),
+            Eigen::Vector3d(0, K(1, 1), K(1, 2)).normalized(),
+            Eigen::Vector3d(0, -K(1, 1), height - K(1, 2)).normalized()};
+    const double focal = std::max(K(0, 0), K(1, 1));
+    const double grid_cells = double(int64_t(1) << sampling_depth_);
+
+    // Returns the distance from the camera to the bounding sphere of node i,
+    // or a negative value if the sphere is outside the view frustum.
+    auto distance_to_node = [&](int i) {
+        const PointCloudLODNode &node = nodes_[i];
+        double radius = node.size_ * std::sqrt(3.0) / 2;
+        Eigen::Vector3d center =
+                node.min_bound_ + Eigen::Vector3d::Constant(node.size_ / 2);
+        center = R * center + t;
+        if (center(2) < -radius) return -1.0;
+        for (const auto &plane : planes) {
+            if (plane.dot(center) < -radius) return -1.0;
+        }
+        return std::max(center.norm() - radius, 1e-9);
+    };
+
+    // Nodes are visited by decreasing projected cell size.
+    std::priority_queue<std::pair<double, int>> queue;
+    double root_distance = distance_to_node(0);
+    if (root_distance < 0) return selected;
+    queue.push(std::make_pair(nodes_[0].size_ / root_distance, 0));
+    size_t num_points = 0;
+    while (!queue.empty()) {
+        int i = queue.top().second;
+        queue.pop();
+        size_t count = GetNodePointCount(i);
+        if (num_points + count > point_budget) break;
+        num_points += count;
+        selected.push_back(i);
+        const PointCloudLODNode &node = nodes_[i];
+        for (int k = 0; k < node.num_children_; k++) {
+            int c = node.first_child_ + k;
+            double distance = distance_to_node(c);
+            if (distance < 0) continue;
+            double spacing = nodes_[c].size_ / grid_cells;
+            if (spacing * focal / distance < min_pixel_spacing) continue;
+            queue.push(std::make_pair(nodes_[c].size_ / distance, c));
+        }
+    }
+    return selected;
+}
+
+std::shared_ptr<PointCloud> PointCloudLOD::ExtractPointCloud(
+        const std::vector<int> &nodes) const {
+    auto output = std::make_shared<PointCloud>();
+    std::vector<size_t> offsets(nodes.size() + 1, 0);
+    for (size_t i = 0; i < nodes.size(); i++) {
+        offsets[i + 1] = offsets[i] + GetNodePointCount(nodes[i]);
+    }
+    output->points_.resize(offsets.back());
+    if (pointcloud_.HasColors()) output->colors_.resize(offsets.back());
+    if (pointcloud_.HasNormals()) output->normals_.resize(offsets.back());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < int(nodes.size()); i++) {
+        const PointCloudLODNode &node = nodes_[nodes[i]];
+        std::copy(pointcloud_.points_.begin() + node.begin_,
+                  pointcloud_.points_.begin() + node.end_,
+                  output->points_.begin() + offsets[i]);
+        if (pointcloud_.HasColors()) {
+            std::copy(pointcloud_.colors_.begin() + node.begin_,
+                      pointcloud_.colors_.begin() + node.end_,
+                      output->colors_.begin() + offsets[i]);
+        }
+        if (pointcloud_.HasNormals()) {
+            std::copy(pointcloud_.normals_.begin() + node.begin_,
+                      pointcloud_.normals_.begin() + node.end_,
+                      output->normals_.begin() + offsets[i]);
+        }
+    }
+    return output;
+}
+
+size_t PointCloudLOD::GetPointCount(const std::vector<int> &nodes) const {
+    size_t count = 0;
+    for (int node : nodes) {
+        count += GetNodePointCount(node);
+    }
+    return count;
+}
+
+}  // namespace geometry
+}  // namespace open3d
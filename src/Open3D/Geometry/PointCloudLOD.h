@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/PointCloud.h"
+
+namespace open3d {
+
+namespace camera {
+class PinholeCameraParameters;
+}
+
+namespace geometry {
+
+/// \class PointCloudLODNode
+///
+/// \brief Node of a PointCloudLOD.
+class PointCloudLODNode {
+public:
+    PointCloudLODNode() {}
+    PointCloudLODNode(const Eigen::Vector3d &min_bound,
+                      double size,
+                      int depth,
+                      int parent)
+        : min_bound_(min_bound), size_(size), depth_(depth), parent_(parent) {}
+    ~PointCloudLODNode() {}
+
+public:
+    /// Minimum corner of the cubic cell of the node.
+    Eigen::Vector3d min_bound_ = Eigen::Vector3d::Zero();
+    /// Side length of the cell.
+    double size_ = 0;
+    /// Depth of the node, 0 for the root.
+    int depth_ = 0;
+    /// Index of the parent node, -1 for the root.
+    int parent_ = -1;
+    /// The children of a node are stored consecutively, starting at
+    /// first_child_. first_child_ is -1 for leaves.
+    int first_child_ = -1;
+    int num_children_ = 0;
+    /// Range [begin_, end_) of the points of the node in
+    /// PointCloudLOD::pointcloud_.
+    size_t begin_ = 0;
+    size_t end_ = 0;
+};
+
+/// \class PointCloudLOD
+///
+/// \brief Level of detail hierarchy of a point cloud for rendering clouds
+/// that do not fit into a point budget.
+///
+/// Every point is stored in exactly one node of an octree. Each node keeps one
+/// point per cell of a regular grid laid over its cell and passes the other
+/// points on to its children, so that a node together with its ancestors is a
+/// uniform subsample of the cloud in its cell. Rendering a subtree that
+/// contains the root therefore shows the whole cloud at a resolution that
+/// increases with the depth of the selected nodes.
+class PointCloudLOD {
+public:
+    PointCloudLOD() {}
+    ~PointCloudLOD() {}
+
+public:
+    /// \brief Function to build the hierarchy of a point cloud.
+    ///
+    /// \param pointcloud The point cloud. Points, colors and normals are
+    /// copied.
+    /// \param max_points_per_node Nodes with at most this many points in their
+    /// subtree are not split.
+    /// \param sampling_depth Each node keeps at most one point per cell of a
+    /// grid of 2^sampling_depth cells per side.
+    /// \param max_depth Maximum depth of the nodes.
+    static std::shared_ptr<PointCloudLOD> CreateFromPointCloud(
+            const PointCloud &pointcloud,
+            size_t max_points_per_node = 20000,
+            int sampling_depth = 7,
+            int max_depth = 14);
+
+    /// \brief Function to select the nodes to render from a camera.
+    ///
+    /// Nodes inside the view frustum are visited by decreasing projected
+    /// size, and selected until the next node would exceed the point budget.
+    /// Every selected node other than the root has its parent selected.
+    ///
+    /// \param camera Intrinsic and extrinsic parameters of the camera.
+    /// \param point_budget Maximum number of points of the selected nodes.
+    /// \param min_pixel_spacing A node is only refined if the grid spacing of
+    /// its children projects to at least this many pixels.
+    /// \return Indices of the selected nodes, parents before children.
+    std::vector<int> SelectNodes(const camera::PinholeCameraParameters &camera,
+                                 size_t point_budget,
+                                 double min_pixel_spacing = 1.0) const;
+
+    /// \brief Function to create a point cloud from the points of \p nodes,
+    /// concatenated in the given order.
+    std::shared_ptr<PointCloud> ExtractPointCloud(
+            const std::vector<int> &nodes) const;
+
+    /// Returns the number of points stored in node \p node.
+    size_t GetNodePointCount(int node) const {
+        return nodes_[node].end_ - nodes_[node].begin_;
+    }
+
+    /// Returns the number of points of \p nodes.
+    size_t GetPointCount(const std::vector<int> &nodes) const;
+
+public:
+    /// Nodes in breadth-first order, the root is nodes_[0].
+    std::vector<PointCloudLODNode> nodes_;
+    /// Points of the input cloud, reordered so that the points of every node
+    /// are contiguous.
+    PointCloud pointcloud_;
+    /// Index in the input cloud of every point of pointcloud_.
+    std::vector<size_t> indices_;
+    int sampling_depth_ = 7;
+};
+
+}  // namespace geometry
+}  // namespace open3d
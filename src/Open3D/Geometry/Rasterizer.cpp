@@ -0,0 +1,493 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/Rasterizer.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Vertices are snapped to 1/256 pixel. With coordinates inside the guard
+/// band below, snapped coordinates fit in int and edge functions are exact
+/// in int64_t as well as in double precision.
+const int kSubpixelBits = 8;
+const int kSubpixels = 1 << kSubpixelBits;
+const double kGuardBand = 131072.0;
+
+/// Vertices projected to snapped subpixel coordinates, with the inverse of
+/// their camera space depth. inv_z_ is 0 for vertices closer than the near
+/// plane or outside the guard band; such vertices are not drawn.
+class ScreenVertices {
+public:
+    std::vector<int> x_;
+    std::vector<int> y_;
+    std::vector<float> inv_z_;
+};
+
+ScreenVertices ProjectVertices(const std::vector<Eigen::Vector3d>& vertices,
+                               const camera::PinholeCameraParameters& camera,
+                               double near_plane) {
+    const Eigen::Matrix3d& K = camera.intrinsic_.intrinsic_matrix_;
+    Eigen::Matrix3d R = camera.extrinsic_.block<3, 3>(0, 0);
+    Eigen::Vector3d t = camera.extrinsic_.block<3, 1>(0, 3);
+    ScreenVertices screen;
+    screen.x_.resize(vertices.size());
+    screen.y_.resize(vertices.size());
+    screen.inv_z_.resize(vertices.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(vertices.size()); i++) {
+        Eigen::Vector3d p = R * vertices[i] + t;
+        screen.x_[i] = screen.y_[i] = 0;
+        screen.inv_z_[i] = 0;
+        if (p(2) < near_plane) continue;
+        double x = K(0, 0) * p(0) / p(2) + K(0, 2);
+        double y = K(1, 1) * p(1) / p(2) + K(1, 2);
+        if (!(std::abs(x) <= kGuardBand && std::abs(y) <= kGuardBand)) {
+            continue;
+        }
+        screen.x_[i] = int(std::round(x * kSubpixels));
+        screen.y_[i] = int(std::round(y * kSubpixels));
+        screen.inv_z_[i] = float(1.0 / p(2));
+    }
+    return screen;
+}
+
+/// Screen tiles and the primitives overlapping each of them. Primitives are
+/// binned in contiguous blocks, one per thread, so that binning needs no
+/// synchronization; bins_[block][tile] is sorted by primitive index.
+class TileBins {
+public:
+    TileBins(int width, int height, int tile_size)
+        : width_(width),
+          height_(height),
+          tile_size_(tile_size),
+          tiles_x_((width + tile_size - 1) / tile_size),
+          tiles_y_((height + tile_size - 1) / tile_size) {}
+
+public:
+    int width_;
+    int height_;
+    int tile_size_;
+    int tiles_x_;
+    int tiles_y_;
+    /// Inclusive pixel bounding box (x0, y0, x1, y1) of every primitive.
+    std::vector<Eigen::Vector4i> bounds_;
+    std::vector<std::vector<std::vector<int>>> bins_;
+};
+
+/// Bins \p n_primitives primitives. \p setup(i, bound) computes the clipped
+/// pixel bounding box of primitive i and returns false if it is not drawn.
+template <typename SetupFunc>
+void BinPrimitives(int n_primitives, const SetupFunc& setup, TileBins& bins) {
+    int num_blocks = 1;
+#ifdef _OPENMP
+    num_blocks = std::max(1, std::min(omp_get_max_threads(),
+                                      n_primitives / 4096));
+#endif
+    const int block_size = (n_primitives + num_blocks - 1) / num_blocks;
+    const int n_tiles = bins.tiles_x_ * bins.tiles_y_;
+    bins.bounds_.resize(n_primitives);
+    bins.bins_.assign(num_blocks, std::vector<std::vector<int>>(n_tiles));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for (int b = 0; b < num_blocks; b++) {
+        int end = std::min(n_primitives, (b + 1) * block_size);
+        for (int i = b * block_size; i < end; i++) {
+            Eigen::Vector4i& bound = bins.bounds_[i];
+            if (!setup(i, bound)) continue;
+            for (int ty = bound(1) / bins.tile_size_;
+                 ty <= bound(3) / bins.tile_size_; ty++) {
+                for (int tx = bound(0) / bins.tile_size_;
+                     tx <= bound(2) / bins.tile_size_; tx++) {
+                    bins.bins_[b][ty * bins.tiles_x_ + tx].push_back(i);
+                }
+            }
+        }
+    }
+}
+
+/// Rasterizes all tiles in parallel. \p raster(i, x0, y0, x1, y1) draws
+/// primitive i into the inclusive pixel rectangle, which lies in one tile.
+template <typename RasterFunc>
+void RasterizeTiles(const TileBins& bins, const RasterFunc& raster) {
+    const int n_tiles = bins.tiles_x_ * bins.tiles_y_;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int tile = 0; tile < n_tiles; tile++) {
+        int tile_x0 = (tile % bins.tiles_x_) * bins.tile_size_;
+        int tile_y0 = (tile / bins.tiles_x_) * bins.tile_size_;
+        int tile_x1 = std::min(bins.width_, tile_x0 + bins.tile_size_) - 1;
+        int tile_y1 = std::min(bins.height_, tile_y0 + bins.tile_size_) - 1;
+        for (const auto& block : bins.bins_) {
+            for (int i : block[tile]) {
+                const Eigen::Vector4i& bound = bins.bounds_[i];
+                raster(i, std::max(tile_x0, bound(0)),
+                       std::max(tile_y0, bound(1)),
+                       std::min(tile_x1, bound(2)),
+                       std::min(tile_y1, bound(3)));
+            }
+        }
+    }
+}
+
+/// Edge functions of a screen space triangle with positive area, in snapped
+/// subpixel units. The edge function of vertex k at pixel (x, y),
+/// a_[k] * x + b_[k] * y + c_[k] with x and y scaled by kSubpixels, is the
+/// doubled area spanned by the opposite edge and the pixel; it equals the
+/// doubled triangle area at vertex k and 0 on the opposite edge.
+class TriangleSetup {
+public:
+    double a_[3];
+    double b_[3];
+    double c_[3];
+    double inv_z_[3];
+    double inv_area_;
+    /// Pixels exactly on edge k are drawn only if it is a top-left edge, so
+    /// that shared edges are drawn exactly once.
+    bool top_left_[3];
+    /// Vertex indices in the winding order of the setup.
+    int vertex_[3];
+};
+
+bool SetupTriangle(const ScreenVertices& screen,
+                   const Eigen::Vector3i& triangle,
+                   int width,
+                   int height,
+                   TriangleSetup& setup,
+                   Eigen::Vector4i& bound) {
+    int v[3] = {triangle(0), triangle(1), triangle(2)};
+    if (screen.inv_z_[v[0]] <= 0 || screen.inv_z_[v[1]] <= 0 ||
+        screen.inv_z_[v[2]] <= 0) {
+        return false;
+    }
+    int64_t x[3] = {screen.x_[v[0]], screen.x_[v[1]], screen.x_[v[2]]};
+    int64_t y[3] = {screen.y_[v[0]], screen.y_[v[1]], screen.y_[v[2]]};
+    int64_t area =
+            (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+    if (area == 0) return false;
+    if (area < 0) {
+        std::swap(v[1], v[2]);
+        std::swap(x[1], x[2]);
+        std::swap(y[1], y[2]);
+        area = -area;
+    }
+    // Arithmetic shifts round towards negative infinity, so the bounds are
+    // the pixel centers inside the subpixel bounding box.
+    const int64_t round_up = kSubpixels - 1;
+    bound(0) = int((std::min({x[0], x[1], x[2]}) + round_up) >> kSubpixelBits);
+    bound(1) = int((std::min({y[0], y[1], y[2]}) + round_up) >> kSubpixelBits);
+    bound(2) = int(std::max({x[0], x[1], x[2]}) >> kSubpixelBits);
+    bound(3) = int(std::max({y[0], y[1], y[2]}) >> kSubpixelBits);
+    bound(0) = std::max(0, bound(0));
+    bound(1) = std::max(0, bound(1));
+    bound(2) = std::min(width - 1, bound(2));
+    bound(3) = std::min(height - 1, bound(3));
+    if (bound(0) > bound(2) || bound(1) > bound(3)) return false;
+    for (int k = 0; k < 3; k++) {
+        int j = (k + 1) % 3, l = (k + 2) % 3;
+        int64_t a = y[j] - y[l];
+        int64_t b = x[l] - x[j];
+        setup.a_[k] = double(a);
+        setup.b_[k] = double(b);
+        setup.c_[k] = double(x[j] * y[l] - x[l] * y[j]);
+        setup.top_left_[k] = a > 0 || (a == 0 && b > 0);
+        setup.inv_z_[k] = screen.inv_z_[v[k]];
+        setup.vertex_[k] = v[k];
+    }
+    setup.inv_area_ = 1.0 / double(area);
+    return true;
+}
+
+void RasterizeTriangle(const TriangleSetup& s,
+                       int id,
+                       int x0,
+                       int y0,
+                       int x1,
+                       int y1,
+                       int width,
+                       float* inv_depth,
+                       int* index) {
+    const bool tl0 = s.top_left_[0], tl1 = s.top_left_[1],
+               tl2 = s.top_left_[2];
+    for (int y = y0; y <= y1; y++) {
+        double fy = y * kSubpixels;
+        double r0 = s.b_[0] * fy + s.c_[0];
+        double r1 = s.b_[1] * fy + s.c_[1];
+        double r2 = s.b_[2] * fy + s.c_[2];
+        float* row_depth = inv_depth + size_t(y) * width;
+        int* row_index = index + size_t(y) * width;
+        // Branch-free so that the compiler can vectorize the row.
+        for (int x = x0; x <= x1; x++) {
+            double fx = x * kSubpixels;
+            double w0 = s.a_[0] * fx + r0;
+            double w1 = s.a_[1] * fx + r1;
+            double w2 = s.a_[2] * fx + r2;
+            bool inside = ((w0 > 0) | ((w0 == 0) & tl0)) &
+                          ((w1 > 0) | ((w1 == 0) & tl1)) &
+                          ((w2 > 0) | ((w2 == 0) & tl2));
+            float iz = float((w0 * s.inv_z_[0] + w1 * s.inv_z_[1] +
+                              w2 * s.inv_z_[2]) *
+                             s.inv_area_);
+            float old_iz = row_depth[x];
+            int old_id = row_index[x];
+            bool closer = inside & ((iz > old_iz) | ((iz == old_iz) &
+                                                     (id < old_id)));
+            row_depth[x] = closer ? iz : old_iz;
+            row_index[x] = closer ? id : old_id;
+        }
+    }
+}
+
+uint8_t ColorToByte(double value) {
+    return uint8_t(std::round(std::min(1.0, std::max(0.0, value)) * 255.0));
+}
+
+/// Converts the inverse depth buffer and allocates the output images.
+std::tuple<std::shared_ptr<Image>,
+           std::shared_ptr<Image>,
+           std::shared_ptr<Image>>
+CreateOutputImages(int width,
+                   int height,
+                   const std::vector<float>& inv_depth,
+                   const std::vector<int>& index) {
+    auto depth = std::make_shared<Image>();
+    depth->Prepare(width, height, 1, 4);
+    auto color = std::make_shared<Image>();
+    color->Prepare(width, height, 3, 1);
+    auto index_image = std::make_shared<Image>();
+    index_image->Prepare(width, height, 1, 4);
+    float* depth_data = reinterpret_cast<float*>(depth->data_.data());
+    int* index_data = reinterpret_cast<int*>(index_image->data_.data());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < width * height; i++) {
+        depth_data[i] = inv_depth[i] > 0 ? 1.0f / inv_depth[i] : 0.0f;
+        index_data[i] = index[i];
+    }
+    return std::make_tuple(depth, color, index_image);
+}
+
+bool IsValidCamera(const camera::PinholeCameraParameters& camera,
+                   const RasterizerOption& option) {
+    if (!camera.intrinsic_.IsValid()) {
+        utility::LogWarning("[Rasterize] Invalid camera intrinsic.");
+        return false;
+    }
+    if (option.tile_size_ <= 0 || option.point_size_ <= 0) {
+        utility::LogWarning(
+                "[Rasterize] tile_size and point_size must be positive.");
+        return false;
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
+std::tuple<std::shared_ptr<Image>,
+           std::shared_ptr<Image>,
+           std::shared_ptr<Image>>
+RasterizeTriangleMesh(
+        const TriangleMesh& mesh,
+        const camera::PinholeCameraParameters& camera,
+        const RasterizerOption& option /* = RasterizerOption()*/) {
+    if (!IsValidCamera(camera, option)) {
+        return std::make_tuple(std::make_shared<Image>(),
+                               std::make_shared<Image>(),
+                               std::make_shared<Image>());
+    }
+    const int width = camera.intrinsic_.width_;
+    const int height = camera.intrinsic_.height_;
+    ScreenVertices screen =
+            ProjectVertices(mesh.vertices_, camera, option.near_plane_);
+
+    Eigen::Vector3d camera_center =
+            -camera.extrinsic_.block<3, 3>(0, 0).transpose() *
+            camera.extrinsic_.block<3, 1>(0, 3);
+    // Triangles are set up again for every tile they overlap instead of
+    // keeping the setups of the whole mesh in memory.
+    TileBins bins(width, height, option.tile_size_);
+    BinPrimitives(
+            int(mesh.triangles_.size()),
+            [&](int i, Eigen::Vector4i& bound) {
+                const Eigen::Vector3i& triangle = mesh.triangles_[i];
+                if (option.cull_back_faces_) {
+                    const Eigen::Vector3d& p0 = mesh.vertices_[triangle(0)];
+                    Eigen::Vector3d normal =
+                            (mesh.vertices_[triangle(1)] - p0)
+                                    .cross(mesh.vertices_[triangle(2)] - p0);
+                    if (normal.dot(p0 - camera_center) >= 0) return false;
+                }
+                TriangleSetup setup;
+                return SetupTriangle(screen, triangle, width, height, setup,
+                                     bound);
+            },
+            bins);
+
+    std::vector<float> inv_depth(size_t(width) * height, 0.0f);
+    std::vector<int> index(size_t(width) * height, -1);
+    RasterizeTiles(bins, [&](int i, int x0, int y0, int x1, int y1) {
+        TriangleSetup setup;
+        Eigen::Vector4i bound;
+        SetupTriangle(screen, mesh.triangles_[i], width, height, setup, bound);
+        RasterizeTriangle(setup, i, x0, y0, x1, y1, width, inv_depth.data(),
+                          index.data());
+    });
+
+    std::shared_ptr<Image> depth, color, index_image;
+    std::tie(depth, color, index_image) =
+            CreateOutputImages(width, height, inv_depth, index);
+    // Colors are interpolated once per pixel, for the visible triangle only.
+    bool has_colors = mesh.HasVertexColors();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int i = index[size_t(y) * width + x];
+            uint8_t* rgb = color->PointerAt<uint8_t>(x, y, 0);
+            if (i < 0) {
+                rgb[0] = rgb[1] = rgb[2] = 0;
+                continue;
+            }
+            if (!has_colors) {
+                rgb[0] = rgb[1] = rgb[2] = 255;
+                continue;
+            }
+            TriangleSetup s;
+            Eigen::Vector4i bound;
+            SetupTriangle(screen, mesh.triangles_[i], width, height, s, bound);
+            Eigen::Vector3d c = Eigen::Vector3d::Zero();
+            double sum = 0;
+            for (int k = 0; k < 3; k++) {
+                double w = (s.a_[k] * x * kSubpixels +
+                            s.b_[k] * y * kSubpixels + s.c_[k]) *
+                           s.inv_z_[k];
+                c += w * mesh.vertex_colors_[s.vertex_[k]];
+                sum += w;
+            }
+            if (sum > 0) c /= sum;
+            for (int k = 0; k < 3; k++) rgb[k] = ColorToByte(c(k));
+        }
+    }
+    return std::make_tuple(depth, color, index_image);
+}
+
+std::tuple<std::shared_ptr<Image>,
+           std::shared_ptr<Image>,
+           std::shared_ptr<Image>>
+RasterizePointCloud(const PointCloud& pointcloud,
+                    const camera::PinholeCameraParameters& camera,
+                    const RasterizerOption& option /* = RasterizerOption()*/) {
+    if (!IsValidCamera(camera, option)) {
+        return std::make_tuple(std::make_shared<Image>(),
+                               std::make_shared<Image>(),
+                               std::make_shared<Image>());
+    }
+    const int width = camera.intrinsic_.width_;
+    const int height = camera.intrinsic_.height_;
+    ScreenVertices screen =
+            ProjectVertices(pointcloud.points_, camera, option.near_plane_);
+
+    const int half = (option.point_size_ - 1) / 2;
+    TileBins bins(width, height, option.tile_size_);
+    BinPrimitives(int(pointcloud.points_.size()),
+                  [&](int i, Eigen::Vector4i& bound) {
+                      if (screen.inv_z_[i] <= 0) return false;
+                      const int rounding = kSubpixels / 2;
+                      int x0 = ((screen.x_[i] + rounding) >> kSubpixelBits) -
+                               half;
+                      int y0 = ((screen.y_[i] + rounding) >> kSubpixelBits) -
+                               half;
+                      int x1 = x0 + option.point_size_ - 1;
+                      int y1 = y0 + option.point_size_ - 1;
+                      if (x1 < 0 || y1 < 0 || x0 >= width || y0 >= height) {
+                          return false;
+                      }
+                      bound = Eigen::Vector4i(std::max(0, x0), std::max(0, y0),
+                                              std::min(width - 1, x1),
+                                              std::min(height - 1, y1));
+                      return true;
+                  },
+                  bins);
+
+    std::vector<float> inv_depth(size_t(width) * height, 0.0f);
+    std::vector<int> index(size_t(width) * height, -1);
+    RasterizeTiles(bins, [&](int i, int x0, int y0, int x1, int y1) {
+        float iz = screen.inv_z_[i];
+        for (int y = y0; y <= y1; y++) {
+            for (int x = x0; x <= x1; x++) {
+                size_t p = size_t(y) * width + x;
+                if (iz > inv_depth[p] || (iz == inv_depth[p] && i < index[p])) {
+                    inv_depth[p] = iz;
+                    index[p] = i;
+                }
+            }
+        }
+    });
+
+    std::shared_ptr<Image> depth, color, index_image;
+    std::tie(depth, color, index_image) =
+            CreateOutputImages(width, height, inv_depth, index);
+    bool has_colors = pointcloud.HasColors();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int p = 0; p < width * height; p++) {
+        uint8_t* rgb = color->data_.data() + size_t(p) * 3;
+        int i = index[p];
+        for (int k = 0; k < 3; k++) {
+            rgb[k] = i < 0 ? 0
+                           : (has_colors ? ColorToByte(pointcloud.colors_[i](k))
+                                         : 255);
+        }
+    }
+    return std::make_tuple(depth, color, index_image);
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <tuple>
+
+namespace open3d {
+
+namespace camera {
+class PinholeCameraParameters;
+}
+
+namespace geometry {
+
+class Image;
+class PointCloud;
+class TriangleMesh;
+
+/// \class RasterizerOption
+///
+/// \brief Options for the CPU rasterizer.
+class RasterizerOption {
+public:
+    RasterizerOption(int tile_size = 32,
+                     int point_size = 1,
+                     bool cull_back_faces = false,
+                     double near_plane = 1e-3)
+        : tile_size_(tile_size),
+          point_size_(point_size),
+          cull_back_faces_(cull_back_faces),
+          near_plane_(near_plane) {}
+    ~RasterizerOption() {}
+
+public:
+    /// Side length in pixels of the square screen tiles primitives are
+    /// binned into. Each tile is rasterized by a single thread.
+    int tile_size_;
+    /// Side length in pixels of the square splat drawn for each point.
+    int point_size_;
+    /// If true, triangles facing away from the camera are not drawn.
+    bool cull_back_faces_;
+    /// Primitives with a vertex closer to the camera than near_plane (in
+    /// meters) are not drawn. Triangles are not clipped.
+    double near_plane_;
+};
+
+/// \brief Function to render a triangle mesh on the CPU without an OpenGL
+/// context.
+///
+/// Triangles are binned into screen tiles, and the tiles are rasterized in
+/// parallel with a depth test. Pixel centers are at integer coordinates, as
+/// in PointCloud::CreateFromDepthImage, and a top-left fill rule makes shared
+/// edges watertight. The image size is taken from the camera intrinsic.
+///
+/// \param mesh The mesh to render.
+/// \param camera Intrinsic and extrinsic parameters of the camera.
+/// \param option Rasterizer options.
+/// \return Tuple of the depth image (one float channel holding the camera
+/// space z in meters, 0 where nothing was drawn), the color image (three
+/// 1-byte channels with perspective-correct interpolated vertex colors, or
+/// white if the mesh has none) and the index image (one int channel holding
+/// the triangle index, -1 where nothing was drawn).
+std::tuple<std::shared_ptr<Image>,
+           std::shared_ptr<Image>,
+           std::shared_ptr<Image>>
+RasterizeTriangleMesh(const TriangleMesh& mesh,
+                      const camera::PinholeCameraParameters& camera,
+                      const RasterizerOption& option = RasterizerOption());
+
+/// \brief Function to render a point cloud on the CPU without an OpenGL
+/// context.
+///
+/// Every point is drawn as a square of RasterizerOption::point_size_ pixels
+/// around its rounded projection, at the depth of the point.
+///
+/// \param pointcloud The point cloud to render.
+/// \param camera Intrinsic and extrinsic parameters of the camera.
+/// \param option Rasterizer options.
+/// \return Tuple of the depth, color and index images as in
+/// RasterizeTriangleMesh, with point indices in the index image.
+std::tuple<std::shared_ptr<Image>,
+           std::shared_ptr<Image>,
+           std::shared_ptr<Image>>
+RasterizePointCloud(const PointCloud& pointcloud,
+                    const camera::PinholeCameraParameters& camera,
+                    const RasterizerOption& option = RasterizerOption());
+
+}  // namespace geometry
+}  // namespace open3d
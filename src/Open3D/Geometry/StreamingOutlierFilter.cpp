@@ -0,0 +1,222 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/StreamingOutlierFilter.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+StreamingOutlierFilter::StreamingOutlierFilter(FilterType filter_type,
+                                               size_t nb_points,
+                                               double parameter,
+                                               double halo_width /* = 0.0*/)
+    : filter_type_(filter_type),
+      nb_points_(nb_points),
+      parameter_(parameter),
+      halo_width_(halo_width) {
+    if (nb_points < 1 || parameter <= 0) {
+        utility::LogError(
+                "[StreamingOutlierFilter] Illegal input parameters, number of "
+                "points and radius or standard deviation ratio must be "
+                "positive");
+    }
+    if (filter_type_ == FilterType::Radius) {
+        halo_width_ = std::max(halo_width_, parameter_);
+    } else if (halo_width_ <= 0) {
+        utility::LogError(
+                "[StreamingOutlierFilter] The statistical filter requires a "
+                "positive halo width");
+    }
+}
+
+StreamingOutlierFilter::~StreamingOutlierFilter() {}
+
+void StreamingOutlierFilter::AddChunk(const PointCloud &chunk) {
+    if (pass_ >= NumPasses()) {
+        utility::LogError(
+                "[StreamingOutlierFilter] All passes have been finished.");
+    }
+    if (has_pending_) {
+        std::vector<Eigen::Vector3d> upper_halo;
+        std::vector<Eigen::Vector3d> lower_halo;
+        if (!pending_points_.empty() && chunk.HasPoints()) {
+            CollectHalo(chunk.points_, pending_min_bound_, pending_max_bound_,
+                        upper_halo);
+            CollectHalo(pending_points_, chunk.GetMinBound(),
+                        chunk.GetMaxBound(), lower_halo);
+        }
+        ProcessPendingChunk(upper_halo);
+        pending_lower_halo_ = std::move(lower_halo);
+    } else {
+        pending_lower_halo_.clear();
+    }
+    pending_points_ = chunk.points_;
+    pending_min_bound_ = chunk.GetMinBound();
+    pending_max_bound_ = chunk.GetMaxBound();
+    has_pending_ = true;
+}
+
+void StreamingOutlierFilter::Finish() {
+    if (has_pending_) {
+        ProcessPendingChunk(std::vector<Eigen::Vector3d>());
+    }
+    has_pending_ = false;
+    pending_points_.clear();
+    pending_lower_halo_.clear();
+    chunk_index_ = 0;
+
+    if (filter_type_ == FilterType::Statistical && pass_ == 0) {
+        if (valid_distances_ > 1) {
+            double mean = distance_sum_ / valid_distances_;
+            // Sum of squared deviations of the positive distances, expanded
+            // so that it can be accumulated in a single pass.
+            double sq_sum = distance_sq_sum_ - 2.0 * mean * distance_sum_ +
+                            positive_distances_ * mean * mean;
+            // Bessel's correction
+            double std_dev =
+                    std::sqrt(std::max(sq_sum, 0.0) / (valid_distances_ - 1));
+            distance_threshold_ = mean + parameter_ * std_dev;
+        } else {
+            distance_threshold_ = 0.0;
+        }
+    }
+    pass_++;
+}
+
+void StreamingOutlierFilter::CollectHalo(
+        const std::vector<Eigen::Vector3d> &points,
+        const Eigen::Vector3d &min_bound,
+        const Eigen::Vector3d &max_bound,
+        std::vector<Eigen::Vector3d> &halo) const {
+    Eigen::Vector3d halo_min = min_bound.array() - halo_width_;
+    Eigen::Vector3d halo_max = max_bound.array() + halo_width_;
+    for (const auto &point : points) {
+        if ((point.array() >= halo_min.array()).all() &&
+            (point.array() <= halo_max.array()).all()) {
+            halo.push_back(point);
+        }
+    }
+}
+
+void StreamingOutlierFilter::ProcessPendingChunk(
+        const std::vector<Eigen::Vector3d> &upper_halo) {
+    bool report = pass_ == NumPasses() - 1;
+    int num_points = int(pending_points_.size());
+    if (num_points == 0) {
+        if (report && mask_callback_) {
+            mask_callback_(chunk_index_, std::vector<bool>());
+        }
+        chunk_index_++;
+        return;
+    }
+
+    PointCloud work;
+    work.points_.reserve(pending_points_.size() + pending_lower_halo_.size() +
+                         upper_halo.size());
+    work.points_.insert(work.points_.end(), pending_points_.begin(),
+                        pending_points_.end());
+    work.points_.insert(work.points_.end(), pending_lower_halo_.begin(),
+                        pending_lower_halo_.end());
+    work.points_.insert(work.points_.end(), upper_halo.begin(),
+                        upper_halo.end());
+    KDTreeFlann kdtree;
+    kdtree.SetGeometry(work);
+
+    // Average neighbor distance for the statistical filter, neighbor count
+    // for the radius filter.
+    std::vector<double> values(num_points);
+    size_t valid_distances = 0;
+    size_t positive_distances = 0;
+    double distance_sum = 0.0;
+    double distance_sq_sum = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel reduction(+ : valid_distances, positive_distances, \
+                               distance_sum, distance_sq_sum)
+    {
+#endif
+        std::vector<int> tmp_indices;
+        std::vector<double> dist;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int i = 0; i < num_points; i++) {
+            if (filter_type_ == FilterType::Radius) {
+                values[i] = kdtree.SearchHybrid(work.points_[i], parameter_,
+                                                int(nb_points_) + 1,
+                                                tmp_indices, dist);
+                continue;
+            }
+            kdtree.SearchKNN(work.points_[i], int(nb_points_), tmp_indices,
+                             dist);
+            double mean = -1.0;
+            if (dist.size() > 0u) {
+                double sum = 0.0;
+                for (double d : dist) {
+                    sum += std::sqrt(d);
+                }
+                mean = sum / dist.size();
+                valid_distances++;
+                distance_sum += mean;
+                if (mean > 0) {
+                    positive_distances++;
+                    distance_sq_sum += mean * mean;
+                }
+            }
+            values[i] = mean;
+        }
+#ifdef _OPENMP
+    }
+#endif
+
+    if (filter_type_ == FilterType::Statistical && pass_ == 0) {
+        valid_distances_ += valid_distances;
+        positive_distances_ += positive_distances;
+        distance_sum_ += distance_sum;
+        distance_sq_sum_ += distance_sq_sum;
+    }
+    if (report && mask_callback_) {
+        std::vector<bool> mask(num_points);
+        for (int i = 0; i < num_points; i++) {
+            if (filter_type_ == FilterType::Radius) {
+                mask[i] = values[i] > double(nb_points_);
+            } else {
+                mask[i] = values[i] > 0 && values[i] < distance_threshold_;
+            }
+        }
+        mask_callback_(chunk_index_, mask);
+    }
+    chunk_index_++;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,145 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+
+/// \class StreamingOutlierFilter
+///
+/// \brief Out-of-core counterpart of PointCloud::RemoveRadiusOutliers and
+/// PointCloud::RemoveStatisticalOutliers.
+///
+/// The cloud is streamed as a sequence of spatially coherent chunks, e.g.
+/// slabs or tiles sorted along one axis. Neighbors of a chunk are searched in
+/// the chunk itself plus a halo made of the points of the previous and the
+/// next chunk that lie within \p halo_width of the chunk bounds. Only three
+/// chunks are held in memory at any time. The mask of a chunk is therefore
+/// reported through the mask callback once the following chunk has been added,
+/// or when Finish() is called for the last chunk.
+///
+/// The radius filter clamps the halo width to at least the search radius.
+/// It reproduces the result of the in-core filter exactly as long as every
+/// point within the search radius of a chunk lies in that chunk or in the
+/// previous or next one, e.g. for slabs that are at least one search radius
+/// thick. Thinner chunks lose the neighbors beyond the adjacent chunks and
+/// may mark inliers as outliers. The statistical filter needs the
+/// global mean and standard deviation of the neighbor distances, so the
+/// chunks have to be streamed twice: the first pass accumulates the statistics
+/// and the second pass reports the masks. Its result is exact if \p halo_width
+/// is larger than the distance to the furthest of the \p nb_neighbors nearest
+/// neighbors of every point.
+class StreamingOutlierFilter {
+public:
+    enum class FilterType {
+        Radius = 0,
+        Statistical = 1,
+    };
+
+    /// Callback receiving the index of a chunk in the stream and its inlier
+    /// mask.
+    typedef std::function<void(size_t, const std::vector<bool> &)>
+            MaskCallback;
+
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param filter_type Radius or statistical filter.
+    /// \param nb_points Number of points within the radius for the radius
+    /// filter, number of neighbors for the statistical filter.
+    /// \param parameter Search radius for the radius filter, standard
+    /// deviation ratio for the statistical filter.
+    /// \param halo_width Width of the halo kept around each chunk. The radius
+    /// filter uses at least the search radius.
+    StreamingOutlierFilter(FilterType filter_type,
+                           size_t nb_points,
+                           double parameter,
+                           double halo_width = 0.0);
+    ~StreamingOutlierFilter();
+
+public:
+    /// Sets the function that receives the chunk masks.
+    void SetMaskCallback(const MaskCallback &callback) {
+        mask_callback_ = callback;
+    }
+    /// Returns the number of times the chunks have to be streamed.
+    int NumPasses() const {
+        return filter_type_ == FilterType::Statistical ? 2 : 1;
+    }
+    /// Returns the current pass.
+    int GetPass() const { return pass_; }
+
+    /// \brief Adds the next chunk of the stream.
+    ///
+    /// \param chunk Points of the chunk. Only `points_` are used.
+    void AddChunk(const PointCloud &chunk);
+    /// Ends the current pass and flushes the last chunk.
+    void Finish();
+
+    /// Returns the threshold on the average neighbor distance computed by the
+    /// first pass of the statistical filter.
+    double GetDistanceThreshold() const { return distance_threshold_; }
+
+protected:
+    void ProcessPendingChunk(const std::vector<Eigen::Vector3d> &upper_halo);
+    void CollectHalo(const std::vector<Eigen::Vector3d> &points,
+                     const Eigen::Vector3d &min_bound,
+                     const Eigen::Vector3d &max_bound,
+                     std::vector<Eigen::Vector3d> &halo) const;
+
+protected:
+    FilterType filter_type_;
+    size_t nb_points_;
+    double parameter_;
+    double halo_width_;
+    MaskCallback mask_callback_;
+
+    int pass_ = 0;
+    size_t chunk_index_ = 0;
+    bool has_pending_ = false;
+    std::vector<Eigen::Vector3d> pending_points_;
+    Eigen::Vector3d pending_min_bound_;
+    Eigen::Vector3d pending_max_bound_;
+    std::vector<Eigen::Vector3d> pending_lower_halo_;
+
+    // Statistics of the average neighbor distances of the statistical filter.
+    size_t valid_distances_ = 0;
+    size_t positive_distances_ = 0;
+    double distance_sum_ = 0.0;
+    double distance_sq_sum_ = 0.0;
+    double distance_threshold_ = 0.0;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -32,12 +32,255 @@
 
 #include <Eigen/Dense>
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <list>
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Computes the circumcenter and the circumradius of a tetra from the
+/// determinants of its lifted vertices. Returns false for a flat tetra.
+bool ComputeTetraCircumsphere(const std::vector<Eigen::Vector3d>& verts,
+                              const std::vector<double>& vsqn,
+                              const Eigen::Vector4i& tetra,
+                              Eigen::Vector3d& center,
+                              double& radius) {
+    // clang-format off
+    Eigen::Matrix4d tmp;
+    tmp << verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2), 1,
+            verts[tetra(1)](0), verts[tetra(1)](1), verts[tetra(1)](2), 1,
+            verts[tetra(2)](0), verts[tetra(2)](1), verts[tetra(2)](2), 1,
+            verts[tetra(3)](0), verts[tetra(3)](1), verts[tetra(3)](2), 1;
+    double a = tmp.determinant();
+    tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2),
+            vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](1), verts[tetra(1)](2),
+            vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](1), verts[tetra(2)](2),
+            vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](1), verts[tetra(3)](2);
+    double c = tmp.determinant();
+    tmp << vsqn[tetra(0)], verts[tetra(0)](1), verts[tetra(0)](2), 1,
+            vsqn[tetra(1)], verts[tetra(1)](1), verts[tetra(1)](2), 1,
+            vsqn[tetra(2)], verts[tetra(2)](1), verts[tetra(2)](2), 1,
+            vsqn[tetra(3)], verts[tetra(3)](1), verts[tetra(3)](2), 1;
+    double dx = tmp.determinant();
+    tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](2), 1,
+            vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](2), 1,
+            vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](2), 1,
+            vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](2), 1;
+    double dy = tmp.determinant();
+    tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](1), 1,
+            vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](1), 1,
+            vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](1), 1,
+            vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](1), 1;
+    double dz = tmp.determinant();
+    // clang-format on
+    if (a == 0) {
+        return false;
+    }
+    center = Eigen::Vector3d(dx, -dy, dz) / (2 * a);
+    radius = std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
+             (2 * std::abs(a));
+    return true;
+}
+
+/// Adds the four faces of a tetra, with sorted vertex indices.
+void AddTetraFaces(int v0,
+                   int v1,
+                   int v2,
+                   int v3,
+                   std::vector<Eigen::Vector3i>& triangles) {
+    triangles.push_back(TriangleMesh::GetOrderedTriangle(v0, v1, v2));
+    triangles.push_back(TriangleMesh::GetOrderedTriangle(v0, v1, v3));
+    triangles.push_back(TriangleMesh::GetOrderedTriangle(v0, v2, v3));
+    triangles.push_back(TriangleMesh::GetOrderedTriangle(v1, v2, v3));
+}
+
+/// Keeps the faces of the alpha tetras that are not shared by two of them.
+void RemoveInnerTriangles(TriangleMesh& mesh) {
+    utility::LogDebug(
+            "[CreateFromPointCloudAlphaShape] remove triangles within "
+            "the mesh");
+    std::unordered_map<Eigen::Vector3i, int,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            triangle_count;
+    for (size_t tidx = 0; tidx < mesh.triangles_.size(); ++tidx) {
+        Eigen::Vector3i triangle = mesh.triangles_[tidx];
+        if (triangle_count.count(triangle) == 0) {
+            triangle_count[triangle] = 1;
+        } else {
+            triangle_count[triangle] += 1;
+        }
+    }
+
+    size_t to_idx = 0;
+    for (size_t tidx = 0; tidx < mesh.triangles_.size(); ++tidx) {
+        Eigen::Vector3i triangle = mesh.triangles_[tidx];
+        if (triangle_count[triangle] == 1) {
+            mesh.triangles_[to_idx] = triangle;
+            to_idx++;
+        }
+    }
+    mesh.triangles_.resize(to_idx);
+    utility::LogDebug(
+            "[CreateFromPointCloudAlphaShape] done remove triangles within "
+            "the mesh");
+
+    utility::LogDebug(
+            "[CreateFromPointCloudAlphaShape] remove duplicate triangles and "
+            "unreferenced vertices");
+    mesh.RemoveDuplicatedTriangles();
+    mesh.RemoveUnreferencedVertices();
+    utility::LogDebug(
+            "[CreateFromPointCloudAlphaShape] done remove duplicate triangles "
+            "and unreferenced vertices");
+}
+
+/// Node of a kd-tree over the points. Each node owns the half-open box
+/// [min_bound_, max_bound_), the root owns the whole space. points_min_ and
+/// points_max_ bound the points of the node.
+struct AlphaShapeBlock {
+    Eigen::Vector3d min_bound_;
+    Eigen::Vector3d max_bound_;
+    Eigen::Vector3d points_min_;
+    Eigen::Vector3d points_max_;
+    int begin_;
+    int end_;
+    int left_;
+    int right_;
+};
+
+void SplitAlphaShapeBlock(const std::vector<Eigen::Vector3d>& points,
+                          int max_block_points,
+                          int node_idx,
+                          std::vector<int>& indices,
+                          std::vector<AlphaShapeBlock>& blocks) {
+    AlphaShapeBlock block = blocks[node_idx];
+    block.points_min_ = points[indices[block.begin_]];
+    block.points_max_ = block.points_min_;
+    for (int idx = block.begin_; idx < block.end_; ++idx) {
+        block.points_min_ = block.points_min_.cwiseMin(points[indices[idx]]);
+        block.points_max_ = block.points_max_.cwiseMax(points[indices[idx]]);
+    }
+    block.left_ = -1;
+    block.right_ = -1;
+    blocks[node_idx] = block;
+    if (block.end_ - block.begin_ <= max_block_points) {
+        return;
+    }
+
+    int axis;
+    (block.points_max_ - block.points_min_).maxCoeff(&axis);
+    int mid = (block.begin_ + block.end_) / 2;
+    std::nth_element(indices.begin() + block.begin_, indices.begin() + mid,
+                     indices.begin() + block.end_, [&](int a, int b) {
+                         return points[a](axis) < points[b](axis);
+                     });
+    double split = points[indices[mid]](axis);
+    if (split <= block.points_min_(axis)) {
+        // Too many identical coordinates to split further.
+        return;
+    }
+    // Points at the split coordinate may lie on both sides, which only
+    // matters for the balance of the tree.
+    AlphaShapeBlock left = block, right = block;
+    left.max_bound_(axis) = split;
+    left.end_ = mid;
+    right.min_bound_(axis) = split;
+    right.begin_ = mid;
+    blocks[node_idx].left_ = int(blocks.size());
+    blocks.push_back(left);
+    blocks[node_idx].right_ = int(blocks.size());
+    blocks.push_back(right);
+    SplitAlphaShapeBlock(points, max_block_points, blocks[node_idx].left_,
+                         indices, blocks);
+    SplitAlphaShapeBlock(points, max_block_points, blocks[node_idx].right_,
+                         indices, blocks);
+}
+
+/// Collects the points that lie within the box [min_bound, max_bound].
+void CollectAlphaShapeBlockPoints(const std::vector<Eigen::Vector3d>& points,
+                                  const std::vector<int>& indices,
+                                  const std::vector<AlphaShapeBlock>& blocks,
+                                  int node_idx,
+                                  const Eigen::Vector3d& min_bound,
+                                  const Eigen::Vector3d& max_bound,
+                                  std::vector<int>& block_indices) {
+    const AlphaShapeBlock& block = blocks[node_idx];
+    if ((block.points_min_.array() > max_bound.array()).any() ||
+        (block.points_max_.array() < min_bound.array()).any()) {
+        return;
+    }
+    if (block.left_ < 0) {
+        for (int idx = block.begin_; idx < block.end_; ++idx) {
+            const Eigen::Vector3d& point = points[indices[idx]];
+            if ((point.array() >= min_bound.array()).all() &&
+                (point.array() <= max_bound.array()).all()) {
+                block_indices.push_back(indices[idx]);
+            }
+        }
+        return;
+    }
+    CollectAlphaShapeBlockPoints(points, indices, blocks, block.left_,
+                                 min_bound, max_bound, block_indices);
+    CollectAlphaShapeBlockPoints(points, indices, blocks, block.right_,
+                                 min_bound, max_bound, block_indices);
+}
+
+/// Returns true if the points span no volume, i.e. there are fewer than
+/// four of them, they coincide, or they are collinear or coplanar. Qhull
+/// cannot tetrahedralize such a set, and it has no tetras to contribute.
+bool IsDegenerateAlphaShapeBlock(const std::vector<Eigen::Vector3d>& points) {
+    if (points.size() < 4) {
+        return true;
+    }
+    Eigen::Vector3d min_bound = points[0];
+    Eigen::Vector3d max_bound = points[0];
+    for (const auto& point : points) {
+        min_bound = min_bound.cwiseMin(point);
+        max_bound = max_bound.cwiseMax(point);
+    }
+    const double extent = (max_bound - min_bound).norm();
+    if (extent == 0) {
+        return true;
+    }
+    const double eps = 1e-12 * extent;
+
+    // Grow a simplex from the first point: the farthest point, the point
+    // farthest from their line and the point farthest from their plane.
+    const Eigen::Vector3d& p0 = points[0];
+    Eigen::Vector3d axis = Eigen::Vector3d::Zero();
+    for (const auto& point : points) {
+        if ((point - p0).squaredNorm() > axis.squaredNorm()) {
+            axis = point - p0;
+        }
+    }
+    axis.normalize();
+    Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+    double max_dist = 0;
+    for (const auto& point : points) {
+        Eigen::Vector3d n = axis.cross(point - p0);
+        if (n.norm() > max_dist) {
+            max_dist = n.norm();
+            normal = n;
+        }
+    }
+    if (max_dist <= eps) {
+        return true;
+    }
+    normal.normalize();
+    for (const auto& point : points) {
+        if (std::abs(normal.dot(point - p0)) > eps) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
         const PointCloud& pcd,
         double alpha,
@@ -82,97 +325,156 @@ std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
     utility::LogDebug(
             "[CreateFromPointCloudAlphaShape] add triangles from tetras that "
             "satisfy constraint");
-    const auto& verts = tetra_mesh->vertices_;
     for (size_t tidx = 0; tidx < tetra_mesh->tetras_.size(); ++tidx) {
         const auto& tetra = tetra_mesh->tetras_[tidx];
-        // clang-format off
-        Eigen::Matrix4d tmp;
-        tmp << verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2), 1,
-                verts[tetra(1)](0), verts[tetra(1)](1), verts[tetra(1)](2), 1,
-                verts[tetra(2)](0), verts[tetra(2)](1), verts[tetra(2)](2), 1,
-                verts[tetra(3)](0), verts[tetra(3)](1), verts[tetra(3)](2), 1;
-        double a = tmp.determinant();
-        tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2),
-                vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](1), verts[tetra(1)](2),
-                vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](1), verts[tetra(2)](2),
-                vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](1), verts[tetra(3)](2);
-        double c = tmp.determinant();
-        tmp << vsqn[tetra(0)], verts[tetra(0)](1), verts[tetra(0)](2), 1,
-                vsqn[tetra(1)], verts[tetra(1)](1), verts[tetra(1)](2), 1,
-                vsqn[tetra(2)], verts[tetra(2)](1), verts[tetra(2)](2), 1,
-                vsqn[tetra(3)], verts[tetra(3)](1), verts[tetra(3)](2), 1;
-        double dx = tmp.determinant();
-        tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](2), 1,
-                vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](2), 1,
-                vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](2), 1,
-                vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](2), 1;
-        double dy = tmp.determinant();
-        tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](1), 1,
-                vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](1), 1,
-                vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](1), 1,
-                vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](1), 1;
-        double dz = tmp.determinant();
-        // clang-format on
-        if (a == 0) {
+        Eigen::Vector3d center;
+        double r;
+        if (!ComputeTetraCircumsphere(tetra_mesh->vertices_, vsqn, tetra,
+                                      center, r)) {
             utility::LogError(
                     "[CreateFromPointCloudAlphaShape] invalid tetra in "
                     "TetraMesh");
         }
-        double r = std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
-                   (2 * std::abs(a));
 
         if (r <= alpha) {
-            mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                    tetra(0), tetra(1), tetra(2)));
-            mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                    tetra(0), tetra(1), tetra(3)));
-            mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                    tetra(0), tetra(2), tetra(3)));
-            mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                    tetra(1), tetra(2), tetra(3)));
+            AddTetraFaces(tetra(0), tetra(1), tetra(2), tetra(3),
+                          mesh->triangles_);
         }
     }
     utility::LogDebug(
             "[CreateFromPointCloudAlphaShape] done add triangles from tetras "
             "that satisfy constraint");
 
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] remove triangles within "
-            "the mesh");
-    std::unordered_map<Eigen::Vector3i, int,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            triangle_count;
-    for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-        Eigen::Vector3i triangle = mesh->triangles_[tidx];
-        if (triangle_count.count(triangle) == 0) {
-            triangle_count[triangle] = 1;
-        } else {
-            triangle_count[triangle] += 1;
-        }
+    RemoveInnerTriangles(*mesh);
+    return mesh;
+}
+
+std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
+        const PointCloud& pcd,
+        double alpha,
+        const AlphaShapeOption& option) {
+    if (option.max_block_points_ <= 0 ||
+        pcd.points_.size() <= size_t(option.max_block_points_)) {
+        return CreateFromPointCloudAlphaShape(pcd, alpha);
     }
 
-    size_t to_idx = 0;
-    for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-        Eigen::Vector3i triangle = mesh->triangles_[tidx];
-        if (triangle_count[triangle] == 1) {
-            mesh->triangles_[to_idx] = triangle;
-            to_idx++;
+    // Split the cloud into blocks with a kd-tree whose leaves partition the
+    // whole space, so that every circumcenter has exactly one owner.
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<int> indices(pcd.points_.size());
+    for (size_t pidx = 0; pidx < indices.size(); ++pidx) {
+        indices[pidx] = int(pidx);
+    }
+    std::vector<AlphaShapeBlock> blocks(1);
+    blocks[0].min_bound_ = Eigen::Vector3d::Constant(-inf);
+    blocks[0].max_bound_ = Eigen::Vector3d::Constant(inf);
+    blocks[0].begin_ = 0;
+    blocks[0].end_ = int(indices.size());
+    SplitAlphaShapeBlock(pcd.points_, option.max_block_points_, 0, indices,
+                         blocks);
+    std::vector<int> leaves;
+    for (size_t bidx = 0; bidx < blocks.size(); ++bidx) {
+        if (blocks[bidx].left_ < 0) {
+            leaves.push_back(int(bidx));
         }
     }
-    mesh->triangles_.resize(to_idx);
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done remove triangles within "
-            "the mesh");
+    utility::LogDebug("[CreateFromPointCloudAlphaShape] {:d} blocks",
+                      leaves.size());
 
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] remove duplicate triangles and "
-            "unreferenced vertices");
-    mesh->RemoveDuplicatedTriangles();
-    mesh->RemoveUnreferencedVertices();
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done remove duplicate triangles "
-            "and unreferenced vertices");
+    // The circumsphere of an alpha tetra owned by a block lies within alpha
+    // of the block. Tetrahedralizing the block together with these points
+    // therefore yields exactly the alpha tetras of the whole cloud it owns.
+    std::vector<std::vector<Eigen::Vector3i>> block_triangles(leaves.size());
+    std::string error;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int lidx = 0; lidx < int(leaves.size()); ++lidx) {
+        const AlphaShapeBlock& block = blocks[leaves[lidx]];
+        std::vector<int> block_indices;
+        CollectAlphaShapeBlockPoints(
+                pcd.points_, indices, blocks, 0,
+                block.min_bound_.array() - alpha,
+                block.max_bound_.array() + alpha, block_indices);
+        std::vector<Eigen::Vector3d> block_points(block_indices.size());
+        for (size_t idx = 0; idx < block_indices.size(); ++idx) {
+            block_points[idx] = pcd.points_[block_indices[idx]];
+        }
+        if (IsDegenerateAlphaShapeBlock(block_points)) {
+            // A flat block has no tetras of its own, so it contributes no
+            // triangles.
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            utility::LogDebug(
+                    "[CreateFromPointCloudAlphaShape] skipping degenerate "
+                    "block {:d}",
+                    lidx);
+            continue;
+        }
 
+        std::shared_ptr<TetraMesh> tetra_mesh;
+        std::vector<size_t> pt_map;
+        try {
+            std::tie(tetra_mesh, pt_map) =
+                    Qhull::ComputeDelaunayTetrahedralization(block_points);
+        } catch (const std::exception& e) {
+            // Exceptions must not leave the parallel region, so the error is
+            // reported after the loop.
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            error = e.what();
+            continue;
+        }
+        if (pt_map.empty()) {
+            // Four points are passed through without a map.
+            for (size_t idx = 0; idx < tetra_mesh->vertices_.size(); ++idx) {
+                pt_map.push_back(idx);
+            }
+        }
+
+        std::vector<double> vsqn(tetra_mesh->vertices_.size());
+        for (size_t vidx = 0; vidx < vsqn.size(); ++vidx) {
+            vsqn[vidx] = tetra_mesh->vertices_[vidx].squaredNorm();
+        }
+        for (const auto& tetra : tetra_mesh->tetras_) {
+            Eigen::Vector3d center;
+            double r;
+            if (!ComputeTetraCircumsphere(tetra_mesh->vertices_, vsqn, tetra,
+                                          center, r)) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                error = "invalid tetra in TetraMesh";
+                break;
+            }
+            if (r > alpha ||
+                (center.array() < block.min_bound_.array()).any() ||
+                (center.array() >= block.max_bound_.array()).any()) {
+                continue;
+            }
+            AddTetraFaces(block_indices[pt_map[tetra(0)]],
+                          block_indices[pt_map[tetra(1)]],
+                          block_indices[pt_map[tetra(2)]],
+                          block_indices[pt_map[tetra(3)]],
+                          block_triangles[lidx]);
+        }
+    }
+    if (!error.empty()) {
+        utility::LogError("[CreateFromPointCloudAlphaShape] {}", error);
+    }
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = pcd.points_;
+    mesh->vertex_normals_ = pcd.normals_;
+    mesh->vertex_colors_ = pcd.colors_;
+    for (auto& triangles : block_triangles) {
+        mesh->triangles_.insert(mesh->triangles_.end(), triangles.begin(),
+                                triangles.end());
+        std::vector<Eigen::Vector3i>().swap(triangles);
+    }
+    RemoveInnerTriangles(*mesh);
     return mesh;
 }
 
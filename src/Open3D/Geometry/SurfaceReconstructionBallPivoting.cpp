@@ -24,168 +24,214 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+
 #include "Open3D/Geometry/IntersectionTest.h"
-#include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
 
 #include <Eigen/Dense>
 
-#include <iostream>
-#include <list>
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <unordered_map>
 
 namespace open3d {
 namespace geometry {
 
-class BallPivotingVertex;
-class BallPivotingEdge;
-class BallPivotingTriangle;
+/// Uniform grid over the points with cells as large as the largest query
+/// radius. A search box spans two cells per axis, so it overlaps at most
+/// 3 x 3 x 3 = 27 cells. The points are stored sorted by cell to keep the
+/// searches cache friendly.
+class BallPivotingGrid {
+public:
+    BallPivotingGrid(const std::vector<Eigen::Vector3d>& points)
+        : points_(points) {}
+
+    void Build(double cell_size) {
+        cell_size_ = cell_size;
+        cell_index_.clear();
+        origin_ = Eigen::Vector3d::Zero();
+        if (points_.empty()) {
+            cell_begin_.assign(1, 0);
+            return;
+        }
+        origin_ = points_[0];
+        for (const auto& point : points_) {
+            origin_ = origin_.cwiseMin(point);
+        }
+
+        std::vector<int> point_cells(points_.size());
+        std::vector<int> cell_count;
+        for (size_t pidx = 0; pidx < points_.size(); ++pidx) {
+            auto it = cell_index_.emplace(GetCell(points_[pidx]),
+                                          int(cell_count.size()));
+            if (it.second) {
+                cell_count.push_back(0);
+            }
+            point_cells[pidx] = it.first->second;
+            cell_count[it.first->second]++;
+        }
+
+        cell_begin_.resize(cell_count.size() + 1);
+        cell_begin_[0] = 0;
+        for (size_t cidx = 0; cidx < cell_count.size(); ++cidx) {
+            cell_begin_[cidx + 1] = cell_begin_[cidx] + cell_count[cidx];
+        }
+        std::vector<int> offset(cell_begin_.begin(), cell_begin_.end() - 1);
+        sorted_indices_.resize(points_.size());
+        sorted_points_.resize(points_.size());
+        for (size_t pidx = 0; pidx < points_.size(); ++pidx) {
+            int dst = offset[point_cells[pidx]]++;
+            sorted_indices_[dst] = int(pidx);
+            sorted_points_[dst] = points_[pidx];
+        }
+    }
+
+    /// Returns the indices of all points closer than radius to query in grid
+    /// order. radius must not exceed the cell size.
+    void SearchRadius(const Eigen::Vector3d& query,
+                      double radius,
+                      std::vector<int>& indices) const {
+        indices.clear();
+        // KDTreeFlann hands the squared radius to flann as a float, round it
+        // the same way so that both searches agree on the boundary.
+        double radius2 = float(radius * radius);
+        Eigen::Vector3i lo = GetCell(query.array() - radius);
+        Eigen::Vector3i hi = GetCell(query.array() + radius);
+        for (int x = lo(0); x <= hi(0); ++x) {
+            for (int y = lo(1); y <= hi(1); ++y) {
+                for (int z = lo(2); z <= hi(2); ++z) {
+                    auto it = cell_index_.find(Eigen::Vector3i(x, y, z));
+                    if (it == cell_index_.end()) {
+                        continue;
+                    }
+                    for (int sidx = cell_begin_[it->second];
+                         sidx < cell_begin_[it->second + 1]; ++sidx) {
+                        if ((sorted_points_[sidx] - query).squaredNorm() <
+                            radius2) {
+                            indices.push_back(sorted_indices_[sidx]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /// Sorts indices by distance to query and then by index, the order in
+    /// which a KDTreeFlann radius search reports them.
+    void SortByDistance(const Eigen::Vector3d& query,
+                        std::vector<int>& indices) const {
+        std::sort(indices.begin(), indices.end(), [&](int a, int b) {
+            double da = (points_[a] - query).squaredNorm();
+            double db = (points_[b] - query).squaredNorm();
+            return da < db || (da == db && a < b);
+        });
+    }
+
+private:
+    Eigen::Vector3i GetCell(const Eigen::Vector3d& point) const {
+        Eigen::Vector3d cell = ((point - origin_) / cell_size_).array().floor();
+        return cell.cast<int>();
+    }
 
-typedef BallPivotingVertex* BallPivotingVertexPtr;
-typedef std::shared_ptr<BallPivotingEdge> BallPivotingEdgePtr;
-typedef std::shared_ptr<BallPivotingTriangle> BallPivotingTrianglePtr;
+private:
+    const std::vector<Eigen::Vector3d>& points_;
+    double cell_size_ = 1.0;
+    Eigen::Vector3d origin_;
+    std::unordered_map<Eigen::Vector3i,
+                       int,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            cell_index_;
+    std::vector<int> cell_begin_;
+    std::vector<int> sorted_indices_;
+    std::vector<Eigen::Vector3d> sorted_points_;
+};
 
+/// Vertices, edges and triangles of the front live in flat pools and refer to
+/// each other by index. The edges of a vertex form an intrusive list through
+/// BallPivotingEdge::next_.
 class BallPivotingVertex {
 public:
     enum Type { Orphan = 0, Front = 1, Inner = 2 };
 
-    BallPivotingVertex(int idx,
-                       const Eigen::Vector3d& point,
-                       const Eigen::Vector3d& normal)
-        : idx_(idx), point_(point), normal_(normal), type_(Orphan) {}
-
-    void UpdateType();
-
 public:
-    int idx_;
-    const Eigen::Vector3d& point_;
-    const Eigen::Vector3d& normal_;
-    std::unordered_set<BallPivotingEdgePtr> edges_;
-    Type type_;
+    int first_edge_ = -1;
+    Type type_ = Type::Orphan;
 };
 
 class BallPivotingEdge {
 public:
     enum Type { Border = 0, Front = 1, Inner = 2 };
 
-    BallPivotingEdge(BallPivotingVertexPtr source, BallPivotingVertexPtr target)
-        : source_(source), target_(target), type_(Type::Front) {}
+    BallPivotingEdge(int source, int target)
+        : source_(source),
+          target_(target),
+          vertices_{source, target},
+          next_{-1, -1},
+          type_(Type::Front) {}
 
-    void AddAdjacentTriangle(BallPivotingTrianglePtr triangle);
-    BallPivotingVertexPtr GetOppositeVertex();
+    int GetNextEdge(int vidx) const {
+        return vertices_[0] == vidx ? next_[0] : next_[1];
+    }
+    int GetOtherVertex(int vidx) const {
+        return vertices_[0] == vidx ? vertices_[1] : vertices_[0];
+    }
 
 public:
-    BallPivotingVertexPtr source_;
-    BallPivotingVertexPtr target_;
-    BallPivotingTrianglePtr triangle0_;
-    BallPivotingTrianglePtr triangle1_;
+    /// Oriented endpoints, swapped to agree with the first triangle.
+    int source_;
+    int target_;
+    /// Endpoints in creation order and the next edge in the edge list of each.
+    int vertices_[2];
+    int next_[2];
+    int triangle0_ = -1;
+    int triangle1_ = -1;
     Type type_;
 };
 
 class BallPivotingTriangle {
 public:
-    BallPivotingTriangle(BallPivotingVertexPtr vert0,
-                         BallPivotingVertexPtr vert1,
-                         BallPivotingVertexPtr vert2,
-                         Eigen::Vector3d ball_center)
+    BallPivotingTriangle(int vert0,
+                         int vert1,
+                         int vert2,
+                         const Eigen::Vector3d& ball_center)
         : vert0_(vert0),
           vert1_(vert1),
           vert2_(vert2),
           ball_center_(ball_center) {}
 
 public:
-    BallPivotingVertexPtr vert0_;
-    BallPivotingVertexPtr vert1_;
-    BallPivotingVertexPtr vert2_;
+    int vert0_;
+    int vert1_;
+    int vert2_;
     Eigen::Vector3d ball_center_;
 };
 
-void BallPivotingVertex::UpdateType() {
-    if (edges_.empty()) {
-        type_ = Type::Orphan;
-    } else {
-        for (const BallPivotingEdgePtr& edge : edges_) {
-            if (edge->type_ != BallPivotingEdge::Type::Inner) {
-                type_ = Type::Front;
-                return;
-            }
-        }
-        type_ = Type::Inner;
-    }
-}
-
-void BallPivotingEdge::AddAdjacentTriangle(BallPivotingTrianglePtr triangle) {
-    if (triangle != triangle0_ && triangle != triangle1_) {
-        if (triangle0_ == nullptr) {
-            triangle0_ = triangle;
-            type_ = Type::Front;
-            // update orientation
-            BallPivotingVertexPtr opp = GetOppositeVertex();
-            Eigen::Vector3d tr_norm =
-                    (target_->point_ - source_->point_)
-                            .cross(opp->point_ - source_->point_);
-            tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm =
-                    source_->normal_ + target_->normal_ + opp->normal_;
-            pt_norm /= pt_norm.norm();
-            if (pt_norm.dot(tr_norm) < 0) {
-                std::swap(target_, source_);
-            }
-        } else if (triangle1_ == nullptr) {
-            triangle1_ = triangle;
-            type_ = Type::Inner;
-        } else {
-            utility::LogDebug("!!! This case should not happen");
-        }
-    }
-}
-
-BallPivotingVertexPtr BallPivotingEdge::GetOppositeVertex() {
-    if (triangle0_ != nullptr) {
-        if (triangle0_->vert0_->idx_ != source_->idx_ &&
-            triangle0_->vert0_->idx_ != target_->idx_) {
-            return triangle0_->vert0_;
-        } else if (triangle0_->vert1_->idx_ != source_->idx_ &&
-                   triangle0_->vert1_->idx_ != target_->idx_) {
-            return triangle0_->vert1_;
-        } else {
-            return triangle0_->vert2_;
-        }
-    } else {
-        return nullptr;
-    }
-}
-
 class BallPivoting {
 public:
     BallPivoting(const PointCloud& pcd)
-        : has_normals_(pcd.HasNormals()), kdtree_(pcd) {
+        : has_normals_(pcd.HasNormals()),
+          points_(pcd.points_),
+          normals_(pcd.normals_),
+          grid_(pcd.points_),
+          vertices_(pcd.points_.size()) {
         mesh_ = std::make_shared<TriangleMesh>();
         mesh_->vertices_ = pcd.points_;
         mesh_->vertex_normals_ = pcd.normals_;
         mesh_->vertex_colors_ = pcd.colors_;
-        for (size_t vidx = 0; vidx < pcd.points_.size(); ++vidx) {
-            vertices.emplace_back(new BallPivotingVertex(static_cast<int>(vidx),
-                                                         pcd.points_[vidx],
-                                                         pcd.normals_[vidx]));
-        }
-    }
-
-    virtual ~BallPivoting() {
-        for (auto vert : vertices) {
-            delete vert;
-        }
     }
 
     bool ComputeBallCenter(int vidx1,
                            int vidx2,
                            int vidx3,
                            double radius,
-                           Eigen::Vector3d& center) {
-        const Eigen::Vector3d& v1 = vertices[vidx1]->point_;
-        const Eigen::Vector3d& v2 = vertices[vidx2]->point_;
-        const Eigen::Vector3d& v3 = vertices[vidx3]->point_;
+                           Eigen::Vector3d& center) const {
+        const Eigen::Vector3d& v1 = points_[vidx1];
+        const Eigen::Vector3d& v2 = points_[vidx2];
+        const Eigen::Vector3d& v3 = points_[vidx3];
         double c = (v2 - v1).squaredNorm();
         double b = (v1 - v3).squaredNorm();
         double a = (v3 - v2).squaredNorm();
@@ -216,9 +262,8 @@ public:
         if (height >= 0.0) {
             Eigen::Vector3d tr_norm = (v2 - v1).cross(v3 - v1);
             tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm = vertices[vidx1]->normal_ +
-                                      vertices[vidx2]->normal_ +
-                                      vertices[vidx3]->normal_;
+            Eigen::Vector3d pt_norm =
+                    normals_[vidx1] + normals_[vidx2] + normals_[vidx3];
             pt_norm /= pt_norm.norm();
             if (tr_norm.dot(pt_norm) < 0) {
                 tr_norm *= -1;
@@ -231,72 +276,122 @@ public:
         return false;
     }
 
-    BallPivotingEdgePtr GetLinkingEdge(const BallPivotingVertexPtr& v0,
-                                       const BallPivotingVertexPtr& v1) {
-        for (BallPivotingEdgePtr edge0 : v0->edges_) {
-            for (BallPivotingEdgePtr edge1 : v1->edges_) {
-                if (edge0->source_->idx_ == edge1->source_->idx_ &&
-                    edge0->target_->idx_ == edge1->target_->idx_) {
-                    return edge0;
-                }
+    int GetLinkingEdge(int v0, int v1) const {
+        for (int eidx = vertices_[v0].first_edge_; eidx >= 0;
+             eidx = edges_[eidx].GetNextEdge(v0)) {
+            if (edges_[eidx].GetOtherVertex(v0) == v1) {
+                return eidx;
             }
         }
-        return nullptr;
+        return -1;
     }
 
-    void CreateTriangle(const BallPivotingVertexPtr& v0,
-                        const BallPivotingVertexPtr& v1,
-                        const BallPivotingVertexPtr& v2,
-                        const Eigen::Vector3d& center) {
-        utility::LogDebug(
-                "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}",
-                v0->idx_, v1->idx_, v2->idx_);
-        BallPivotingTrianglePtr triangle =
-                std::make_shared<BallPivotingTriangle>(v0, v1, v2, center);
-
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v1);
-        if (e0 == nullptr) {
-            e0 = std::make_shared<BallPivotingEdge>(v0, v1);
+    int GetOppositeVertex(const BallPivotingEdge& edge) const {
+        if (edge.triangle0_ < 0) {
+            return -1;
+        }
+        const BallPivotingTriangle& triangle = triangles_[edge.triangle0_];
+        if (triangle.vert0_ != edge.source_ &&
+            triangle.vert0_ != edge.target_) {
+            return triangle.vert0_;
+        } else if (triangle.vert1_ != edge.source_ &&
+                   triangle.vert1_ != edge.target_) {
+            return triangle.vert1_;
+        } else {
+            return triangle.vert2_;
         }
-        e0->AddAdjacentTriangle(triangle);
-        v0->edges_.insert(e0);
-        v1->edges_.insert(e0);
+    }
+
+    void AddAdjacentTriangle(int eidx, int tidx) {
+        BallPivotingEdge& edge = edges_[eidx];
+        if (tidx != edge.triangle0_ && tidx != edge.triangle1_) {
+            if (edge.triangle0_ < 0) {
+                edge.triangle0_ = tidx;
+                edge.type_ = BallPivotingEdge::Type::Front;
+                // update orientation
+                int opp = GetOppositeVertex(edge);
+                Eigen::Vector3d tr_norm =
+                        (points_[edge.target_] - points_[edge.source_])
+                                .cross(points_[opp] - points_[edge.source_]);
+                tr_norm /= tr_norm.norm();
+                Eigen::Vector3d pt_norm = normals_[edge.source_] +
+                                          normals_[edge.target_] +
+                                          normals_[opp];
+                pt_norm /= pt_norm.norm();
+                if (pt_norm.dot(tr_norm) < 0) {
+                    std::swap(edge.target_, edge.source_);
+                }
+            } else if (edge.triangle1_ < 0) {
+                edge.triangle1_ = tidx;
+                edge.type_ = BallPivotingEdge::Type::Inner;
+            } else {
+                utility::LogDebug("!!! This case should not happen");
+            }
+        }
+    }
 
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e1 == nullptr) {
-            e1 = std::make_shared<BallPivotingEdge>(v1, v2);
+    int GetOrCreateEdge(int v0, int v1) {
+        int eidx = GetLinkingEdge(v0, v1);
+        if (eidx < 0) {
+            eidx = int(edges_.size());
+            edges_.emplace_back(v0, v1);
+            BallPivotingEdge& edge = edges_.back();
+            edge.next_[0] = vertices_[v0].first_edge_;
+            edge.next_[1] = vertices_[v1].first_edge_;
+            vertices_[v0].first_edge_ = eidx;
+            vertices_[v1].first_edge_ = eidx;
         }
-        e1->AddAdjacentTriangle(triangle);
-        v1->edges_.insert(e1);
-        v2->edges_.insert(e1);
+        return eidx;
+    }
 
-        BallPivotingEdgePtr e2 = GetLinkingEdge(v2, v0);
-        if (e2 == nullptr) {
-            e2 = std::make_shared<BallPivotingEdge>(v2, v0);
+    void UpdateType(int vidx) {
+        BallPivotingVertex& vertex = vertices_[vidx];
+        if (vertex.first_edge_ < 0) {
+            vertex.type_ = BallPivotingVertex::Type::Orphan;
+        } else {
+            for (int eidx = vertex.first_edge_; eidx >= 0;
+                 eidx = edges_[eidx].GetNextEdge(vidx)) {
+                if (edges_[eidx].type_ != BallPivotingEdge::Type::Inner) {
+                    vertex.type_ = BallPivotingVertex::Type::Front;
+                    return;
+                }
+            }
+            vertex.type_ = BallPivotingVertex::Type::Inner;
         }
-        e2->AddAdjacentTriangle(triangle);
-        v2->edges_.insert(e2);
-        v0->edges_.insert(e2);
+    }
+
+    bool IsOrphan(int vidx) const {
+        return vertices_[vidx].type_ == BallPivotingVertex::Type::Orphan;
+    }
+
+    void CreateTriangle(int v0, int v1, int v2, const Eigen::Vector3d& center) {
+        utility::LogDebug(
+                "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}", v0,
+                v1, v2);
+        int tidx = int(triangles_.size());
+        triangles_.emplace_back(v0, v1, v2, center);
+
+        AddAdjacentTriangle(GetOrCreateEdge(v0, v1), tidx);
+        AddAdjacentTriangle(GetOrCreateEdge(v1, v2), tidx);
+        AddAdjacentTriangle(GetOrCreateEdge(v2, v0), tidx);
 
-        v0->UpdateType();
-        v1->UpdateType();
-        v2->UpdateType();
+        UpdateType(v0);
+        UpdateType(v1);
+        UpdateType(v2);
 
         Eigen::Vector3d face_normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (face_normal.dot(v0->normal_) > -1e-16) {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v1->idx_, v2->idx_));
+                ComputeFaceNormal(points_[v0], points_[v1], points_[v2]);
+        if (face_normal.dot(normals_[v0]) > -1e-16) {
+            mesh_->triangles_.emplace_back(Eigen::Vector3i(v0, v1, v2));
         } else {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v2->idx_, v1->idx_));
+            mesh_->triangles_.emplace_back(Eigen::Vector3i(v0, v2, v1));
         }
         mesh_->triangle_normals_.push_back(face_normal);
     }
 
     Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
                                       const Eigen::Vector3d& v1,
-                                      const Eigen::Vector3d& v2) {
+                                      const Eigen::Vector3d& v2) const {
         Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
         double norm = normal.norm();
         if (norm > 0) {
@@ -305,121 +400,93 @@ public:
         return normal;
     }
 
-    bool IsCompatible(const BallPivotingVertexPtr& v0,
-                      const BallPivotingVertexPtr& v1,
-                      const BallPivotingVertexPtr& v2) {
-        utility::LogDebug("[IsCompatible] v0.idx={}, v1.idx={}, v2.idx={}",
-                          v0->idx_, v1->idx_, v2->idx_);
+    bool IsCompatible(int v0, int v1, int v2) const {
         Eigen::Vector3d normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (normal.dot(v0->normal_) < -1e-16) {
+                ComputeFaceNormal(points_[v0], points_[v1], points_[v2]);
+        if (normal.dot(normals_[v0]) < -1e-16) {
             normal *= -1;
         }
-        bool ret = normal.dot(v0->normal_) > -1e-16 &&
-                   normal.dot(v1->normal_) > -1e-16 &&
-                   normal.dot(v2->normal_) > -1e-16;
-        utility::LogDebug("[IsCompatible] returns = {}", ret);
-        return ret;
+        return normal.dot(normals_[v0]) > -1e-16 &&
+               normal.dot(normals_[v1]) > -1e-16 &&
+               normal.dot(normals_[v2]) > -1e-16;
+    }
+
+    bool IsEmptyBall(const Eigen::Vector3d& center,
+                     double radius,
+                     const std::vector<int>& nb_indices,
+                     int v0,
+                     int v1,
+                     int v2) const {
+        for (int nbidx : nb_indices) {
+            if (nbidx == v0 || nbidx == v1 || nbidx == v2) {
+                continue;
+            }
+            if ((center - points_[nbidx]).norm() < radius - 1e-16) {
+                return false;
+            }
+        }
+        return true;
     }
 
-    BallPivotingVertexPtr FindCandidateVertex(
-            const BallPivotingEdgePtr& edge,
-            double radius,
-            Eigen::Vector3d& candidate_center) {
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), radius={}",
-                          edge->source_->idx_, edge->target_->idx_, radius);
-        BallPivotingVertexPtr src = edge->source_;
-        BallPivotingVertexPtr tgt = edge->target_;
-
-        const BallPivotingVertexPtr opp = edge->GetOppositeVertex();
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), opp={}",
-                          src->idx_, tgt->idx_, opp->idx_);
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", src->idx_,
-                          src->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] tgt={} => {}", tgt->idx_,
-                          tgt->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", opp->idx_,
-                          opp->point_.transpose());
-
-        Eigen::Vector3d mp = 0.5 * (src->point_ + tgt->point_);
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), mp={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          mp.transpose());
-
-        BallPivotingTrianglePtr triangle = edge->triangle0_;
-        const Eigen::Vector3d& center = triangle->ball_center_;
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), center={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          center.transpose());
-
-        Eigen::Vector3d v = tgt->point_ - src->point_;
+    bool IsCloser(const Eigen::Vector3d& query, int a, int b) const {
+        double da = (points_[a] - query).squaredNorm();
+        double db = (points_[b] - query).squaredNorm();
+        return da < db || (da == db && a < b);
+    }
+
+    int FindCandidateVertex(int eidx,
+                            double radius,
+                            std::vector<int>& indices,
+                            Eigen::Vector3d& candidate_center) const {
+        const BallPivotingEdge& edge = edges_[eidx];
+        int src = edge.source_;
+        int tgt = edge.target_;
+        int opp = GetOppositeVertex(edge);
+        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), opp={}", src,
+                          tgt, opp);
+
+        Eigen::Vector3d mp = 0.5 * (points_[src] + points_[tgt]);
+        const Eigen::Vector3d& center =
+                triangles_[edge.triangle0_].ball_center_;
+
+        Eigen::Vector3d v = points_[tgt] - points_[src];
         v /= v.norm();
 
         Eigen::Vector3d a = center - mp;
         a /= a.norm();
 
-        std::vector<int> indices;
-        std::vector<double> dists2;
-        kdtree_.SearchRadius(mp, 2 * radius, indices, dists2);
-        utility::LogDebug("[FindCandidateVertex] found {} potential candidates",
-                          indices.size());
+        grid_.SearchRadius(mp, 2 * radius, indices);
 
-        BallPivotingVertexPtr min_candidate = nullptr;
+        int min_candidate = -1;
         double min_angle = 2 * M_PI;
-        for (auto nbidx : indices) {
-            utility::LogDebug("[FindCandidateVertex] nbidx {:d}", nbidx);
-            const BallPivotingVertexPtr& candidate = vertices[nbidx];
-            if (candidate->idx_ == src->idx_ || candidate->idx_ == tgt->idx_ ||
-                candidate->idx_ == opp->idx_) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is a triangle "
-                        "vertex of the edge",
-                        candidate->idx_);
+        for (int candidate : indices) {
+            if (candidate == src || candidate == tgt || candidate == opp) {
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate={:d} => {}",
-                              candidate->idx_, candidate->point_.transpose());
 
             bool coplanar = IntersectionTest::PointsCoplanar(
-                    src->point_, tgt->point_, opp->point_, candidate->point_);
+                    points_[src], points_[tgt], points_[opp],
+                    points_[candidate]);
             if (coplanar && (IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, src->point_,
-                                     opp->point_) < 1e-12 ||
+                                     mp, points_[candidate], points_[src],
+                                     points_[opp]) < 1e-12 ||
                              IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, tgt->point_,
-                                     opp->point_) < 1e-12)) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is intersecting "
-                        "the existing triangle",
-                        candidate->idx_);
+                                     mp, points_[candidate], points_[tgt],
+                                     points_[opp]) < 1e-12)) {
                 continue;
             }
 
             Eigen::Vector3d new_center;
-            if (!ComputeBallCenter(src->idx_, tgt->idx_, candidate->idx_,
-                                   radius, new_center)) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} can not compute "
-                        "ball",
-                        candidate->idx_);
+            if (!ComputeBallCenter(src, tgt, candidate, radius, new_center)) {
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate {:d} center={}",
-                              candidate->idx_, new_center.transpose());
 
             Eigen::Vector3d b = new_center - mp;
             b /= b.norm();
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} v={}, a={}, b={}",
-                    candidate->idx_, v.transpose(), a.transpose(),
-                    b.transpose());
 
             double cosinus = a.dot(b);
             cosinus = std::min(cosinus, 1.0);
             cosinus = std::max(cosinus, -1.0);
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} cosinus={:f}",
-                    candidate->idx_, cosinus);
 
             double angle = std::acos(cosinus);
 
@@ -428,242 +495,223 @@ public:
                 angle = 2 * M_PI - angle;
             }
 
-            if (angle >= min_angle) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} angle {:f} > "
-                        "min_angle {:f}",
-                        candidate->idx_, angle, min_angle);
+            // Among equal angles the candidate closest to mp wins.
+            if (angle > min_angle ||
+                (angle == min_angle &&
+                 (min_candidate < 0 ||
+                  !IsCloser(mp, candidate, min_candidate)))) {
                 continue;
             }
 
-            bool empty_ball = true;
-            for (auto nbidx2 : indices) {
-                const BallPivotingVertexPtr& nb = vertices[nbidx2];
-                if (nb->idx_ == src->idx_ || nb->idx_ == tgt->idx_ ||
-                    nb->idx_ == candidate->idx_) {
-                    continue;
-                }
-                if ((new_center - nb->point_).norm() < radius - 1e-16) {
-                    utility::LogDebug(
-                            "[FindCandidateVertex] candidate {:d} not an empty "
-                            "ball",
-                            candidate->idx_);
-                    empty_ball = false;
-                    break;
-                }
-            }
-
-            if (empty_ball) {
-                utility::LogDebug("[FindCandidateVertex] candidate {:d} works",
-                                  candidate->idx_);
+            if (IsEmptyBall(new_center, radius, indices, src, tgt,
+                            candidate)) {
                 min_angle = angle;
-                min_candidate = vertices[nbidx];
+                min_candidate = candidate;
                 candidate_center = new_center;
             }
         }
 
-        if (min_candidate == nullptr) {
-            utility::LogDebug("[FindCandidateVertex] returns nullptr");
-        } else {
-            utility::LogDebug("[FindCandidateVertex] returns {:d}",
-                              min_candidate->idx_);
-        }
+        utility::LogDebug("[FindCandidateVertex] returns {:d}", min_candidate);
         return min_candidate;
     }
 
     void ExpandTriangulation(double radius) {
         utility::LogDebug("[ExpandTriangulation] radius={}", radius);
+        std::vector<int> indices;
         while (!edge_front_.empty()) {
-            BallPivotingEdgePtr edge = edge_front_.front();
+            int eidx = edge_front_.front();
             edge_front_.pop_front();
-            if (edge->type_ != BallPivotingEdge::Front) {
+            if (edges_[eidx].type_ != BallPivotingEdge::Front) {
                 continue;
             }
 
             Eigen::Vector3d center;
-            BallPivotingVertexPtr candidate =
-                    FindCandidateVertex(edge, radius, center);
-            if (candidate == nullptr ||
-                candidate->type_ == BallPivotingVertex::Type::Inner ||
-                !IsCompatible(candidate, edge->source_, edge->target_)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+            int candidate = FindCandidateVertex(eidx, radius, indices, center);
+            int src = edges_[eidx].source_;
+            int tgt = edges_[eidx].target_;
+            if (candidate < 0 ||
+                vertices_[candidate].type_ ==
+                        BallPivotingVertex::Type::Inner ||
+                !IsCompatible(candidate, src, tgt)) {
+                edges_[eidx].type_ = BallPivotingEdge::Type::Border;
+                border_edges_.push_back(eidx);
                 continue;
             }
 
-            BallPivotingEdgePtr e0 = GetLinkingEdge(candidate, edge->source_);
-            BallPivotingEdgePtr e1 = GetLinkingEdge(candidate, edge->target_);
-            if ((e0 != nullptr && e0->type_ != BallPivotingEdge::Type::Front) ||
-                (e1 != nullptr && e1->type_ != BallPivotingEdge::Type::Front)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+            int e0 = GetLinkingEdge(candidate, src);
+            int e1 = GetLinkingEdge(candidate, tgt);
+            if ((e0 >= 0 &&
+                 edges_[e0].type_ != BallPivotingEdge::Type::Front) ||
+                (e1 >= 0 &&
+                 edges_[e1].type_ != BallPivotingEdge::Type::Front)) {
+                edges_[eidx].type_ = BallPivotingEdge::Type::Border;
+                border_edges_.push_back(eidx);
                 continue;
             }
 
-            CreateTriangle(edge->source_, edge->target_, candidate, center);
+            CreateTriangle(src, tgt, candidate, center);
 
-            e0 = GetLinkingEdge(candidate, edge->source_);
-            e1 = GetLinkingEdge(candidate, edge->target_);
-            if (e0->type_ == BallPivotingEdge::Type::Front) {
+            e0 = GetLinkingEdge(candidate, src);
+            e1 = GetLinkingEdge(candidate, tgt);
+            if (edges_[e0].type_ == BallPivotingEdge::Type::Front) {
                 edge_front_.push_front(e0);
             }
-            if (e1->type_ == BallPivotingEdge::Type::Front) {
+            if (edges_[e1].type_ == BallPivotingEdge::Type::Front) {
                 edge_front_.push_front(e1);
             }
         }
     }
 
-    bool TryTriangleSeed(const BallPivotingVertexPtr& v0,
-                         const BallPivotingVertexPtr& v1,
-                         const BallPivotingVertexPtr& v2,
-                         const std::vector<int>& nb_indices,
-                         double radius,
-                         Eigen::Vector3d& center) {
-        utility::LogDebug(
-                "[TryTriangleSeed] v0.idx={}, v1.idx={}, v2.idx={}, "
-                "radius={}",
-                v0->idx_, v1->idx_, v2->idx_, radius);
-
-        if (!IsCompatible(v0, v1, v2)) {
-            return false;
-        }
-
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v2);
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e0 != nullptr && e0->type_ == BallPivotingEdge::Type::Inner) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} because e0 is inner edge",
-                    false);
-            return false;
-        }
-        if (e1 != nullptr && e1->type_ == BallPivotingEdge::Type::Inner) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} because e1 is inner edge",
-                    false);
-            return false;
-        }
-
-        if (!ComputeBallCenter(v0->idx_, v1->idx_, v2->idx_, radius, center)) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} could not compute ball "
-                    "center",
-                    false);
-            return false;
-        }
-
-        // test if no other point is within the ball
-        for (const auto& nbidx : nb_indices) {
-            const BallPivotingVertexPtr& v = vertices[nbidx];
-            if (v->idx_ == v0->idx_ || v->idx_ == v1->idx_ ||
-                v->idx_ == v2->idx_) {
-                continue;
-            }
-            if ((center - v->point_).norm() < radius - 1e-16) {
-                utility::LogDebug(
-                        "[TryTriangleSeed] returns {} computed ball is not "
-                        "empty",
-                        false);
-                return false;
-            }
-        }
-
-        utility::LogDebug("[TryTriangleSeed] returns {}", true);
-        return true;
-    }
-
-    bool TrySeed(BallPivotingVertexPtr& v, double radius) {
-        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
-                          radius);
-        std::vector<int> indices;
-        std::vector<double> dists2;
-        kdtree_.SearchRadius(v->point_, 2 * radius, indices, dists2);
+    /// Searches the neighborhood of the orphan vertex vidx for the first pair
+    /// of orphan vertices that forms an empty-ball seed triangle with it.
+    /// Orphans have no edges, so the result only depends on which neighbors
+    /// are orphans, and the function is safe to call concurrently.
+    bool FindSeedTriangle(int vidx,
+                          double radius,
+                          const std::vector<int>& indices,
+                          int& nb0,
+                          int& nb1,
+                          Eigen::Vector3d& center) const {
         if (indices.size() < 3u) {
             return false;
         }
-
         for (size_t nbidx0 = 0; nbidx0 < indices.size(); ++nbidx0) {
-            const BallPivotingVertexPtr& nb0 = vertices[indices[nbidx0]];
-            if (nb0->type_ != BallPivotingVertex::Type::Orphan) {
+            nb0 = indices[nbidx0];
+            if (!IsOrphan(nb0) || nb0 == vidx) {
                 continue;
             }
-            if (nb0->idx_ == v->idx_) {
-                continue;
-            }
-
-            int candidate_vidx2 = -1;
-            Eigen::Vector3d center;
             for (size_t nbidx1 = nbidx0 + 1; nbidx1 < indices.size();
                  ++nbidx1) {
-                const BallPivotingVertexPtr& nb1 = vertices[indices[nbidx1]];
-                if (nb1->type_ != BallPivotingVertex::Type::Orphan) {
-                    continue;
-                }
-                if (nb1->idx_ == v->idx_) {
+                nb1 = indices[nbidx1];
+                if (!IsOrphan(nb1) || nb1 == vidx) {
                     continue;
                 }
-                if (TryTriangleSeed(v, nb0, nb1, indices, radius, center)) {
-                    candidate_vidx2 = nb1->idx_;
-                    break;
+                if (IsCompatible(vidx, nb0, nb1) &&
+                    ComputeBallCenter(vidx, nb0, nb1, radius, center) &&
+                    IsEmptyBall(center, radius, indices, vidx, nb0, nb1)) {
+                    return true;
                 }
             }
+        }
+        return false;
+    }
 
-            if (candidate_vidx2 >= 0) {
-                const BallPivotingVertexPtr& nb1 = vertices[candidate_vidx2];
+    int CountOrphans(const std::vector<int>& indices) const {
+        int count = 0;
+        for (int nbidx : indices) {
+            count += IsOrphan(nbidx) ? 1 : 0;
+        }
+        return count;
+    }
 
-                BallPivotingEdgePtr e0 = GetLinkingEdge(v, nb1);
-                if (e0 != nullptr &&
-                    e0->type_ != BallPivotingEdge::Type::Front) {
-                    continue;
-                }
-                BallPivotingEdgePtr e1 = GetLinkingEdge(nb0, nb1);
-                if (e1 != nullptr &&
-                    e1->type_ != BallPivotingEdge::Type::Front) {
-                    continue;
-                }
-                BallPivotingEdgePtr e2 = GetLinkingEdge(v, nb0);
-                if (e2 != nullptr &&
-                    e2->type_ != BallPivotingEdge::Type::Front) {
-                    continue;
+    /// Visits the orphan vertices in index order, seeds a triangle at each one
+    /// that admits an empty ball and expands it. The seed searches of a batch
+    /// run in parallel against the state at the start of the batch. A
+    /// speculative result stays valid as long as no neighbor of the vertex
+    /// stopped being an orphan, otherwise it is recomputed, so the output does
+    /// not depend on the number of threads.
+    void FindSeedTriangles(double radius) {
+        const int n_vertices = int(vertices_.size());
+        const int batch_size = 1024;
+        std::vector<int> batch;
+        std::vector<std::vector<int>> batch_indices(batch_size);
+        std::vector<int> batch_orphans(batch_size);
+        std::vector<int> batch_found(batch_size);
+        std::vector<Eigen::Vector3i> batch_seeds(batch_size);
+        std::vector<Eigen::Vector3d> batch_centers(batch_size);
+
+        for (int begin = 0; begin < n_vertices;) {
+            batch.clear();
+            for (; begin < n_vertices && int(batch.size()) < batch_size;
+                 ++begin) {
+                if (IsOrphan(begin)) {
+                    batch.push_back(begin);
                 }
+            }
 
-                CreateTriangle(v, nb0, nb1, center);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+            for (int bidx = 0; bidx < int(batch.size()); ++bidx) {
+                int vidx = batch[bidx];
+                grid_.SearchRadius(points_[vidx], 2 * radius,
+                                   batch_indices[bidx]);
+                grid_.SortByDistance(points_[vidx], batch_indices[bidx]);
+                batch_orphans[bidx] = CountOrphans(batch_indices[bidx]);
+                batch_seeds[bidx](0) = vidx;
+                batch_found[bidx] = FindSeedTriangle(
+                        vidx, radius, batch_indices[bidx],
+                        batch_seeds[bidx](1), batch_seeds[bidx](2),
+                        batch_centers[bidx]);
+            }
 
-                e0 = GetLinkingEdge(v, nb1);
-                e1 = GetLinkingEdge(nb0, nb1);
-                e2 = GetLinkingEdge(v, nb0);
-                if (e0->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e0);
+            for (int bidx = 0; bidx < int(batch.size()); ++bidx) {
+                int v = batch[bidx];
+                if (!IsOrphan(v)) {
+                    continue;
                 }
-                if (e1->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e1);
+                if (CountOrphans(batch_indices[bidx]) != batch_orphans[bidx]) {
+                    batch_found[bidx] = FindSeedTriangle(
+                            v, radius, batch_indices[bidx],
+                            batch_seeds[bidx](1), batch_seeds[bidx](2),
+                            batch_centers[bidx]);
                 }
-                if (e2->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e2);
+                if (!batch_found[bidx]) {
+                    continue;
                 }
 
-                if (edge_front_.size() > 0) {
-                    utility::LogDebug(
-                            "[TrySeed] edge_front_.size() > 0 => return "
-                            "true");
-                    return true;
+                int nb0 = batch_seeds[bidx](1);
+                int nb1 = batch_seeds[bidx](2);
+                CreateTriangle(v, nb0, nb1, batch_centers[bidx]);
+                for (int eidx : {GetLinkingEdge(v, nb1),
+                                 GetLinkingEdge(nb0, nb1),
+                                 GetLinkingEdge(v, nb0)}) {
+                    if (edges_[eidx].type_ == BallPivotingEdge::Type::Front) {
+                        edge_front_.push_front(eidx);
+                    }
                 }
+                ExpandTriangulation(radius);
             }
         }
-
-        utility::LogDebug("[TrySeed] return false");
-        return false;
     }
 
-    void FindSeedTriangle(double radius) {
-        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
-            utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
-                              radius, vidx);
-            if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
-                if (TrySeed(vertices[vidx], radius)) {
-                    ExpandTriangulation(radius);
+    /// Moves the border edges whose triangle admits an empty ball of the new
+    /// radius back to the front.
+    void ReactivateBorderEdges(double radius) {
+        std::vector<int> reactivate(border_edges_.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int bidx = 0; bidx < int(border_edges_.size()); ++bidx) {
+            const BallPivotingTriangle& triangle =
+                    triangles_[edges_[border_edges_[bidx]].triangle0_];
+            Eigen::Vector3d center;
+            if (ComputeBallCenter(triangle.vert0_, triangle.vert1_,
+                                  triangle.vert2_, radius, center)) {
+                std::vector<int> indices;
+                grid_.SearchRadius(center, radius, indices);
+                reactivate[bidx] = 1;
+                for (int idx : indices) {
+                    if (idx != triangle.vert0_ && idx != triangle.vert1_ &&
+                        idx != triangle.vert2_) {
+                        reactivate[bidx] = 0;
+                        break;
+                    }
                 }
             }
         }
+
+        size_t n_border = 0;
+        for (size_t bidx = 0; bidx < border_edges_.size(); ++bidx) {
+            int eidx = border_edges_[bidx];
+            if (reactivate[bidx]) {
+                edges_[eidx].type_ = BallPivotingEdge::Type::Front;
+                edge_front_.push_back(eidx);
+            } else {
+                border_edges_[n_border++] = eidx;
+            }
+        }
+        border_edges_.resize(n_border);
     }
 
     std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
@@ -674,76 +722,40 @@ public:
         mesh_->triangles_.clear();
 
         for (double radius : radii) {
-            utility::LogDebug("[Run] ################################");
             utility::LogDebug("[Run] change to radius {:.4f}", radius);
             if (radius <= 0) {
                 utility::LogError(
                         "got an invalid, negative radius as parameter");
             }
 
-            // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
-                BallPivotingTrianglePtr triangle = edge->triangle0_;
-                utility::LogDebug(
-                        "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
-                        edge->source_->idx_, edge->target_->idx_,
-                        triangle->vert0_->idx_, triangle->vert1_->idx_,
-                        triangle->vert2_->idx_);
-
-                Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
-                                      triangle->vert1_->idx_,
-                                      triangle->vert2_->idx_, radius, center)) {
-                    utility::LogDebug("[Run]   yes, we can work on this");
-                    std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
-                    bool empty_ball = true;
-                    for (auto idx : indices) {
-                        if (idx != triangle->vert0_->idx_ &&
-                            idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
-                            utility::LogDebug(
-                                    "[Run]   but no, the ball is not empty");
-                            empty_ball = false;
-                            break;
-                        }
-                    }
+            grid_.Build(2 * radius);
 
-                    if (empty_ball) {
-                        utility::LogDebug(
-                                "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
-                        continue;
-                    }
-                }
-                ++it;
-            }
+            // update radius => update border edges
+            ReactivateBorderEdges(radius);
 
             // do the reconstruction
             if (edge_front_.empty()) {
-                FindSeedTriangle(radius);
+                FindSeedTriangles(radius);
             } else {
                 ExpandTriangulation(radius);
             }
 
             utility::LogDebug("[Run] mesh_ has {:d} triangles",
                               mesh_->triangles_.size());
-            utility::LogDebug("[Run] ################################");
         }
         return mesh_;
     }
 
 private:
     bool has_normals_;
-    KDTreeFlann kdtree_;
-    std::list<BallPivotingEdgePtr> edge_front_;
-    std::list<BallPivotingEdgePtr> border_edges_;
-    std::vector<BallPivotingVertexPtr> vertices;
+    const std::vector<Eigen::Vector3d>& points_;
+    const std::vector<Eigen::Vector3d>& normals_;
+    BallPivotingGrid grid_;
+    std::deque<int> edge_front_;
+    std::vector<int> border_edges_;
+    std::vector<BallPivotingVertex> vertices_;
+    std::vector<BallPivotingEdge> edges_;
+    std::vector<BallPivotingTriangle> triangles_;
     std::shared_ptr<TriangleMesh> mesh_;
 };
 
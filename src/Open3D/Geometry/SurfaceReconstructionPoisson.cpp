@@ -29,12 +29,14 @@
 #include "Open3D/Utility/Console.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
 #include <list>
+#include <memory>
 
 // clang-format off
 #include "PoissonRecon/Src/PreProcessor.h"
@@ -96,7 +98,11 @@ class Open3DPointStream
     : public InputPointStreamWithData<Real, DIMENSION, Open3DData> {
 public:
     Open3DPointStream(const open3d::geometry::PointCloud* pcd)
-        : pcd_(pcd), xform_(nullptr), current_(0) {}
+        : pcd_(pcd),
+          xform_(nullptr),
+          current_(0),
+          has_normals_(pcd->HasNormals()),
+          has_colors_(pcd->HasColors()) {}
     void reset(void) { current_ = 0; }
     bool nextPoint(Point<Real, 3>& p, Open3DData& d) {
         if (current_ >= pcd_->points_.size()) {
@@ -110,13 +116,13 @@ public:
             p = (*xform_) * p;
         }
 
-        if (pcd_->HasNormals()) {
+        if (has_normals_) {
             d.normal_ = pcd_->normals_[current_];
         } else {
             d.normal_ = Eigen::Vector3d(0, 0, 0);
         }
 
-        if (pcd_->HasColors()) {
+        if (has_colors_) {
             d.color_ = pcd_->colors_[current_];
         } else {
             d.color_ = Eigen::Vector3d(0, 0, 0);
@@ -130,6 +136,8 @@ public:
     const open3d::geometry::PointCloud* pcd_;
     XForm<Real, 4>* xform_;
     size_t current_;
+    bool has_normals_;
+    bool has_colors_;
 };
 
 template <typename _Real>
@@ -252,22 +260,18 @@ XForm<Real, Dim + 1> GetBoundingBoxXForm(Point<Real, Dim> min,
     return sXForm * tXForm;
 }
 
+// Reads the bounding box from the point cloud instead of streaming over all
+// points.
 template <class Real, unsigned int Dim>
-XForm<Real, Dim + 1> GetPointXForm(InputPointStream<Real, Dim>& stream,
-                                   Real width,
-                                   Real scaleFactor,
-                                   int& depth) {
-    Point<Real, Dim> min, max;
-    stream.boundingBox(min, max);
-    return GetBoundingBoxXForm(min, max, width, scaleFactor, depth);
-}
-
-template <class Real, unsigned int Dim>
-XForm<Real, Dim + 1> GetPointXForm(InputPointStream<Real, Dim>& stream,
-                                   Real scaleFactor) {
-    Point<Real, Dim> min, max;
-    stream.boundingBox(min, max);
-    return GetBoundingBoxXForm(min, max, scaleFactor);
+void GetPointCloudBoundingBox(const open3d::geometry::PointCloud& pcd,
+                              Point<Real, Dim>& min,
+                              Point<Real, Dim>& max) {
+    Eigen::Vector3d min_bound = pcd.GetMinBound();
+    Eigen::Vector3d max_bound = pcd.GetMaxBound();
+    for (unsigned int d = 0; d < Dim; d++) {
+        min[d] = static_cast<Real>(min_bound(d));
+        max[d] = static_cast<Real>(max_bound(d));
+    }
 }
 
 template <unsigned int Dim, typename Real>
@@ -376,6 +380,11 @@ void ExtractMesh(
 
     mesh->resetIterator();
     out_densities.clear();
+    out_densities.reserve(mesh->outOfCorePointCount());
+    out_mesh->vertices_.reserve(mesh->outOfCorePointCount());
+    out_mesh->vertex_normals_.reserve(mesh->outOfCorePointCount());
+    out_mesh->vertex_colors_.reserve(mesh->outOfCorePointCount());
+    out_mesh->triangles_.reserve(mesh->polygonCount());
     for (size_t vidx = 0; vidx < mesh->outOfCorePointCount(); ++vidx) {
         Vertex v;
         mesh->nextOutOfCorePoint(v);
@@ -404,10 +413,8 @@ template <class Real, typename... SampleData, unsigned int... FEMSigs>
 void Execute(const open3d::geometry::PointCloud& pcd,
              std::shared_ptr<open3d::geometry::TriangleMesh>& out_mesh,
              std::vector<double>& out_densities,
-             int depth,
-             size_t width,
-             float scale,
-             bool linear_fit,
+             const PoissonReconstructionOption& option,
+             PoissonReconstructionTimings& timings,
              UIntPack<FEMSigs...>) {
     static const int Dim = sizeof...(FEMSigs);
     typedef UIntPack<FEMSigs...> Sigs;
@@ -425,21 +432,42 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     XForm<Real, Dim + 1> xForm, iXForm;
     xForm = XForm<Real, Dim + 1>::Identity();
 
+    int depth = static_cast<int>(option.depth_);
+    size_t width = option.width_;
+    float scale = option.scale_;
+    bool linear_fit = option.linear_fit_;
     float datax = 32.f;
     int base_depth = 0;
     int base_v_cycles = 1;
     float confidence = 0.f;
-    float point_weight = 2.f * DEFAULT_FEM_DEGREE;
+    float point_weight = option.point_weight_;
     float confidence_bias = 0.f;
-    float samples_per_node = 1.5f;
-    float cg_solver_accuracy = 1e-3f;
-    int full_depth = 5;
-    int iters = 8;
+    float samples_per_node = option.samples_per_node_;
+    float cg_solver_accuracy = option.cg_solver_accuracy_;
+    int full_depth = option.full_depth_;
+    int iters = option.iters_;
     bool exact_interpolation = false;
 
     double startTime = Time();
+    double stageTime = startTime;
     Real isoValue = 0;
 
+    // MaxMemoryUsage() is a process-wide peak that is never reset, so the
+    // memory of this call is measured against the usage when it starts.
+    const double baseline_memory_mb = FEMTree<Dim, Real>::MemoryUsage();
+    timings.peak_memory_mb_ = 0.0;
+    auto CheckMemory = [&](const char* stage) {
+        double memory_mb =
+                FEMTree<Dim, Real>::MemoryUsage() - baseline_memory_mb;
+        timings.peak_memory_mb_ = std::max(timings.peak_memory_mb_, memory_mb);
+        if (option.max_memory_mb_ > 0 && memory_mb > option.max_memory_mb_) {
+            utility::LogError(
+                    "[CreateFromPointCloudPoisson] {} exceeded the memory "
+                    "limit: {:.1f} MB > {:.1f} MB",
+                    stage, memory_mb, option.max_memory_mb_);
+        }
+    };
+
     FEMTree<Dim, Real> tree(MEMORY_ALLOCATOR_BLOCK_SIZE);
     FEMTreeProfiler<Dim, Real> profiler(tree);
 
@@ -448,22 +476,23 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     Real pointWeightSum;
     std::vector<typename FEMTree<Dim, Real>::PointSample> samples;
     std::vector<Open3DData> sampleData;
-    DensityEstimator* density = NULL;
-    SparseNodeData<Point<Real, Dim>, NormalSigs>* normalInfo = NULL;
+    std::unique_ptr<DensityEstimator> density;
+    std::unique_ptr<SparseNodeData<Point<Real, Dim>, NormalSigs>> normalInfo;
     Real targetValue = (Real)0.5;
 
     // Read in the samples (and color data)
     {
         Open3DPointStream<Real> pointStream(&pcd);
+        Point<Real, Dim> min, max;
+        GetPointCloudBoundingBox(pcd, min, max);
 
         if (width > 0) {
-            xForm = GetPointXForm<Real, Dim>(pointStream, (Real)width,
-                                             (Real)(scale > 0 ? scale : 1.),
-                                             depth) *
+            xForm = GetBoundingBoxXForm(min, max, (Real)width,
+                                        (Real)(scale > 0 ? scale : 1.),
+                                        depth) *
                     xForm;
         } else {
-            xForm = scale > 0 ? GetPointXForm<Real, Dim>(pointStream,
-                                                         (Real)scale) *
+            xForm = scale > 0 ? GetBoundingBoxXForm(min, max, (Real)scale) *
                                         xForm
                               : xForm;
         }
@@ -513,7 +542,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     DenseNodeData<Real, Sigs> solution;
     {
         DenseNodeData<Real, Sigs> constraints;
-        InterpolationInfo* iInfo = NULL;
+        std::unique_ptr<InterpolationInfo> iInfo;
         int solveDepth = depth;
 
         tree.resetNodeIndices();
@@ -521,15 +550,16 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         // Get the kernel density estimator
         {
             profiler.start();
-            density = tree.template setDensityEstimator<WEIGHT_DEGREE>(
-                    samples, kernelDepth, samples_per_node, 1);
+            density.reset(tree.template setDensityEstimator<WEIGHT_DEGREE>(
+                    samples, kernelDepth, samples_per_node, 1));
             profiler.dumpOutput("#   Got kernel density:");
         }
 
         // Transform the Hermite samples into a vector field
         {
             profiler.start();
-            normalInfo = new SparseNodeData<Point<Real, Dim>, NormalSigs>();
+            normalInfo.reset(
+                    new SparseNodeData<Point<Real, Dim>, NormalSigs>());
             std::function<bool(Open3DData, Point<Real, Dim>&)>
                     ConversionFunction =
                             [](Open3DData in, Point<Real, Dim>& out) {
@@ -563,11 +593,11 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                     };
             if (confidence_bias > 0) {
                 *normalInfo = tree.setDataField(
-                        NormalSigs(), samples, sampleData, density,
+                        NormalSigs(), samples, sampleData, density.get(),
                         pointWeightSum, ConversionAndBiasFunction);
             } else {
                 *normalInfo = tree.setDataField(
-                        NormalSigs(), samples, sampleData, density,
+                        NormalSigs(), samples, sampleData, density.get(),
                         pointWeightSum, ConversionFunction);
             }
             ThreadPool::Parallel_for(0, normalInfo->size(),
@@ -589,9 +619,12 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                     full_depth,
                     typename FEMTree<Dim, Real>::template HasNormalDataFunctor<
                             NormalSigs>(*normalInfo),
-                    normalInfo, density);
+                    normalInfo.get(), density.get());
             profiler.dumpOutput("#       Finalized tree:");
         }
+        timings.tree_build_ = Time() - stageTime;
+        stageTime = Time();
+        CheckMemory("Tree construction");
 
         // Add the FEM constraints
         {
@@ -619,13 +652,13 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         }
 
         // Free up the normal info
-        delete normalInfo, normalInfo = NULL;
+        normalInfo.reset();
 
         // Add the interpolation constraints
         if (point_weight > 0) {
             profiler.start();
             if (exact_interpolation) {
-                iInfo = FEMTree<Dim, Real>::
+                iInfo.reset(FEMTree<Dim, Real>::
                         template InitializeExactPointInterpolationInfo<Real, 0>(
                                 tree, samples,
                                 ConstraintDual<Dim, Real>(
@@ -633,9 +666,9 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                                         (Real)point_weight * pointWeightSum),
                                 SystemDual<Dim, Real>((Real)point_weight *
                                                       pointWeightSum),
-                                true, false);
+                                true, false));
             } else {
-                iInfo = FEMTree<Dim, Real>::
+                iInfo.reset(FEMTree<Dim, Real>::
                         template InitializeApproximatePointInterpolationInfo<
                                 Real, 0>(
                                 tree, samples,
@@ -644,11 +677,12 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                                         (Real)point_weight * pointWeightSum),
                                 SystemDual<Dim, Real>((Real)point_weight *
                                                       pointWeightSum),
-                                true, 1);
+                                true, 1));
             }
             tree.addInterpolationConstraints(constraints, solveDepth, *iInfo);
             profiler.dumpOutput("#Set point constraints:");
         }
+        CheckMemory("Setting constraints");
 
         utility::LogDebug(
                 "Leaf Nodes / Active Nodes / Ghost Nodes: {} / {} / {}",
@@ -673,10 +707,11 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                                                     IsotropicUIntPack<Dim, 1>>
                     F({0., 1.});
             solution = tree.solveSystem(Sigs(), F, constraints, solveDepth,
-                                        sInfo, iInfo);
+                                        sInfo, iInfo.get());
             profiler.dumpOutput("# Linear system solved:");
-            if (iInfo) delete iInfo, iInfo = NULL;
+            iInfo.reset();
         }
+        CheckMemory("Solving");
     }
 
     {
@@ -705,6 +740,8 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         utility::LogDebug("Iso-Value: {:e} = {:e} / {:e}", isoValue, valueSum,
                           weightSum);
     }
+    timings.solve_ = Time() - stageTime;
+    stageTime = Time();
 
     auto SetVertex = [](Open3DVertex<Real>& v, Point<Real, Dim> p, Real w,
                         Open3DData d) {
@@ -716,9 +753,16 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     ExtractMesh<Open3DVertex<Real>, Real>(
             datax, linear_fit, UIntPack<FEMSigs...>(),
             std::tuple<SampleData...>(), tree, solution, isoValue, &samples,
-            &sampleData, density, SetVertex, iXForm, out_mesh, out_densities);
-
-    if (density) delete density, density = NULL;
+            &sampleData, density.get(), SetVertex, iXForm, out_mesh,
+            out_densities);
+    density.reset();
+    CheckMemory("Extraction");
+    timings.extraction_ = Time() - stageTime;
+    timings.total_ = Time() - startTime;
+
+    utility::LogDebug(
+            "Tree build / Solve / Extraction: {:.3f} / {:.3f} / {:.3f} (s)",
+            timings.tree_build_, timings.solve_, timings.extraction_);
     utility::LogDebug("#          Total Solve: {:9.1f} (s), {:9.1f} (MB)",
                       Time() - startTime, FEMTree<Dim, Real>::MaxMemoryUsage());
 }
@@ -731,6 +775,15 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
                                           size_t width,
                                           float scale,
                                           bool linear_fit) {
+    return CreateFromPointCloudPoisson(
+            pcd, PoissonReconstructionOption(depth, width, scale, linear_fit));
+}
+
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+TriangleMesh::CreateFromPointCloudPoisson(
+        const PointCloud& pcd,
+        const PoissonReconstructionOption& option,
+        PoissonReconstructionTimings* timings /* = nullptr */) {
     static const BoundaryType BType = poisson::DEFAULT_FEM_BOUNDARY;
     typedef IsotropicUIntPack<
             poisson::DIMENSION,
@@ -741,20 +794,32 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
         utility::LogError("[CreateFromPointCloudPoisson] pcd has no normals");
     }
 
+    int n_threads = option.n_threads_ > 0
+                            ? option.n_threads_
+                            : (int)std::thread::hardware_concurrency();
 #ifdef _OPENMP
     ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::OPEN_MP,
-                     std::thread::hardware_concurrency());
+                     n_threads);
 #else
     ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::THREAD_POOL,
-                     std::thread::hardware_concurrency());
+                     n_threads);
 #endif
 
     auto mesh = std::make_shared<TriangleMesh>();
     std::vector<double> densities;
-    poisson::Execute<float>(pcd, mesh, densities, static_cast<int>(depth),
-                            width, scale, linear_fit, FEMSigs());
+    PoissonReconstructionTimings stage_timings;
+    try {
+        poisson::Execute<float>(pcd, mesh, densities, option, stage_timings,
+                                FEMSigs());
+    } catch (...) {
+        ThreadPool::Terminate();
+        throw;
+    }
 
     ThreadPool::Terminate();
+    if (timings != nullptr) {
+        *timings = stage_timings;
+    }
 
     return std::make_tuple(mesh, densities);
 }
@@ -41,9 +41,162 @@
 namespace open3d {
 namespace geometry {
 
+class DeformAsRigidAsPossibleSession;
 class PointCloud;
 class TetraMesh;
 
+/// \class PoissonReconstructionOption
+///
+/// \brief Options for TriangleMesh::CreateFromPointCloudPoisson.
+class PoissonReconstructionOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param depth Maximum depth of the tree used for surface reconstruction.
+    /// \param width Target width of the finest level octree cells, ignored if
+    /// 0.
+    /// \param scale Ratio between the diameter of the cube used for
+    /// reconstruction and the diameter of the samples' bounding cube.
+    /// \param linear_fit If true, use linear interpolation to estimate the
+    /// positions of iso-vertices.
+    /// \param n_threads Number of threads, -1 uses all hardware threads.
+    /// \param iters Number of solver iterations at every depth.
+    /// \param cg_solver_accuracy Accuracy of the conjugate gradient solver.
+    /// \param samples_per_node Minimum number of samples per octree node.
+    /// \param point_weight Importance of point interpolation, 0 disables the
+    /// screening term.
+    /// \param full_depth Depth up to which the octree is complete.
+    /// \param max_memory_mb Memory limit of the reconstruction in megabytes,
+    /// checked after every stage, 0 for no limit.
+    PoissonReconstructionOption(size_t depth = 8,
+                                size_t width = 0,
+                                float scale = 1.1f,
+                                bool linear_fit = false,
+                                int n_threads = -1,
+                                int iters = 8,
+                                float cg_solver_accuracy = 1e-3f,
+                                float samples_per_node = 1.5f,
+                                float point_weight = 2.f,
+                                int full_depth = 5,
+                                double max_memory_mb = 0.0)
+        : depth_(depth),
+          width_(width),
+          scale_(scale),
+          linear_fit_(linear_fit),
+          n_threads_(n_threads),
+          iters_(iters),
+          cg_solver_accuracy_(cg_solver_accuracy),
+          samples_per_node_(samples_per_node),
+          point_weight_(point_weight),
+          full_depth_(full_depth),
+          max_memory_mb_(max_memory_mb) {}
+    ~PoissonReconstructionOption() {}
+
+public:
+    /// Maximum depth of the tree used for surface reconstruction.
+    size_t depth_;
+    /// Target width of the finest level octree cells, ignored if 0.
+    size_t width_;
+    /// Ratio between the reconstruction cube and the samples' bounding cube.
+    float scale_;
+    /// Use linear interpolation to estimate the positions of iso-vertices.
+    bool linear_fit_;
+    /// Number of threads, -1 uses all hardware threads.
+    int n_threads_;
+    /// Number of solver iterations at every depth.
+    int iters_;
+    /// Accuracy of the conjugate gradient solver.
+    float cg_solver_accuracy_;
+    /// Minimum number of samples per octree node.
+    float samples_per_node_;
+    /// Importance of point interpolation, 0 disables the screening term.
+    float point_weight_;
+    /// Depth up to which the octree is complete.
+    int full_depth_;
+    /// Memory limit of the reconstruction in megabytes, 0 for no limit. This
+    /// is a check after every stage, not a cap on allocations: the memory the
+    /// call added since it started is compared against the limit after tree
+    /// construction, constraints, solving and extraction, and the
+    /// reconstruction fails at the first check that exceeds it.
+    double max_memory_mb_;
+};
+
+/// \class PoissonReconstructionTimings
+///
+/// \brief Wall clock time in seconds spent in the stages of
+/// TriangleMesh::CreateFromPointCloudPoisson.
+class PoissonReconstructionTimings {
+public:
+    PoissonReconstructionTimings()
+        : tree_build_(0.0),
+          solve_(0.0),
+          extraction_(0.0),
+          total_(0.0),
+          peak_memory_mb_(0.0) {}
+    ~PoissonReconstructionTimings() {}
+
+public:
+    /// Octree construction, density estimation and normal field splatting.
+    double tree_build_;
+    /// Setting up the constraints and solving the linear system.
+    double solve_;
+    /// Iso-surface extraction and conversion to TriangleMesh.
+    double extraction_;
+    /// Total reconstruction time.
+    double total_;
+    /// Largest memory added by the call over its usage when it started, in
+    /// megabytes, sampled after every stage.
+    double peak_memory_mb_;
+};
+
+/// \class QuadricDecimationOption
+///
+/// \brief Options for the parallel TriangleMesh::SimplifyQuadricDecimation.
+class QuadricDecimationOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param partition_size Approximate number of triangles per spatial
+    /// partition. Partitions are decimated in parallel, 0 decimates the mesh
+    /// as a single partition.
+    /// \param preserve_topology If true, edges whose collapse would change
+    /// the topology of the mesh are not collapsed.
+    QuadricDecimationOption(int partition_size = 100000,
+                            bool preserve_topology = true)
+        : partition_size_(partition_size),
+          preserve_topology_(preserve_topology) {}
+    ~QuadricDecimationOption() {}
+
+public:
+    /// Approximate number of triangles per spatial partition, 0 for a single
+    /// partition.
+    int partition_size_;
+    /// Reject edge collapses that violate the link condition or pinch the
+    /// boundary.
+    bool preserve_topology_;
+};
+
+/// \class AlphaShapeOption
+///
+/// \brief Options for the tiled TriangleMesh::CreateFromPointCloudAlphaShape.
+class AlphaShapeOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_block_points Maximum number of points per spatial block.
+    /// Blocks are tetrahedralized in parallel, 0 tetrahedralizes the whole
+    /// cloud at once.
+    AlphaShapeOption(int max_block_points = 1000000)
+        : max_block_points_(max_block_points) {}
+    ~AlphaShapeOption() {}
+
+public:
+    /// Maximum number of points per spatial block, not counting the points
+    /// within alpha of the block that are tetrahedralized with it. 0 for a
+    /// single block.
+    int max_block_points_;
+};
+
 /// \class TriangleMesh
 ///
 /// \brief Triangle mesh contains vertices and triangles represented by the
@@ -415,6 +568,21 @@ public:
     std::shared_ptr<TriangleMesh> SimplifyQuadricDecimation(
             int target_number_of_triangles) const;
 
+    /// \brief Function to simplify mesh using Quadric Error Metric Decimation
+    /// in parallel.
+    ///
+    /// The mesh is split into spatial partitions that are decimated in
+    /// parallel with the vertices on their seams locked, and a final pass over
+    /// the whole mesh collapses the remaining edges including the seams.
+    ///
+    /// \param target_number_of_triangles defines the number of triangles that
+    /// the simplified mesh should have. It is not guranteed that this number
+    /// will be reached.
+    /// \param option Partitioning and topology options.
+    std::shared_ptr<TriangleMesh> SimplifyQuadricDecimation(
+            int target_number_of_triangles,
+            const QuadricDecimationOption &option) const;
+
     /// Function to select points from \param input TriangleMesh into
     /// output TriangleMesh
     /// Vertices with indices in \param indices are selected.
@@ -514,6 +682,25 @@ public:
             std::shared_ptr<TetraMesh> tetra_mesh = nullptr,
             std::vector<size_t> *pt_map = nullptr);
 
+    /// \brief Computes the alpha shape block by block, so that each Delaunay
+    /// tetrahedralization covers one block instead of the whole cloud.
+    ///
+    /// The cloud is split into blocks of at most option.max_block_points_
+    /// points. Each block is tetrahedralized in parallel together with the
+    /// points within alpha of it and keeps the tetras whose circumcenter lies
+    /// in the block. Blocks with fewer than four points or without volume are
+    /// skipped. For points in general position the result equals the one of
+    /// a single tetrahedralization.
+    /// \param pcd PointCloud for what the alpha shape should be computed.
+    /// \param alpha parameter to control the shape. A very big value will
+    /// give a shape close to the convex hull.
+    /// \param option Controls the block size.
+    /// \return TriangleMesh of the alpha shape.
+    static std::shared_ptr<TriangleMesh> CreateFromPointCloudAlphaShape(
+            const PointCloud &pcd,
+            double alpha,
+            const AlphaShapeOption &option);
+
     /// Function that computes a triangle mesh from a oriented PointCloud \param
     /// pcd. This implements the Ball Pivoting algorithm proposed in F.
     /// Bernardini et al., "The ball-pivoting algorithm for surface
@@ -557,6 +744,20 @@ public:
                                 float scale = 1.1f,
                                 bool linear_fit = false);
 
+    /// \brief Function that computes a triangle mesh from a oriented PointCloud
+    /// pcd with Screened Poisson Reconstruction, see the overload above.
+    ///
+    /// \param pcd PointCloud with normals and optionally colors.
+    /// \param option Reconstruction and solver options.
+    /// \param timings If not nullptr, receives the time spent per stage.
+    /// \return The estimated TriangleMesh, and per vertex densitie values that
+    /// can be used to to trim the mesh.
+    static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+    CreateFromPointCloudPoisson(
+            const PointCloud &pcd,
+            const PoissonReconstructionOption &option,
+            PoissonReconstructionTimings *timings = nullptr);
+
     /// Factory function to create a tetrahedron mesh (trianglemeshfactory.cpp).
     /// the mesh centroid will be at (0,0,0) and \param radius defines the
     /// distance from the center to the mesh vertices.
@@ -696,6 +897,8 @@ public:
                                                        double scale = 1);
 
 protected:
+    friend class DeformAsRigidAsPossibleSession;
+
     // Forward child class type to avoid indirect nonvirtual base
     TriangleMesh(Geometry::GeometryType type) : MeshBase(type) {}
 
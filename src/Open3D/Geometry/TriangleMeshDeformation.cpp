@@ -24,188 +24,286 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshDeformation.h"
 
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
 #include <algorithm>
 
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Timer.h"
 
 namespace open3d {
 namespace geometry {
 
-std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
+DeformAsRigidAsPossibleSession::DeformAsRigidAsPossibleSession(
+        const TriangleMesh &mesh,
         const std::vector<int> &constraint_vertex_indices,
-        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
-        size_t max_iter,
-        DeformAsRigidAsPossibleEnergy energy_model,
-        double smoothed_alpha) const {
-    auto prime = std::make_shared<TriangleMesh>();
-    prime->vertices_ = this->vertices_;
-    prime->triangles_ = this->triangles_;
+        MeshBase::DeformAsRigidAsPossibleEnergy energy
+        /* = MeshBase::DeformAsRigidAsPossibleEnergy::Spokes*/,
+        double smoothed_alpha /* = 0.01*/)
+    : vertices_(mesh.vertices_),
+      triangles_(mesh.triangles_),
+      energy_(energy),
+      smoothed_alpha_(smoothed_alpha),
+      constraint_vertex_indices_(constraint_vertex_indices) {
+    int num_vertices = int(vertices_.size());
+    system_index_.resize(num_vertices, 0);
+    for (size_t k = 0; k < constraint_vertex_indices_.size(); ++k) {
+        int idx = constraint_vertex_indices_[k];
+        if (idx < 0 || idx >= num_vertices) {
+            utility::LogError(
+                    "[DeformAsRigidAsPossible] Constraint vertex index {:d} "
+                    "out of range.",
+                    idx);
+        }
+        system_index_[idx] = -1 - int(k);
+    }
+    for (int i = 0; i < num_vertices; ++i) {
+        if (system_index_[i] >= 0) {
+            system_index_[i] = int(free_vertices_.size());
+            free_vertices_.push_back(i);
+        }
+    }
 
     utility::LogDebug("[DeformAsRigidAsPossible] setting up S'");
-    prime->ComputeAdjacencyList();
-    auto edges_to_vertices = prime->GetEdgeToVerticesMap();
-    auto edge_weights =
-            prime->ComputeEdgeWeightsCot(edges_to_vertices, /*min_weight=*/0);
-    utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
-
-    std::unordered_map<int, Eigen::Vector3d> constraints;
-    for (size_t idx = 0; idx < constraint_vertex_indices.size() &&
-                         idx < constraint_vertex_positions.size();
-         ++idx) {
-        constraints[constraint_vertex_indices[idx]] =
-                constraint_vertex_positions[idx];
+    TriangleMesh rest;
+    rest.vertices_ = vertices_;
+    rest.triangles_ = triangles_;
+    rest.ComputeAdjacencyList();
+    auto weights = rest.ComputeEdgeWeightsCot(rest.GetEdgeToVerticesMap(),
+                                              /*min_weight=*/0);
+    if (energy_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed) {
+        surface_area_ = rest.GetSurfaceArea();
     }
-
-    double surface_area = -1;
-    // std::vector<Eigen::Matrix3d> Rs(vertices_.size(),
-    // Eigen::Matrix3d::Identity());
-    std::vector<Eigen::Matrix3d> Rs(vertices_.size());
-    std::vector<Eigen::Matrix3d> Rs_old;
-    if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-        surface_area = prime->GetSurfaceArea();
-        Rs_old.resize(vertices_.size());
+    // Sorted neighbors keep the summation order independent of hashing.
+    adjacency_begin_.resize(num_vertices + 1, 0);
+    for (int i = 0; i < num_vertices; ++i) {
+        adjacency_begin_[i + 1] =
+                adjacency_begin_[i] + int(rest.adjacency_list_[i].size());
     }
+    adjacency_.resize(adjacency_begin_[num_vertices]);
+    edge_weights_.resize(adjacency_.size());
+    for (int i = 0; i < num_vertices; ++i) {
+        auto begin = adjacency_.begin() + adjacency_begin_[i];
+        std::copy(rest.adjacency_list_[i].begin(),
+                  rest.adjacency_list_[i].end(), begin);
+        std::sort(begin, adjacency_.begin() + adjacency_begin_[i + 1]);
+        for (int e = adjacency_begin_[i]; e < adjacency_begin_[i + 1]; ++e) {
+            edge_weights_[e] =
+                    weights[TriangleMesh::GetOrderedEdge(i, adjacency_[e])];
+        }
+    }
+    utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
 
-    // Build system matrix L and its solver
+    // The constrained vertices are moved to the right hand side, which leaves
+    // a symmetric positive definite system over the free vertices.
     utility::LogDebug("[DeformAsRigidAsPossible] setting up system matrix L");
     std::vector<Eigen::Triplet<double>> triplets;
-    for (int i = 0; i < int(vertices_.size()); ++i) {
-        if (constraints.count(i) > 0) {
-            triplets.push_back(Eigen::Triplet<double>(i, i, 1));
-        } else {
-            double W = 0;
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                triplets.push_back(Eigen::Triplet<double>(i, j, -w));
-                W += w;
-            }
-            if (W > 0) {
-                triplets.push_back(Eigen::Triplet<double>(i, i, W));
+    for (int row = 0; row < int(free_vertices_.size()); ++row) {
+        int i = free_vertices_[row];
+        double W = 0;
+        for (int e = adjacency_begin_[i]; e < adjacency_begin_[i + 1]; ++e) {
+            int col = system_index_[adjacency_[e]];
+            if (col >= 0) {
+                triplets.push_back(
+                        Eigen::Triplet<double>(row, col, -edge_weights_[e]));
             }
+            W += edge_weights_[e];
+        }
+        if (W > 0) {
+            triplets.push_back(Eigen::Triplet<double>(row, row, W));
         }
     }
-    Eigen::SparseMatrix<double> L(vertices_.size(), vertices_.size());
+    Eigen::SparseMatrix<double> L(free_vertices_.size(),
+                                  free_vertices_.size());
     L.setFromTriplets(triplets.begin(), triplets.end());
     utility::LogDebug(
             "[DeformAsRigidAsPossible] done setting up system matrix L");
 
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up sparse solver");
-    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
-    solver.analyzePattern(L);
-    solver.factorize(L);
-    if (solver.info() != Eigen::Success) {
-        utility::LogError(
-                "[DeformAsRigidAsPossible] Failed to build solver (factorize)");
-    } else {
+    if (free_vertices_.empty() == false) {
+        utility::LogDebug(
+                "[DeformAsRigidAsPossible] setting up sparse solver");
+        solver_.compute(L);
+        if (solver_.info() != Eigen::Success) {
+            utility::LogError(
+                    "[DeformAsRigidAsPossible] Failed to build solver "
+                    "(factorize)");
+        }
         utility::LogDebug(
                 "[DeformAsRigidAsPossible] done setting up sparse solver");
     }
+    Reset();
+}
+
+void DeformAsRigidAsPossibleSession::Reset() {
+    deformed_vertices_ = vertices_;
+    rotations_.resize(vertices_.size());
+    previous_rotations_.resize(vertices_.size());
+    has_rotations_ = false;
+}
 
-    std::vector<Eigen::VectorXd> b = {Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size())};
+std::shared_ptr<TriangleMesh> DeformAsRigidAsPossibleSession::Deform(
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+        size_t max_iter) {
+    if (constraint_vertex_positions.size() !=
+        constraint_vertex_indices_.size()) {
+        utility::LogError(
+                "[DeformAsRigidAsPossible] Expected {:d} constraint "
+                "positions, got {:d}.",
+                constraint_vertex_indices_.size(),
+                constraint_vertex_positions.size());
+    }
+    iteration_times_.clear();
+    iteration_energies_.clear();
     for (size_t iter = 0; iter < max_iter; ++iter) {
-        if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-            std::swap(Rs, Rs_old);
-        }
+        utility::Timer timer;
+        timer.Start();
+        UpdateRotations(iter > 0 || has_rotations_);
+        UpdatePositions(constraint_vertex_positions);
+        double energy = ComputeEnergy();
+        timer.Stop();
+        iteration_times_.push_back(timer.GetDuration());
+        iteration_energies_.push_back(energy);
+        utility::LogDebug("[DeformAsRigidAsPossible] iter={}, energy={:e}",
+                          iter, energy);
+    }
+    if (max_iter > 0) {
+        has_rotations_ = true;
+    }
 
+    auto prime = std::make_shared<TriangleMesh>();
+    prime->vertices_ = deformed_vertices_;
+    prime->triangles_ = triangles_;
+    return prime;
+}
+
+void DeformAsRigidAsPossibleSession::UpdateRotations(
+        bool has_previous_rotations) {
+    bool smoothed =
+            energy_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed;
+    if (smoothed) {
+        std::swap(rotations_, previous_rotations_);
+    }
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            // Update rotations
-            Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
-            Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
-            int n_nbs = 0;
-            for (int j : prime->adjacency_list_[i]) {
-                Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
-                Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                S += w * (e0 * e1.transpose());
-                if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-                    R += Rs_old[j];
-                }
-                n_nbs++;
-            }
-            if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed &&
-                iter > 0 && n_nbs > 0) {
-                S = 2 * S +
-                    (4 * smoothed_alpha * surface_area / n_nbs) * R.transpose();
-            }
-            Eigen::JacobiSVD<Eigen::Matrix3d> svd(
-                    S, Eigen::ComputeFullU | Eigen::ComputeFullV);
-            Eigen::Matrix3d U = svd.matrixU();
-            Eigen::Matrix3d V = svd.matrixV();
-            Eigen::Vector3d D(1, 1, (V * U.transpose()).determinant());
-            // ensure rotation:
-            // http://graphics.stanford.edu/~smr/ICP/comparison/eggert_comparison_mva97.pdf
-            Rs[i] = V * D.asDiagonal() * U.transpose();
-            if (Rs[i].determinant() <= 0) {
-                utility::LogError(
-                        "[DeformAsRigidAsPossible] something went wrong with "
-                        "updating R");
+    for (int i = 0; i < int(vertices_.size()); ++i) {
+        Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
+        Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
+        int n_nbs = adjacency_begin_[i + 1] - adjacency_begin_[i];
+        for (int e = adjacency_begin_[i]; e < adjacency_begin_[i + 1]; ++e) {
+            int j = adjacency_[e];
+            Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
+            Eigen::Vector3d e1 = deformed_vertices_[i] - deformed_vertices_[j];
+            S += edge_weights_[e] * (e0 * e1.transpose());
+            if (smoothed) {
+                R += previous_rotations_[j];
             }
         }
+        if (smoothed && has_previous_rotations && n_nbs > 0) {
+            S = 2 * S + (4 * smoothed_alpha_ * surface_area_ / n_nbs) *
+                                R.transpose();
+        }
+        Eigen::JacobiSVD<Eigen::Matrix3d> svd(
+                S, Eigen::ComputeFullU | Eigen::ComputeFullV);
+        Eigen::Matrix3d U = svd.matrixU();
+        Eigen::Matrix3d V = svd.matrixV();
+        Eigen::Vector3d D(1, 1, (V * U.transpose()).determinant());
+        // ensure rotation:
+        // http://graphics.stanford.edu/~smr/ICP/comparison/eggert_comparison_mva97.pdf
+        rotations_[i] = V * D.asDiagonal() * U.transpose();
+        if (rotations_[i].determinant() <= 0) {
+            utility::LogError(
+                    "[DeformAsRigidAsPossible] something went wrong with "
+                    "updating R");
+        }
+    }
+}
 
+void DeformAsRigidAsPossibleSession::UpdatePositions(
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions) {
+    auto Position = [&](int j) -> const Eigen::Vector3d & {
+        return constraint_vertex_positions[-1 - system_index_[j]];
+    };
+    Eigen::MatrixXd b(free_vertices_.size(), 3);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            // Update Positions
-            Eigen::Vector3d bi(0, 0, 0);
-            if (constraints.count(i) > 0) {
-                bi = constraints[i];
-            } else {
-                for (int j : prime->adjacency_list_[i]) {
-                    double w = edge_weights[GetOrderedEdge(i, j)];
-                    bi += w / 2 *
-                          ((Rs[i] + Rs[j]) * (vertices_[i] - vertices_[j]));
-                }
+    for (int row = 0; row < int(free_vertices_.size()); ++row) {
+        int i = free_vertices_[row];
+        Eigen::Vector3d bi(0, 0, 0);
+        for (int e = adjacency_begin_[i]; e < adjacency_begin_[i + 1]; ++e) {
+            int j = adjacency_[e];
+            double w = edge_weights_[e];
+            bi += w / 2 * ((rotations_[i] + rotations_[j]) *
+                           (vertices_[i] - vertices_[j]));
+            if (system_index_[j] < 0) {
+                bi += w * Position(j);
             }
-            b[0](i) = bi(0);
-            b[1](i) = bi(1);
-            b[2](i) = bi(2);
         }
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int comp = 0; comp < 3; ++comp) {
-            Eigen::VectorXd p_prime = solver.solve(b[comp]);
-            if (solver.info() != Eigen::Success) {
-                utility::LogError(
-                        "[DeformAsRigidAsPossible] Cholesky solve failed");
-            }
-            for (int i = 0; i < int(vertices_.size()); ++i) {
-                prime->vertices_[i](comp) = p_prime(i);
-            }
+        b.row(row) = bi.transpose();
+    }
+    if (free_vertices_.empty() == false) {
+        Eigen::MatrixXd p_prime = solver_.solve(b);
+        if (solver_.info() != Eigen::Success) {
+            utility::LogError(
+                    "[DeformAsRigidAsPossible] Cholesky solve failed");
         }
+        for (int row = 0; row < int(free_vertices_.size()); ++row) {
+            deformed_vertices_[free_vertices_[row]] = p_prime.row(row);
+        }
+    }
+    for (int i : constraint_vertex_indices_) {
+        deformed_vertices_[i] = Position(i);
+    }
+}
 
-        // Compute energy and log
-        double energy = 0;
-        double reg = 0;
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
-                Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
-                Eigen::Vector3d diff = e1 - Rs[i] * e0;
-                energy += w * diff.squaredNorm();
-                if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-                    reg += (Rs[i] - Rs[j]).squaredNorm();
-                }
+double DeformAsRigidAsPossibleSession::ComputeEnergy() const {
+    bool smoothed =
+            energy_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed;
+    double energy = 0;
+    double reg = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : energy, reg)
+#endif
+    for (int i = 0; i < int(vertices_.size()); ++i) {
+        for (int e = adjacency_begin_[i]; e < adjacency_begin_[i + 1]; ++e) {
+            int j = adjacency_[e];
+            Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
+            Eigen::Vector3d e1 = deformed_vertices_[i] - deformed_vertices_[j];
+            Eigen::Vector3d diff = e1 - rotations_[i] * e0;
+            energy += edge_weights_[e] * diff.squaredNorm();
+            if (smoothed) {
+                reg += (rotations_[i] - rotations_[j]).squaredNorm();
             }
         }
-        if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-            energy = energy + smoothed_alpha * surface_area * reg;
-        }
-        utility::LogDebug("[DeformAsRigidAsPossible] iter={}, energy={:e}",
-                          iter, energy);
     }
+    if (smoothed) {
+        energy = energy + smoothed_alpha_ * surface_area_ * reg;
+    }
+    return energy;
+}
 
+std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
+        const std::vector<int> &constraint_vertex_indices,
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+        size_t max_iter,
+        DeformAsRigidAsPossibleEnergy energy_model,
+        double smoothed_alpha) const {
+    size_t n_constraints = std::min(constraint_vertex_indices.size(),
+                                    constraint_vertex_positions.size());
+    DeformAsRigidAsPossibleSession session(
+            *this,
+            std::vector<int>(constraint_vertex_indices.begin(),
+                             constraint_vertex_indices.begin() + n_constraints),
+            energy_model, smoothed_alpha);
+    auto prime = session.Deform(
+            std::vector<Eigen::Vector3d>(
+                    constraint_vertex_positions.begin(),
+                    constraint_vertex_positions.begin() + n_constraints),
+            max_iter);
+    prime->ComputeAdjacencyList();
     return prime;
 }
 
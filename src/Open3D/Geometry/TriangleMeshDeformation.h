@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace geometry {
+
+/// \class DeformAsRigidAsPossibleSession
+///
+/// \brief Repeated As-Rigid-As-Possible deformations of a mesh with a fixed
+/// set of constrained vertices.
+///
+/// The cotangent edge weights are stored in compressed rows and the system
+/// matrix over the unconstrained vertices is factorized once when the session
+/// is created. Each call to Deform() then only runs the iterations, starting
+/// from the positions and rotations of the previous call, which suits
+/// interactive handle dragging.
+class DeformAsRigidAsPossibleSession {
+public:
+    /// \param mesh The mesh in its rest pose. Vertices and triangles are
+    /// copied.
+    /// \param constraint_vertex_indices Indices of the vertices whose
+    /// positions are given to Deform().
+    /// \param energy Energy model that is minimized.
+    /// \param smoothed_alpha Alpha parameter of the smoothed ARAP model.
+    DeformAsRigidAsPossibleSession(
+            const TriangleMesh &mesh,
+            const std::vector<int> &constraint_vertex_indices,
+            MeshBase::DeformAsRigidAsPossibleEnergy energy =
+                    MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+            double smoothed_alpha = 0.01);
+    ~DeformAsRigidAsPossibleSession() {}
+
+public:
+    /// \brief Function to deform the mesh towards new constraint positions.
+    ///
+    /// \param constraint_vertex_positions Positions of the vertices in
+    /// constraint_vertex_indices, in the same order.
+    /// \param max_iter Number of iterations.
+    /// \return The deformed TriangleMesh.
+    std::shared_ptr<TriangleMesh> Deform(
+            const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+            size_t max_iter);
+
+    /// Function to restart the next Deform() from the rest pose.
+    void Reset();
+
+    /// Returns the time in milliseconds of each iteration of the last
+    /// Deform().
+    const std::vector<double> &GetIterationTimes() const {
+        return iteration_times_;
+    }
+
+    /// Returns the energy after each iteration of the last Deform().
+    const std::vector<double> &GetIterationEnergies() const {
+        return iteration_energies_;
+    }
+
+private:
+    void UpdateRotations(bool has_previous_rotations);
+    void UpdatePositions(
+            const std::vector<Eigen::Vector3d> &constraint_vertex_positions);
+    double ComputeEnergy() const;
+
+private:
+    std::vector<Eigen::Vector3d> vertices_;
+    std::vector<Eigen::Vector3i> triangles_;
+    MeshBase::DeformAsRigidAsPossibleEnergy energy_;
+    double smoothed_alpha_;
+    double surface_area_ = -1;
+
+    /// Neighbors of vertex i are adjacency_[adjacency_begin_[i]] to
+    /// adjacency_[adjacency_begin_[i + 1] - 1], with the cotangent weights
+    /// edge_weights_ of the edges.
+    std::vector<int> adjacency_begin_;
+    std::vector<int> adjacency_;
+    std::vector<double> edge_weights_;
+
+    std::vector<int> constraint_vertex_indices_;
+    /// Row of each vertex in the system, or -1 - k for the k-th constraint.
+    std::vector<int> system_index_;
+    /// Unconstrained vertex of each row of the system.
+    std::vector<int> free_vertices_;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver_;
+
+    std::vector<Eigen::Vector3d> deformed_vertices_;
+    std::vector<Eigen::Matrix3d> rotations_;
+    std::vector<Eigen::Matrix3d> previous_rotations_;
+    bool has_rotations_ = false;
+
+    std::vector<double> iteration_times_;
+    std::vector<double> iteration_energies_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -27,10 +27,12 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <queue>
 #include <tuple>
 
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/RadixSort.h"
 
 namespace open3d {
 namespace geometry {
@@ -548,5 +550,517 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     return mesh;
 }
 
+namespace {
+
+/// Candidate edge collapse of a partition. The candidate is stale once the
+/// stamp of one of its vertices changed.
+struct CollapseCandidate {
+    int vidx0_;
+    int vidx1_;
+    int stamp0_;
+    int stamp1_;
+    Eigen::Vector3d vbar_;
+};
+
+/// Entry of the min-heap of candidates, kept small since the heap is sifted
+/// far more often than the candidates are read.
+struct CollapseHeapEntry {
+    double cost_;
+    int candidate_;
+};
+
+struct CollapseHeapEntryGreater {
+    bool operator()(const CollapseHeapEntry &a,
+                    const CollapseHeapEntry &b) const {
+        return a.cost_ > b.cost_;
+    }
+};
+
+/// Interleaves the lowest 10 bits of \p x with two zero bits each.
+uint64_t SpreadBits10(uint64_t x) {
+    uint64_t r = 0;
+    for (int b = 0; b < 10; ++b) {
+        r |= ((x >> b) & 1) << (3 * b);
+    }
+    return r;
+}
+
+/// Edge collapse decimation on flat per-vertex and per-triangle arrays. The
+/// triangles of a partition can be decimated concurrently with the triangles
+/// of other partitions as long as the vertices shared between partitions are
+/// locked.
+class QuadricDecimator {
+public:
+    QuadricDecimator(TriangleMesh &mesh, bool preserve_topology)
+        : mesh_(mesh),
+          preserve_topology_(preserve_topology),
+          has_vert_normal_(mesh.HasVertexNormals()),
+          has_vert_color_(mesh.HasVertexColors()) {
+        const int n_vertices = int(mesh_.vertices_.size());
+        const int n_triangles = int(mesh_.triangles_.size());
+        vertex_triangles_.resize(n_vertices);
+        for (int tidx = 0; tidx < n_triangles; ++tidx) {
+            for (int k = 0; k < 3; ++k) {
+                vertex_triangles_[mesh_.triangles_[tidx](k)].push_back(tidx);
+            }
+        }
+        vertex_deleted_.resize(n_vertices, 0);
+        triangle_deleted_.resize(n_triangles, 0);
+        boundary_.resize(n_vertices, 0);
+        stamps_.resize(n_vertices, 0);
+        quadrics_.resize(n_vertices);
+
+        std::vector<Eigen::Vector4d> planes(n_triangles);
+        std::vector<double> areas(n_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int tidx = 0; tidx < n_triangles; ++tidx) {
+            planes[tidx] = mesh_.GetTrianglePlane(tidx);
+            areas[tidx] = mesh_.GetTriangleArea(tidx);
+        }
+
+        // Each vertex sums the quadrics of its triangles and of the planes
+        // perpendicular to its boundary edges.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int vidx = 0; vidx < n_vertices; ++vidx) {
+            Quadric &Q = quadrics_[vidx];
+            for (int tidx : vertex_triangles_[vidx]) {
+                Q += Quadric(planes[tidx], areas[tidx]);
+                const Eigen::Vector3i &tria = mesh_.triangles_[tidx];
+                for (int k = 0; k < 3; ++k) {
+                    int widx = tria(k);
+                    if (widx == vidx) continue;
+                    int count = 0;
+                    for (int tidx2 : vertex_triangles_[vidx]) {
+                        const Eigen::Vector3i &tria2 = mesh_.triangles_[tidx2];
+                        count += (tria2(0) == widx || tria2(1) == widx ||
+                                  tria2(2) == widx);
+                    }
+                    if (count != 1) continue;
+                    boundary_[vidx] = 1;
+                    const Eigen::Vector3d &v = mesh_.vertices_[vidx];
+                    Eigen::Vector3d n = (mesh_.vertices_[widx] - v)
+                                                .cross(planes[tidx].head<3>());
+                    double norm = n.norm();
+                    if (norm > 0) {
+                        n /= norm;
+                        Q += Quadric(Eigen::Vector4d(n(0), n(1), n(2),
+                                                     -n.dot(v)),
+                                     areas[tidx]);
+                    }
+                }
+            }
+        }
+    }
+
+    /// Collapses edges of the triangles \p triangles until at most
+    /// \p target_number_of_triangles of them remain. Edges with a vertex in
+    /// \p locked are not collapsed.
+    void Decimate(const std::vector<int> &triangles,
+                  int target_number_of_triangles,
+                  const std::vector<uint8_t> &locked) {
+        auto IsLocked = [&](int vidx) {
+            return !locked.empty() && locked[vidx] != 0;
+        };
+        int n_triangles = 0;
+        std::vector<uint64_t> edges;
+        edges.reserve(triangles.size() * 3);
+        for (int tidx : triangles) {
+            if (triangle_deleted_[tidx]) continue;
+            n_triangles++;
+            const Eigen::Vector3i &tria = mesh_.triangles_[tidx];
+            for (int k = 0; k < 3; ++k) {
+                int vidx0 = std::min(tria(k), tria((k + 1) % 3));
+                int vidx1 = std::max(tria(k), tria((k + 1) % 3));
+                if (IsLocked(vidx0) || IsLocked(vidx1)) continue;
+                edges.push_back(uint64_t(vidx0) << 32 | uint64_t(vidx1));
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+        std::vector<CollapseCandidate> candidates;
+        std::vector<CollapseHeapEntry> heap;
+        CollapseHeapEntryGreater greater;
+        auto AddCandidate = [&](int vidx0, int vidx1) {
+            CollapseHeapEntry entry;
+            entry.candidate_ = int(candidates.size());
+            candidates.push_back(ComputeCandidate(vidx0, vidx1, entry.cost_));
+            heap.push_back(entry);
+        };
+        candidates.reserve(edges.size() * 2);
+        heap.reserve(edges.size() * 2);
+        for (uint64_t edge : edges) {
+            AddCandidate(int(edge >> 32), int(edge & 0xffffffff));
+        }
+        std::make_heap(heap.begin(), heap.end(), greater);
+
+        std::vector<int> neighbors, neighbors1;
+        while (n_triangles > target_number_of_triangles && !heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), greater);
+            const CollapseCandidate candidate =
+                    candidates[heap.back().candidate_];
+            heap.pop_back();
+            int vidx0 = candidate.vidx0_;
+            int vidx1 = candidate.vidx1_;
+            if (vertex_deleted_[vidx0] || vertex_deleted_[vidx1] ||
+                stamps_[vidx0] != candidate.stamp0_ ||
+                stamps_[vidx1] != candidate.stamp1_) {
+                continue;
+            }
+            if (preserve_topology_ &&
+                !IsLinkConditionSatisfied(vidx0, vidx1, neighbors,
+                                          neighbors1)) {
+                continue;
+            }
+            if (IsFlipped(vidx0, vidx1, candidate.vbar_) ||
+                IsFlipped(vidx1, vidx0, candidate.vbar_)) {
+                continue;
+            }
+            n_triangles -= Collapse(vidx0, vidx1, candidate.vbar_);
+
+            // Only the costs of the edges of vidx0 changed.
+            GetNeighbors(vidx0, neighbors);
+            for (int widx : neighbors) {
+                if (IsLocked(widx)) continue;
+                AddCandidate(std::min(vidx0, widx), std::max(vidx0, widx));
+                std::push_heap(heap.begin(), heap.end(), greater);
+            }
+        }
+    }
+
+    /// Removes the deleted vertices and triangles from the mesh.
+    void Compact() {
+        std::vector<int> remap(mesh_.vertices_.size(), -1);
+        int next_free = 0;
+        for (size_t idx = 0; idx < mesh_.vertices_.size(); ++idx) {
+            if (vertex_deleted_[idx]) continue;
+            remap[idx] = next_free;
+            mesh_.vertices_[next_free] = mesh_.vertices_[idx];
+            if (has_vert_normal_) {
+                mesh_.vertex_normals_[next_free] = mesh_.vertex_normals_[idx];
+            }
+            if (has_vert_color_) {
+                mesh_.vertex_colors_[next_free] = mesh_.vertex_colors_[idx];
+            }
+            next_free++;
+        }
+        mesh_.vertices_.resize(next_free);
+        if (has_vert_normal_) {
+            mesh_.vertex_normals_.resize(next_free);
+        }
+        if (has_vert_color_) {
+            mesh_.vertex_colors_.resize(next_free);
+        }
+
+        next_free = 0;
+        for (size_t idx = 0; idx < mesh_.triangles_.size(); ++idx) {
+            if (triangle_deleted_[idx]) continue;
+            const Eigen::Vector3i &tria = mesh_.triangles_[idx];
+            mesh_.triangles_[next_free] =
+                    Eigen::Vector3i(remap[tria(0)], remap[tria(1)],
+                                    remap[tria(2)]);
+            next_free++;
+        }
+        mesh_.triangles_.resize(next_free);
+    }
+
+    const std::vector<std::vector<int>> &GetVertexTriangles() const {
+        return vertex_triangles_;
+    }
+
+private:
+    CollapseCandidate ComputeCandidate(int vidx0,
+                                       int vidx1,
+                                       double &cost) const {
+        CollapseCandidate candidate;
+        candidate.vidx0_ = vidx0;
+        candidate.vidx1_ = vidx1;
+        candidate.stamp0_ = stamps_[vidx0];
+        candidate.stamp1_ = stamps_[vidx1];
+        Quadric Qbar = quadrics_[vidx0] + quadrics_[vidx1];
+        if (Qbar.IsInvertible()) {
+            candidate.vbar_ = Qbar.Minimum();
+            cost = Qbar.Eval(candidate.vbar_);
+        } else {
+            const Eigen::Vector3d &v0 = mesh_.vertices_[vidx0];
+            const Eigen::Vector3d &v1 = mesh_.vertices_[vidx1];
+            Eigen::Vector3d vmid = (v0 + v1) / 2;
+            double cost0 = Qbar.Eval(v0);
+            double cost1 = Qbar.Eval(v1);
+            double costmid = Qbar.Eval(vmid);
+            cost = std::min(cost0, std::min(cost1, costmid));
+            if (cost == costmid) {
+                candidate.vbar_ = vmid;
+            } else if (cost == cost0) {
+                candidate.vbar_ = v0;
+            } else {
+                candidate.vbar_ = v1;
+            }
+        }
+        return candidate;
+    }
+
+    /// Stores the vertices adjacent to \p vidx in \p neighbors, sorted.
+    void GetNeighbors(int vidx, std::vector<int> &neighbors) const {
+        neighbors.clear();
+        for (int tidx : vertex_triangles_[vidx]) {
+            if (triangle_deleted_[tidx]) continue;
+            const Eigen::Vector3i &tria = mesh_.triangles_[tidx];
+            for (int k = 0; k < 3; ++k) {
+                if (tria(k) != vidx) neighbors.push_back(tria(k));
+            }
+        }
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                        neighbors.end());
+    }
+
+    /// The collapse keeps the mesh topology if the vertices adjacent to both
+    /// vertices are exactly the opposite vertices of the edge triangles, and
+    /// an interior edge does not connect two boundary vertices.
+    bool IsLinkConditionSatisfied(int vidx0,
+                                  int vidx1,
+                                  std::vector<int> &neighbors0,
+                                  std::vector<int> &neighbors1) const {
+        int n_edge_triangles = 0;
+        for (int tidx : vertex_triangles_[vidx0]) {
+            if (triangle_deleted_[tidx]) continue;
+            const Eigen::Vector3i &tria = mesh_.triangles_[tidx];
+            n_edge_triangles +=
+                    (tria(0) == vidx1 || tria(1) == vidx1 || tria(2) == vidx1);
+        }
+        if (n_edge_triangles == 0 || n_edge_triangles > 2) {
+            return false;
+        }
+        if (n_edge_triangles == 2 && boundary_[vidx0] && boundary_[vidx1]) {
+            return false;
+        }
+        GetNeighbors(vidx0, neighbors0);
+        GetNeighbors(vidx1, neighbors1);
+        int n_shared = 0;
+        auto it0 = neighbors0.begin();
+        auto it1 = neighbors1.begin();
+        while (it0 != neighbors0.end() && it1 != neighbors1.end()) {
+            if (*it0 < *it1) {
+                ++it0;
+            } else if (*it1 < *it0) {
+                ++it1;
+            } else {
+                n_shared++;
+                ++it0;
+                ++it1;
+            }
+        }
+        return n_shared == n_edge_triangles;
+    }
+
+    /// Returns true if moving \p vidx to \p vbar flips the normal of one of its
+    /// triangles that do not contain \p vidx_other.
+    bool IsFlipped(int vidx,
+                   int vidx_other,
+                   const Eigen::Vector3d &vbar) const {
+        for (int tidx : vertex_triangles_[vidx]) {
+            if (triangle_deleted_[tidx]) continue;
+            const Eigen::Vector3i &tria = mesh_.triangles_[tidx];
+            if (tria(0) == vidx_other || tria(1) == vidx_other ||
+                tria(2) == vidx_other) {
+                continue;
+            }
+            Eigen::Vector3d vert0 = mesh_.vertices_[tria(0)];
+            Eigen::Vector3d vert1 = mesh_.vertices_[tria(1)];
+            Eigen::Vector3d vert2 = mesh_.vertices_[tria(2)];
+            Eigen::Vector3d norm_before = (vert1 - vert0).cross(vert2 - vert0);
+            if (vidx == tria(0)) {
+                vert0 = vbar;
+            } else if (vidx == tria(1)) {
+                vert1 = vbar;
+            } else {
+                vert2 = vbar;
+            }
+            Eigen::Vector3d norm_after = (vert1 - vert0).cross(vert2 - vert0);
+            if (norm_before.dot(norm_after) < 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Collapses \p vidx1 into \p vidx0 at \p vbar and returns the number of
+    /// removed triangles.
+    int Collapse(int vidx0, int vidx1, const Eigen::Vector3d &vbar) {
+        int n_removed = 0;
+        for (int tidx : vertex_triangles_[vidx1]) {
+            if (triangle_deleted_[tidx]) continue;
+            Eigen::Vector3i &tria = mesh_.triangles_[tidx];
+            if (tria(0) == vidx0 || tria(1) == vidx0 || tria(2) == vidx0) {
+                triangle_deleted_[tidx] = 1;
+                n_removed++;
+                continue;
+            }
+            for (int k = 0; k < 3; ++k) {
+                if (tria(k) == vidx1) tria(k) = vidx0;
+            }
+            vertex_triangles_[vidx0].push_back(tidx);
+        }
+        auto &triangles0 = vertex_triangles_[vidx0];
+        triangles0.erase(std::remove_if(triangles0.begin(), triangles0.end(),
+                                        [&](int tidx) {
+                                            return triangle_deleted_[tidx] != 0;
+                                        }),
+                         triangles0.end());
+        // Removed triangles stay in the lists of their third vertices and are
+        // skipped there.
+        std::vector<int>().swap(vertex_triangles_[vidx1]);
+
+        mesh_.vertices_[vidx0] = vbar;
+        quadrics_[vidx0] += quadrics_[vidx1];
+        if (has_vert_normal_) {
+            mesh_.vertex_normals_[vidx0] = 0.5 * (mesh_.vertex_normals_[vidx0] +
+                                                  mesh_.vertex_normals_[vidx1]);
+        }
+        if (has_vert_color_) {
+            mesh_.vertex_colors_[vidx0] = 0.5 * (mesh_.vertex_colors_[vidx0] +
+                                                 mesh_.vertex_colors_[vidx1]);
+        }
+        boundary_[vidx0] = boundary_[vidx0] || boundary_[vidx1];
+        vertex_deleted_[vidx1] = 1;
+        stamps_[vidx0]++;
+        return n_removed;
+    }
+
+private:
+    TriangleMesh &mesh_;
+    bool preserve_topology_;
+    bool has_vert_normal_;
+    bool has_vert_color_;
+    std::vector<Quadric> quadrics_;
+    std::vector<std::vector<int>> vertex_triangles_;
+    std::vector<uint8_t> vertex_deleted_;
+    std::vector<uint8_t> triangle_deleted_;
+    std::vector<uint8_t> boundary_;
+    std::vector<int> stamps_;
+};
+
+}  // unnamed namespace
+
+std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
+        int target_number_of_triangles,
+        const QuadricDecimationOption &option) const {
+    if (HasTriangleUvs()) {
+        utility::LogWarning(
+                "[SimplifyQuadricDecimation] This mesh contains triangle uvs "
+                "that are not handled in this function");
+    }
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
+    mesh->triangles_ = triangles_;
+    const int n_triangles = int(triangles_.size());
+    if (n_triangles <= target_number_of_triangles) {
+        if (HasTriangleNormals()) {
+            mesh->ComputeTriangleNormals();
+        }
+        return mesh;
+    }
+
+    QuadricDecimator decimator(*mesh, option.preserve_topology_);
+    int n_partitions = 1;
+    if (option.partition_size_ > 0) {
+        n_partitions = std::max(
+                1, (n_triangles + option.partition_size_ / 2) /
+                           option.partition_size_);
+    }
+    if (n_partitions > 1) {
+        // Consecutive runs of triangles in Morton order of their centroids
+        // form compact partitions.
+        const Eigen::Vector3d min_bound = GetMinBound();
+        double size = (GetMaxBound() - min_bound).maxCoeff();
+        const double scale = 1023.0 / (size > 0 ? size : 1.0);
+        std::vector<uint64_t> codes(n_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int tidx = 0; tidx < n_triangles; ++tidx) {
+            const Eigen::Vector3i &tria = triangles_[tidx];
+            Eigen::Vector3d c = (vertices_[tria(0)] + vertices_[tria(1)] +
+                                 vertices_[tria(2)]) /
+                                3.0;
+            Eigen::Vector3d q = (c - min_bound) * scale;
+            uint64_t code = 0;
+            for (int axis = 0; axis < 3; ++axis) {
+                double qi = std::min(1023.0, std::max(0.0, q(axis)));
+                code |= SpreadBits10(uint64_t(qi)) << axis;
+            }
+            codes[tidx] = code;
+        }
+        std::vector<size_t> order;
+        utility::RadixSortWithIndices(codes, order);
+
+        std::vector<int> triangle_partition(n_triangles);
+        std::vector<std::vector<int>> partitions(n_partitions);
+        for (int rank = 0; rank < n_triangles; ++rank) {
+            int p = int(int64_t(rank) * n_partitions / n_triangles);
+            triangle_partition[order[rank]] = p;
+            partitions[p].push_back(int(order[rank]));
+        }
+
+        // Vertices with triangles in more than one partition are locked.
+        const auto &vertex_triangles = decimator.GetVertexTriangles();
+        std::vector<uint8_t> locked(vertices_.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int vidx = 0; vidx < int(vertices_.size()); ++vidx) {
+            for (int tidx : vertex_triangles[vidx]) {
+                if (triangle_partition[tidx] !=
+                    triangle_partition[vertex_triangles[vidx][0]]) {
+                    locked[vidx] = 1;
+                    break;
+                }
+            }
+        }
+
+        // Triangles on the seams are left to the final pass, so they do not
+        // count against the target of the partition.
+        double ratio = double(target_number_of_triangles) / n_triangles;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int p = 0; p < n_partitions; ++p) {
+            int n_seam = 0;
+            for (int tidx : partitions[p]) {
+                const Eigen::Vector3i &tria = triangles_[tidx];
+                n_seam += (locked[tria(0)] || locked[tria(1)] ||
+                           locked[tria(2)]);
+            }
+            int n_interior = int(partitions[p].size()) - n_seam;
+            decimator.Decimate(partitions[p],
+                               int(ratio * n_interior) + n_seam, locked);
+        }
+        utility::LogDebug(
+                "[SimplifyQuadricDecimation] decimated {:d} partitions",
+                n_partitions);
+    }
+
+    // Final pass over the whole mesh, including the seams.
+    std::vector<int> all_triangles(n_triangles);
+    for (int tidx = 0; tidx < n_triangles; ++tidx) {
+        all_triangles[tidx] = tidx;
+    }
+    decimator.Decimate(all_triangles, target_number_of_triangles,
+                       std::vector<uint8_t>());
+    decimator.Compact();
+
+    if (HasTriangleNormals()) {
+        mesh->ComputeTriangleNormals();
+    }
+    return mesh;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -220,8 +220,12 @@ public:
     ///
     /// \param input The input TriangleMesh.
     /// \param voxel_size Voxel size of of the VoxelGrid construction.
+    /// \param fill_interior If true, the voxels enclosed by the mesh are
+    /// added as well, see CreateFromTriangleMeshWithinBounds.
     static std::shared_ptr<VoxelGrid> CreateFromTriangleMesh(
-            const TriangleMesh &input, double voxel_size);
+            const TriangleMesh &input,
+            double voxel_size,
+            bool fill_interior = false);
 
     /// Creates a VoxelGrid from a given TriangleMesh. No color information is
     /// converted. The bounds of the created VoxelGrid are defined by the given
@@ -231,11 +235,15 @@ public:
     /// \param voxel_size Voxel size of of the VoxelGrid construction.
     /// \param min_bound Minimum boundary point for the VoxelGrid to create.
     /// \param max_bound Maximum boundary point for the VoxelGrid to create.
+    /// \param fill_interior If true, the voxels that cannot be reached from
+    /// the grid boundary without crossing the surface are added as well. This
+    /// needs a closed mesh and one byte per voxel of the bounding grid.
     static std::shared_ptr<VoxelGrid> CreateFromTriangleMeshWithinBounds(
             const TriangleMesh &input,
             double voxel_size,
             const Eigen::Vector3d &min_bound,
-            const Eigen::Vector3d &max_bound);
+            const Eigen::Vector3d &max_bound,
+            bool fill_interior = false);
 
     /// Returns List of ``Voxel``: Voxels contained in voxel grid.
     /// Changes to the voxels returned from this method are not reflected in
@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <numeric>
 #include <unordered_map>
 
@@ -33,6 +34,7 @@
 #include "Open3D/Geometry/VoxelGrid.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/RadixSort.h"
 
 namespace open3d {
 namespace geometry {
@@ -118,7 +120,8 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromTriangleMeshWithinBounds(
         const TriangleMesh &input,
         double voxel_size,
         const Eigen::Vector3d &min_bound,
-        const Eigen::Vector3d &max_bound) {
+        const Eigen::Vector3d &max_bound,
+        bool fill_interior /* = false */) {
     auto output = std::make_shared<VoxelGrid>();
     if (voxel_size <= 0.0) {
         utility::LogError("[CreateFromTriangleMesh] voxel_size <= 0.");
@@ -132,42 +135,149 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromTriangleMeshWithinBounds(
     output->origin_ = min_bound;
 
     Eigen::Vector3d grid_size = max_bound - min_bound;
-    int num_w = int(std::round(grid_size(0) / voxel_size));
-    int num_h = int(std::round(grid_size(1) / voxel_size));
-    int num_d = int(std::round(grid_size(2) / voxel_size));
+    const Eigen::Vector3i num_voxels(
+            int(std::round(grid_size(0) / voxel_size)),
+            int(std::round(grid_size(1) / voxel_size)),
+            int(std::round(grid_size(2) / voxel_size)));
+    if (num_voxels.minCoeff() <= 0) {
+        return output;
+    }
     const Eigen::Vector3d box_half_size(voxel_size / 2, voxel_size / 2,
                                         voxel_size / 2);
-    for (int widx = 0; widx < num_w; widx++) {
-        for (int hidx = 0; hidx < num_h; hidx++) {
-            for (int didx = 0; didx < num_d; didx++) {
-                const Eigen::Vector3d box_center =
-                        min_bound +
-                        Eigen::Vector3d(widx, hidx, didx) * voxel_size;
-                for (const Eigen::Vector3i &tria : input.triangles_) {
-                    const Eigen::Vector3d &v0 = input.vertices_[tria(0)];
-                    const Eigen::Vector3d &v1 = input.vertices_[tria(1)];
-                    const Eigen::Vector3d &v2 = input.vertices_[tria(2)];
-                    if (IntersectionTest::TriangleAABB(
-                                box_center, box_half_size, v0, v1, v2)) {
-                        Eigen::Vector3i grid_index(widx, hidx, didx);
-                        output->AddVoxel(geometry::Voxel(grid_index));
-                        break;
+    auto VoxelKey = [&num_voxels](int widx, int hidx, int didx) {
+        return uint64_t(widx) +
+               uint64_t(num_voxels(0)) *
+                       (uint64_t(hidx) + uint64_t(num_voxels(1)) * didx);
+    };
+
+    // Every triangle runs the exact overlap test only against the voxels
+    // whose boxes overlap its bounding box. The box of voxel (w, h, d) is
+    // centered at min_bound + (w, h, d) * voxel_size.
+    std::vector<uint64_t> keys;
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        std::vector<uint64_t> local_keys;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for (int tidx = 0; tidx < (int)input.triangles_.size(); tidx++) {
+            const Eigen::Vector3i &tria = input.triangles_[tidx];
+            const Eigen::Vector3d &v0 = input.vertices_[tria(0)];
+            const Eigen::Vector3d &v1 = input.vertices_[tria(1)];
+            const Eigen::Vector3d &v2 = input.vertices_[tria(2)];
+            Eigen::Vector3d tria_min = v0.cwiseMin(v1).cwiseMin(v2);
+            Eigen::Vector3d tria_max = v0.cwiseMax(v1).cwiseMax(v2);
+            Eigen::Vector3i index_min, index_max;
+            for (int c = 0; c < 3; c++) {
+                // A small margin guards against rounding.
+                index_min(c) = int(std::max(
+                        0.0, std::floor((tria_min(c) - min_bound(c)) /
+                                                voxel_size -
+                                        0.501)));
+                index_max(c) = int(std::min(
+                        double(num_voxels(c) - 1),
+                        std::ceil((tria_max(c) - min_bound(c)) / voxel_size +
+                                  0.501)));
+            }
+            for (int didx = index_min(2); didx <= index_max(2); didx++) {
+                for (int hidx = index_min(1); hidx <= index_max(1); hidx++) {
+                    for (int widx = index_min(0); widx <= index_max(0);
+                         widx++) {
+                        const Eigen::Vector3d box_center =
+                                min_bound +
+                                Eigen::Vector3d(widx, hidx, didx) * voxel_size;
+                        if (IntersectionTest::TriangleAABB(
+                                    box_center, box_half_size, v0, v1, v2)) {
+                            local_keys.push_back(VoxelKey(widx, hidx, didx));
+                        }
                     }
                 }
             }
         }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        { keys.insert(keys.end(), local_keys.begin(), local_keys.end()); }
+#ifdef _OPENMP
     }
+#endif
+    utility::RadixSort(keys);
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
 
+    if (fill_interior) {
+        // Flood fill the exterior from the grid boundary; everything that is
+        // neither surface nor exterior is inside.
+        const uint64_t num_total = VoxelKey(0, 0, num_voxels(2));
+        std::vector<uint8_t> state(num_total, 0);
+        const uint8_t SURFACE = 1, EXTERIOR = 2;
+        for (uint64_t key : keys) {
+            state[key] = SURFACE;
+        }
+        std::vector<Eigen::Vector3i> stack;
+        auto Visit = [&](int widx, int hidx, int didx) {
+            if (widx < 0 || hidx < 0 || didx < 0 || widx >= num_voxels(0) ||
+                hidx >= num_voxels(1) || didx >= num_voxels(2)) {
+                return;
+            }
+            uint8_t &voxel_state = state[VoxelKey(widx, hidx, didx)];
+            if (voxel_state == 0) {
+                voxel_state = EXTERIOR;
+                stack.push_back(Eigen::Vector3i(widx, hidx, didx));
+            }
+        };
+        for (int didx = 0; didx < num_voxels(2); didx++) {
+            for (int hidx = 0; hidx < num_voxels(1); hidx++) {
+                for (int widx = 0; widx < num_voxels(0); widx++) {
+                    if (didx == 0 || hidx == 0 || widx == 0 ||
+                        didx == num_voxels(2) - 1 ||
+                        hidx == num_voxels(1) - 1 ||
+                        widx == num_voxels(0) - 1) {
+                        Visit(widx, hidx, didx);
+                    }
+                }
+            }
+        }
+        while (!stack.empty()) {
+            Eigen::Vector3i voxel = stack.back();
+            stack.pop_back();
+            Visit(voxel(0) - 1, voxel(1), voxel(2));
+            Visit(voxel(0) + 1, voxel(1), voxel(2));
+            Visit(voxel(0), voxel(1) - 1, voxel(2));
+            Visit(voxel(0), voxel(1) + 1, voxel(2));
+            Visit(voxel(0), voxel(1), voxel(2) - 1);
+            Visit(voxel(0), voxel(1), voxel(2) + 1);
+        }
+        keys.clear();
+        for (uint64_t key = 0; key < num_total; key++) {
+            if (state[key] != EXTERIOR) {
+                keys.push_back(key);
+            }
+        }
+    }
+
+    for (uint64_t key : keys) {
+        Eigen::Vector3i grid_index(int(key % num_voxels(0)),
+                                   int(key / num_voxels(0) % num_voxels(1)),
+                                   int(key / num_voxels(0) / num_voxels(1)));
+        output->AddVoxel(geometry::Voxel(grid_index));
+    }
+    utility::LogDebug(
+            "TriangleMesh is voxelized from {:d} triangles to {:d} voxels.",
+            (int)input.triangles_.size(), (int)output->voxels_.size());
     return output;
 }
 
 std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromTriangleMesh(
-        const TriangleMesh &input, double voxel_size) {
+        const TriangleMesh &input,
+        double voxel_size,
+        bool fill_interior /* = false */) {
     Eigen::Vector3d voxel_size3(voxel_size, voxel_size, voxel_size);
     Eigen::Vector3d min_bound = input.GetMinBound() - voxel_size3 * 0.5;
     Eigen::Vector3d max_bound = input.GetMaxBound() + voxel_size3 * 0.5;
     return CreateFromTriangleMeshWithinBounds(input, voxel_size, min_bound,
-                                              max_bound);
+                                              max_bound, fill_interior);
 }
 
 }  // namespace geometry
@@ -0,0 +1,166 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/AsyncImageWriter.h"
+
+#include <algorithm>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Timer.h"
+
+namespace open3d {
+namespace io {
+
+AsyncImageWriter::AsyncImageWriter(
+        size_t queue_size /* = 16*/,
+        int num_threads /* = 0*/,
+        const PNGWriteOption &png_option /* = PNGWriteOption()*/,
+        int jpeg_quality /* = 90*/)
+    : queue_size_(queue_size),
+      png_option_(png_option),
+      jpeg_quality_(jpeg_quality) {
+    if (queue_size_ == 0) {
+        utility::LogError("[AsyncImageWriter] queue_size must be positive.");
+    }
+    if (num_threads <= 0) {
+        num_threads = std::max(1, int(std::thread::hardware_concurrency()));
+    }
+    for (int i = 0; i < num_threads; i++) {
+        workers_.emplace_back(&AsyncImageWriter::RunWorker, this);
+    }
+}
+
+AsyncImageWriter::~AsyncImageWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    condition_.notify_all();
+    // Workers only stop once the queue is empty.
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+void AsyncImageWriter::WriteImage(
+        const std::string &filename,
+        std::shared_ptr<const geometry::Image> image) {
+    WriteImage(filename, image, png_option_);
+}
+
+void AsyncImageWriter::WriteImage(const std::string &filename,
+                                  std::shared_ptr<const geometry::Image> image,
+                                  const PNGWriteOption &png_option) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (start_time_ < 0) {
+        start_time_ = utility::Timer::GetSystemTimeInMilliseconds();
+    }
+    if (queue_.size() >= queue_size_) {
+        double start = utility::Timer::GetSystemTimeInMilliseconds();
+        condition_.wait(lock, [this] { return queue_.size() < queue_size_; });
+        double end = utility::Timer::GetSystemTimeInMilliseconds();
+        statistics_.num_producer_stalls_++;
+        statistics_.producer_stall_seconds_ += (end - start) / 1000.0;
+    }
+    queue_.push_back(Job{filename, std::move(image), png_option});
+    lock.unlock();
+    condition_.notify_all();
+}
+
+void AsyncImageWriter::Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock,
+                    [this] { return queue_.empty() && num_in_progress_ == 0; });
+}
+
+void AsyncImageWriter::RunWorker() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        condition_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+        if (queue_.empty()) {
+            return;
+        }
+        Job job = std::move(queue_.front());
+        queue_.pop_front();
+        num_in_progress_++;
+        lock.unlock();
+        // A queue entry was freed for the producer.
+        condition_.notify_all();
+
+        double start = utility::Timer::GetSystemTimeInMilliseconds();
+        bool success = WriteJob(job);
+        double end = utility::Timer::GetSystemTimeInMilliseconds();
+        job.image_.reset();
+
+        lock.lock();
+        num_in_progress_--;
+        if (success) {
+            statistics_.num_written_++;
+        } else {
+            statistics_.num_failed_++;
+        }
+        statistics_.encode_seconds_ += (end - start) / 1000.0;
+        last_write_time_ = end;
+        condition_.notify_all();
+    }
+}
+
+bool AsyncImageWriter::WriteJob(const Job &job) const {
+    if (!job.image_) {
+        utility::LogWarning("[AsyncImageWriter] No image for {}.",
+                            job.filename_);
+        return false;
+    }
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(job.filename_);
+    bool success;
+    if (filename_ext == "png") {
+        success = WriteImageToPNG(job.filename_, *job.image_, job.png_option_);
+    } else {
+        success = io::WriteImage(job.filename_, *job.image_, jpeg_quality_);
+    }
+    if (!success) {
+        utility::LogWarning("[AsyncImageWriter] Failed to write {}.",
+                            job.filename_);
+    }
+    return success;
+}
+
+AsyncImageWriterStatistics AsyncImageWriter::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    AsyncImageWriterStatistics statistics = statistics_;
+    size_t num_done = statistics.num_written_ + statistics.num_failed_;
+    double elapsed = (last_write_time_ - start_time_) / 1000.0;
+    if (num_done > 0 && start_time_ >= 0 && elapsed > 0) {
+        statistics.frames_per_second_ = statistics.num_written_ / elapsed;
+    }
+    return statistics;
+}
+
+}  // namespace io
+}  // namespace open3d
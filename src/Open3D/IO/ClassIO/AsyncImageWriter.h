@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+
+namespace open3d {
+namespace io {
+
+/// \class AsyncImageWriterStatistics
+///
+/// \brief Throughput and stall counters of an AsyncImageWriter.
+class AsyncImageWriterStatistics {
+public:
+    AsyncImageWriterStatistics() {}
+    ~AsyncImageWriterStatistics() {}
+
+public:
+    /// Number of images written so far.
+    size_t num_written_ = 0;
+    /// Number of images that could not be written.
+    size_t num_failed_ = 0;
+    /// Time spent encoding and writing, summed over the worker threads, in
+    /// seconds.
+    double encode_seconds_ = 0;
+    /// Written images per second of wall time from the first queued image to
+    /// the last written image.
+    double frames_per_second_ = 0;
+    /// Number of WriteImage() calls that waited because the queue was full.
+    size_t num_producer_stalls_ = 0;
+    /// Time WriteImage() spent waiting for the queue, in seconds.
+    double producer_stall_seconds_ = 0;
+};
+
+/// \class AsyncImageWriter
+///
+/// \brief Writes images on a pool of background threads.
+///
+/// WriteImage() queues an image and returns immediately, so that a capture
+/// loop does not wait for PNG or JPEG encoding. The queue is bounded: when it
+/// is full, WriteImage() waits for a worker to take an image, which bounds
+/// the memory held by the writer and is reported as a producer stall.
+class AsyncImageWriter {
+public:
+    /// \param queue_size Maximum number of images waiting to be written.
+    /// \param num_threads Number of encoding threads, 0 to use the number of
+    /// hardware threads.
+    /// \param png_option Compression settings of PNG files.
+    /// \param jpeg_quality Quality of JPEG files, from 0 to 100.
+    AsyncImageWriter(size_t queue_size = 16,
+                     int num_threads = 0,
+                     const PNGWriteOption &png_option = PNGWriteOption(),
+                     int jpeg_quality = 90);
+    /// Writes the images still in the queue and stops the workers.
+    ~AsyncImageWriter();
+    AsyncImageWriter(const AsyncImageWriter &) = delete;
+    AsyncImageWriter &operator=(const AsyncImageWriter &) = delete;
+
+public:
+    /// \brief Queues \p image to be written to \p filename, in the format
+    /// given by the file extension.
+    ///
+    /// The image must not be modified until it has been written.
+    void WriteImage(const std::string &filename,
+                    std::shared_ptr<const geometry::Image> image);
+    /// \brief Queues \p image with PNG settings that override the settings
+    /// of the writer, e.g. fast settings for depth and the default ones for
+    /// color.
+    void WriteImage(const std::string &filename,
+                    std::shared_ptr<const geometry::Image> image,
+                    const PNGWriteOption &png_option);
+
+    /// Waits until all queued images have been written.
+    void Flush();
+
+    /// Returns the throughput and stall counters.
+    AsyncImageWriterStatistics GetStatistics() const;
+
+private:
+    struct Job {
+        std::string filename_;
+        std::shared_ptr<const geometry::Image> image_;
+        PNGWriteOption png_option_;
+    };
+
+    void RunWorker();
+    bool WriteJob(const Job &job) const;
+
+private:
+    size_t queue_size_;
+    PNGWriteOption png_option_;
+    int jpeg_quality_;
+
+    // Shared with the worker threads.
+    mutable std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<std::thread> workers_;
+    std::deque<Job> queue_;
+    size_t num_in_progress_ = 0;
+    bool stop_ = false;
+    AsyncImageWriterStatistics statistics_;
+    double start_time_ = -1;
+    double last_write_time_ = 0;
+};
+
+}  // namespace io
+}  // namespace open3d
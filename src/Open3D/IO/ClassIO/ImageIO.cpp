@@ -49,7 +49,11 @@ static const std::unordered_map<
         std::string,
         std::function<bool(const std::string &, const geometry::Image &, int)>>
         file_extension_to_image_write_function{
-                {"png", WriteImageToPNG},
+                {"png",
+                 [](const std::string &filename, const geometry::Image &image,
+                    int quality) {
+                     return WriteImageToPNG(filename, image, quality);
+                 }},
                 {"jpg", WriteImageToJPG},
                 {"jpeg", WriteImageToJPG},
         };
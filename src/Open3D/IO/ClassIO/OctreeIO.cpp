@@ -40,6 +40,10 @@ static const std::unordered_map<
         std::function<bool(const std::string &, geometry::Octree &)>>
         file_extension_to_octree_read_function{
                 {"json", ReadOctreeFromJson},
+                {"bin",
+                 [](const std::string &filename, geometry::Octree &octree) {
+                     return ReadOctreeFromBIN(filename, octree);
+                 }},
         };
 
 static const std::unordered_map<
@@ -47,6 +51,7 @@ static const std::unordered_map<
         std::function<bool(const std::string &, const geometry::Octree &)>>
         file_extension_to_octree_write_function{
                 {"json", WriteOctreeToJson},
+                {"bin", WriteOctreeToBIN},
         };
 
 std::shared_ptr<geometry::Octree> CreateOctreeFromFile(
@@ -57,5 +57,20 @@ bool ReadOctreeFromJson(const std::string &filename, geometry::Octree &octree);
 bool WriteOctreeToJson(const std::string &filename,
                        const geometry::Octree &octree);
 
+/// \brief Reads an Octree from the pointerless binary octree format.
+///
+/// The file is loaded with a single read and decoded breadth-first from the
+/// child masks, without a Json::Value per node.
+/// \param num_decoded_nodes If not nullptr, set to the number of internal and
+/// leaf nodes decoded.
+bool ReadOctreeFromBIN(const std::string &filename,
+                       geometry::Octree &octree,
+                       size_t *num_decoded_nodes = nullptr);
+
+/// \brief Writes an Octree as breadth-first child masks followed by the
+/// leaf colors. Only OctreeColorLeafNode leaves are supported.
+bool WriteOctreeToBIN(const std::string &filename,
+                      const geometry::Octree &octree);
+
 }  // namespace io
 }  // namespace open3d
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "Open3D/Camera/PinholeCameraTrajectory.h"
 
@@ -68,5 +69,19 @@ bool WritePinholeCameraTrajectoryToTUM(
         const std::string &filename,
         const camera::PinholeCameraTrajectory &trajectory);
 
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory);
+
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory);
+
+/// \brief Appends camera parameters to a binary trajectory file as a new
+/// chunk. Creates the file if it does not exist.
+bool AppendPinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const std::vector<camera::PinholeCameraParameters> &parameters);
+
 }  // namespace io
 }  // namespace open3d
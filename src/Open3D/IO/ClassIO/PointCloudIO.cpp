@@ -47,6 +47,12 @@ static const std::unordered_map<
                 {"ply", ReadPointCloudFromPLY},
                 {"pcd", ReadPointCloudFromPCD},
                 {"pts", ReadPointCloudFromPTS},
+                {"tpc",
+                 [](const std::string &filename,
+                    geometry::PointCloud &pointcloud, bool print_progress) {
+                     return ReadPointCloudFromTPC(filename, pointcloud,
+                                                  print_progress);
+                 }},
         };
 
 static const std::unordered_map<std::string,
@@ -60,8 +66,25 @@ static const std::unordered_map<std::string,
                 {"xyzn", WritePointCloudToXYZN},
                 {"xyzrgb", WritePointCloudToXYZRGB},
                 {"ply", WritePointCloudToPLY},
-                {"pcd", WritePointCloudToPCD},
+                {"pcd",
+                 [](const std::string &filename,
+                    const geometry::PointCloud &pointcloud,
+                    const bool write_ascii, const bool compressed,
+                    const bool print_progress) {
+                     return WritePointCloudToPCD(filename, pointcloud,
+                                                 write_ascii, compressed,
+                                                 print_progress);
+                 }},
                 {"pts", WritePointCloudToPTS},
+                {"tpc",
+                 [](const std::string &filename,
+                    const geometry::PointCloud &pointcloud,
+                    const bool write_ascii, const bool compressed,
+                    const bool print_progress) {
+                     return WritePointCloudToTPC(filename, pointcloud,
+                                                 write_ascii, compressed,
+                                                 print_progress);
+                 }},
         };
 }  // unnamed namespace
 
@@ -115,6 +138,44 @@ bool ReadPointCloud(const std::string &filename,
     return success;
 }
 
+bool ReadPointCloud(const std::string &filename,
+                    geometry::PointCloud &pointcloud,
+                    const geometry::AxisAlignedBoundingBox &bbox,
+                    int level /* = -1*/,
+                    bool print_progress /* = false*/) {
+    if (utility::filesystem::GetFileExtensionInLowerCase(filename) == "tpc") {
+        if (!ReadPointCloudFromTPC(filename, pointcloud, bbox, level,
+                                   print_progress)) {
+            return false;
+        }
+        pointcloud.RemoveNonFinitePoints(true, true);
+        return true;
+    }
+    if (!ReadPointCloud(filename, pointcloud, "auto", true, true,
+                        print_progress)) {
+        return false;
+    }
+    pointcloud = *pointcloud.SelectByIndex(
+            bbox.GetPointIndicesWithinBoundingBox(pointcloud.points_));
+    return true;
+}
+
+bool ReadPointCloud(const std::string &filename,
+                    geometry::PointCloud &pointcloud,
+                    int level,
+                    bool print_progress /* = false*/) {
+    if (utility::filesystem::GetFileExtensionInLowerCase(filename) == "tpc") {
+        if (!ReadPointCloudFromTPC(filename, pointcloud, level,
+                                   print_progress)) {
+            return false;
+        }
+        pointcloud.RemoveNonFinitePoints(true, true);
+        return true;
+    }
+    return ReadPointCloud(filename, pointcloud, "auto", true, true,
+                          print_progress);
+}
+
 bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      bool write_ascii /* = false*/,
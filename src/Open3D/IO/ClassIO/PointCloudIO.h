@@ -28,6 +28,7 @@
 
 #include <string>
 
+#include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/PointCloud.h"
 
 namespace open3d {
@@ -50,6 +51,32 @@ bool ReadPointCloud(const std::string &filename,
                     bool remove_infinite_points = true,
                     bool print_progress = false);
 
+/// \brief Reads the points of a PointCloud file inside a bounding box.
+///
+/// For tiled point cloud (tpc) files only the tiles intersecting \p bbox are
+/// read, in parallel. Other formats are read completely and cropped. Points
+/// with NaN or infinite coordinates are removed for all formats.
+///
+/// \param bbox Points outside this box are not returned.
+/// \param level Level of detail to read, or -1 to read all points. Only tpc
+/// files store levels of detail; other formats ignore it.
+bool ReadPointCloud(const std::string &filename,
+                    geometry::PointCloud &pointcloud,
+                    const geometry::AxisAlignedBoundingBox &bbox,
+                    int level = -1,
+                    bool print_progress = false);
+
+/// \brief Reads a level of detail of a whole PointCloud file.
+///
+/// Points with NaN or infinite coordinates are removed for all formats.
+///
+/// \param level Level of detail to read, or -1 to read all points. Only tpc
+/// files store levels of detail; other formats are read completely.
+bool ReadPointCloud(const std::string &filename,
+                    geometry::PointCloud &pointcloud,
+                    int level,
+                    bool print_progress = false);
+
 /// The general entrance for writing a PointCloud to a file
 /// The function calls write functions based on the extension name of filename.
 /// If the write function supports binary encoding and compression, the later
@@ -111,6 +138,40 @@ bool WritePointCloudToPCD(const std::string &filename,
                           bool compressed = false,
                           bool print_progress = false);
 
+/// \class PCDWriteOption
+///
+/// \brief Options for writing a PointCloud to a PCD file.
+class PCDWriteOption {
+public:
+    PCDWriteOption(bool write_ascii = false,
+                   bool compressed = false,
+                   bool chunked = false,
+                   int chunk_size = 1 << 20)
+        : write_ascii_(write_ascii),
+          compressed_(compressed),
+          chunked_(chunked),
+          chunk_size_(chunk_size) {}
+    ~PCDWriteOption() {}
+
+public:
+    /// Write the data as ASCII text.
+    bool write_ascii_;
+    /// Write the data as binary_compressed with LZF.
+    bool compressed_;
+    /// Compress the data in independent chunks of chunk_size_ bytes in
+    /// parallel. The chunks form a single valid LZF stream, so other PCD
+    /// readers still read the file; ReadPointCloudFromPCD also decompresses
+    /// the chunks in parallel.
+    bool chunked_;
+    /// Uncompressed size of a chunk in bytes.
+    int chunk_size_;
+};
+
+bool WritePointCloudToPCD(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const PCDWriteOption &option,
+                          bool print_progress = false);
+
 bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            bool print_progress = false);
@@ -121,5 +182,71 @@ bool WritePointCloudToPTS(const std::string &filename,
                           bool compressed = false,
                           bool print_progress = false);
 
+/// \class TPCWriteOption
+///
+/// \brief Options for writing a PointCloud to a tiled point cloud (tpc) file.
+class TPCWriteOption {
+public:
+    TPCWriteOption(size_t max_points_per_tile = 65536,
+                   int num_levels = 4,
+                   int sampling_depth = 8)
+        : max_points_per_tile_(max_points_per_tile),
+          num_levels_(num_levels),
+          sampling_depth_(sampling_depth) {}
+    ~TPCWriteOption() {}
+
+public:
+    /// Octree cells with more points than this are split into smaller tiles.
+    size_t max_points_per_tile_;
+    /// Number of levels of detail, at most 32.
+    int num_levels_;
+    /// Levels 0 to k together keep one point per occupied cell of a grid of
+    /// 2^(sampling_depth_ + k) cells per side over the cloud, and the last
+    /// level keeps the remaining points.
+    int sampling_depth_;
+};
+
+/// \brief Reads a whole tiled point cloud (tpc) file.
+///
+/// Points are returned tile by tile in Morton order, and by level within a
+/// tile, rather than in the order they were written.
+bool ReadPointCloudFromTPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           bool print_progress = false);
+
+/// \brief Reads the points of a tpc file inside \p bbox up to level of detail
+/// \p level. Only the tiles intersecting \p bbox are read.
+///
+/// \param level Level of detail, or -1 to read all points.
+bool ReadPointCloudFromTPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const geometry::AxisAlignedBoundingBox &bbox,
+                           int level = -1,
+                           bool print_progress = false);
+
+/// \brief Reads the levels of detail up to \p level of a whole tpc file.
+bool ReadPointCloudFromTPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           int level,
+                           bool print_progress = false);
+
+/// \brief Writes a PointCloud to a tiled point cloud (tpc) file.
+///
+/// Points are grouped into the leaves of an octree, and the points of every
+/// tile into levels of detail. Each level of a tile is compressed on its own,
+/// and an index of the tile bounds and data offsets is stored up front, so
+/// that regions and levels of detail can be read without reading the whole
+/// file. Normals are stored as floats and colors as 8-bit values.
+bool WritePointCloudToTPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          bool write_ascii = false,
+                          bool compressed = false,
+                          bool print_progress = false);
+
+bool WritePointCloudToTPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const TPCWriteOption &option,
+                          bool print_progress = false);
+
 }  // namespace io
 }  // namespace open3d
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "Open3D/Registration/PoseGraph.h"
 
@@ -51,5 +52,29 @@ bool ReadPoseGraph(const std::string &filename,
 bool WritePoseGraph(const std::string &filename,
                     const registration::PoseGraph &pose_graph);
 
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          registration::PoseGraph &pose_graph);
+
+/// \brief Writes a PoseGraph to the chunked binary pose graph format.
+///
+/// \param float_information If true, information matrices are stored as
+/// float32, which shrinks every edge record from 440 to 296 bytes.
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const registration::PoseGraph &pose_graph,
+                         bool float_information = false);
+
+/// \brief Appends nodes and edges to a binary pose graph file as new chunks,
+/// without reading or rewriting the data already in the file.
+///
+/// Creates the file if it does not exist. This is intended for incremental
+/// logging, e.g. writing the new nodes and edges of every SLAM step. Reading
+/// the file returns the concatenation of all appended nodes and edges, and
+/// an interrupted append loses at most its own incomplete records.
+bool AppendPoseGraphToBIN(
+        const std::string &filename,
+        const std::vector<registration::PoseGraphNode> &nodes,
+        const std::vector<registration::PoseGraphEdge> &edges,
+        bool float_information = false);
+
 }  // namespace io
 }  // namespace open3d
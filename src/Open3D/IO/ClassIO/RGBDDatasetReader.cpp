@@ -0,0 +1,208 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/RGBDDatasetReader.h"
+
+#include <algorithm>
+#include <exception>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Timer.h"
+
+namespace open3d {
+namespace io {
+
+RGBDDatasetReader::RGBDDatasetReader(
+        const std::vector<std::string> &color_filenames,
+        const std::vector<std::string> &depth_filenames,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 3.0*/,
+        bool convert_rgb_to_intensity /* = true*/,
+        size_t queue_size /* = 8*/,
+        int num_threads /* = 0*/)
+    : color_filenames_(color_filenames),
+      depth_filenames_(depth_filenames),
+      depth_scale_(depth_scale),
+      depth_trunc_(depth_trunc),
+      convert_rgb_to_intensity_(convert_rgb_to_intensity) {
+    Start(queue_size, num_threads);
+}
+
+RGBDDatasetReader::RGBDDatasetReader(
+        const std::vector<std::string> &color_filenames,
+        const std::vector<std::string> &depth_filenames,
+        const camera::PinholeCameraTrajectory &trajectory,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 3.0*/,
+        bool convert_rgb_to_intensity /* = true*/,
+        size_t queue_size /* = 8*/,
+        int num_threads /* = 0*/)
+    : color_filenames_(color_filenames),
+      depth_filenames_(depth_filenames),
+      trajectory_(trajectory),
+      depth_scale_(depth_scale),
+      depth_trunc_(depth_trunc),
+      convert_rgb_to_intensity_(convert_rgb_to_intensity) {
+    if (trajectory_.parameters_.size() != color_filenames_.size()) {
+        utility::LogError(
+                "[RGBDDatasetReader] {:d} cameras do not match {:d} frames.",
+                trajectory_.parameters_.size(), color_filenames_.size());
+    }
+    Start(queue_size, num_threads);
+}
+
+RGBDDatasetReader::~RGBDDatasetReader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    condition_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+void RGBDDatasetReader::Start(size_t queue_size, int num_threads) {
+    if (color_filenames_.size() != depth_filenames_.size()) {
+        utility::LogError(
+                "[RGBDDatasetReader] {:d} color files do not match {:d} "
+                "depth files.",
+                color_filenames_.size(), depth_filenames_.size());
+    }
+    if (queue_size == 0) {
+        utility::LogError("[RGBDDatasetReader] queue_size must be positive.");
+    }
+    if (num_threads <= 0) {
+        num_threads = std::max(1, int(std::thread::hardware_concurrency()));
+    }
+    num_threads = int(std::min(size_t(num_threads), NumFrames()));
+    slots_.resize(queue_size);
+    slot_ready_.resize(queue_size, false);
+    start_time_ = utility::Timer::GetSystemTimeInMilliseconds();
+    for (int i = 0; i < num_threads; i++) {
+        workers_.emplace_back(&RGBDDatasetReader::RunWorker, this);
+    }
+}
+
+void RGBDDatasetReader::RunWorker() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        // Wait until the next frame fits into the queue.
+        bool stalled = false;
+        while (!stop_ && next_to_decode_ < NumFrames() &&
+               next_to_decode_ >= next_to_hand_out_ + slots_.size()) {
+            if (!stalled) {
+                statistics_.num_producer_stalls_++;
+                stalled = true;
+            }
+            condition_.wait(lock);
+        }
+        if (stop_ || next_to_decode_ >= NumFrames()) {
+            return;
+        }
+        size_t index = next_to_decode_++;
+        lock.unlock();
+
+        double start = utility::Timer::GetSystemTimeInMilliseconds();
+        std::shared_ptr<geometry::RGBDImage> rgbd;
+        geometry::Image color, depth;
+        if (!ReadImage(color_filenames_[index], color)) {
+            utility::LogWarning("[RGBDDatasetReader] Failed to read {}.",
+                                color_filenames_[index]);
+        } else if (!ReadImage(depth_filenames_[index], depth)) {
+            utility::LogWarning("[RGBDDatasetReader] Failed to read {}.",
+                                depth_filenames_[index]);
+        } else {
+            // Invalid frames, e.g. with different color and depth sizes, make
+            // CreateFromColorAndDepth throw, which must not end the worker.
+            try {
+                rgbd = geometry::RGBDImage::CreateFromColorAndDepth(
+                        color, depth, depth_scale_, depth_trunc_,
+                        convert_rgb_to_intensity_);
+            } catch (const std::exception &e) {
+                utility::LogWarning(
+                        "[RGBDDatasetReader] Failed to create frame {:d}: {}",
+                        index, e.what());
+                rgbd = nullptr;
+            }
+        }
+        double end = utility::Timer::GetSystemTimeInMilliseconds();
+
+        lock.lock();
+        size_t slot = index % slots_.size();
+        slots_[slot] = rgbd;
+        slot_ready_[slot] = true;
+        statistics_.num_decoded_++;
+        statistics_.decode_seconds_ += (end - start) / 1000.0;
+        last_decode_time_ = end;
+        condition_.notify_all();
+    }
+}
+
+bool RGBDDatasetReader::NextFrame(RGBDDatasetFrame &frame) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (next_to_hand_out_ >= NumFrames()) {
+        return false;
+    }
+    size_t slot = next_to_hand_out_ % slots_.size();
+    if (!slot_ready_[slot]) {
+        double start = utility::Timer::GetSystemTimeInMilliseconds();
+        condition_.wait(lock, [this, slot] { return bool(slot_ready_[slot]); });
+        double end = utility::Timer::GetSystemTimeInMilliseconds();
+        statistics_.num_consumer_stalls_++;
+        statistics_.consumer_stall_seconds_ += (end - start) / 1000.0;
+    }
+    frame.index_ = next_to_hand_out_;
+    frame.rgbd_ = std::move(slots_[slot]);
+    frame.camera_.reset();
+    if (!trajectory_.parameters_.empty()) {
+        frame.camera_ = std::make_shared<camera::PinholeCameraParameters>(
+                trajectory_.parameters_[next_to_hand_out_]);
+    }
+    slots_[slot].reset();
+    slot_ready_[slot] = false;
+    next_to_hand_out_++;
+    lock.unlock();
+    // A slot was freed for the workers.
+    condition_.notify_all();
+    return true;
+}
+
+RGBDDatasetReaderStatistics RGBDDatasetReader::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    RGBDDatasetReaderStatistics statistics = statistics_;
+    double elapsed = (last_decode_time_ - start_time_) / 1000.0;
+    if (statistics.num_decoded_ > 0 && elapsed > 0) {
+        statistics.decode_throughput_ = statistics.num_decoded_ / elapsed;
+    }
+    return statistics;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,171 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Open3D/Camera/PinholeCameraTrajectory.h"
+
+namespace open3d {
+
+namespace geometry {
+class RGBDImage;
+}
+
+namespace io {
+
+/// \class RGBDDatasetFrame
+///
+/// \brief Frame handed out by RGBDDatasetReader.
+class RGBDDatasetFrame {
+public:
+    RGBDDatasetFrame() {}
+    ~RGBDDatasetFrame() {}
+
+public:
+    /// Index of the frame in the file lists.
+    size_t index_ = 0;
+    /// The decoded frame, or nullptr if a file could not be read or the color
+    /// and depth images do not match.
+    std::shared_ptr<geometry::RGBDImage> rgbd_;
+    /// Camera of the frame if the reader was created with a trajectory.
+    std::shared_ptr<camera::PinholeCameraParameters> camera_;
+};
+
+/// \class RGBDDatasetReaderStatistics
+///
+/// \brief Throughput and stall counters of an RGBDDatasetReader.
+class RGBDDatasetReaderStatistics {
+public:
+    RGBDDatasetReaderStatistics() {}
+    ~RGBDDatasetReaderStatistics() {}
+
+public:
+    /// Number of frames decoded so far.
+    size_t num_decoded_ = 0;
+    /// Time spent decoding, summed over the worker threads, in seconds.
+    double decode_seconds_ = 0;
+    /// Decoded frames per second of wall time from the start of the reader to
+    /// the last decoded frame.
+    double decode_throughput_ = 0;
+    /// Number of NextFrame() calls that had to wait for a frame.
+    size_t num_consumer_stalls_ = 0;
+    /// Time NextFrame() spent waiting for frames, in seconds.
+    double consumer_stall_seconds_ = 0;
+    /// Number of times a worker waited because the queue was full.
+    size_t num_producer_stalls_ = 0;
+};
+
+/// \class RGBDDatasetReader
+///
+/// \brief Reads a sequence of color and depth images with prefetching.
+///
+/// Frames are decoded by a pool of background threads into a bounded queue
+/// and handed out in order by NextFrame(), so that decoding overlaps with the
+/// processing of earlier frames. Workers only decode frames less than
+/// queue_size frames ahead of the consumer, which bounds the memory held by
+/// the reader.
+class RGBDDatasetReader {
+public:
+    /// \param color_filenames Color image file of every frame.
+    /// \param depth_filenames Depth image file of every frame.
+    /// \param depth_scale Ratio to scale raw depth values to meters.
+    /// \param depth_trunc Depth values larger than depth_trunc (in meters)
+    /// are set to 0.
+    /// \param convert_rgb_to_intensity Whether to convert the color image to
+    /// intensity, see geometry::RGBDImage::CreateFromColorAndDepth().
+    /// \param queue_size Maximum number of decoded frames waiting to be
+    /// handed out.
+    /// \param num_threads Number of decoding threads, 0 to use the number of
+    /// hardware threads.
+    RGBDDatasetReader(const std::vector<std::string> &color_filenames,
+                      const std::vector<std::string> &depth_filenames,
+                      double depth_scale = 1000.0,
+                      double depth_trunc = 3.0,
+                      bool convert_rgb_to_intensity = true,
+                      size_t queue_size = 8,
+                      int num_threads = 0);
+    /// \brief Reader whose frames carry the cameras of \p trajectory, which
+    /// must have one camera per frame.
+    RGBDDatasetReader(const std::vector<std::string> &color_filenames,
+                      const std::vector<std::string> &depth_filenames,
+                      const camera::PinholeCameraTrajectory &trajectory,
+                      double depth_scale = 1000.0,
+                      double depth_trunc = 3.0,
+                      bool convert_rgb_to_intensity = true,
+                      size_t queue_size = 8,
+                      int num_threads = 0);
+    ~RGBDDatasetReader();
+    RGBDDatasetReader(const RGBDDatasetReader &) = delete;
+    RGBDDatasetReader &operator=(const RGBDDatasetReader &) = delete;
+
+public:
+    /// \brief Function to get the next frame, waiting until it is decoded.
+    ///
+    /// \return false once all frames have been handed out.
+    bool NextFrame(RGBDDatasetFrame &frame);
+
+    /// Returns the number of frames.
+    size_t NumFrames() const { return color_filenames_.size(); }
+
+    /// Returns the throughput and stall counters.
+    RGBDDatasetReaderStatistics GetStatistics() const;
+
+private:
+    void Start(size_t queue_size, int num_threads);
+    void RunWorker();
+
+private:
+    std::vector<std::string> color_filenames_;
+    std::vector<std::string> depth_filenames_;
+    camera::PinholeCameraTrajectory trajectory_;
+    double depth_scale_;
+    double depth_trunc_;
+    bool convert_rgb_to_intensity_;
+
+    // Shared with the worker threads. Frame i is stored in slots_[i %
+    // slots_.size()] once decoded.
+    mutable std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<std::thread> workers_;
+    bool stop_ = false;
+    size_t next_to_decode_ = 0;
+    size_t next_to_hand_out_ = 0;
+    std::vector<std::shared_ptr<geometry::RGBDImage>> slots_;
+    std::vector<bool> slot_ready_;
+    RGBDDatasetReaderStatistics statistics_;
+    double start_time_ = 0;
+    double last_decode_time_ = 0;
+};
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,189 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/TensorMapIO.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(const std::string &, TensorMap &, bool)>>
+        file_extension_to_tensor_map_read_function{
+                {"ply", ReadTensorMapFromPLY},
+                {"pcd", ReadTensorMapFromPCD},
+        };
+
+static const std::unordered_map<std::string,
+                                std::function<bool(const std::string &,
+                                                   const TensorMap &,
+                                                   const bool,
+                                                   const bool,
+                                                   const bool)>>
+        file_extension_to_tensor_map_write_function{
+                {"ply", WriteTensorMapToPLY},
+                {"pcd", WriteTensorMapToPCD},
+        };
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadTensorMap(const std::string &filename,
+                   TensorMap &tensor_map,
+                   const std::string &format,
+                   bool print_progress) {
+    std::string filename_ext;
+    if (format == "auto") {
+        filename_ext =
+                utility::filesystem::GetFileExtensionInLowerCase(filename);
+    } else {
+        filename_ext = format;
+    }
+    if (filename_ext.empty()) {
+        utility::LogWarning("Read TensorMap failed: unknown file extension.");
+        return false;
+    }
+    auto map_itr =
+            file_extension_to_tensor_map_read_function.find(filename_ext);
+    if (map_itr == file_extension_to_tensor_map_read_function.end()) {
+        utility::LogWarning("Read TensorMap failed: unknown file extension.");
+        return false;
+    }
+    bool success = map_itr->second(filename, tensor_map, print_progress);
+    utility::LogDebug("Read TensorMap: {:d} attributes.",
+                      (int)tensor_map.size());
+    return success;
+}
+
+bool WriteTensorMap(const std::string &filename,
+                    const TensorMap &tensor_map,
+                    bool write_ascii /* = false*/,
+                    bool compressed /* = false*/,
+                    bool print_progress) {
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    if (filename_ext.empty()) {
+        utility::LogWarning("Write TensorMap failed: unknown file extension.");
+        return false;
+    }
+    auto map_itr =
+            file_extension_to_tensor_map_write_function.find(filename_ext);
+    if (map_itr == file_extension_to_tensor_map_write_function.end()) {
+        utility::LogWarning("Write TensorMap failed: unknown file extension.");
+        return false;
+    }
+    bool success = map_itr->second(filename, tensor_map, write_ascii,
+                                   compressed, print_progress);
+    utility::LogDebug("Write TensorMap: {:d} attributes.",
+                      (int)tensor_map.size());
+    return success;
+}
+
+Dtype GetTensorMapReadDtype(char type, int size) {
+    if (type == 'F') {
+        if (size == 4) {
+            return Dtype::Float32;
+        } else if (size == 8) {
+            return Dtype::Float64;
+        }
+    } else if (type == 'U') {
+        if (size == 1) {
+            return Dtype::UInt8;
+        } else if (size == 2) {
+            return Dtype::Int32;
+        } else if (size == 4 || size == 8) {
+            return Dtype::Int64;
+        }
+    } else if (type == 'I') {
+        if (size == 1 || size == 2 || size == 4) {
+            return Dtype::Int32;
+        } else if (size == 8) {
+            return Dtype::Int64;
+        }
+    }
+    return Dtype::Undefined;
+}
+
+bool GetTensorMapWriteAttributes(const TensorMap &tensor_map,
+                                 std::vector<std::string> &names,
+                                 std::vector<Tensor> &tensors,
+                                 int64_t &num_points) {
+    names.clear();
+    for (const auto &name : {"x", "y", "z"}) {
+        if (tensor_map.count(name) > 0) {
+            names.push_back(name);
+        }
+    }
+    std::vector<std::string> others;
+    for (const auto &kv : tensor_map) {
+        if (kv.first != "x" && kv.first != "y" && kv.first != "z") {
+            others.push_back(kv.first);
+        }
+    }
+    std::sort(others.begin(), others.end());
+    names.insert(names.end(), others.begin(), others.end());
+
+    tensors.clear();
+    num_points = -1;
+    for (const auto &name : names) {
+        Tensor tensor = tensor_map.at(name);
+        if (tensor.GetDevice().GetType() != Device::DeviceType::CPU) {
+            tensor = tensor.Copy(Device("CPU:0"));
+        } else if (!tensor.IsContiguous()) {
+            tensor = tensor.Contiguous();
+        }
+        const SizeVector shape = tensor.GetShape();
+        if (shape.size() < 1 || shape.size() > 2 ||
+            name.find_first_of(" \t\r\n") != std::string::npos) {
+            utility::LogWarning(
+                    "[WriteTensorMap] Attribute {} must have 1 or 2 "
+                    "dimensions and a name without spaces.",
+                    name);
+            return false;
+        }
+        if (num_points >= 0 && shape[0] != num_points) {
+            utility::LogWarning(
+                    "[WriteTensorMap] Attribute {} has {:d} points instead "
+                    "of {:d}.",
+                    name, shape[0], num_points);
+            return false;
+        }
+        num_points = shape[0];
+        tensors.push_back(tensor);
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
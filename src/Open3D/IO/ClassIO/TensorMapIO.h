@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+namespace io {
+
+/// \brief Named per-point attributes, each a Tensor whose first dimension is
+/// the number of points.
+using TensorMap = std::unordered_map<std::string, Tensor>;
+
+/// \brief The general entrance for reading every vertex property of a point
+/// file into a TensorMap.
+///
+/// The function calls read functions based on the extension name of filename.
+/// Each property keeps the dtype of the file where Tensor supports it. Other
+/// integer types are widened to Int32, or Int64 for 32-bit unsigned values.
+/// The tensors are contiguous on the CPU, so they can be handed to other
+/// frameworks with Tensor::ToDLPack without copying.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadTensorMap(const std::string &filename,
+                   TensorMap &tensor_map,
+                   const std::string &format = "auto",
+                   bool print_progress = false);
+
+/// \brief The general entrance for writing a TensorMap to a point file.
+///
+/// The function calls write functions based on the extension name of filename.
+/// Every tensor must have the same size in its first dimension and at most
+/// two dimensions. A tensor of shape {N, k} is written as k values per point.
+/// If the write function supports binary encoding and compression, the later
+/// two parameters will be used. Otherwise they will be ignored.
+/// \return return true if the write function is successful, false otherwise.
+bool WriteTensorMap(const std::string &filename,
+                    const TensorMap &tensor_map,
+                    bool write_ascii = false,
+                    bool compressed = false,
+                    bool print_progress = false);
+
+/// \brief Returns the dtype that values of a file are read as.
+///
+/// Tensor has no 8-bit signed, 16-bit or 32-bit unsigned dtype. Those types
+/// are widened to the smallest signed dtype that holds all their values, and
+/// 64-bit unsigned values are read as Int64.
+/// \param type 'F' for floating point, 'I' for signed and 'U' for unsigned
+/// integer values.
+/// \param size Bytes of a value.
+/// \return Dtype::Undefined if no dtype holds the values.
+Dtype GetTensorMapReadDtype(char type, int size);
+
+/// \brief Prepares the attributes of a TensorMap for writing.
+///
+/// The attributes are ordered x, y and z, followed by the other names in
+/// alphabetical order, and their tensors are made contiguous on the CPU.
+/// Fails if a tensor does not have 1 or 2 dimensions, if the tensors differ
+/// in their number of points, or if a name contains blanks.
+/// \param names Attribute names in writing order.
+/// \param tensors Tensors of the attributes in writing order.
+/// \param num_points Number of points, -1 if there are no attributes.
+bool GetTensorMapWriteAttributes(const TensorMap &tensor_map,
+                                 std::vector<std::string> &names,
+                                 std::vector<Tensor> &tensors,
+                                 int64_t &num_points);
+
+/// \brief Reads the scalar properties of the vertex element of a PLY file.
+///
+/// Binary bodies are read in large blocks and each property is copied out of
+/// the records in one pass. List properties are skipped.
+bool ReadTensorMapFromPLY(const std::string &filename,
+                          TensorMap &tensor_map,
+                          bool print_progress = false);
+
+/// \brief Writes a TensorMap as the vertex element of a PLY file.
+///
+/// The columns of a tensor of shape {N, k} are named name_0 ... name_k-1.
+/// x, y and z come first. Bool is written as uchar and Int64 as int or uint
+/// if its values fit, otherwise the write fails.
+/// \param compressed Ignored.
+bool WriteTensorMapToPLY(const std::string &filename,
+                         const TensorMap &tensor_map,
+                         bool write_ascii = false,
+                         bool compressed = false,
+                         bool print_progress = false);
+
+/// \brief Reads every field of a PCD file. A field with a count of k becomes
+/// a tensor of shape {N, k}.
+bool ReadTensorMapFromPCD(const std::string &filename,
+                          TensorMap &tensor_map,
+                          bool print_progress = false);
+
+/// \brief Writes a TensorMap as the fields of a PCD file. Bool is written as
+/// U1.
+bool WriteTensorMapToPCD(const std::string &filename,
+                         const TensorMap &tensor_map,
+                         bool write_ascii = false,
+                         bool compressed = false,
+                         bool print_progress = false);
+
+}  // namespace io
+}  // namespace open3d
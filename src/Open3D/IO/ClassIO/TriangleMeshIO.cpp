@@ -36,17 +36,36 @@ namespace open3d {
 namespace {
 using namespace io;
 
-static const std::unordered_map<
-        std::string,
-        std::function<bool(
-                const std::string &, geometry::TriangleMesh &, bool)>>
+using ReadTriangleMeshFunction =
+        std::function<bool(const std::string &,
+                           geometry::TriangleMesh &,
+                           const ReadTriangleMeshOption &,
+                           bool)>;
+
+/// Adapts a reader without format specific settings to the dispatch table.
+static ReadTriangleMeshFunction IgnoreReadOption(
+        bool (*read)(const std::string &, geometry::TriangleMesh &, bool)) {
+    return [read](const std::string &filename, geometry::TriangleMesh &mesh,
+                  const ReadTriangleMeshOption &, bool print_progress) {
+        return read(filename, mesh, print_progress);
+    };
+}
+
+static const std::unordered_map<std::string, ReadTriangleMeshFunction>
         file_extension_to_trianglemesh_read_function{
-                {"ply", ReadTriangleMeshFromPLY},
-                {"stl", ReadTriangleMeshFromSTL},
-                {"obj", ReadTriangleMeshFromOBJ},
-                {"off", ReadTriangleMeshFromOFF},
-                {"gltf", ReadTriangleMeshFromGLTF},
-                {"glb", ReadTriangleMeshFromGLTF},
+                {"ply", IgnoreReadOption(ReadTriangleMeshFromPLY)},
+                {"stl",
+                 [](const std::string &filename, geometry::TriangleMesh &mesh,
+                    const ReadTriangleMeshOption &option,
+                    bool print_progress) {
+                     return ReadTriangleMeshFromSTL(filename, mesh,
+                                                    option.weld_vertices_,
+                                                    print_progress);
+                 }},
+                {"obj", IgnoreReadOption(ReadTriangleMeshFromOBJ)},
+                {"off", IgnoreReadOption(ReadTriangleMeshFromOFF)},
+                {"gltf", IgnoreReadOption(ReadTriangleMeshFromGLTF)},
+                {"glb", IgnoreReadOption(ReadTriangleMeshFromGLTF)},
         };
 
 static const std::unordered_map<
@@ -82,6 +101,14 @@ std::shared_ptr<geometry::TriangleMesh> CreateMeshFromFile(
 bool ReadTriangleMesh(const std::string &filename,
                       geometry::TriangleMesh &mesh,
                       bool print_progress /* = false */) {
+    return ReadTriangleMesh(filename, mesh, ReadTriangleMeshOption(),
+                            print_progress);
+}
+
+bool ReadTriangleMesh(const std::string &filename,
+                      geometry::TriangleMesh &mesh,
+                      const ReadTriangleMeshOption &option,
+                      bool print_progress /* = false */) {
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -98,7 +125,7 @@ bool ReadTriangleMesh(const std::string &filename,
                 "extension.");
         return false;
     }
-    bool success = map_itr->second(filename, mesh, print_progress);
+    bool success = map_itr->second(filename, mesh, option, print_progress);
     utility::LogDebug(
             "Read geometry::TriangleMesh: {:d} triangles and {:d} vertices.",
             (int)mesh.triangles_.size(), (int)mesh.vertices_.size());
@@ -33,6 +33,24 @@
 namespace open3d {
 namespace io {
 
+/// \class ReadTriangleMeshOption
+///
+/// \brief Format specific settings for reading a TriangleMesh. Formats that
+/// do not support a setting ignore it.
+class ReadTriangleMeshOption {
+public:
+    /// \param weld_vertices If true, STL vertices with equal coordinates are
+    /// merged while loading.
+    ReadTriangleMeshOption(bool weld_vertices = false)
+        : weld_vertices_(weld_vertices) {}
+    ~ReadTriangleMeshOption() {}
+
+public:
+    /// Merge STL vertices with equal coordinates while loading, which gives
+    /// the same mesh as TriangleMesh::RemoveDuplicatedVertices afterwards.
+    bool weld_vertices_;
+};
+
 /// Factory function to create a mesh from a file (TriangleMeshFactory.cpp)
 /// Return an empty mesh if fail to read the file.
 std::shared_ptr<geometry::TriangleMesh> CreateMeshFromFile(
@@ -45,6 +63,14 @@ bool ReadTriangleMesh(const std::string &filename,
                       geometry::TriangleMesh &mesh,
                       bool print_progress = false);
 
+/// \brief Reads a TriangleMesh from a file with format specific settings.
+///
+/// \param option Settings passed to the reader of the file format.
+bool ReadTriangleMesh(const std::string &filename,
+                      geometry::TriangleMesh &mesh,
+                      const ReadTriangleMeshOption &option,
+                      bool print_progress = false);
+
 /// The general entrance for writing a TriangleMesh to a file
 /// The function calls write functions based on the extension name of filename.
 /// If the write function supports binary encoding and compression, the later
@@ -78,6 +104,18 @@ bool ReadTriangleMeshFromSTL(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress);
 
+/// \brief Reads a binary STL file in large blocks that are decoded in
+/// parallel.
+///
+/// \param weld_vertices If true, vertices with equal coordinates are merged
+/// while loading with a parallel sort, which gives the same mesh as reading
+/// without welding followed by TriangleMesh::RemoveDuplicatedVertices.
+/// Otherwise every triangle gets three vertices of its own.
+bool ReadTriangleMeshFromSTL(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             bool weld_vertices,
+                             bool print_progress);
+
 bool WriteTriangleMeshToSTL(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii,
@@ -41,6 +41,7 @@ static const std::unordered_map<
         std::function<bool(const std::string &, geometry::VoxelGrid &, bool)>>
         file_extension_to_voxelgrid_read_function{
                 {"ply", ReadVoxelGridFromPLY},
+                {"bin", ReadVoxelGridFromBIN},
         };
 
 static const std::unordered_map<std::string,
@@ -51,6 +52,7 @@ static const std::unordered_map<std::string,
                                                    const bool)>>
         file_extension_to_voxelgrid_write_function{
                 {"ply", WriteVoxelGridToPLY},
+                {"bin", WriteVoxelGridToBIN},
         };
 }  // unnamed namespace
 
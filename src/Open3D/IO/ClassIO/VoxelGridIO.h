@@ -69,5 +69,22 @@ bool WriteVoxelGridToPLY(const std::string &filename,
                          bool compressed = false,
                          bool print_progress = false);
 
+/// \brief Reads a VoxelGrid from the blocked binary voxel grid format with a
+/// single read.
+bool ReadVoxelGridFromBIN(const std::string &filename,
+                          geometry::VoxelGrid &voxelgrid,
+                          bool print_progress = false);
+
+/// \brief Writes a VoxelGrid as 8 x 8 x 8 blocks with occupancy bit masks
+/// and 8-bit colors.
+///
+/// \param write_ascii Ignored, the format is binary only.
+/// \param compressed Ignored.
+bool WriteVoxelGridToBIN(const std::string &filename,
+                         const geometry::VoxelGrid &voxelgrid,
+                         bool write_ascii = false,
+                         bool compressed = false,
+                         bool print_progress = false);
+
 }  // namespace io
 }  // namespace open3d
@@ -24,13 +24,71 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "Open3D/IO/ClassIO/FeatureIO.h"
+#include "Open3D/IO/ClassIO/OctreeIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
+#include "Open3D/IO/ClassIO/VoxelGridIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Binary pose graphs and camera trajectories start with an 8-byte magic string
+// followed by any number of chunks. A chunk is a 16-byte header
+//
+//   uint32 record type, uint32 record size in bytes, uint64 number of records
+//
+// followed by the records, which have a fixed size and a size that is a
+// multiple of 8 bytes, so that the records of a chunk can be memory mapped as
+// an array. Appending data to a file adds a new chunk and leaves the existing
+// complete records untouched, a truncated last chunk left by an interrupted
+// append is cut back to its complete records first. The record layouts, in
+// little-endian byte order, are
+//
+//   node         double pose[16]
+//   edge         int32 source, int32 target, int32 uncertain, int32 0,
+//                double confidence, double transformation[16],
+//                double information[36] (or float information[36])
+//   camera       int32 width, int32 height, double intrinsic[9],
+//                double extrinsic[16]
+//
+// with matrices stored in column-major order.
+//
+// Octrees are stored without pointers, as the masks of a breadth-first
+// traversal. After the header
+//
+//   char magic[8], double origin[3], double size, uint64 max depth,
+//   uint32 root type (0 none, 1 internal, 2 leaf), uint32 0,
+//   uint64 number of internal nodes, uint64 number of leaf nodes
+//
+// every internal node, in breadth-first order, has two bytes: the mask of its
+// children, bit i set if child i exists, and the mask of the children that are
+// leaves. The masks are followed by zero padding up to a multiple of 8 bytes
+// and the colors of the leaves in breadth-first order, three doubles each.
+//
+// Voxel grids are stored as blocks of 8 x 8 x 8 voxels. After the header
+//
+//   char magic[8], double voxel size, double origin[3], uint32 has colors,
+//   uint32 block size, uint64 number of blocks, uint64 number of voxels
+//
+// come the blocks, each int32 block index[3] and uint32 number of voxels, then
+// a 64-byte occupancy mask per block with bit x + 8 y + 64 z set for the
+// voxel at that position inside the block, and finally the colors of the
+// voxels, 3 bytes each, in block and bit order.
+
 namespace open3d {
 
 namespace {
@@ -72,6 +130,412 @@ bool WriteMatrixXdToBINFile(FILE *file, const Eigen::MatrixXd &mat) {
     return true;
 }
 
+const char kPoseGraphBINMagic[8] = {'O', '3', 'D', 'P', 'G', 'B', '0', '1'};
+const char kTrajectoryBINMagic[8] = {'O', '3', 'D', 'C', 'T', 'B', '0', '1'};
+
+enum BINRecordType : std::uint32_t {
+    BIN_RECORD_NODE = 1,
+    BIN_RECORD_EDGE = 2,
+    BIN_RECORD_EDGE_FLOAT_INFORMATION = 3,
+    BIN_RECORD_CAMERA = 4,
+};
+
+const std::uint32_t kNodeRecordSize = 16 * 8;
+const std::uint32_t kEdgeRecordSize = 16 + 8 + 16 * 8 + 36 * 8;
+const std::uint32_t kEdgeFloatRecordSize = 16 + 8 + 16 * 8 + 36 * 4;
+const std::uint32_t kCameraRecordSize = 8 + 9 * 8 + 16 * 8;
+
+std::uint32_t GetBINRecordSize(std::uint32_t type) {
+    switch (type) {
+        case BIN_RECORD_NODE:
+            return kNodeRecordSize;
+        case BIN_RECORD_EDGE:
+            return kEdgeRecordSize;
+        case BIN_RECORD_EDGE_FLOAT_INFORMATION:
+            return kEdgeFloatRecordSize;
+        case BIN_RECORD_CAMERA:
+            return kCameraRecordSize;
+        default:
+            return 0;
+    }
+}
+
+void EncodeNodeRecord(const registration::PoseGraphNode &node, char *record) {
+    memcpy(record, node.pose_.data(), 16 * 8);
+}
+
+void DecodeNodeRecord(const char *record, registration::PoseGraphNode &node) {
+    memcpy(node.pose_.data(), record, 16 * 8);
+}
+
+void EncodeEdgeRecord(const registration::PoseGraphEdge &edge,
+                      bool float_information,
+                      char *record) {
+    std::int32_t header[4] = {edge.source_node_id_, edge.target_node_id_,
+                              edge.uncertain_ ? 1 : 0, 0};
+    memcpy(record, header, 16);
+    memcpy(record + 16, &edge.confidence_, 8);
+    memcpy(record + 24, edge.transformation_.data(), 16 * 8);
+    if (float_information) {
+        Eigen::Matrix<float, 6, 6> information =
+                edge.information_.cast<float>();
+        memcpy(record + 152, information.data(), 36 * 4);
+    } else {
+        memcpy(record + 152, edge.information_.data(), 36 * 8);
+    }
+}
+
+void DecodeEdgeRecord(const char *record,
+                      bool float_information,
+                      registration::PoseGraphEdge &edge) {
+    std::int32_t header[4];
+    memcpy(header, record, 16);
+    edge.source_node_id_ = header[0];
+    edge.target_node_id_ = header[1];
+    edge.uncertain_ = header[2] != 0;
+    memcpy(&edge.confidence_, record + 16, 8);
+    memcpy(edge.transformation_.data(), record + 24, 16 * 8);
+    if (float_information) {
+        Eigen::Matrix<float, 6, 6> information;
+        memcpy(information.data(), record + 152, 36 * 4);
+        edge.information_ = information.cast<double>();
+    } else {
+        memcpy(edge.information_.data(), record + 152, 36 * 8);
+    }
+}
+
+void EncodeCameraRecord(const camera::PinholeCameraParameters &parameters,
+                        char *record) {
+    std::int32_t size[2] = {parameters.intrinsic_.width_,
+                            parameters.intrinsic_.height_};
+    memcpy(record, size, 8);
+    memcpy(record + 8, parameters.intrinsic_.intrinsic_matrix_.data(), 9 * 8);
+    memcpy(record + 80, parameters.extrinsic_.data(), 16 * 8);
+}
+
+void DecodeCameraRecord(const char *record,
+                        camera::PinholeCameraParameters &parameters) {
+    std::int32_t size[2];
+    memcpy(size, record, 8);
+    parameters.intrinsic_.width_ = size[0];
+    parameters.intrinsic_.height_ = size[1];
+    memcpy(parameters.intrinsic_.intrinsic_matrix_.data(), record + 8, 9 * 8);
+    memcpy(parameters.extrinsic_.data(), record + 80, 16 * 8);
+}
+
+/// Writes a chunk of \p count records, encoded in parallel by
+/// encode(index, record).
+template <typename EncodeFunction>
+bool WriteBINChunk(FILE *file,
+                   std::uint32_t type,
+                   size_t count,
+                   EncodeFunction encode) {
+    if (count == 0) {
+        return true;
+    }
+    std::uint32_t header[2] = {type, GetBINRecordSize(type)};
+    std::uint64_t num_records = count;
+    std::vector<char> records(count * header[1]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(count); i++) {
+        encode(i, records.data() + size_t(i) * header[1]);
+    }
+    return fwrite(header, 4, 2, file) == 2 &&
+           fwrite(&num_records, 8, 1, file) == 1 &&
+           fwrite(records.data(), 1, records.size(), file) == records.size();
+}
+
+/// Walks the chunks of a file opened for appending and cuts off a truncated
+/// last chunk, as left by an interrupted append. The complete records of that
+/// chunk are kept by patching its record count. Leaves the file positioned at
+/// the end of the last complete record, where new chunks are written.
+bool RepairBINChunks(FILE *file) {
+    if (fseek(file, 0, SEEK_END) != 0) {
+        return false;
+    }
+    const std::uint64_t file_size = std::uint64_t(ftell(file));
+    std::uint64_t offset = 8;
+    while (offset + 16 <= file_size) {
+        std::uint32_t header[2];
+        std::uint64_t num_records;
+        if (fseek(file, long(offset), SEEK_SET) != 0 ||
+            fread(header, 4, 2, file) != 2 ||
+            fread(&num_records, 8, 1, file) != 1) {
+            return false;
+        }
+        if (GetBINRecordSize(header[0]) == 0 ||
+            GetBINRecordSize(header[0]) != header[1]) {
+            utility::LogWarning("Write BIN failed: unknown record type {:d}.",
+                                header[0]);
+            return false;
+        }
+        const std::uint64_t available =
+                (file_size - offset - 16) / header[1];
+        if (available >= num_records) {
+            offset += 16 + num_records * header[1];
+            continue;
+        }
+        if (available > 0) {
+            if (fseek(file, long(offset + 8), SEEK_SET) != 0 ||
+                fwrite(&available, 8, 1, file) != 1) {
+                return false;
+            }
+            offset += 16 + available * header[1];
+        }
+        break;
+    }
+    if (offset < file_size) {
+        utility::LogWarning(
+                "Write BIN: dropping {:d} bytes of a truncated chunk.",
+                file_size - offset);
+        if (!utility::filesystem::TruncateFile(file, size_t(offset))) {
+            return false;
+        }
+    }
+    return fseek(file, long(offset), SEEK_SET) == 0;
+}
+
+/// Opens \p filename for writing, or for appending if \p append is true and
+/// the file exists, and checks or writes the magic string.
+FILE *OpenBINFile(const std::string &filename,
+                  const char *magic,
+                  bool append) {
+    if (append && utility::filesystem::FileExists(filename)) {
+        FILE *file = utility::filesystem::FOpen(filename, "r+b");
+        if (file == NULL) {
+            utility::LogWarning("Write BIN failed: unable to open file: {}",
+                                filename);
+            return NULL;
+        }
+        char file_magic[8];
+        if (fread(file_magic, 1, 8, file) != 8 ||
+            memcmp(file_magic, magic, 8) != 0) {
+            utility::LogWarning(
+                    "Write BIN failed: {} is not a file of the same type.",
+                    filename);
+            fclose(file);
+            return NULL;
+        }
+        if (!RepairBINChunks(file)) {
+            utility::LogWarning("Write BIN failed: unable to repair {}.",
+                                filename);
+            fclose(file);
+            return NULL;
+        }
+        return file;
+    }
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return NULL;
+    }
+    if (fwrite(magic, 1, 8, file) != 8) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+        fclose(file);
+        return NULL;
+    }
+    return file;
+}
+
+/// Reads all chunks of a file and calls decode(type, records, count) for the
+/// records of every chunk. A truncated last chunk, as left by an interrupted
+/// append, is read up to its last complete record.
+template <typename DecodeFunction>
+bool ReadBINChunks(const std::string &filename,
+                   const char *magic,
+                   DecodeFunction decode) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    char file_magic[8];
+    if (fread(file_magic, 1, 8, file) != 8 ||
+        memcmp(file_magic, magic, 8) != 0) {
+        utility::LogWarning("Read BIN failed: unexpected file type.");
+        fclose(file);
+        return false;
+    }
+    std::vector<char> records;
+    while (true) {
+        std::uint32_t header[2];
+        std::uint64_t num_records;
+        size_t read = fread(header, 4, 2, file);
+        if (read == 0 && feof(file)) {
+            break;
+        }
+        if (read != 2 || fread(&num_records, 8, 1, file) != 1) {
+            utility::LogWarning("Read BIN: ignoring a truncated chunk.");
+            break;
+        }
+        if (GetBINRecordSize(header[0]) == 0 ||
+            GetBINRecordSize(header[0]) != header[1]) {
+            utility::LogWarning("Read BIN failed: unknown record type {:d}.",
+                                header[0]);
+            fclose(file);
+            return false;
+        }
+        // Records are read in blocks to bound the memory of the buffer.
+        const size_t block_records =
+                std::max(size_t(1), size_t(64 << 20) / header[1]);
+        bool truncated = false;
+        while (num_records > 0 && !truncated) {
+            size_t count =
+                    size_t(std::min<std::uint64_t>(num_records, block_records));
+            records.resize(count * header[1]);
+            size_t read_records = fread(records.data(), header[1], count, file);
+            if (read_records < count) {
+                utility::LogWarning(
+                        "Read BIN: ignoring {:d} records of a truncated "
+                        "chunk.",
+                        num_records - read_records);
+                truncated = true;
+            }
+            decode(header[0], records.data(), read_records);
+            num_records -= count;
+        }
+        if (truncated) {
+            break;
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+bool WritePoseGraphBINChunks(
+        const std::string &filename,
+        const std::vector<registration::PoseGraphNode> &nodes,
+        const std::vector<registration::PoseGraphEdge> &edges,
+        bool float_information,
+        bool append) {
+    FILE *file = OpenBINFile(filename, kPoseGraphBINMagic, append);
+    if (file == NULL) {
+        return false;
+    }
+    bool success =
+            WriteBINChunk(file, BIN_RECORD_NODE, nodes.size(),
+                          [&nodes](int i, char *record) {
+                              EncodeNodeRecord(nodes[i], record);
+                          }) &&
+            WriteBINChunk(file,
+                          float_information ? BIN_RECORD_EDGE_FLOAT_INFORMATION
+                                            : BIN_RECORD_EDGE,
+                          edges.size(),
+                          [&edges, float_information](int i, char *record) {
+                              EncodeEdgeRecord(edges[i], float_information,
+                                               record);
+                          });
+    if (!success) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+    }
+    fclose(file);
+    return success;
+}
+
+bool WriteTrajectoryBINChunks(
+        const std::string &filename,
+        const std::vector<camera::PinholeCameraParameters> &parameters,
+        bool append) {
+    FILE *file = OpenBINFile(filename, kTrajectoryBINMagic, append);
+    if (file == NULL) {
+        return false;
+    }
+    bool success = WriteBINChunk(file, BIN_RECORD_CAMERA, parameters.size(),
+                                 [&parameters](int i, char *record) {
+                                     EncodeCameraRecord(parameters[i], record);
+                                 });
+    if (!success) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+    }
+    fclose(file);
+    return success;
+}
+
+const char kOctreeBINMagic[8] = {'O', '3', 'D', 'O', 'C', 'B', '0', '1'};
+const char kVoxelGridBINMagic[8] = {'O', '3', 'D', 'V', 'X', 'B', '0', '1'};
+
+enum OctreeBINRootType : std::uint32_t {
+    OCTREE_BIN_ROOT_NONE = 0,
+    OCTREE_BIN_ROOT_INTERNAL = 1,
+    OCTREE_BIN_ROOT_LEAF = 2,
+};
+
+const size_t kOctreeBINHeaderSize = 8 + 4 * 8 + 8 + 8 + 2 * 8;
+const int kVoxelGridBINBlockBits = 3;
+const int kVoxelGridBINBlockSize = 1 << kVoxelGridBINBlockBits;
+const size_t kVoxelGridBINHeaderSize = 8 + 4 * 8 + 8 + 2 * 8;
+const size_t kVoxelGridBINMaskSize = 64;
+
+size_t AlignTo8(size_t size) { return (size + 7) / 8 * 8; }
+
+/// Reads a whole file with a single read.
+bool ReadBINFileToBuffer(const std::string &filename,
+                         std::vector<char> &buffer) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    buffer.resize(size > 0 ? size_t(size) : 0);
+    bool success =
+            fread(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+    }
+    return success;
+}
+
+bool WriteBufferToBINFile(const std::string &filename,
+                          const std::vector<char> &buffer) {
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success =
+            fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+    }
+    return success;
+}
+
+template <typename T>
+void AppendToBuffer(std::vector<char> &buffer, const T &value) {
+    const char *data = reinterpret_cast<const char *>(&value);
+    buffer.insert(buffer.end(), data, data + sizeof(T));
+}
+
+/// Returns the block index and the bit inside the block of a voxel.
+std::pair<Eigen::Vector3i, int> GetVoxelGridBINBlock(
+        const Eigen::Vector3i &grid_index) {
+    // Arithmetic shifts and masks round negative indices down.
+    Eigen::Vector3i block(grid_index(0) >> kVoxelGridBINBlockBits,
+                          grid_index(1) >> kVoxelGridBINBlockBits,
+                          grid_index(2) >> kVoxelGridBINBlockBits);
+    const int mask = kVoxelGridBINBlockSize - 1;
+    int bit = (grid_index(0) & mask) +
+              kVoxelGridBINBlockSize * ((grid_index(1) & mask) +
+                                        kVoxelGridBINBlockSize *
+                                                (grid_index(2) & mask));
+    return std::make_pair(block, bit);
+}
+
+std::uint8_t ColorToBINByte(double value) {
+    return std::uint8_t(std::min(255.0, std::max(0.0, value * 255.0)) + 0.5);
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -102,5 +566,466 @@ bool WriteFeatureToBIN(const std::string &filename,
     return success;
 }
 
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          registration::PoseGraph &pose_graph) {
+    pose_graph.nodes_.clear();
+    pose_graph.edges_.clear();
+    return ReadBINChunks(
+            filename, kPoseGraphBINMagic,
+            [&pose_graph](std::uint32_t type, const char *records,
+                          size_t count) {
+                const std::uint32_t size = GetBINRecordSize(type);
+                if (type == BIN_RECORD_NODE) {
+                    size_t offset = pose_graph.nodes_.size();
+                    pose_graph.nodes_.resize(offset + count);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+                    for (int i = 0; i < int(count); i++) {
+                        DecodeNodeRecord(records + size_t(i) * size,
+                                         pose_graph.nodes_[offset + i]);
+                    }
+                } else if (type == BIN_RECORD_EDGE ||
+                           type == BIN_RECORD_EDGE_FLOAT_INFORMATION) {
+                    bool float_information =
+                            type == BIN_RECORD_EDGE_FLOAT_INFORMATION;
+                    size_t offset = pose_graph.edges_.size();
+                    pose_graph.edges_.resize(offset + count);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+                    for (int i = 0; i < int(count); i++) {
+                        DecodeEdgeRecord(records + size_t(i) * size,
+                                         float_information,
+                                         pose_graph.edges_[offset + i]);
+                    }
+                }
+            });
+}
+
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const registration::PoseGraph &pose_graph,
+                         bool float_information /* = false*/) {
+    return WritePoseGraphBINChunks(filename, pose_graph.nodes_,
+                                   pose_graph.edges_, float_information, false);
+}
+
+bool AppendPoseGraphToBIN(
+        const std::string &filename,
+        const std::vector<registration::PoseGraphNode> &nodes,
+        const std::vector<registration::PoseGraphEdge> &edges,
+        bool float_information /* = false*/) {
+    return WritePoseGraphBINChunks(filename, nodes, edges, float_information,
+                                   true);
+}
+
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory) {
+    trajectory.parameters_.clear();
+    return ReadBINChunks(
+            filename, kTrajectoryBINMagic,
+            [&trajectory](std::uint32_t type, const char *records,
+                          size_t count) {
+                if (type != BIN_RECORD_CAMERA) return;
+                size_t offset = trajectory.parameters_.size();
+                trajectory.parameters_.resize(offset + count);
+                for (size_t i = 0; i < count; i++) {
+                    DecodeCameraRecord(records + i * kCameraRecordSize,
+                                       trajectory.parameters_[offset + i]);
+                }
+            });
+}
+
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory) {
+    return WriteTrajectoryBINChunks(filename, trajectory.parameters_, false);
+}
+
+bool AppendPinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const std::vector<camera::PinholeCameraParameters> &parameters) {
+    return WriteTrajectoryBINChunks(filename, parameters, true);
+}
+
+bool ReadOctreeFromBIN(const std::string &filename,
+                       geometry::Octree &octree,
+                       size_t *num_decoded_nodes /* = nullptr*/) {
+    if (num_decoded_nodes != nullptr) {
+        *num_decoded_nodes = 0;
+    }
+    std::vector<char> buffer;
+    if (!ReadBINFileToBuffer(filename, buffer)) {
+        return false;
+    }
+    if (buffer.size() < kOctreeBINHeaderSize ||
+        memcmp(buffer.data(), kOctreeBINMagic, 8) != 0) {
+        utility::LogWarning("Read BIN failed: unexpected file type.");
+        return false;
+    }
+    double bounds[4];
+    std::uint64_t max_depth, num_internal, num_leaves;
+    std::uint32_t root_type;
+    memcpy(bounds, buffer.data() + 8, 4 * 8);
+    memcpy(&max_depth, buffer.data() + 40, 8);
+    memcpy(&root_type, buffer.data() + 48, 4);
+    memcpy(&num_internal, buffer.data() + 56, 8);
+    memcpy(&num_leaves, buffer.data() + 64, 8);
+    const size_t masks_size = AlignTo8(size_t(num_internal) * 2);
+    if (num_internal > buffer.size() || num_leaves > buffer.size() ||
+        buffer.size() != kOctreeBINHeaderSize + masks_size +
+                                 size_t(num_leaves) * 3 * 8 ||
+        root_type > OCTREE_BIN_ROOT_LEAF ||
+        (root_type == OCTREE_BIN_ROOT_INTERNAL) != (num_internal > 0) ||
+        (root_type == OCTREE_BIN_ROOT_LEAF && num_leaves != 1) ||
+        (root_type == OCTREE_BIN_ROOT_NONE && num_leaves != 0)) {
+        utility::LogWarning("Read BIN failed: inconsistent octree header.");
+        return false;
+    }
+    const std::uint8_t *masks = reinterpret_cast<const std::uint8_t *>(
+            buffer.data() + kOctreeBINHeaderSize);
+    const char *colors = buffer.data() + kOctreeBINHeaderSize + masks_size;
+    auto create_leaf = [colors](size_t leaf) {
+        auto node = std::make_shared<geometry::OctreeColorLeafNode>();
+        memcpy(node->color_.data(), colors + leaf * 3 * 8, 3 * 8);
+        return node;
+    };
+
+    octree.Clear();
+    octree.origin_ = Eigen::Vector3d(bounds[0], bounds[1], bounds[2]);
+    octree.size_ = bounds[3];
+    octree.max_depth_ = size_t(max_depth);
+    if (root_type == OCTREE_BIN_ROOT_LEAF) {
+        octree.root_node_ = create_leaf(0);
+    } else if (root_type == OCTREE_BIN_ROOT_INTERNAL) {
+        // The masks are decoded in the order they were written, every
+        // internal child is appended to the queue of nodes to decode.
+        std::vector<geometry::OctreeInternalNode *> queue;
+        queue.reserve(size_t(num_internal));
+        auto root = std::make_shared<geometry::OctreeInternalNode>();
+        queue.push_back(root.get());
+        octree.root_node_ = root;
+        size_t next_leaf = 0;
+        bool valid = true;
+        for (size_t i = 0; i < queue.size() && valid; i++) {
+            std::uint8_t child_mask = masks[i * 2];
+            std::uint8_t leaf_mask = masks[i * 2 + 1];
+            valid = (leaf_mask & ~child_mask) == 0;
+            for (int c = 0; c < 8 && valid; c++) {
+                if (!(child_mask & (1 << c))) continue;
+                if (leaf_mask & (1 << c)) {
+                    valid = next_leaf < num_leaves;
+                    if (valid) {
+                        queue[i]->children_[c] = create_leaf(next_leaf++);
+                    }
+                } else {
+                    valid = queue.size() < num_internal;
+                    if (valid) {
+                        auto child = std::make_shared<
+                                geometry::OctreeInternalNode>();
+                        queue.push_back(child.get());
+                        queue[i]->children_[c] = child;
+                    }
+                }
+            }
+        }
+        if (!valid || queue.size() != num_internal ||
+            next_leaf != num_leaves) {
+            utility::LogWarning(
+                    "Read BIN failed: octree masks do not match the number "
+                    "of nodes.");
+            octree.Clear();
+            return false;
+        }
+    }
+    if (num_decoded_nodes != nullptr) {
+        *num_decoded_nodes = size_t(num_internal + num_leaves);
+    }
+    return true;
+}
+
+bool WriteOctreeToBIN(const std::string &filename,
+                      const geometry::Octree &octree) {
+    std::vector<std::uint8_t> masks;
+    std::vector<double> colors;
+    std::uint32_t root_type = OCTREE_BIN_ROOT_NONE;
+    auto append_leaf = [&colors](const geometry::OctreeNode *node) {
+        auto leaf = dynamic_cast<const geometry::OctreeColorLeafNode *>(node);
+        if (leaf == nullptr) {
+            utility::LogWarning(
+                    "Write BIN failed: only OctreeColorLeafNode leaves are "
+                    "supported.");
+            return false;
+        }
+        colors.insert(colors.end(), leaf->color_.data(),
+                      leaf->color_.data() + 3);
+        return true;
+    };
+    if (auto root = dynamic_cast<const geometry::OctreeInternalNode *>(
+                octree.root_node_.get())) {
+        root_type = OCTREE_BIN_ROOT_INTERNAL;
+        std::vector<const geometry::OctreeInternalNode *> queue(1, root);
+        for (size_t i = 0; i < queue.size(); i++) {
+            std::uint8_t child_mask = 0, leaf_mask = 0;
+            for (size_t c = 0; c < queue[i]->children_.size() && c < 8; c++) {
+                const geometry::OctreeNode *child =
+                        queue[i]->children_[c].get();
+                if (child == nullptr) continue;
+                child_mask |= std::uint8_t(1 << c);
+                if (auto internal = dynamic_cast<
+                            const geometry::OctreeInternalNode *>(child)) {
+                    queue.push_back(internal);
+                } else if (append_leaf(child)) {
+                    leaf_mask |= std::uint8_t(1 << c);
+                } else {
+                    return false;
+                }
+            }
+            masks.push_back(child_mask);
+            masks.push_back(leaf_mask);
+        }
+    } else if (octree.root_node_ != nullptr) {
+        if (!append_leaf(octree.root_node_.get())) {
+            return false;
+        }
+        root_type = OCTREE_BIN_ROOT_LEAF;
+    }
+
+    std::vector<char> buffer(kOctreeBINMagic, kOctreeBINMagic + 8);
+    buffer.reserve(kOctreeBINHeaderSize + AlignTo8(masks.size()) +
+                   colors.size() * 8);
+    for (int i = 0; i < 3; i++) {
+        AppendToBuffer(buffer, octree.origin_(i));
+    }
+    AppendToBuffer(buffer, octree.size_);
+    AppendToBuffer(buffer, std::uint64_t(octree.max_depth_));
+    AppendToBuffer(buffer, root_type);
+    AppendToBuffer(buffer, std::uint32_t(0));
+    AppendToBuffer(buffer, std::uint64_t(masks.size() / 2));
+    AppendToBuffer(buffer, std::uint64_t(colors.size() / 3));
+    buffer.insert(buffer.end(), masks.begin(), masks.end());
+    buffer.resize(AlignTo8(buffer.size()), 0);
+    const char *color_data = reinterpret_cast<const char *>(colors.data());
+    buffer.insert(buffer.end(), color_data, color_data + colors.size() * 8);
+    return WriteBufferToBINFile(filename, buffer);
+}
+
+bool ReadVoxelGridFromBIN(const std::string &filename,
+                          geometry::VoxelGrid &voxelgrid,
+                          bool print_progress /* = false*/) {
+    std::vector<char> buffer;
+    if (!ReadBINFileToBuffer(filename, buffer)) {
+        return false;
+    }
+    if (buffer.size() < kVoxelGridBINHeaderSize ||
+        memcmp(buffer.data(), kVoxelGridBINMagic, 8) != 0) {
+        utility::LogWarning("Read BIN failed: unexpected file type.");
+        return false;
+    }
+    double voxel_size, origin[3];
+    std::uint32_t has_colors, block_size;
+    std::uint64_t num_blocks, num_voxels;
+    memcpy(&voxel_size, buffer.data() + 8, 8);
+    memcpy(origin, buffer.data() + 16, 3 * 8);
+    memcpy(&has_colors, buffer.data() + 40, 4);
+    memcpy(&block_size, buffer.data() + 44, 4);
+    memcpy(&num_blocks, buffer.data() + 48, 8);
+    memcpy(&num_voxels, buffer.data() + 56, 8);
+    const size_t blocks_offset = kVoxelGridBINHeaderSize;
+    const size_t masks_offset = blocks_offset + size_t(num_blocks) * 16;
+    const size_t colors_offset =
+            masks_offset + size_t(num_blocks) * kVoxelGridBINMaskSize;
+    if (num_blocks > buffer.size() ||
+        num_voxels > num_blocks * kVoxelGridBINMaskSize * 8 ||
+        block_size != std::uint32_t(kVoxelGridBINBlockSize) ||
+        buffer.size() != colors_offset + (has_colors ? num_voxels * 3 : 0)) {
+        utility::LogWarning(
+                "Read BIN failed: inconsistent voxel grid header.");
+        return false;
+    }
+
+    // The offset of every block in the voxel array, from the voxel counts.
+    std::vector<size_t> voxel_offsets(size_t(num_blocks) + 1, 0);
+    for (size_t b = 0; b < num_blocks; b++) {
+        std::uint32_t count;
+        memcpy(&count, buffer.data() + blocks_offset + b * 16 + 12, 4);
+        voxel_offsets[b + 1] = voxel_offsets[b] + count;
+    }
+    if (voxel_offsets.back() != num_voxels) {
+        utility::LogWarning(
+                "Read BIN failed: voxel counts do not match the header.");
+        return false;
+    }
+    std::vector<geometry::Voxel> voxels(static_cast<size_t>(num_voxels));
+    std::atomic<bool> valid(true);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int b = 0; b < int(num_blocks); b++) {
+        std::int32_t block[4];
+        memcpy(block, buffer.data() + blocks_offset + size_t(b) * 16, 16);
+        const std::uint8_t *mask = reinterpret_cast<const std::uint8_t *>(
+                buffer.data() + masks_offset + b * kVoxelGridBINMaskSize);
+        size_t v = voxel_offsets[b];
+        for (int bit = 0; bit < int(kVoxelGridBINMaskSize) * 8; bit++) {
+            if (!(mask[bit / 8] & (1 << (bit % 8)))) continue;
+            if (v == voxel_offsets[b + 1]) {
+                v++;
+                break;
+            }
+            geometry::Voxel &voxel = voxels[v];
+            voxel.grid_index_ = Eigen::Vector3i(
+                    block[0] * kVoxelGridBINBlockSize +
+                            bit % kVoxelGridBINBlockSize,
+                    block[1] * kVoxelGridBINBlockSize +
+                            bit / kVoxelGridBINBlockSize %
+                                    kVoxelGridBINBlockSize,
+                    block[2] * kVoxelGridBINBlockSize +
+                            bit / (kVoxelGridBINBlockSize *
+                                   kVoxelGridBINBlockSize));
+            if (has_colors) {
+                const std::uint8_t *color =
+                        reinterpret_cast<const std::uint8_t *>(
+                                buffer.data() + colors_offset + v * 3);
+                voxel.color_ = Eigen::Vector3d(color[0], color[1], color[2]) /
+                               255.0;
+            }
+            v++;
+        }
+        if (v != voxel_offsets[b + 1]) {
+            valid = false;
+        }
+    }
+    if (!valid) {
+        utility::LogWarning(
+                "Read BIN failed: voxel masks do not match the voxel counts.");
+        return false;
+    }
+
+    voxelgrid.Clear();
+    voxelgrid.voxel_size_ = voxel_size;
+    voxelgrid.origin_ = Eigen::Vector3d(origin[0], origin[1], origin[2]);
+    utility::ConsoleProgressBar progress_bar(voxels.size(),
+                                             "Reading BIN: ", print_progress);
+    voxelgrid.voxels_.reserve(voxels.size());
+    for (const auto &voxel : voxels) {
+        voxelgrid.voxels_.emplace(voxel.grid_index_, voxel);
+        ++progress_bar;
+    }
+    return true;
+}
+
+bool WriteVoxelGridToBIN(const std::string &filename,
+                         const geometry::VoxelGrid &voxelgrid,
+                         bool write_ascii /* = false*/,
+                         bool compressed /* = false*/,
+                         bool print_progress /* = false*/) {
+    // Sort the voxels by block and by bit inside the block. When the blocks
+    // span less than 2^18 along every axis, the order is that of a 63-bit key
+    // made of the block index relative to the minimum block and the bit.
+    struct BlockVoxel {
+        Eigen::Vector3i block_;
+        int bit_;
+        std::uint64_t key_;
+        const geometry::Voxel *voxel_;
+    };
+    std::vector<BlockVoxel> block_voxels;
+    block_voxels.reserve(voxelgrid.voxels_.size());
+    Eigen::Vector3i min_block = Eigen::Vector3i::Constant(INT_MAX);
+    Eigen::Vector3i max_block = Eigen::Vector3i::Constant(INT_MIN);
+    for (const auto &it : voxelgrid.voxels_) {
+        auto block_bit = GetVoxelGridBINBlock(it.second.grid_index_);
+        block_voxels.push_back(
+                {block_bit.first, block_bit.second, 0, &it.second});
+        min_block = min_block.cwiseMin(block_bit.first);
+        max_block = max_block.cwiseMax(block_bit.first);
+    }
+    const std::int64_t kMaxKeyExtent = std::int64_t(1) << 18;
+    if (block_voxels.empty() ||
+        (std::int64_t(max_block(0)) - min_block(0) < kMaxKeyExtent &&
+         std::int64_t(max_block(1)) - min_block(1) < kMaxKeyExtent &&
+         std::int64_t(max_block(2)) - min_block(2) < kMaxKeyExtent)) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(block_voxels.size()); i++) {
+            BlockVoxel &v = block_voxels[i];
+            v.key_ = (std::uint64_t(v.block_(2) - min_block(2)) << 45) |
+                     (std::uint64_t(v.block_(1) - min_block(1)) << 27) |
+                     (std::uint64_t(v.block_(0) - min_block(0)) << 9) |
+                     std::uint64_t(v.bit_);
+        }
+        std::sort(block_voxels.begin(), block_voxels.end(),
+                  [](const BlockVoxel &a, const BlockVoxel &b) {
+                      return a.key_ < b.key_;
+                  });
+    } else {
+        std::sort(block_voxels.begin(), block_voxels.end(),
+                  [](const BlockVoxel &a, const BlockVoxel &b) {
+                      if (a.block_(2) != b.block_(2)) {
+                          return a.block_(2) < b.block_(2);
+                      }
+                      if (a.block_(1) != b.block_(1)) {
+                          return a.block_(1) < b.block_(1);
+                      }
+                      if (a.block_(0) != b.block_(0)) {
+                          return a.block_(0) < b.block_(0);
+                      }
+                      return a.bit_ < b.bit_;
+                  });
+    }
+    std::vector<size_t> block_starts;
+    for (size_t i = 0; i < block_voxels.size(); i++) {
+        if (i == 0 || block_voxels[i].block_ != block_voxels[i - 1].block_) {
+            block_starts.push_back(i);
+        }
+    }
+    const size_t num_blocks = block_starts.size();
+    block_starts.push_back(block_voxels.size());
+    const bool has_colors = voxelgrid.HasColors();
+
+    std::vector<char> buffer(kVoxelGridBINMagic, kVoxelGridBINMagic + 8);
+    AppendToBuffer(buffer, voxelgrid.voxel_size_);
+    for (int i = 0; i < 3; i++) {
+        AppendToBuffer(buffer, voxelgrid.origin_(i));
+    }
+    AppendToBuffer(buffer, std::uint32_t(has_colors ? 1 : 0));
+    AppendToBuffer(buffer, std::uint32_t(kVoxelGridBINBlockSize));
+    AppendToBuffer(buffer, std::uint64_t(num_blocks));
+    AppendToBuffer(buffer, std::uint64_t(block_voxels.size()));
+    const size_t blocks_offset = buffer.size();
+    const size_t masks_offset = blocks_offset + num_blocks * 16;
+    const size_t colors_offset =
+            masks_offset + num_blocks * kVoxelGridBINMaskSize;
+    buffer.resize(colors_offset + (has_colors ? block_voxels.size() * 3 : 0),
+                  0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int b = 0; b < int(num_blocks); b++) {
+        std::int32_t block[4] = {
+                block_voxels[block_starts[b]].block_(0),
+                block_voxels[block_starts[b]].block_(1),
+                block_voxels[block_starts[b]].block_(2),
+                std::int32_t(block_starts[b + 1] - block_starts[b])};
+        memcpy(buffer.data() + blocks_offset + size_t(b) * 16, block, 16);
+        std::uint8_t *mask = reinterpret_cast<std::uint8_t *>(
+                buffer.data() + masks_offset + b * kVoxelGridBINMaskSize);
+        for (size_t v = block_starts[b]; v < block_starts[b + 1]; v++) {
+            int bit = block_voxels[v].bit_;
+            mask[bit / 8] |= std::uint8_t(1 << (bit % 8));
+            if (has_colors) {
+                const Eigen::Vector3d &color = block_voxels[v].voxel_->color_;
+                char *out = buffer.data() + colors_offset + v * 3;
+                for (int i = 0; i < 3; i++) {
+                    out[i] = char(ColorToBINByte(color(i)));
+                }
+            }
+        }
+    }
+    return WriteBufferToBINFile(filename, buffer);
+}
+
 }  // namespace io
 }  // namespace open3d
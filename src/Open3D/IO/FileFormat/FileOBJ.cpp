@@ -24,7 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
 #include <numeric>
 #include <vector>
 
@@ -32,119 +38,689 @@
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/ParallelTextIO.h"
 
 #include <tiny_obj_loader.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace open3d {
-namespace io {
 
-bool ReadTriangleMeshFromOBJ(const std::string& filename,
-                             geometry::TriangleMesh& mesh,
-                             bool print_progress) {
-    tinyobj::attrib_t attrib;
-    std::vector<tinyobj::shape_t> shapes;
-    std::vector<tinyobj::material_t> materials;
-    std::string warn;
-    std::string err;
+namespace {
+
+// Size of the blocks an OBJ file is read in.
+const size_t kOBJBlockSize = size_t(64) << 20;
+
+enum class OBJLineType {
+    Vertex,
+    TexCoord,
+    Normal,
+    Face,
+    UseMaterial,
+    MaterialLibrary,
+    Other
+};
+
+// A newline-aligned part of an OBJ file that is parsed by one thread.
+struct OBJChunk {
+    const char *begin_ = nullptr;
+    const char *end_ = nullptr;
+    // Counts in this chunk, then offsets of the first element of this chunk.
+    size_t num_vertices_ = 0;
+    size_t num_texcoords_ = 0;
+    size_t num_normals_ = 0;
+    size_t num_triangles_ = 0;
+    // Last usemtl name in this chunk.
+    bool has_material_ = false;
+    std::string last_material_;
+    std::vector<std::string> material_libraries_;
+    // Material in use at the beginning of this chunk.
+    int material_id_ = -1;
+    // A vertex in this chunk has at least six values, i.e. possibly a color.
+    bool has_color_values_ = false;
+    bool has_colors_ = false;
+    bool all_uvs_ = true;
+    std::string error_;
+};
+
+bool IsBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+const char *SkipBlanks(const char *p, const char *end) {
+    while (p < end && IsBlank(*p)) {
+        ++p;
+    }
+    return p;
+}
 
-    std::string mtl_base_path =
-            utility::filesystem::GetFileParentDirectory(filename);
-    bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err,
-                                filename.c_str(), mtl_base_path.c_str());
-    if (!warn.empty()) {
-        utility::LogWarning("Read OBJ failed: {}", warn);
+std::string TrimmedString(const char *begin, const char *end) {
+    begin = SkipBlanks(begin, end);
+    while (end > begin && IsBlank(end[-1])) {
+        --end;
+    }
+    return std::string(begin, end);
+}
+
+// Identifies the keyword of the line starting at p and moves p behind it.
+OBJLineType ParseKeyword(const char *&p, const char *end) {
+    p = SkipBlanks(p, end);
+    const char *q = p;
+    while (q < end && !IsBlank(*q)) {
+        ++q;
+    }
+    if (q == end || !IsBlank(*q)) {
+        // A keyword needs arguments.
+        return OBJLineType::Other;
+    }
+    size_t length = q - p;
+    OBJLineType type = OBJLineType::Other;
+    if (length == 1 && p[0] == 'v') {
+        type = OBJLineType::Vertex;
+    } else if (length == 2 && p[0] == 'v' && p[1] == 't') {
+        type = OBJLineType::TexCoord;
+    } else if (length == 2 && p[0] == 'v' && p[1] == 'n') {
+        type = OBJLineType::Normal;
+    } else if (length == 1 && p[0] == 'f') {
+        type = OBJLineType::Face;
+    } else if (length == 6 && std::strncmp(p, "usemtl", 6) == 0) {
+        type = OBJLineType::UseMaterial;
+    } else if (length == 6 && std::strncmp(p, "mtllib", 6) == 0) {
+        type = OBJLineType::MaterialLibrary;
     }
-    if (!err.empty()) {
-        utility::LogWarning("Read OBJ failed: {}", err);
+    p = q;
+    return type;
+}
+
+int CountTokens(const char *p, const char *end) {
+    int count = 0;
+    while (true) {
+        p = SkipBlanks(p, end);
+        if (p == end) {
+            return count;
+        }
+        count++;
+        while (p < end && !IsBlank(*p)) {
+            ++p;
+        }
     }
+}
 
-    if (!ret) {
+// Parses an index of a face corner. Positive indices start at 1, negative
+// indices are relative to the count of elements read so far.
+bool ParseIndex(const char *&p,
+                const char *end,
+                size_t count,
+                size_t total,
+                int& index) {
+    bool negative = p < end && *p == '-';
+    const char *q = negative || (p < end && *p == '+') ? p + 1 : p;
+    if (q == end || *q < '0' || *q > '9') {
+        return false;
+    }
+    long long value = 0;
+    for (; q < end && *q >= '0' && *q <= '9'; ++q) {
+        value = std::min(value * 10 + (*q - '0'), 1ll << 40);
+    }
+    p = q;
+    if (value == 0) {
         return false;
     }
+    value = negative ? (long long)count - value : value - 1;
+    if (value < 0 || value >= (long long)total) {
+        return false;
+    }
+    index = int(value);
+    return true;
+}
 
-    mesh.Clear();
+// Parses a v, v/vt, v//vn or v/vt/vn face corner. Missing texture coordinate
+// or normal indices are -1.
+bool ParseFaceCorner(const char *&p,
+                     const char *end,
+                     const size_t counts[3],
+                     const size_t totals[3],
+                     Eigen::Vector3i& corner) {
+    corner = Eigen::Vector3i(-1, -1, -1);
+    if (!ParseIndex(p, end, counts[0], totals[0], corner(0))) {
+        return false;
+    }
+    for (int k = 1; k < 3 && p < end && *p == '/'; k++) {
+        ++p;
+        if (p < end && *p != '/' && !IsBlank(*p) &&
+            !ParseIndex(p, end, counts[k], totals[k], corner(k))) {
+            return false;
+        }
+    }
+    return p == end || IsBlank(*p);
+}
 
-    // copy vertex and data
-    for (size_t vidx = 0; vidx < attrib.vertices.size(); vidx += 3) {
-        tinyobj::real_t vx = attrib.vertices[vidx + 0];
-        tinyobj::real_t vy = attrib.vertices[vidx + 1];
-        tinyobj::real_t vz = attrib.vertices[vidx + 2];
-        mesh.vertices_.push_back(Eigen::Vector3d(vx, vy, vz));
+// Point in triangle test in the projection of the polygon.
+bool IsPointInTriangle(const double vx[3],
+                       const double vy[3],
+                       double tx,
+                       double ty) {
+    bool inside = false;
+    for (int i = 0, j = 2; i < 3; j = i++) {
+        if (((vy[i] > ty) != (vy[j] > ty)) &&
+            (tx < (vx[j] - vx[i]) * (ty - vy[i]) / (vy[j] - vy[i]) + vx[i])) {
+            inside = !inside;
+        }
     }
+    return inside;
+}
 
-    for (size_t vidx = 0; vidx < attrib.colors.size(); vidx += 3) {
-        tinyobj::real_t r = attrib.colors[vidx + 0];
-        tinyobj::real_t g = attrib.colors[vidx + 1];
-        tinyobj::real_t b = attrib.colors[vidx + 2];
-        mesh.vertex_colors_.push_back(Eigen::Vector3d(r, g, b));
+// Triangulates a polygon by ear clipping in its dominant projection plane,
+// with the same vertex order as tinyobjloader. For convex polygons this is a
+// fan around the first corner. Appends n - 2 triangles of corner positions.
+void TriangulatePolygon(const std::vector<Eigen::Vector3d>& vertices,
+                        const std::vector<Eigen::Vector3i>& corners,
+                        std::vector<Eigen::Vector3i>& triangles) {
+    int n = int(corners.size());
+    if (n == 3) {
+        triangles.push_back(Eigen::Vector3i(0, 1, 2));
+        return;
+    }
+    auto vertex = [&](int k) -> const Eigen::Vector3d& {
+        return vertices[corners[k](0)];
+    };
+
+    int axes[2] = {1, 2};
+    for (int k = 0; k < n; k++) {
+        Eigen::Vector3d e0 = vertex((k + 1) % n) - vertex(k);
+        Eigen::Vector3d e1 = vertex((k + 2) % n) - vertex((k + 1) % n);
+        Eigen::Vector3d c = e0.cross(e1).cwiseAbs();
+        const double eps = std::numeric_limits<double>::epsilon();
+        if (c(0) > eps || c(1) > eps || c(2) > eps) {
+            if (!(c(0) > c(1) && c(0) > c(2))) {
+                axes[0] = 0;
+                if (c(2) > c(0) && c(2) > c(1)) {
+                    axes[1] = 1;
+                }
+            }
+            break;
+        }
+    }
+    double area = 0;
+    for (int k = 0; k < n; k++) {
+        const Eigen::Vector3d& v0 = vertex(k);
+        const Eigen::Vector3d& v1 = vertex((k + 1) % n);
+        area += (v0(axes[0]) * v1(axes[1]) - v0(axes[1]) * v1(axes[0])) * 0.5;
     }
 
-    // resize normal data and create bool indicator vector
-    mesh.vertex_normals_.resize(mesh.vertices_.size());
-    std::vector<bool> normals_indicator(mesh.vertices_.size(), false);
+    std::vector<int> remaining(n);
+    std::iota(remaining.begin(), remaining.end(), 0);
+    int guess = 0;
+    int iterations = n;
+    int previous_size = n;
+    while (remaining.size() > 3 && iterations > 0) {
+        int m = int(remaining.size());
+        if (guess >= m) {
+            guess -= m;
+        }
+        if (previous_size != m) {
+            previous_size = m;
+            iterations = m;
+        } else {
+            iterations--;
+        }
+        int ear[3];
+        double vx[3], vy[3];
+        for (int k = 0; k < 3; k++) {
+            ear[k] = remaining[(guess + k) % m];
+            vx[k] = vertex(ear[k])(axes[0]);
+            vy[k] = vertex(ear[k])(axes[1]);
+        }
+        double cross = (vx[1] - vx[0]) * (vy[2] - vy[1]) -
+                       (vy[1] - vy[0]) * (vx[2] - vx[1]);
+        if (cross * area < 0.0) {
+            // Reflex corner.
+            guess++;
+            continue;
+        }
+        bool overlap = false;
+        for (int k = 3; k < m && !overlap; k++) {
+            const Eigen::Vector3d& v = vertex(remaining[(guess + k) % m]);
+            overlap = IsPointInTriangle(vx, vy, v(axes[0]), v(axes[1]));
+        }
+        if (overlap) {
+            guess++;
+            continue;
+        }
+        triangles.push_back(Eigen::Vector3i(ear[0], ear[1], ear[2]));
+        remaining.erase(remaining.begin() + (guess + 1) % m);
+    }
+    // Degenerate polygons without ears are closed with a fan.
+    for (size_t k = 2; k < remaining.size(); k++) {
+        triangles.push_back(
+                Eigen::Vector3i(remaining[0], remaining[k - 1], remaining[k]));
+    }
+}
 
-    // copy face data and copy normals data
-    // append face-wise uv data
-    for (size_t s = 0; s < shapes.size(); s++) {
-        size_t index_offset = 0;
-        for (size_t f = 0; f < shapes[s].mesh.num_face_vertices.size(); f++) {
-            int fv = shapes[s].mesh.num_face_vertices[f];
-            if (fv != 3) {
-                utility::LogWarning(
-                        "Read OBJ failed: facet with number of vertices not "
-                        "equal to 3");
-                return false;
-            }
+// Counts the elements of a chunk and collects its material statements.
+void ScanOBJChunk(OBJChunk& chunk) {
+    for (const char *line = chunk.begin_; line < chunk.end_;) {
+        const char *line_end = static_cast<const char *>(
+                memchr(line, '\n', chunk.end_ - line));
+        line_end = line_end == nullptr ? chunk.end_ : line_end;
+        const char *p = line;
+        switch (ParseKeyword(p, line_end)) {
+            case OBJLineType::Vertex:
+                chunk.num_vertices_++;
+                if (CountTokens(p, line_end) >= 6) {
+                    chunk.has_color_values_ = true;
+                }
+                break;
+            case OBJLineType::TexCoord:
+                chunk.num_texcoords_++;
+                break;
+            case OBJLineType::Normal:
+                chunk.num_normals_++;
+                break;
+            case OBJLineType::Face:
+                chunk.num_triangles_ +=
+                        std::max(CountTokens(p, line_end) - 2, 0);
+                break;
+            case OBJLineType::UseMaterial:
+                chunk.has_material_ = true;
+                chunk.last_material_ = TrimmedString(p, line_end);
+                break;
+            case OBJLineType::MaterialLibrary:
+                chunk.material_libraries_.push_back(
+                        TrimmedString(p, line_end));
+                break;
+            default:
+                break;
+        }
+        line = line_end + 1;
+    }
+}
 
-            Eigen::Vector3i facet;
-            for (int v = 0; v < fv; v++) {
-                tinyobj::index_t idx = shapes[s].mesh.indices[index_offset + v];
-                int vidx = idx.vertex_index;
-                facet(v) = vidx;
-
-                if (!attrib.normals.empty() && !normals_indicator[vidx] &&
-                    (3 * idx.normal_index + 2) < int(attrib.normals.size())) {
-                    tinyobj::real_t nx =
-                            attrib.normals[3 * idx.normal_index + 0];
-                    tinyobj::real_t ny =
-                            attrib.normals[3 * idx.normal_index + 1];
-                    tinyobj::real_t nz =
-                            attrib.normals[3 * idx.normal_index + 2];
-                    mesh.vertex_normals_[vidx](0) = nx;
-                    mesh.vertex_normals_[vidx](1) = ny;
-                    mesh.vertex_normals_[vidx](2) = nz;
-                    normals_indicator[vidx] = true;
+// Parses the vertices, texture coordinates and normals of a chunk.
+void ParseOBJChunkVertices(OBJChunk& chunk,
+                           geometry::TriangleMesh& mesh,
+                           std::vector<Eigen::Vector2d>& texcoords,
+                           std::vector<Eigen::Vector3d>& normals) {
+    size_t v = chunk.num_vertices_;
+    size_t vt = chunk.num_texcoords_;
+    size_t vn = chunk.num_normals_;
+    for (const char *line = chunk.begin_; line < chunk.end_;) {
+        const char *line_end = static_cast<const char *>(
+                memchr(line, '\n', chunk.end_ - line));
+        line_end = line_end == nullptr ? chunk.end_ : line_end;
+        const char *p = line;
+        double values[6] = {0, 0, 0, 1, 1, 1};
+        int num_values = 0;
+        switch (ParseKeyword(p, line_end)) {
+            case OBJLineType::Vertex:
+                // Missing coordinates are 0, colors need all three values.
+                while (num_values < 6 &&
+                       utility::ParseDouble(p, line_end, values[num_values])) {
+                    num_values++;
+                }
+                if (num_values < 6) {
+                    std::fill(values + 3, values + 6, 1.0);
+                } else {
+                    chunk.has_colors_ = true;
+                }
+                mesh.vertices_[v] = Eigen::Vector3d(values[0], values[1],
+                                                    values[2]);
+                if (!mesh.vertex_colors_.empty()) {
+                    mesh.vertex_colors_[v] =
+                            Eigen::Vector3d(values[3], values[4], values[5]);
                 }
+                v++;
+                break;
+            case OBJLineType::TexCoord:
+                if (utility::ParseDouble(p, line_end, values[0])) {
+                    utility::ParseDouble(p, line_end, values[1]);
+                }
+                texcoords[vt++] = Eigen::Vector2d(values[0], values[1]);
+                break;
+            case OBJLineType::Normal:
+                while (num_values < 3 &&
+                       utility::ParseDouble(p, line_end, values[num_values])) {
+                    num_values++;
+                }
+                normals[vn++] = Eigen::Vector3d(values[0], values[1],
+                                                values[2]);
+                break;
+            default:
+                break;
+        }
+        line = line_end + 1;
+    }
+}
 
-                if (!attrib.texcoords.empty() &&
-                    2 * idx.texcoord_index + 1 < int(attrib.texcoords.size())) {
-                    tinyobj::real_t tx =
-                            attrib.texcoords[2 * idx.texcoord_index + 0];
-                    tinyobj::real_t ty =
-                            attrib.texcoords[2 * idx.texcoord_index + 1];
-                    mesh.triangle_uvs_.push_back(Eigen::Vector2d(tx, ty));
+// Parses and triangulates the faces of a chunk.
+void ParseOBJChunkFaces(OBJChunk& chunk,
+                        const std::map<std::string, int>& material_map,
+                        const std::vector<Eigen::Vector2d>& texcoords,
+                        const size_t totals[3],
+                        geometry::TriangleMesh& mesh,
+                        std::vector<int>& corner_normals) {
+    // Element counts before the current line, for relative indices.
+    size_t counts[3] = {chunk.num_vertices_, chunk.num_texcoords_,
+                        chunk.num_normals_};
+    size_t t = chunk.num_triangles_;
+    int material_id = chunk.material_id_;
+    std::vector<Eigen::Vector3i> corners;
+    std::vector<Eigen::Vector3i> polygon_triangles;
+    for (const char *line = chunk.begin_; line < chunk.end_;) {
+        const char *line_end = static_cast<const char *>(
+                memchr(line, '\n', chunk.end_ - line));
+        line_end = line_end == nullptr ? chunk.end_ : line_end;
+        const char *p = line;
+        switch (ParseKeyword(p, line_end)) {
+            case OBJLineType::Vertex:
+                counts[0]++;
+                break;
+            case OBJLineType::TexCoord:
+                counts[1]++;
+                break;
+            case OBJLineType::Normal:
+                counts[2]++;
+                break;
+            case OBJLineType::UseMaterial: {
+                auto it = material_map.find(TrimmedString(p, line_end));
+                material_id = it == material_map.end() ? -1 : it->second;
+                break;
+            }
+            case OBJLineType::Face: {
+                corners.clear();
+                while ((p = SkipBlanks(p, line_end)) < line_end) {
+                    Eigen::Vector3i corner;
+                    if (!ParseFaceCorner(p, line_end, counts, totals,
+                                         corner)) {
+                        chunk.error_ = "invalid face \"" +
+                                       TrimmedString(line, line_end) + "\"";
+                        return;
+                    }
+                    corners.push_back(corner);
+                }
+                if (corners.size() < 3) {
+                    break;
                 }
+                polygon_triangles.clear();
+                TriangulatePolygon(mesh.vertices_, corners, polygon_triangles);
+                for (const auto& triangle : polygon_triangles) {
+                    for (int k = 0; k < 3; k++) {
+                        const Eigen::Vector3i& corner = corners[triangle(k)];
+                        mesh.triangles_[t](k) = corner(0);
+                        if (corner(1) < 0) {
+                            chunk.all_uvs_ = false;
+                        } else {
+                            mesh.triangle_uvs_[3 * t + k] =
+                                    texcoords[corner(1)];
+                        }
+                        if (corner(2) >= 0) {
+                            corner_normals[3 * t + k] = corner(2);
+                        }
+                    }
+                    mesh.triangle_material_ids_[t++] = material_id;
+                }
+                break;
             }
-            mesh.triangles_.push_back(facet);
-            mesh.triangle_material_ids_.push_back(
-                    shapes[s].mesh.material_ids[f]);
-            index_offset += fv;
+            default:
+                break;
+        }
+        line = line_end + 1;
+    }
+}
+
+// Loads the first material library of an mtllib statement that exists.
+void LoadMaterialLibrary(const std::string& base_path,
+                         const std::string& libraries,
+                         std::vector<tinyobj::material_t>& materials,
+                         std::map<std::string, int>& material_map) {
+    std::vector<std::string> filenames;
+    utility::SplitString(filenames, libraries, " \t");
+    for (const auto& library : filenames) {
+        std::ifstream stream((base_path + library).c_str());
+        if (stream) {
+            std::string warn, err;
+            tinyobj::LoadMtl(&material_map, &materials, &stream, &warn, &err);
+            if (!warn.empty()) {
+                utility::LogWarning("Read OBJ: {}", warn);
+            }
+            if (!err.empty()) {
+                utility::LogWarning("Read OBJ: {}", err);
+            }
+            return;
+        }
+    }
+    utility::LogWarning("Read OBJ: unable to open material library {}",
+                        libraries);
+}
+
+// Splits a block of complete lines into num_chunks newline-aligned chunks.
+void SplitOBJBlock(const char *data,
+                   const char *data_end,
+                   int num_chunks,
+                   OBJChunk *chunks) {
+    for (int c = 0; c < num_chunks; c++) {
+        const char *p = c == 0 ? data : chunks[c - 1].end_;
+        chunks[c].begin_ = p;
+        p = std::max(p, data + (data_end - data) * (c + 1) / num_chunks);
+        if (p > data && p < data_end && p[-1] != '\n') {
+            p = static_cast<const char *>(memchr(p, '\n', data_end - p));
+            p = p == nullptr ? data_end : p + 1;
         }
+        chunks[c].end_ = p;
     }
+}
 
-    // if not all normals have been set, then remove the vertex normals
-    bool all_normals_set =
-            std::accumulate(normals_indicator.begin(), normals_indicator.end(),
-                            true, [](bool a, bool b) { return a && b; });
-    if (!all_normals_set) {
-        mesh.vertex_normals_.clear();
+// Reads the file from its start in blocks of complete lines and calls
+// process with each block until it returns false. Every pass over the same
+// file sees the same blocks.
+bool ForEachOBJBlock(
+        std::ifstream& file,
+        std::vector<char>& buffer,
+        const std::function<bool(const char *, const char *)>& process) {
+    file.clear();
+    file.seekg(0);
+    buffer.resize(kOBJBlockSize);
+    size_t carry = 0;
+    bool eof = false;
+    while (!eof) {
+        file.read(buffer.data() + carry, buffer.size() - carry);
+        if (file.bad()) {
+            return false;
+        }
+        size_t size = carry + size_t(file.gcount());
+        eof = size < buffer.size();
+        const char *data = buffer.data();
+        const char *data_end = data + size;
+        if (!eof) {
+            // Only complete lines, the rest is carried over.
+            while (data_end > data && data_end[-1] != '\n') {
+                --data_end;
+            }
+            if (data_end == data) {
+                // A single line fills the buffer.
+                carry = size;
+                buffer.resize(buffer.size() * 2);
+                continue;
+            }
+        }
+        if (!process(data, data_end)) {
+            return false;
+        }
+        carry = size_t(data + size - data_end);
+        std::memmove(buffer.data(), data_end, carry);
     }
+    return true;
+}
 
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadTriangleMeshFromOBJ(const std::string& filename,
+                             geometry::TriangleMesh& mesh,
+                             bool print_progress) {
+    std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!file) {
+        utility::LogWarning("Read OBJ failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    // The file is read in blocks, three times: to count the elements, to
+    // parse the vertices and to parse the faces. Each block is split into
+    // chunks of complete lines that are processed in parallel.
+    int num_chunks = 1;
+#ifdef _OPENMP
+    num_chunks = omp_get_max_threads() * 4;
+#endif
+    std::vector<char> buffer;
+    std::vector<OBJChunk> chunks;
+    bool read = ForEachOBJBlock(
+            file, buffer, [&](const char *data, const char *data_end) {
+                size_t first = chunks.size();
+                chunks.resize(first + num_chunks);
+                SplitOBJBlock(data, data_end, num_chunks, &chunks[first]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+                for (int c = 0; c < num_chunks; c++) {
+                    ScanOBJChunk(chunks[first + c]);
+                }
+                return true;
+            });
+    if (!read) {
+        utility::LogWarning("Read OBJ failed: unable to read file: {}",
+                            filename);
+        return false;
+    }
+
+    // Turn the counts into offsets and load the materials in file order.
+    std::string mtl_base_path =
+            utility::filesystem::GetFileParentDirectory(filename);
+    std::vector<tinyobj::material_t> materials;
+    std::map<std::string, int> material_map;
+    size_t totals[3] = {0, 0, 0};
+    size_t num_triangles = 0;
+    bool has_color_values = false;
+    int material_id = -1;
+    for (auto& chunk : chunks) {
+        size_t chunk_vertices = chunk.num_vertices_;
+        size_t chunk_texcoords = chunk.num_texcoords_;
+        size_t chunk_normals = chunk.num_normals_;
+        size_t chunk_triangles = chunk.num_triangles_;
+        has_color_values = has_color_values || chunk.has_color_values_;
+        chunk.num_vertices_ = totals[0];
+        chunk.num_texcoords_ = totals[1];
+        chunk.num_normals_ = totals[2];
+        chunk.num_triangles_ = num_triangles;
+        totals[0] += chunk_vertices;
+        totals[1] += chunk_texcoords;
+        totals[2] += chunk_normals;
+        num_triangles += chunk_triangles;
+        for (const auto& library : chunk.material_libraries_) {
+            LoadMaterialLibrary(mtl_base_path, library, materials,
+                                material_map);
+        }
+        chunk.material_id_ = material_id;
+        if (chunk.has_material_) {
+            auto it = material_map.find(chunk.last_material_);
+            material_id = it == material_map.end() ? -1 : it->second;
+        }
+    }
+
+    // Colors, texture coordinates and normals are only allocated if the file
+    // has them.
+    mesh.Clear();
+    mesh.vertices_.resize(totals[0]);
+    if (has_color_values) {
+        mesh.vertex_colors_.resize(totals[0]);
+    }
+    mesh.triangles_.resize(num_triangles);
+    if (totals[1] > 0) {
+        mesh.triangle_uvs_.resize(3 * num_triangles);
+    }
+    mesh.triangle_material_ids_.resize(num_triangles);
+    std::vector<Eigen::Vector2d> texcoords(totals[1]);
+    std::vector<Eigen::Vector3d> normals(totals[2]);
+    std::vector<int> corner_normals(totals[2] > 0 ? 3 * num_triangles : 0,
+                                    -1);
+    // Every pass splits the blocks into the same chunks as the first one.
+    auto parse_blocks = [&](const std::function<void(OBJChunk&)>& parse) {
+        size_t first = 0;
+        bool read = ForEachOBJBlock(
+                file, buffer, [&](const char *data, const char *data_end) {
+                    if (first + num_chunks > chunks.size()) {
+                        return false;
+                    }
+                    SplitOBJBlock(data, data_end, num_chunks,
+                                  &chunks[first]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+                    for (int c = 0; c < num_chunks; c++) {
+                        parse(chunks[first + c]);
+                    }
+                    first += num_chunks;
+                    return true;
+                });
+        return read && first == chunks.size();
+    };
+    read = parse_blocks([&](OBJChunk& chunk) {
+        ParseOBJChunkVertices(chunk, mesh, texcoords, normals);
+    });
+    // Polygons are triangulated with the coordinates of all vertices.
+    read = read && parse_blocks([&](OBJChunk& chunk) {
+               ParseOBJChunkFaces(chunk, material_map, texcoords, totals,
+                                  mesh, corner_normals);
+           });
+    file.close();
+    if (!read) {
+        utility::LogWarning("Read OBJ failed: unable to read file: {}",
+                            filename);
+        mesh.Clear();
+        return false;
+    }
+
+    bool has_colors = false;
+    bool all_uvs = true;
+    for (const auto& chunk : chunks) {
+        if (!chunk.error_.empty()) {
+            utility::LogWarning("Read OBJ failed: {}", chunk.error_);
+            mesh.Clear();
+            return false;
+        }
+        has_colors = has_colors || chunk.has_colors_;
+        all_uvs = all_uvs && chunk.all_uvs_;
+    }
+    if (!has_colors) {
+        mesh.vertex_colors_.clear();
+    }
     // if not all triangles have corresponding uvs, then remove uvs
-    if (3 * mesh.triangles_.size() != mesh.triangle_uvs_.size()) {
+    if (!all_uvs) {
         mesh.triangle_uvs_.clear();
     }
 
+    // Each vertex takes the normal of its first face corner with a normal.
+    if (!corner_normals.empty()) {
+        mesh.vertex_normals_.resize(mesh.vertices_.size());
+        std::vector<bool> normals_indicator(mesh.vertices_.size(), false);
+        for (size_t i = 0; i < corner_normals.size(); i++) {
+            int vidx = mesh.triangles_[i / 3](i % 3);
+            if (corner_normals[i] >= 0 && !normals_indicator[vidx]) {
+                mesh.vertex_normals_[vidx] = normals[corner_normals[i]];
+                normals_indicator[vidx] = true;
+            }
+        }
+        // if not all normals have been set, then remove the vertex normals
+        bool all_normals_set = std::accumulate(
+                normals_indicator.begin(), normals_indicator.end(), true,
+                [](bool a, bool b) { return a && b; });
+        if (!all_normals_set) {
+            mesh.vertex_normals_.clear();
+        }
+    }
+
     // Now we assert only one shape is stored, we only select the first
     // diffuse material
     for (auto& material : materials) {
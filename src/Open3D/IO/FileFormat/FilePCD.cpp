@@ -25,14 +25,29 @@
 // ----------------------------------------------------------------------------
 
 #include <liblzf/lzf.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
 #include <sstream>
+#include <type_traits>
+#include <vector>
 
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/TensorMapIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/ParallelTextIO.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 // References for PCD file IO
 // http://pointclouds.org/documentation/tutorials/pcd_file_format.php
@@ -50,6 +65,11 @@ enum PCDDataType {
     PCD_DATA_BINARY_COMPRESSED = 2
 };
 
+// Chunked binary_compressed data is followed by a table with the uncompressed
+// chunk size, the number of chunks, the compressed size of each chunk and this
+// magic string. Other PCD readers ignore data after the compressed block.
+const char kPCDChunkTableMagic[8] = {'O', '3', 'D', 'L', 'Z', 'F', 'C', 'T'};
+
 struct PCLPointField {
 public:
     std::string name;
@@ -78,7 +98,7 @@ public:
     bool has_colors;
 };
 
-bool CheckHeader(PCDHeader &header) {
+bool CheckHeader(PCDHeader &header, bool require_points) {
     if (header.points <= 0 || header.pointsize <= 0) {
         utility::LogWarning("[CheckHeader] PCD has no data.");
         return false;
@@ -120,7 +140,7 @@ bool CheckHeader(PCDHeader &header) {
     header.has_points = (has_x && has_y && has_z);
     header.has_normals = (has_normal_x && has_normal_y && has_normal_z);
     header.has_colors = (has_rgb || has_rgba);
-    if (header.has_points == false) {
+    if (require_points && header.has_points == false) {
         utility::LogWarning(
                 "[CheckHeader] Fields for point data are not complete.");
         return false;
@@ -128,7 +148,9 @@ bool CheckHeader(PCDHeader &header) {
     return true;
 }
 
-bool ReadPCDHeader(FILE *file, PCDHeader &header) {
+bool ReadPCDHeader(FILE *file,
+                   PCDHeader &header,
+                   bool require_points = true) {
     char line_buffer[DEFAULT_IO_BUFFER_SIZE];
     size_t specified_channel_count = 0;
 
@@ -228,7 +250,7 @@ bool ReadPCDHeader(FILE *file, PCDHeader &header) {
             break;
         }
     }
-    if (CheckHeader(header) == false) {
+    if (CheckHeader(header, require_points) == false) {
         return false;
     }
     return true;
@@ -295,6 +317,88 @@ Eigen::Vector3d UnpackBinaryPCDColor(const char *data_ptr,
     }
 }
 
+template <typename T>
+void UnpackBinaryPCDColumn(const char *data_ptr,
+                           int stride,
+                           int num,
+                           double *output,
+                           int output_stride) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num; i++) {
+        T data;
+        memcpy(&data, data_ptr + size_t(i) * stride, sizeof(data));
+        output[size_t(i) * output_stride] = (double)data;
+    }
+}
+
+// Unpacks a column of num elements, stride bytes apart, into
+// output[i * output_stride]. The type is dispatched once per column.
+void UnpackBinaryPCDColumn(const char *data_ptr,
+                           const char type,
+                           const int size,
+                           int stride,
+                           int num,
+                           double *output,
+                           int output_stride) {
+    if (type == 'I' && size == 1) {
+        UnpackBinaryPCDColumn<std::int8_t>(data_ptr, stride, num, output,
+                                           output_stride);
+    } else if (type == 'I' && size == 2) {
+        UnpackBinaryPCDColumn<std::int16_t>(data_ptr, stride, num, output,
+                                            output_stride);
+    } else if (type == 'I' && size == 4) {
+        UnpackBinaryPCDColumn<std::int32_t>(data_ptr, stride, num, output,
+                                            output_stride);
+    } else if (type == 'U' && size == 1) {
+        UnpackBinaryPCDColumn<std::uint8_t>(data_ptr, stride, num, output,
+                                            output_stride);
+    } else if (type == 'U' && size == 2) {
+        UnpackBinaryPCDColumn<std::uint16_t>(data_ptr, stride, num, output,
+                                             output_stride);
+    } else if (type == 'U' && size == 4) {
+        UnpackBinaryPCDColumn<std::uint32_t>(data_ptr, stride, num, output,
+                                             output_stride);
+    } else if (type == 'F' && size == 4) {
+        UnpackBinaryPCDColumn<std::float_t>(data_ptr, stride, num, output,
+                                            output_stride);
+    } else {
+        for (int i = 0; i < num; i++) {
+            output[size_t(i) * output_stride] = 0.0;
+        }
+    }
+}
+
+// Reads the chunk table that may follow binary_compressed data. Returns false
+// if there is none or it does not match the compressed data.
+bool ReadPCDChunkTable(FILE *file,
+                       std::uint32_t compressed_size,
+                       std::uint32_t uncompressed_size,
+                       std::uint32_t &chunk_size,
+                       std::vector<std::uint32_t> &compressed_chunk_sizes) {
+    std::uint32_t num_chunks;
+    if (fread(&chunk_size, sizeof(chunk_size), 1, file) != 1 ||
+        fread(&num_chunks, sizeof(num_chunks), 1, file) != 1 ||
+        chunk_size == 0 ||
+        num_chunks != (uncompressed_size + chunk_size - 1) / chunk_size) {
+        return false;
+    }
+    compressed_chunk_sizes.resize(num_chunks);
+    char magic[sizeof(kPCDChunkTableMagic)];
+    if (fread(compressed_chunk_sizes.data(), sizeof(std::uint32_t),
+              num_chunks, file) != num_chunks ||
+        fread(magic, 1, sizeof(magic), file) != sizeof(magic) ||
+        memcmp(magic, kPCDChunkTableMagic, sizeof(magic)) != 0) {
+        return false;
+    }
+    std::uint64_t total = 0;
+    for (auto size : compressed_chunk_sizes) {
+        total += size;
+    }
+    return total == compressed_size;
+}
+
 double UnpackASCIIPCDElement(const char *data_ptr,
                              const char type,
                              const int size) {
@@ -332,6 +436,76 @@ Eigen::Vector3d UnpackASCIIPCDColor(const char *data_ptr,
     }
 }
 
+// Reads the binary_compressed block and the chunk table that may follow it,
+// and uncompresses the block into buffer.
+bool ReadPCDCompressedData(FILE *file,
+                           std::unique_ptr<char[]> &buffer,
+                           std::uint32_t &uncompressed_size) {
+    std::uint32_t compressed_size;
+    if (fread(&compressed_size, sizeof(compressed_size), 1, file) != 1) {
+        utility::LogWarning(
+                "[ReadPCDCompressedData] Failed to read data record.");
+        return false;
+    }
+    if (fread(&uncompressed_size, sizeof(uncompressed_size), 1, file) != 1) {
+        utility::LogWarning(
+                "[ReadPCDCompressedData] Failed to read data record.");
+        return false;
+    }
+    utility::LogDebug(
+            "PCD data with {:d} compressed size, and {:d} uncompressed size.",
+            compressed_size, uncompressed_size);
+    std::unique_ptr<char[]> buffer_compressed(new char[compressed_size]);
+    if (fread(buffer_compressed.get(), 1, compressed_size, file) !=
+        compressed_size) {
+        utility::LogWarning(
+                "[ReadPCDCompressedData] Failed to read data record.");
+        return false;
+    }
+    buffer.reset(new char[uncompressed_size]);
+    std::uint32_t chunk_size = 0;
+    std::vector<std::uint32_t> compressed_chunk_sizes;
+    if (ReadPCDChunkTable(file, compressed_size, uncompressed_size,
+                          chunk_size, compressed_chunk_sizes)) {
+        int num_chunks = int(compressed_chunk_sizes.size());
+        utility::LogDebug(
+                "[ReadPCDCompressedData] Uncompressing {:d} chunks.",
+                num_chunks);
+        std::vector<size_t> compressed_offsets(num_chunks, 0);
+        for (int c = 1; c < num_chunks; c++) {
+            compressed_offsets[c] = compressed_offsets[c - 1] +
+                                    compressed_chunk_sizes[c - 1];
+        }
+        std::atomic<bool> success(true);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for (int c = 0; c < num_chunks; c++) {
+            size_t offset = size_t(c) * chunk_size;
+            std::uint32_t size = (std::uint32_t)std::min<size_t>(
+                    chunk_size, uncompressed_size - offset);
+            if (lzf_decompress(
+                        buffer_compressed.get() + compressed_offsets[c],
+                        compressed_chunk_sizes[c], buffer.get() + offset,
+                        size) != size) {
+                success = false;
+            }
+        }
+        if (!success) {
+            utility::LogWarning(
+                    "[ReadPCDCompressedData] Uncompression failed.");
+            return false;
+        }
+    } else if (lzf_decompress(buffer_compressed.get(),
+                              (unsigned int)compressed_size, buffer.get(),
+                              (unsigned int)uncompressed_size) !=
+               uncompressed_size) {
+        utility::LogWarning("[ReadPCDCompressedData] Uncompression failed.");
+        return false;
+    }
+    return true;
+}
+
 bool ReadPCDData(FILE *file,
                  const PCDHeader &header,
                  geometry::PointCloud &pointcloud) {
@@ -436,84 +610,48 @@ bool ReadPCDData(FILE *file,
             }
         }
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
-        std::uint32_t compressed_size;
+        std::unique_ptr<char[]> buffer;
         std::uint32_t uncompressed_size;
-        if (fread(&compressed_size, sizeof(compressed_size), 1, file) != 1) {
-            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+        if (!ReadPCDCompressedData(file, buffer, uncompressed_size)) {
             pointcloud.Clear();
             return false;
         }
-        if (fread(&uncompressed_size, sizeof(uncompressed_size), 1, file) !=
-            1) {
-            utility::LogWarning("[ReadPCDData] Failed to read data record.");
-            pointcloud.Clear();
-            return false;
-        }
-        utility::LogDebug(
-                "PCD data with {:d} compressed size, and {:d} uncompressed "
-                "size.",
-                compressed_size, uncompressed_size);
-        std::unique_ptr<char[]> buffer_compressed(new char[compressed_size]);
-        if (fread(buffer_compressed.get(), 1, compressed_size, file) !=
-            compressed_size) {
-            utility::LogWarning("[ReadPCDData] Failed to read data record.");
-            pointcloud.Clear();
-            return false;
-        }
-        std::unique_ptr<char[]> buffer(new char[uncompressed_size]);
-        if (lzf_decompress(buffer_compressed.get(),
-                           (unsigned int)compressed_size, buffer.get(),
-                           (unsigned int)uncompressed_size) !=
-            uncompressed_size) {
-            utility::LogWarning("[ReadPCDData] Uncompression failed.");
+        if ((size_t)header.pointsize * header.points > uncompressed_size) {
+            utility::LogWarning("[ReadPCDData] Not enough data.");
             pointcloud.Clear();
             return false;
         }
         for (const auto &field : header.fields) {
-            const char *base_ptr = buffer.get() + field.offset * header.points;
+            const char *base_ptr =
+                    buffer.get() + (size_t)field.offset * header.points;
+            int stride = field.size * field.count;
+            double *output = nullptr;
             if (field.name == "x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
+                output = pointcloud.points_[0].data() + 0;
             } else if (field.name == "y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
+                output = pointcloud.points_[0].data() + 1;
             } else if (field.name == "z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
+                output = pointcloud.points_[0].data() + 2;
             } else if (field.name == "normal_x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
+                output = pointcloud.normals_[0].data() + 0;
             } else if (field.name == "normal_y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
+                output = pointcloud.normals_[0].data() + 1;
             } else if (field.name == "normal_z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
+                output = pointcloud.normals_[0].data() + 2;
             } else if (field.name == "rgb" || field.name == "rgba") {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.colors_[i] = UnpackBinaryPCDColor(
-                            base_ptr + i * field.size * field.count, field.type,
+                            base_ptr + (size_t)i * stride, field.type,
                             field.size);
                 }
             }
+            if (output != nullptr) {
+                UnpackBinaryPCDColumn(base_ptr, field.type, field.size, stride,
+                                      header.points, output, 3);
+            }
         }
     }
     return true;
@@ -625,9 +763,113 @@ float ConvertRGBToFloat(const Eigen::Vector3d &color) {
     return value;
 }
 
+// Compresses data in independent chunks of chunk_size bytes in parallel. The
+// concatenated chunks form a single LZF stream.
+bool CompressPCDChunks(const char *data,
+                       std::uint32_t size,
+                       std::uint32_t chunk_size,
+                       std::vector<char> &compressed,
+                       std::vector<std::uint32_t> &compressed_chunk_sizes) {
+    int num_chunks = int((size + chunk_size - 1) / chunk_size);
+    // LZF output never exceeds its input by more than 1 byte per 32 bytes.
+    size_t capacity = chunk_size + chunk_size / 16 + 64;
+    std::vector<std::vector<char>> chunks(num_chunks);
+    compressed_chunk_sizes.resize(num_chunks);
+    std::atomic<bool> success(true);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        size_t offset = size_t(c) * chunk_size;
+        unsigned int length =
+                (unsigned int)std::min<size_t>(chunk_size, size - offset);
+        chunks[c].resize(capacity);
+        compressed_chunk_sizes[c] =
+                lzf_compress(data + offset, length, chunks[c].data(),
+                             (unsigned int)capacity);
+        if (compressed_chunk_sizes[c] == 0) {
+            success = false;
+        }
+    }
+    if (!success) {
+        return false;
+    }
+    size_t total = 0;
+    for (auto compressed_chunk_size : compressed_chunk_sizes) {
+        total += compressed_chunk_size;
+    }
+    if (total > UINT32_MAX) {
+        return false;
+    }
+    compressed.resize(total);
+    size_t offset = 0;
+    for (int c = 0; c < num_chunks; c++) {
+        memcpy(compressed.data() + offset, chunks[c].data(),
+               compressed_chunk_sizes[c]);
+        offset += compressed_chunk_sizes[c];
+    }
+    return true;
+}
+
+// Compresses the column-major data of a binary_compressed PCD file and writes
+// it, followed by a chunk table if chunk_size is positive.
+bool WritePCDCompressedData(FILE *file,
+                            const char *buffer,
+                            std::uint32_t buffer_size_in_bytes,
+                            int chunk_size) {
+    if (chunk_size > 0) {
+        std::vector<char> buffer_compressed;
+        std::vector<std::uint32_t> compressed_chunk_sizes;
+        if (!CompressPCDChunks(buffer, buffer_size_in_bytes,
+                               (std::uint32_t)chunk_size, buffer_compressed,
+                               compressed_chunk_sizes)) {
+            utility::LogWarning(
+                    "[WritePCDCompressedData] Failed to compress data.");
+            return false;
+        }
+        std::uint32_t size_compressed =
+                (std::uint32_t)buffer_compressed.size();
+        std::uint32_t num_chunks =
+                (std::uint32_t)compressed_chunk_sizes.size();
+        std::uint32_t chunk_size_u32 = (std::uint32_t)chunk_size;
+        utility::LogDebug(
+                "[WritePCDCompressedData] {:d} bytes data compressed into "
+                "{:d} bytes in {:d} chunks.",
+                buffer_size_in_bytes, size_compressed, num_chunks);
+        fwrite(&size_compressed, sizeof(size_compressed), 1, file);
+        fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
+        fwrite(buffer_compressed.data(), 1, size_compressed, file);
+        fwrite(&chunk_size_u32, sizeof(chunk_size_u32), 1, file);
+        fwrite(&num_chunks, sizeof(num_chunks), 1, file);
+        fwrite(compressed_chunk_sizes.data(), sizeof(std::uint32_t),
+               num_chunks, file);
+        fwrite(kPCDChunkTableMagic, 1, sizeof(kPCDChunkTableMagic), file);
+        return true;
+    }
+    std::unique_ptr<char[]> buffer_compressed(
+            new char[size_t(buffer_size_in_bytes) * 2]);
+    std::uint32_t size_compressed =
+            lzf_compress(buffer, buffer_size_in_bytes, buffer_compressed.get(),
+                         buffer_size_in_bytes * 2);
+    if (size_compressed == 0) {
+        utility::LogWarning(
+                "[WritePCDCompressedData] Failed to compress data.");
+        return false;
+    }
+    utility::LogDebug(
+            "[WritePCDCompressedData] {:d} bytes data compressed into {:d} "
+            "bytes.",
+            buffer_size_in_bytes, size_compressed);
+    fwrite(&size_compressed, sizeof(size_compressed), 1, file);
+    fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
+    fwrite(buffer_compressed.get(), 1, size_compressed, file);
+    return true;
+}
+
 bool WritePCDData(FILE *file,
                   const PCDHeader &header,
-                  const geometry::PointCloud &pointcloud) {
+                  const geometry::PointCloud &pointcloud,
+                  int chunk_size) {
     bool has_normal = pointcloud.HasNormals();
     bool has_color = pointcloud.HasColors();
     if (header.datatype == PCD_DATA_ASCII) {
@@ -671,8 +913,10 @@ bool WritePCDData(FILE *file,
         std::uint32_t buffer_size =
                 (std::uint32_t)(header.elementnum * header.points);
         std::unique_ptr<float[]> buffer(new float[buffer_size]);
-        std::unique_ptr<float[]> buffer_compressed(new float[buffer_size * 2]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < strip_size; i++) {
             const auto &point = pointcloud.points_[i];
             buffer[0 * strip_size + i] = (float)point(0);
             buffer[1 * strip_size + i] = (float)point(1);
@@ -690,24 +934,446 @@ bool WritePCDData(FILE *file,
                 buffer[idx * strip_size + i] = ConvertRGBToFloat(color);
             }
         }
-        std::uint32_t buffer_size_in_bytes = buffer_size * sizeof(float);
-        std::uint32_t size_compressed =
-                lzf_compress(buffer.get(), buffer_size_in_bytes,
-                             buffer_compressed.get(), buffer_size_in_bytes * 2);
-        if (size_compressed == 0) {
-            utility::LogWarning("[WritePCDData] Failed to compress data.");
+        return WritePCDCompressedData(
+                file, (const char *)buffer.get(),
+                (std::uint32_t)(buffer_size * sizeof(float)), chunk_size);
+    }
+    return true;
+}
+
+// See GetTensorMapReadDtype for the fields without a dtype of their own.
+Dtype GetPCDFieldDtype(const PCLPointField &field) {
+    return GetTensorMapReadDtype(field.type, field.size);
+}
+
+// Copies num values, src_stride bytes apart, to dst[i * dst_stride].
+// Contiguous values of the same type are copied with a single memcpy.
+template <typename SrcT, typename DstT>
+void CopyPCDValues(const char *src,
+                   size_t src_stride,
+                   int num,
+                   DstT *dst,
+                   int dst_stride) {
+    if (std::is_same<SrcT, DstT>::value && src_stride == sizeof(SrcT) &&
+        dst_stride == 1) {
+        memcpy(dst, src, size_t(num) * sizeof(SrcT));
+        return;
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num; i++) {
+        SrcT value;
+        memcpy(&value, src + size_t(i) * src_stride, sizeof(value));
+        dst[size_t(i) * dst_stride] = static_cast<DstT>(value);
+    }
+}
+
+void CopyPCDValues(const PCLPointField &field,
+                   const char *src,
+                   size_t src_stride,
+                   int num,
+                   void *dst,
+                   int dst_stride) {
+    if (field.type == 'F' && field.size == 4) {
+        CopyPCDValues<float>(src, src_stride, num, static_cast<float *>(dst),
+                             dst_stride);
+    } else if (field.type == 'F' && field.size == 8) {
+        CopyPCDValues<double>(src, src_stride, num,
+                              static_cast<double *>(dst), dst_stride);
+    } else if (field.type == 'U' && field.size == 1) {
+        CopyPCDValues<std::uint8_t>(src, src_stride, num,
+                                    static_cast<std::uint8_t *>(dst),
+                                    dst_stride);
+    } else if (field.type == 'U' && field.size == 2) {
+        CopyPCDValues<std::uint16_t>(src, src_stride, num,
+                                     static_cast<std::int32_t *>(dst),
+                                     dst_stride);
+    } else if (field.type == 'U' && field.size == 4) {
+        CopyPCDValues<std::uint32_t>(src, src_stride, num,
+                                     static_cast<std::int64_t *>(dst),
+                                     dst_stride);
+    } else if (field.type == 'U' && field.size == 8) {
+        CopyPCDValues<std::uint64_t>(src, src_stride, num,
+                                     static_cast<std::int64_t *>(dst),
+                                     dst_stride);
+    } else if (field.type == 'I' && field.size == 1) {
+        CopyPCDValues<std::int8_t>(src, src_stride, num,
+                                   static_cast<std::int32_t *>(dst),
+                                   dst_stride);
+    } else if (field.type == 'I' && field.size == 2) {
+        CopyPCDValues<std::int16_t>(src, src_stride, num,
+                                    static_cast<std::int32_t *>(dst),
+                                    dst_stride);
+    } else if (field.type == 'I' && field.size == 4) {
+        CopyPCDValues<std::int32_t>(src, src_stride, num,
+                                    static_cast<std::int32_t *>(dst),
+                                    dst_stride);
+    } else if (field.type == 'I' && field.size == 8) {
+        CopyPCDValues<std::int64_t>(src, src_stride, num,
+                                    static_cast<std::int64_t *>(dst),
+                                    dst_stride);
+    }
+}
+
+template <typename T>
+void StorePCDValue(void *dst, size_t index, double value) {
+    static_cast<T *>(dst)[index] = static_cast<T>(value);
+}
+
+// Reads a line of any length, including its newline. Returns false at the
+// end of the file.
+bool ReadPCDLine(FILE *file, std::string &line) {
+    char buffer[DEFAULT_IO_BUFFER_SIZE];
+    line.clear();
+    while (fgets(buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
+        line += buffer;
+        if (line.back() == '\n') {
+            return true;
+        }
+    }
+    return !line.empty();
+}
+
+// Parses the ASCII value of a field into dst[index]. 64-bit integers are
+// converted exactly, all other values with ParseDouble and store. Fails if
+// the token is not a number as a whole or out of range.
+bool ParsePCDASCIIValue(const PCLPointField &field,
+                        const std::string &str,
+                        void (*store)(void *, size_t, double),
+                        void *dst,
+                        size_t index) {
+    const char *begin = str.c_str();
+    const char *end = begin + str.size();
+    char *endptr = nullptr;
+    errno = 0;
+    if (field.type == 'I' && field.size == 8) {
+        static_cast<std::int64_t *>(dst)[index] =
+                std::strtoll(begin, &endptr, 10);
+    } else if (field.type == 'U' && field.size == 8) {
+        if (str[0] == '-') {
             return false;
         }
-        utility::LogDebug(
-                "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
-                buffer_size_in_bytes, size_compressed);
-        fwrite(&size_compressed, sizeof(size_compressed), 1, file);
-        fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
-        fwrite(buffer_compressed.get(), 1, size_compressed, file);
+        static_cast<std::int64_t *>(dst)[index] =
+                std::int64_t(std::strtoull(begin, &endptr, 10));
+    } else {
+        double value;
+        if (!utility::ParseDouble(begin, end, value) || begin != end) {
+            return false;
+        }
+        store(dst, index, value);
+        return true;
+    }
+    return endptr != begin && endptr == end && errno != ERANGE;
+}
+
+bool ReadPCDTensorData(FILE *file,
+                       const PCDHeader &header,
+                       const std::vector<void *> &data_ptrs) {
+    const size_t num_points = size_t(header.points);
+    if (header.datatype == PCD_DATA_ASCII) {
+        std::vector<void (*)(void *, size_t, double)> stores;
+        for (const auto &field : header.fields) {
+            switch (GetPCDFieldDtype(field)) {
+                case Dtype::Float32:
+                    stores.push_back(StorePCDValue<float>);
+                    break;
+                case Dtype::Float64:
+                    stores.push_back(StorePCDValue<double>);
+                    break;
+                case Dtype::UInt8:
+                    stores.push_back(StorePCDValue<std::uint8_t>);
+                    break;
+                case Dtype::Int32:
+                    stores.push_back(StorePCDValue<std::int32_t>);
+                    break;
+                default:
+                    stores.push_back(StorePCDValue<std::int64_t>);
+                    break;
+            }
+        }
+        bool has_64bit_integers = false;
+        for (const auto &field : header.fields) {
+            has_64bit_integers = has_64bit_integers ||
+                                 (field.type != 'F' && field.size == 8);
+        }
+        if (has_64bit_integers) {
+            // Doubles cannot hold every 64-bit integer, e.g. nanosecond
+            // timestamps, so these files are parsed line by line with exact
+            // integer conversion.
+            std::string line;
+            std::vector<std::string> strs;
+            size_t idx = 0;
+            while (idx < num_points && ReadPCDLine(file, line)) {
+                strs.clear();
+                utility::SplitString(strs, line, "\t\r\n ");
+                if ((int)strs.size() < header.elementnum) {
+                    continue;
+                }
+                for (size_t j = 0; j < header.fields.size(); j++) {
+                    const auto &field = header.fields[j];
+                    if (data_ptrs[j] == nullptr) {
+                        continue;
+                    }
+                    for (int c = 0; c < field.count; c++) {
+                        const std::string &str = strs[field.count_offset + c];
+                        if (!ParsePCDASCIIValue(field, str, stores[j],
+                                                data_ptrs[j],
+                                                idx * field.count + c)) {
+                            utility::LogWarning(
+                                    "[ReadPCDTensorData] Invalid value {} of "
+                                    "field {} in point {:d}.",
+                                    str, field.name, idx);
+                            return false;
+                        }
+                    }
+                }
+                idx++;
+            }
+            return idx == num_points;
+        }
+        size_t num_rows = 0;
+        bool success = utility::ReadNumericLines(
+                file, header.elementnum,
+                [&](size_t total) { num_rows = total; },
+                [&](size_t i, const double *values) {
+                    for (size_t j = 0; j < header.fields.size(); j++) {
+                        const auto &field = header.fields[j];
+                        if (data_ptrs[j] == nullptr) {
+                            continue;
+                        }
+                        for (int c = 0; c < field.count; c++) {
+                            stores[j](data_ptrs[j], i * field.count + c,
+                                      values[field.count_offset + c]);
+                        }
+                    }
+                },
+                num_points);
+        return success && num_rows == num_points;
+    } else if (header.datatype == PCD_DATA_BINARY) {
+        const size_t kBlockBytes = 64 << 20;
+        const size_t record_size = size_t(header.pointsize);
+        size_t block_rows = std::max<size_t>(1, kBlockBytes / record_size);
+        block_rows = std::min(block_rows, num_points);
+        std::vector<char> block(block_rows * record_size);
+        for (size_t row_begin = 0; row_begin < num_points;
+             row_begin += block_rows) {
+            int num_rows = int(std::min(block_rows, num_points - row_begin));
+            if (fread(block.data(), record_size, num_rows, file) !=
+                size_t(num_rows)) {
+                return false;
+            }
+            for (size_t j = 0; j < header.fields.size(); j++) {
+                const auto &field = header.fields[j];
+                if (data_ptrs[j] == nullptr) {
+                    continue;
+                }
+                size_t size = size_t(
+                        DtypeUtil::ByteSize(GetPCDFieldDtype(field)));
+                for (int c = 0; c < field.count; c++) {
+                    char *dst = static_cast<char *>(data_ptrs[j]) +
+                                (row_begin * field.count + c) * size;
+                    CopyPCDValues(field,
+                                  block.data() + field.offset + c * field.size,
+                                  record_size, num_rows, dst, field.count);
+                }
+            }
+        }
+        return true;
+    } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
+        std::unique_ptr<char[]> buffer;
+        std::uint32_t uncompressed_size;
+        if (!ReadPCDCompressedData(file, buffer, uncompressed_size)) {
+            return false;
+        }
+        if (size_t(header.pointsize) * num_points > uncompressed_size) {
+            utility::LogWarning("[ReadPCDTensorData] Not enough data.");
+            return false;
+        }
+        // Each field is stored for all points after the previous field, so
+        // the values are already in the order of the tensor.
+        for (size_t j = 0; j < header.fields.size(); j++) {
+            const auto &field = header.fields[j];
+            if (data_ptrs[j] == nullptr) {
+                continue;
+            }
+            CopyPCDValues(field,
+                          buffer.get() + size_t(field.offset) * num_points,
+                          size_t(field.size), header.points * field.count,
+                          data_ptrs[j], 1);
+        }
+        return true;
+    }
+    return false;
+}
+
+// Generates the header of a TensorMap. The tensors are made contiguous on the
+// CPU and are returned in the order of the fields.
+bool GenerateTensorMapHeader(const TensorMap &tensor_map,
+                             const bool write_ascii,
+                             const bool compressed,
+                             PCDHeader &header,
+                             std::vector<Tensor> &tensors) {
+    header.version = "0.7";
+    header.fields.clear();
+    header.elementnum = 0;
+    header.pointsize = 0;
+    std::vector<std::string> names;
+    int64_t num_points;
+    if (!GetTensorMapWriteAttributes(tensor_map, names, tensors,
+                                     num_points)) {
+        return false;
+    }
+    for (size_t i = 0; i < names.size(); i++) {
+        const std::string &name = names[i];
+        const Tensor &tensor = tensors[i];
+        const SizeVector shape = tensor.GetShape();
+        PCLPointField field;
+        field.name = name;
+        field.count = shape.size() == 2 ? int(shape[1]) : 1;
+        field.size = int(DtypeUtil::ByteSize(tensor.GetDtype()));
+        switch (tensor.GetDtype()) {
+            case Dtype::Float32:
+            case Dtype::Float64:
+                field.type = 'F';
+                break;
+            case Dtype::Int32:
+            case Dtype::Int64:
+                field.type = 'I';
+                break;
+            case Dtype::UInt8:
+            case Dtype::Bool:
+                field.type = 'U';
+                break;
+            default:
+                utility::LogWarning(
+                        "[GenerateTensorMapHeader] Attribute {} has no "
+                        "dtype.",
+                        name);
+                return false;
+        }
+        field.count_offset = header.elementnum;
+        field.offset = header.pointsize;
+        header.elementnum += field.count;
+        header.pointsize += field.count * field.size;
+        header.fields.push_back(field);
+    }
+    if (num_points < 0 || num_points > INT_MAX || header.pointsize == 0) {
+        utility::LogWarning(
+                "[GenerateTensorMapHeader] No attributes or too many points.");
+        return false;
+    }
+    header.width = int(num_points);
+    header.height = 1;
+    header.points = header.width;
+    if (write_ascii) {
+        header.datatype = PCD_DATA_ASCII;
+    } else if (compressed) {
+        header.datatype = PCD_DATA_BINARY_COMPRESSED;
+    } else {
+        header.datatype = PCD_DATA_BINARY;
     }
     return true;
 }
 
+void AppendPCDASCIIValue(const PCLPointField &field,
+                         const char *ptr,
+                         std::string &line) {
+    auto out = std::back_inserter(line);
+    if (field.type == 'F' && field.size == 4) {
+        float value;
+        memcpy(&value, ptr, sizeof(value));
+        fmt::format_to(out, "{}", value);
+    } else if (field.type == 'F') {
+        double value;
+        memcpy(&value, ptr, sizeof(value));
+        fmt::format_to(out, "{}", value);
+    } else if (field.size == 8) {
+        std::int64_t value;
+        memcpy(&value, ptr, sizeof(value));
+        fmt::format_to(out, "{}", value);
+    } else if (field.size == 4) {
+        std::int32_t value;
+        memcpy(&value, ptr, sizeof(value));
+        fmt::format_to(out, "{}", value);
+    } else {
+        fmt::format_to(out, "{}", int(*(const std::uint8_t *)ptr));
+    }
+}
+
+bool WritePCDTensorData(FILE *file,
+                        const PCDHeader &header,
+                        const std::vector<Tensor> &tensors) {
+    const size_t num_points = size_t(header.points);
+    std::vector<const char *> data_ptrs;
+    for (const auto &tensor : tensors) {
+        data_ptrs.push_back(static_cast<const char *>(tensor.GetDataPtr()));
+    }
+    if (header.datatype == PCD_DATA_ASCII) {
+        return utility::WriteLines(
+                file, num_points, [&](size_t i, std::string &line) {
+                    for (size_t j = 0; j < header.fields.size(); j++) {
+                        const auto &field = header.fields[j];
+                        for (int c = 0; c < field.count; c++) {
+                            if (j > 0 || c > 0) {
+                                line.push_back(' ');
+                            }
+                            AppendPCDASCIIValue(
+                                    field,
+                                    data_ptrs[j] + (i * field.count + c) *
+                                                           field.size,
+                                    line);
+                        }
+                    }
+                    line.push_back('\n');
+                });
+    } else if (header.datatype == PCD_DATA_BINARY) {
+        const int kBlockRows = 1 << 16;
+        const size_t record_size = size_t(header.pointsize);
+        std::vector<char> block(kBlockRows * record_size);
+        for (size_t row_begin = 0; row_begin < num_points;
+             row_begin += kBlockRows) {
+            int num_rows =
+                    int(std::min<size_t>(kBlockRows, num_points - row_begin));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int i = 0; i < num_rows; i++) {
+                char *record = block.data() + size_t(i) * record_size;
+                for (size_t j = 0; j < header.fields.size(); j++) {
+                    size_t size = size_t(header.fields[j].size) *
+                                  header.fields[j].count;
+                    memcpy(record + header.fields[j].offset,
+                           data_ptrs[j] + (row_begin + i) * size, size);
+                }
+            }
+            if (fwrite(block.data(), record_size, num_rows, file) !=
+                size_t(num_rows)) {
+                return false;
+            }
+        }
+        return true;
+    } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
+        size_t buffer_size = size_t(header.pointsize) * num_points;
+        if (buffer_size > UINT32_MAX) {
+            utility::LogWarning("[WritePCDTensorData] Too much data.");
+            return false;
+        }
+        // The data of each tensor is already the column of its field.
+        std::unique_ptr<char[]> buffer(new char[buffer_size]);
+        for (size_t j = 0; j < header.fields.size(); j++) {
+            const auto &field = header.fields[j];
+            memcpy(buffer.get() + size_t(field.offset) * num_points,
+                   data_ptrs[j],
+                   size_t(field.size) * field.count * num_points);
+        }
+        return WritePCDCompressedData(file, buffer.get(),
+                                      (std::uint32_t)buffer_size,
+                                      PCDWriteOption().chunk_size_);
+    }
+    return false;
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -753,8 +1419,110 @@ bool WritePointCloudToPCD(const std::string &filename,
                           bool write_ascii /* = false*/,
                           bool compressed /* = false*/,
                           bool print_progress) {
+    return WritePointCloudToPCD(filename, pointcloud,
+                                PCDWriteOption(write_ascii, compressed),
+                                print_progress);
+}
+
+bool WritePointCloudToPCD(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const PCDWriteOption &option,
+                          bool print_progress) {
+    if (option.chunked_ && option.chunk_size_ <= 0) {
+        utility::LogWarning("Write PCD failed: invalid chunk size {:d}.",
+                            option.chunk_size_);
+        return false;
+    }
+    PCDHeader header;
+    if (GenerateHeader(pointcloud, option.write_ascii_, option.compressed_,
+                       header) == false) {
+        utility::LogWarning("Write PCD failed: unable to generate header.");
+        return false;
+    }
+    FILE *file = utility::filesystem::FOpen(filename.c_str(), "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write PCD failed: unable to open file.");
+        return false;
+    }
+    if (WritePCDHeader(file, header) == false) {
+        utility::LogWarning("Write PCD failed: unable to write header.");
+        fclose(file);
+        return false;
+    }
+    if (WritePCDData(file, header, pointcloud,
+                     option.chunked_ ? option.chunk_size_ : 0) == false) {
+        utility::LogWarning("Write PCD failed: unable to write data.");
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+    return true;
+}
+
+bool ReadTensorMapFromPCD(const std::string &filename,
+                          TensorMap &tensor_map,
+                          bool print_progress) {
+    tensor_map.clear();
+    PCDHeader header;
+    FILE *file = utility::filesystem::FOpen(filename.c_str(), "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read PCD failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    if (ReadPCDHeader(file, header, false) == false) {
+        utility::LogWarning("Read PCD failed: unable to parse header.");
+        fclose(file);
+        return false;
+    }
+    std::vector<void *> data_ptrs;
+    for (const auto &field : header.fields) {
+        if (field.name == "_") {
+            // Padding of PCL point types.
+            data_ptrs.push_back(nullptr);
+            continue;
+        }
+        Dtype dtype = GetPCDFieldDtype(field);
+        if (dtype == Dtype::Undefined || field.count <= 0) {
+            utility::LogWarning(
+                    "Read PCD failed: field {} has an unknown type.",
+                    field.name);
+            fclose(file);
+            tensor_map.clear();
+            return false;
+        }
+        SizeVector shape = field.count == 1
+                                   ? SizeVector({header.points})
+                                   : SizeVector({header.points, field.count});
+        Tensor tensor(shape, dtype);
+        data_ptrs.push_back(tensor.GetDataPtr());
+        if (!tensor_map.emplace(field.name, tensor).second) {
+            utility::LogWarning("Read PCD failed: duplicate field {}.",
+                                field.name);
+            fclose(file);
+            tensor_map.clear();
+            return false;
+        }
+    }
+    if (ReadPCDTensorData(file, header, data_ptrs) == false) {
+        utility::LogWarning("Read PCD failed: unable to read data.");
+        fclose(file);
+        tensor_map.clear();
+        return false;
+    }
+    fclose(file);
+    return true;
+}
+
+bool WriteTensorMapToPCD(const std::string &filename,
+                         const TensorMap &tensor_map,
+                         bool write_ascii /* = false*/,
+                         bool compressed /* = false*/,
+                         bool print_progress) {
     PCDHeader header;
-    if (GenerateHeader(pointcloud, write_ascii, compressed, header) == false) {
+    std::vector<Tensor> tensors;
+    if (GenerateTensorMapHeader(tensor_map, write_ascii, compressed, header,
+                                tensors) == false) {
         utility::LogWarning("Write PCD failed: unable to generate header.");
         return false;
     }
@@ -768,7 +1536,7 @@ bool WritePointCloudToPCD(const std::string &filename,
         fclose(file);
         return false;
     }
-    if (WritePCDData(file, header, pointcloud) == false) {
+    if (WritePCDTensorData(file, header, tensors) == false) {
         utility::LogWarning("Write PCD failed: unable to write data.");
         fclose(file);
         return false;
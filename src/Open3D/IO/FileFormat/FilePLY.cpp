@@ -25,12 +25,26 @@
 // ----------------------------------------------------------------------------
 
 #include <rply.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <type_traits>
 
 #include "Open3D/IO/ClassIO/LineSetIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/TensorMapIO.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/IO/ClassIO/VoxelGridIO.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/ParallelTextIO.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace open3d {
 
@@ -351,6 +365,525 @@ int ReadColorCallback(p_ply_argument argument) {
 
 }  // namespace ply_voxelgrid_reader
 
+namespace ply_tensor_io {
+
+enum class PLYScalarType {
+    Unknown,
+    Int8,
+    UInt8,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Float32,
+    Float64
+};
+
+enum class PLYFormat { ASCII, BinaryLittleEndian, BinaryBigEndian };
+
+struct PLYProperty {
+    std::string name_;
+    PLYScalarType type_;
+    // Type of the length of a list property, Unknown for scalar properties.
+    PLYScalarType count_type_;
+};
+
+struct PLYElement {
+    std::string name_;
+    int64_t count_;
+    std::vector<PLYProperty> properties_;
+};
+
+struct PLYHeader {
+    PLYFormat format_ = PLYFormat::ASCII;
+    std::vector<PLYElement> elements_;
+};
+
+PLYScalarType GetPLYScalarType(const std::string &name) {
+    if (name == "char" || name == "int8") {
+        return PLYScalarType::Int8;
+    } else if (name == "uchar" || name == "uint8") {
+        return PLYScalarType::UInt8;
+    } else if (name == "short" || name == "int16") {
+        return PLYScalarType::Int16;
+    } else if (name == "ushort" || name == "uint16") {
+        return PLYScalarType::UInt16;
+    } else if (name == "int" || name == "int32") {
+        return PLYScalarType::Int32;
+    } else if (name == "uint" || name == "uint32") {
+        return PLYScalarType::UInt32;
+    } else if (name == "float" || name == "float32") {
+        return PLYScalarType::Float32;
+    } else if (name == "double" || name == "float64") {
+        return PLYScalarType::Float64;
+    }
+    return PLYScalarType::Unknown;
+}
+
+size_t GetPLYScalarSize(PLYScalarType type) {
+    switch (type) {
+        case PLYScalarType::Int8:
+        case PLYScalarType::UInt8:
+            return 1;
+        case PLYScalarType::Int16:
+        case PLYScalarType::UInt16:
+            return 2;
+        case PLYScalarType::Int32:
+        case PLYScalarType::UInt32:
+        case PLYScalarType::Float32:
+            return 4;
+        case PLYScalarType::Float64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+// See GetTensorMapReadDtype for the types without a dtype of their own.
+Dtype GetPLYScalarDtype(PLYScalarType type) {
+    switch (type) {
+        case PLYScalarType::Int8:
+        case PLYScalarType::Int16:
+        case PLYScalarType::Int32:
+            return GetTensorMapReadDtype('I', int(GetPLYScalarSize(type)));
+        case PLYScalarType::UInt8:
+        case PLYScalarType::UInt16:
+        case PLYScalarType::UInt32:
+            return GetTensorMapReadDtype('U', int(GetPLYScalarSize(type)));
+        case PLYScalarType::Float32:
+        case PLYScalarType::Float64:
+            return GetTensorMapReadDtype('F', int(GetPLYScalarSize(type)));
+        default:
+            return Dtype::Undefined;
+    }
+}
+
+bool IsHostLittleEndian() {
+    const std::uint16_t value = 1;
+    std::uint8_t first_byte;
+    memcpy(&first_byte, &value, 1);
+    return first_byte == 1;
+}
+
+// Reads a line without its newline. Returns false at the end of the file.
+bool ReadPLYLine(FILE *file, std::string &line) {
+    line.clear();
+    int c;
+    while ((c = getc(file)) != EOF) {
+        if (c == '\n') {
+            return true;
+        }
+        line.push_back(char(c));
+    }
+    return !line.empty();
+}
+
+bool ReadPLYHeader(FILE *file, PLYHeader &header) {
+    std::string line;
+    if (!ReadPLYLine(file, line) || line.compare(0, 3, "ply") != 0) {
+        utility::LogWarning("[ReadPLYHeader] Not a PLY file.");
+        return false;
+    }
+    bool has_format = false;
+    header.elements_.clear();
+    while (ReadPLYLine(file, line)) {
+        std::vector<std::string> st;
+        utility::SplitString(st, line, "\t\r ");
+        if (st.empty() || st[0] == "comment" || st[0] == "obj_info") {
+            continue;
+        }
+        if (st[0] == "format" && st.size() >= 2) {
+            if (st[1] == "ascii") {
+                header.format_ = PLYFormat::ASCII;
+            } else if (st[1] == "binary_little_endian") {
+                header.format_ = PLYFormat::BinaryLittleEndian;
+            } else if (st[1] == "binary_big_endian") {
+                header.format_ = PLYFormat::BinaryBigEndian;
+            } else {
+                utility::LogWarning("[ReadPLYHeader] Unknown format {}.",
+                                    st[1]);
+                return false;
+            }
+            has_format = true;
+        } else if (st[0] == "element" && st.size() >= 3) {
+            PLYElement element;
+            element.name_ = st[1];
+            element.count_ = std::strtoll(st[2].c_str(), nullptr, 10);
+            if (element.count_ < 0) {
+                utility::LogWarning("[ReadPLYHeader] Bad element count.");
+                return false;
+            }
+            header.elements_.push_back(element);
+        } else if (st[0] == "property" && !header.elements_.empty()) {
+            PLYProperty property;
+            if (st.size() >= 5 && st[1] == "list") {
+                property.count_type_ = GetPLYScalarType(st[2]);
+                property.type_ = GetPLYScalarType(st[3]);
+                property.name_ = st[4];
+                if (property.count_type_ == PLYScalarType::Unknown ||
+                    property.count_type_ == PLYScalarType::Float32 ||
+                    property.count_type_ == PLYScalarType::Float64) {
+                    utility::LogWarning(
+                            "[ReadPLYHeader] Bad list length type {}.", st[2]);
+                    return false;
+                }
+            } else if (st.size() >= 3) {
+                property.count_type_ = PLYScalarType::Unknown;
+                property.type_ = GetPLYScalarType(st[1]);
+                property.name_ = st[2];
+            } else {
+                utility::LogWarning("[ReadPLYHeader] Bad property.");
+                return false;
+            }
+            if (property.type_ == PLYScalarType::Unknown) {
+                utility::LogWarning("[ReadPLYHeader] Unknown type of {}.",
+                                    property.name_);
+                return false;
+            }
+            header.elements_.back().properties_.push_back(property);
+        } else if (st[0] == "end_header") {
+            if (!has_format) {
+                utility::LogWarning("[ReadPLYHeader] Missing format.");
+            }
+            return has_format;
+        } else {
+            utility::LogWarning("[ReadPLYHeader] Bad header line: {}", line);
+            return false;
+        }
+    }
+    utility::LogWarning("[ReadPLYHeader] Missing end_header.");
+    return false;
+}
+
+template <typename T>
+T LoadPLYValue(const char *ptr, bool swap) {
+    T value;
+    if (swap) {
+        char bytes[sizeof(T)];
+        for (size_t k = 0; k < sizeof(T); k++) {
+            bytes[k] = ptr[sizeof(T) - 1 - k];
+        }
+        memcpy(&value, bytes, sizeof(T));
+    } else {
+        memcpy(&value, ptr, sizeof(T));
+    }
+    return value;
+}
+
+int64_t LoadPLYListLength(PLYScalarType type, const char *ptr, bool swap) {
+    switch (type) {
+        case PLYScalarType::Int8:
+            return LoadPLYValue<std::int8_t>(ptr, swap);
+        case PLYScalarType::UInt8:
+            return LoadPLYValue<std::uint8_t>(ptr, swap);
+        case PLYScalarType::Int16:
+            return LoadPLYValue<std::int16_t>(ptr, swap);
+        case PLYScalarType::UInt16:
+            return LoadPLYValue<std::uint16_t>(ptr, swap);
+        case PLYScalarType::Int32:
+            return LoadPLYValue<std::int32_t>(ptr, swap);
+        case PLYScalarType::UInt32:
+            return LoadPLYValue<std::uint32_t>(ptr, swap);
+        default:
+            return -1;
+    }
+}
+
+// Copies the value at offset of num_rows records of record_size bytes to
+// dst. A column that fills whole records is copied with a single memcpy.
+template <typename SrcT, typename DstT>
+void CopyPLYColumn(const char *records,
+                   size_t record_size,
+                   size_t offset,
+                   int num_rows,
+                   bool swap,
+                   DstT *dst) {
+    if (std::is_same<SrcT, DstT>::value && !swap &&
+        record_size == sizeof(SrcT)) {
+        memcpy(dst, records, size_t(num_rows) * sizeof(SrcT));
+        return;
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_rows; i++) {
+        dst[i] = static_cast<DstT>(LoadPLYValue<SrcT>(
+                records + size_t(i) * record_size + offset, swap));
+    }
+}
+
+void CopyPLYColumn(PLYScalarType type,
+                   const char *records,
+                   size_t record_size,
+                   size_t offset,
+                   int num_rows,
+                   bool swap,
+                   void *dst) {
+    switch (type) {
+        case PLYScalarType::Int8:
+            CopyPLYColumn<std::int8_t>(records, record_size, offset, num_rows,
+                                       swap, static_cast<std::int32_t *>(dst));
+            break;
+        case PLYScalarType::UInt8:
+            CopyPLYColumn<std::uint8_t>(records, record_size, offset,
+                                        num_rows, swap,
+                                        static_cast<std::uint8_t *>(dst));
+            break;
+        case PLYScalarType::Int16:
+            CopyPLYColumn<std::int16_t>(records, record_size, offset,
+                                        num_rows, swap,
+                                        static_cast<std::int32_t *>(dst));
+            break;
+        case PLYScalarType::UInt16:
+            CopyPLYColumn<std::uint16_t>(records, record_size, offset,
+                                         num_rows, swap,
+                                         static_cast<std::int32_t *>(dst));
+            break;
+        case PLYScalarType::Int32:
+            CopyPLYColumn<std::int32_t>(records, record_size, offset,
+                                        num_rows, swap,
+                                        static_cast<std::int32_t *>(dst));
+            break;
+        case PLYScalarType::UInt32:
+            CopyPLYColumn<std::uint32_t>(records, record_size, offset,
+                                         num_rows, swap,
+                                         static_cast<std::int64_t *>(dst));
+            break;
+        case PLYScalarType::Float32:
+            CopyPLYColumn<float>(records, record_size, offset, num_rows, swap,
+                                 static_cast<float *>(dst));
+            break;
+        case PLYScalarType::Float64:
+            CopyPLYColumn<double>(records, record_size, offset, num_rows,
+                                  swap, static_cast<double *>(dst));
+            break;
+        default:
+            break;
+    }
+}
+
+// Reads the rows of a binary element in blocks of records that hold its
+// scalar properties back to back, and calls consume with each block. Rows
+// without list properties are read with a single fread per block.
+bool ReadPLYBinaryElement(
+        FILE *file,
+        const PLYElement &element,
+        bool swap,
+        const std::function<void(const char *, int64_t, int)> &consume) {
+    const size_t kBlockBytes = 64 << 20;
+    size_t record_size = 0;
+    bool has_lists = false;
+    for (const auto &property : element.properties_) {
+        if (property.count_type_ == PLYScalarType::Unknown) {
+            record_size += GetPLYScalarSize(property.type_);
+        } else {
+            has_lists = true;
+        }
+    }
+    if (record_size == 0 && !has_lists) {
+        return true;
+    }
+    int64_t block_rows = std::max<int64_t>(
+            1, kBlockBytes / std::max<size_t>(record_size, 1));
+    block_rows = std::min(block_rows, std::max<int64_t>(element.count_, 1));
+    std::vector<char> block(size_t(block_rows) * record_size);
+    std::vector<char> list_buffer;
+    for (int64_t row_begin = 0; row_begin < element.count_;
+         row_begin += block_rows) {
+        int num_rows = int(std::min(block_rows, element.count_ - row_begin));
+        if (!has_lists) {
+            if (fread(block.data(), record_size, num_rows, file) !=
+                size_t(num_rows)) {
+                return false;
+            }
+        } else {
+            for (int i = 0; i < num_rows; i++) {
+                char *record = block.data() + size_t(i) * record_size;
+                for (const auto &property : element.properties_) {
+                    size_t size = GetPLYScalarSize(property.type_);
+                    if (property.count_type_ == PLYScalarType::Unknown) {
+                        if (fread(record, size, 1, file) != 1) {
+                            return false;
+                        }
+                        record += size;
+                        continue;
+                    }
+                    char length_bytes[4];
+                    if (fread(length_bytes,
+                              GetPLYScalarSize(property.count_type_), 1,
+                              file) != 1) {
+                        return false;
+                    }
+                    int64_t length = LoadPLYListLength(property.count_type_,
+                                                       length_bytes, swap);
+                    if (length < 0) {
+                        return false;
+                    }
+                    list_buffer.resize(size_t(length) * size);
+                    if (length > 0 && fread(list_buffer.data(), size, length,
+                                            file) != size_t(length)) {
+                        return false;
+                    }
+                }
+            }
+        }
+        consume(block.data(), row_begin, num_rows);
+    }
+    return true;
+}
+
+bool SkipPLYASCIILines(FILE *file, int64_t num_lines) {
+    for (int64_t i = 0; i < num_lines; i++) {
+        int c;
+        while ((c = getc(file)) != '\n') {
+            if (c == EOF) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename T>
+void StorePLYValue(void *dst, int64_t index, double value) {
+    static_cast<T *>(dst)[index] = static_cast<T>(value);
+}
+
+// A column of the vertex element to write.
+struct PLYTensorColumn {
+    std::string name_;
+    std::string type_name_;
+    Dtype dtype_;
+    const char *data_;
+    // Bytes between the values of consecutive points.
+    size_t stride_;
+    // Bytes of a value in the file.
+    size_t size_;
+    // Int64 values are written as 32-bit values.
+    bool narrow_;
+};
+
+// Splits the attributes into the columns of the vertex element. The returned
+// tensors own the data of the columns.
+bool GetPLYTensorColumns(const TensorMap &tensor_map,
+                         int64_t &num_points,
+                         std::vector<Tensor> &tensors,
+                         std::vector<PLYTensorColumn> &columns) {
+    std::vector<std::string> names;
+    if (!GetTensorMapWriteAttributes(tensor_map, names, tensors,
+                                     num_points)) {
+        return false;
+    }
+    for (size_t i = 0; i < names.size(); i++) {
+        const std::string &name = names[i];
+        const Tensor &tensor = tensors[i];
+        const SizeVector shape = tensor.GetShape();
+        PLYTensorColumn column;
+        column.dtype_ = tensor.GetDtype();
+        column.narrow_ = false;
+        switch (column.dtype_) {
+            case Dtype::Float32:
+                column.type_name_ = "float";
+                break;
+            case Dtype::Float64:
+                column.type_name_ = "double";
+                break;
+            case Dtype::Int32:
+                column.type_name_ = "int";
+                break;
+            case Dtype::UInt8:
+            case Dtype::Bool:
+                column.type_name_ = "uchar";
+                break;
+            case Dtype::Int64: {
+                const auto *values =
+                        static_cast<const int64_t *>(tensor.GetDataPtr());
+                int64_t count = tensor.NumElements();
+                auto range = std::minmax_element(values, values + count);
+                if (count == 0 ||
+                    (*range.first >= 0 && *range.second <= UINT32_MAX)) {
+                    column.type_name_ = "uint";
+                } else if (*range.first >= INT32_MIN &&
+                           *range.second <= INT32_MAX) {
+                    column.type_name_ = "int";
+                } else {
+                    utility::LogWarning(
+                            "[WritePLY] Values of Int64 attribute {} do not "
+                            "fit in 32 bits.",
+                            name);
+                    return false;
+                }
+                column.narrow_ = true;
+                break;
+            }
+            default:
+                utility::LogWarning("[WritePLY] Attribute {} has no dtype.",
+                                    name);
+                return false;
+        }
+        int64_t width = shape.size() == 2 ? shape[1] : 1;
+        size_t size = size_t(DtypeUtil::ByteSize(column.dtype_));
+        column.stride_ = size * size_t(width);
+        column.size_ = column.narrow_ ? 4 : size;
+        const char *data = static_cast<const char *>(tensor.GetDataPtr());
+        for (int64_t j = 0; j < width; j++) {
+            column.name_ = shape.size() == 2 ? name + "_" + std::to_string(j)
+                                             : name;
+            column.data_ = data + size_t(j) * size;
+            columns.push_back(column);
+        }
+    }
+    if (columns.empty()) {
+        utility::LogWarning("[WritePLY] No attributes to write.");
+        return false;
+    }
+    return true;
+}
+
+void AppendPLYASCIIValue(const PLYTensorColumn &column,
+                         int64_t index,
+                         std::string &line) {
+    const char *ptr = column.data_ + size_t(index) * column.stride_;
+    auto out = std::back_inserter(line);
+    switch (column.dtype_) {
+        case Dtype::Float32: {
+            float value;
+            memcpy(&value, ptr, sizeof(value));
+            fmt::format_to(out, "{}", value);
+            break;
+        }
+        case Dtype::Float64: {
+            double value;
+            memcpy(&value, ptr, sizeof(value));
+            fmt::format_to(out, "{}", value);
+            break;
+        }
+        case Dtype::Int32: {
+            std::int32_t value;
+            memcpy(&value, ptr, sizeof(value));
+            fmt::format_to(out, "{}", value);
+            break;
+        }
+        case Dtype::Int64: {
+            std::int64_t value;
+            memcpy(&value, ptr, sizeof(value));
+            fmt::format_to(out, "{}", value);
+            break;
+        }
+        case Dtype::UInt8:
+        case Dtype::Bool: {
+            std::uint8_t value;
+            memcpy(&value, ptr, sizeof(value));
+            fmt::format_to(out, "{}", int(value));
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+}  // namespace ply_tensor_io
+
 }  // unnamed namespace
 
 namespace io {
@@ -968,5 +1501,223 @@ bool WriteVoxelGridToPLY(const std::string &filename,
     return true;
 }
 
+bool ReadTensorMapFromPLY(const std::string &filename,
+                          TensorMap &tensor_map,
+                          bool print_progress) {
+    using namespace ply_tensor_io;
+    tensor_map.clear();
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read PLY failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    PLYHeader header;
+    if (!ReadPLYHeader(file, header)) {
+        utility::LogWarning("Read PLY failed: unable to parse header.");
+        fclose(file);
+        return false;
+    }
+    const bool swap = header.format_ != PLYFormat::ASCII &&
+                      (header.format_ == PLYFormat::BinaryLittleEndian) !=
+                              IsHostLittleEndian();
+    bool success = false;
+    for (const auto &element : header.elements_) {
+        if (element.name_ != "vertex") {
+            // Elements before the vertex element are skipped.
+            bool skipped =
+                    header.format_ == PLYFormat::ASCII
+                            ? SkipPLYASCIILines(file, element.count_)
+                            : ReadPLYBinaryElement(
+                                      file, element, swap,
+                                      [](const char *, int64_t, int) {});
+            if (!skipped) {
+                utility::LogWarning(
+                        "Read PLY failed: unable to read element {}.",
+                        element.name_);
+                break;
+            }
+            continue;
+        }
+        // Scalar properties in record order, with their byte offsets.
+        std::vector<const PLYProperty *> properties;
+        std::vector<size_t> offsets;
+        std::vector<void *> data_ptrs;
+        size_t record_size = 0;
+        bool has_lists = false;
+        bool has_duplicates = false;
+        for (const auto &property : element.properties_) {
+            if (property.count_type_ != PLYScalarType::Unknown) {
+                has_lists = true;
+                continue;
+            }
+            Tensor tensor(SizeVector({element.count_}),
+                          GetPLYScalarDtype(property.type_));
+            data_ptrs.push_back(tensor.GetDataPtr());
+            if (!tensor_map.emplace(property.name_, tensor).second) {
+                has_duplicates = true;
+            }
+            properties.push_back(&property);
+            offsets.push_back(record_size);
+            record_size += GetPLYScalarSize(property.type_);
+        }
+        if (has_duplicates) {
+            utility::LogWarning("Read PLY failed: duplicate property names.");
+            break;
+        }
+        if (header.format_ == PLYFormat::ASCII) {
+            if (has_lists) {
+                utility::LogWarning(
+                        "Read PLY failed: list properties of ASCII vertices "
+                        "are not supported.");
+                break;
+            }
+            std::vector<void (*)(void *, int64_t, double)> stores;
+            for (const auto *property : properties) {
+                switch (GetPLYScalarDtype(property->type_)) {
+                    case Dtype::UInt8:
+                        stores.push_back(StorePLYValue<std::uint8_t>);
+                        break;
+                    case Dtype::Int32:
+                        stores.push_back(StorePLYValue<std::int32_t>);
+                        break;
+                    case Dtype::Int64:
+                        stores.push_back(StorePLYValue<std::int64_t>);
+                        break;
+                    case Dtype::Float32:
+                        stores.push_back(StorePLYValue<float>);
+                        break;
+                    default:
+                        stores.push_back(StorePLYValue<double>);
+                        break;
+                }
+            }
+            size_t num_rows = 0;
+            success = properties.empty() ||
+                      utility::ReadNumericLines(
+                              file, int(properties.size()),
+                              [&](size_t total) { num_rows = total; },
+                              [&](size_t i, const double *values) {
+                                  for (size_t j = 0; j < stores.size(); j++) {
+                                      stores[j](data_ptrs[j], int64_t(i),
+                                                values[j]);
+                                  }
+                              },
+                              size_t(element.count_));
+            if (success && !properties.empty() &&
+                num_rows != size_t(element.count_)) {
+                success = false;
+            }
+        } else {
+            success = ReadPLYBinaryElement(
+                    file, element, swap,
+                    [&](const char *records, int64_t row_begin,
+                        int num_rows) {
+                        for (size_t j = 0; j < properties.size(); j++) {
+                            size_t size = size_t(DtypeUtil::ByteSize(
+                                    GetPLYScalarDtype(properties[j]->type_)));
+                            CopyPLYColumn(properties[j]->type_, records,
+                                          record_size, offsets[j], num_rows,
+                                          swap,
+                                          static_cast<char *>(data_ptrs[j]) +
+                                                  size_t(row_begin) * size);
+                        }
+                    });
+        }
+        if (!success) {
+            utility::LogWarning("Read PLY failed: unable to read vertices.");
+        }
+        break;
+    }
+    fclose(file);
+    if (!success) {
+        tensor_map.clear();
+    }
+    return success;
+}
+
+bool WriteTensorMapToPLY(const std::string &filename,
+                         const TensorMap &tensor_map,
+                         bool write_ascii /* = false*/,
+                         bool compressed /* = false*/,
+                         bool print_progress) {
+    using namespace ply_tensor_io;
+    int64_t num_points;
+    std::vector<Tensor> tensors;
+    std::vector<PLYTensorColumn> columns;
+    if (!GetPLYTensorColumns(tensor_map, num_points, tensors, columns)) {
+        utility::LogWarning("Write PLY failed: invalid attributes.");
+        return false;
+    }
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write PLY failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    fprintf(file, "ply\nformat %s 1.0\ncomment Created by Open3D\n",
+            write_ascii ? "ascii"
+                        : (IsHostLittleEndian() ? "binary_little_endian"
+                                                : "binary_big_endian"));
+    fprintf(file, "element vertex %lld\n", (long long)num_points);
+    for (const auto &column : columns) {
+        fprintf(file, "property %s %s\n", column.type_name_.c_str(),
+                column.name_.c_str());
+    }
+    fprintf(file, "end_header\n");
+    bool success = true;
+    if (write_ascii) {
+        success = utility::WriteLines(
+                file, size_t(num_points), [&](size_t i, std::string &line) {
+                    for (size_t j = 0; j < columns.size(); j++) {
+                        if (j > 0) {
+                            line.push_back(' ');
+                        }
+                        AppendPLYASCIIValue(columns[j], int64_t(i), line);
+                    }
+                    line.push_back('\n');
+                });
+    } else {
+        size_t record_size = 0;
+        for (const auto &column : columns) {
+            record_size += column.size_;
+        }
+        const int kBlockRows = 1 << 16;
+        std::vector<char> block(size_t(kBlockRows) * record_size);
+        for (int64_t row_begin = 0; success && row_begin < num_points;
+             row_begin += kBlockRows) {
+            int num_rows = int(std::min<int64_t>(kBlockRows,
+                                                 num_points - row_begin));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int i = 0; i < num_rows; i++) {
+                char *record = block.data() + size_t(i) * record_size;
+                for (size_t j = 0; j < columns.size(); j++) {
+                    const char *src =
+                            columns[j].data_ +
+                            size_t(row_begin + i) * columns[j].stride_;
+                    if (columns[j].narrow_) {
+                        std::int64_t value;
+                        memcpy(&value, src, sizeof(value));
+                        std::uint32_t bits = static_cast<std::uint32_t>(value);
+                        memcpy(record, &bits, sizeof(bits));
+                    } else {
+                        memcpy(record, src, columns[j].size_);
+                    }
+                    record += columns[j].size_;
+                }
+            }
+            success = fwrite(block.data(), record_size, num_rows, file) ==
+                      size_t(num_rows);
+        }
+    }
+    if (!success) {
+        utility::LogWarning("Write PLY failed: unable to write file: {}",
+                            filename);
+    }
+    fclose(file);
+    return success;
+}
 }  // namespace io
 }  // namespace open3d
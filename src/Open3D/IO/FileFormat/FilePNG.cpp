@@ -25,9 +25,14 @@
 // ----------------------------------------------------------------------------
 
 #include <png.h>
+#include <zlib.h>
+
+#include <cstdio>
+#include <vector>
 
 #include "Open3D/IO/ClassIO/ImageIO.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
 
 namespace open3d {
 
@@ -46,6 +51,95 @@ void SetPNGImageFromImage(const geometry::Image &image, png_image &pngimage) {
     }
 }
 
+int GetPNGFilters(PNGWriteOption::Filter filter) {
+    switch (filter) {
+        case PNGWriteOption::Filter::None:
+            return PNG_FILTER_NONE;
+        case PNGWriteOption::Filter::Sub:
+            return PNG_FILTER_SUB;
+        case PNGWriteOption::Filter::Up:
+            return PNG_FILTER_UP;
+        case PNGWriteOption::Filter::Average:
+            return PNG_FILTER_AVG;
+        case PNGWriteOption::Filter::Paeth:
+            return PNG_FILTER_PAETH;
+        case PNGWriteOption::Filter::Adaptive:
+        default:
+            return PNG_ALL_FILTERS;
+    }
+}
+
+int GetZlibStrategy(PNGWriteOption::Strategy strategy) {
+    switch (strategy) {
+        case PNGWriteOption::Strategy::Filtered:
+            return Z_FILTERED;
+        case PNGWriteOption::Strategy::HuffmanOnly:
+            return Z_HUFFMAN_ONLY;
+        case PNGWriteOption::Strategy::RLE:
+            return Z_RLE;
+        case PNGWriteOption::Strategy::Default:
+        default:
+            return Z_DEFAULT_STRATEGY;
+    }
+}
+
+/// Writes with the full libpng API, which unlike the simplified API exposes
+/// the zlib settings. The header chunks match those of
+/// png_image_write_to_file().
+bool WritePNGFile(FILE *file,
+                  const geometry::Image &image,
+                  const PNGWriteOption &option) {
+    png_structp png_ptr =
+            png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    if (png_ptr == NULL) {
+        return false;
+    }
+    png_infop info_ptr = png_create_info_struct(png_ptr);
+    if (info_ptr == NULL) {
+        png_destroy_write_struct(&png_ptr, NULL);
+        return false;
+    }
+    std::vector<png_bytep> rows(image.height_);
+    if (setjmp(png_jmpbuf(png_ptr))) {
+        png_destroy_write_struct(&png_ptr, &info_ptr);
+        return false;
+    }
+    png_init_io(png_ptr, file);
+    png_set_IHDR(png_ptr, info_ptr, image.width_, image.height_,
+                 image.bytes_per_channel_ * 8,
+                 image.num_of_channels_ == 3 ? PNG_COLOR_TYPE_RGB
+                                             : PNG_COLOR_TYPE_GRAY,
+                 PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+                 PNG_FILTER_TYPE_DEFAULT);
+    if (image.bytes_per_channel_ == 2) {
+        png_set_gAMA_fixed(png_ptr, info_ptr, PNG_GAMMA_LINEAR);
+    } else {
+        png_set_sRGB(png_ptr, info_ptr, PNG_sRGB_INTENT_PERCEPTUAL);
+    }
+    png_set_compression_level(png_ptr, option.compression_level_ < 0
+                                               ? Z_DEFAULT_COMPRESSION
+                                               : option.compression_level_);
+    png_set_compression_strategy(png_ptr, GetZlibStrategy(option.strategy_));
+    png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE,
+                   GetPNGFilters(option.filter_));
+    png_write_info(png_ptr, info_ptr);
+    if (image.bytes_per_channel_ == 2) {
+        // PNG stores 16-bit samples in big-endian order.
+        const std::uint16_t one = 1;
+        if (*reinterpret_cast<const std::uint8_t *>(&one) == 1) {
+            png_set_swap(png_ptr);
+        }
+    }
+    const size_t stride = size_t(image.BytesPerLine());
+    for (int y = 0; y < image.height_; y++) {
+        rows[y] = const_cast<png_bytep>(image.data_.data() + y * stride);
+    }
+    png_write_image(png_ptr, rows.data());
+    png_write_end(png_ptr, NULL);
+    png_destroy_write_struct(&png_ptr, &info_ptr);
+    return true;
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -95,5 +189,34 @@ bool WriteImageToPNG(const std::string &filename,
     return true;
 }
 
+bool WriteImageToPNG(const std::string &filename,
+                     const geometry::Image &image,
+                     const PNGWriteOption &option) {
+    if (image.HasData() == false) {
+        utility::LogWarning("Write PNG failed: image has no data.");
+        return false;
+    }
+    if (option.compression_level_ > 9) {
+        utility::LogWarning("Write PNG failed: invalid compression level {:d}.",
+                            option.compression_level_);
+        return false;
+    }
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write PNG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = WritePNGFile(file, image, option);
+    if (fclose(file) != 0) {
+        success = false;
+    }
+    if (!success) {
+        utility::LogWarning("Write PNG failed: unable to write file: {}",
+                            filename);
+    }
+    return success;
+}
+
 }  // namespace io
 }  // namespace open3d
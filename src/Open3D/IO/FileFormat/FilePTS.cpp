@@ -25,10 +25,13 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <iterator>
+
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/ParallelTextIO.h"
 
 namespace open3d {
 namespace io {
@@ -52,45 +55,55 @@ bool ReadPointCloudFromPTS(const std::string &filename,
         fclose(file);
         return false;
     }
+    // The fields of the first point decide the layout of all points.
+    long data_begin = ftell(file);
+    if (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
+        std::vector<std::string> st;
+        utility::SplitString(st, line_buffer, " ");
+        num_of_fields = (int)st.size();
+    }
+    if (num_of_fields == 0) {
+        fclose(file);
+        return true;
+    }
+    if (num_of_fields < 3) {
+        utility::LogWarning("Read PTS failed: insufficient data fields.");
+        fclose(file);
+        return false;
+    }
+    fseek(file, data_begin, SEEK_SET);
+
     utility::ConsoleProgressBar progress_bar(num_of_pts,
                                              "Reading PTS: ", print_progress);
-    size_t idx = 0;
-    while (idx < num_of_pts &&
-           fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
-        if (num_of_fields == 0) {
-            std::vector<std::string> st;
-            utility::SplitString(st, line_buffer, " ");
-            num_of_fields = (int)st.size();
-            if (num_of_fields < 3) {
-                utility::LogWarning(
-                        "Read PTS failed: insufficient data fields.");
-                fclose(file);
-                return false;
-            }
-            pointcloud.points_.resize(num_of_pts);
-            if (num_of_fields >= 7) {
-                // X Y Z I R G B
-                pointcloud.colors_.resize(num_of_pts);
-            }
-        }
-        double x, y, z;
-        int i, r, g, b;
-        if (num_of_fields < 7) {
-            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-            }
-        } else {
-            if (sscanf(line_buffer, "%lf %lf %lf %d %d %d %d", &x, &y, &z, &i,
-                       &r, &g, &b) == 7) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                pointcloud.colors_[idx] = Eigen::Vector3d(r, g, b) / 255.0;
-            }
-        }
-        idx++;
-        ++progress_bar;
+    size_t num_reported = 0;
+    // X Y Z or X Y Z I R G B
+    bool has_colors = num_of_fields >= 7;
+    bool success = utility::ReadNumericLines(
+            file, has_colors ? 7 : 3,
+            [&](size_t num_points) {
+                pointcloud.points_.resize(num_points);
+                if (has_colors) {
+                    pointcloud.colors_.resize(num_points);
+                }
+                for (; num_reported < num_points; num_reported++) {
+                    ++progress_bar;
+                }
+            },
+            [&](size_t i, const double *values) {
+                pointcloud.points_[i] =
+                        Eigen::Vector3d(values[0], values[1], values[2]);
+                if (has_colors) {
+                    pointcloud.colors_[i] =
+                            Eigen::Vector3d(values[4], values[5], values[6]) /
+                            255.0;
+                }
+            },
+            num_of_pts, true);
+    if (!success) {
+        utility::LogWarning("Read PTS failed: unable to read file.");
     }
     fclose(file);
-    return true;
+    return success;
 }
 
 bool WritePointCloudToPTS(const std::string &filename,
@@ -104,24 +117,28 @@ bool WritePointCloudToPTS(const std::string &filename,
         return false;
     }
     fprintf(file, "%zu\r\n", (size_t)pointcloud.points_.size());
-    utility::ConsoleProgressBar progress_bar(
-            static_cast<size_t>(pointcloud.points_.size()),
-            "Writing PTS: ", print_progress);
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const auto &point = pointcloud.points_[i];
-        if (pointcloud.HasColors() == false) {
-            fprintf(file, "%.10f %.10f %.10f\r\n", point(0), point(1),
-                    point(2));
-        } else {
-            const auto &color = pointcloud.colors_[i] * 255.0;
-            fprintf(file, "%.10f %.10f %.10f %d %d %d %d\r\n", point(0),
-                    point(1), point(2), 0, (int)color(0), (int)color(1),
-                    (int)(color(2)));
-        }
-        ++progress_bar;
+    bool success = utility::WriteLines(
+            file, pointcloud.points_.size(),
+            [&](size_t i, std::string &buffer) {
+                const auto &point = pointcloud.points_[i];
+                if (pointcloud.HasColors() == false) {
+                    fmt::format_to(std::back_inserter(buffer),
+                                   "{:.10f} {:.10f} {:.10f}\r\n", point(0),
+                                   point(1), point(2));
+                } else {
+                    const auto &color = pointcloud.colors_[i] * 255.0;
+                    fmt::format_to(std::back_inserter(buffer),
+                                   "{:.10f} {:.10f} {:.10f} {} {} {} {}\r\n",
+                                   point(0), point(1), point(2), 0,
+                                   (int)color(0), (int)color(1),
+                                   (int)(color(2)));
+                }
+            });
+    if (!success) {
+        utility::LogWarning("Write PTS failed: unable to write file.");
     }
     fclose(file);
-    return true;
+    return success;
 }
 
 }  // namespace io
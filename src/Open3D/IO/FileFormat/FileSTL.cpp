@@ -24,33 +24,146 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <vector>
 
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/RadixSort.h"
 
 namespace open3d {
+
+namespace {
+
+// Number of 50 byte triangle records read and decoded at once.
+const size_t kTrianglesPerBlock = size_t(1) << 20;
+
+Eigen::Vector3f DecodeVector(const char *record) {
+    float values[3];
+    std::memcpy(values, record, sizeof(values));
+    return Eigen::Vector3f(values[0], values[1], values[2]);
+}
+
+// Hash of the coordinates that is equal for vertices comparing equal.
+uint64_t HashVertex(const Eigen::Vector3f &vertex) {
+    uint64_t hash = 0;
+    for (int i = 0; i < 3; i++) {
+        // Adding 0 turns -0 into +0.
+        float value = vertex(i) + 0.0f;
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        hash = (hash ^ bits) * 0x9e3779b97f4a7c15ull;
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
+// Merges vertices with equal coordinates. Unique vertices keep the order of
+// their first occurrence, as in TriangleMesh::RemoveDuplicatedVertices.
+void WeldVertices(const std::vector<Eigen::Vector3f> &vertices,
+                  std::vector<Eigen::Vector3d> &unique_vertices,
+                  std::vector<int> &vertex_to_unique) {
+    int num_vertices = int(vertices.size());
+    // A few more hash bits than vertices keep collisions rare while the radix
+    // sort only needs a few passes.
+    int num_bits = 4;
+    while (num_bits < 64 && (uint64_t(1) << (num_bits - 4)) < vertices.size()) {
+        num_bits++;
+    }
+    std::vector<uint64_t> keys(num_vertices);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_vertices; i++) {
+        keys[i] = HashVertex(vertices[i]) >> (64 - num_bits);
+    }
+    std::vector<size_t> order;
+    utility::RadixSortWithIndices(keys, order);
+
+    // Within each run of equal hashes, map every vertex to the first vertex
+    // with equal coordinates. The sort is stable, so that is the vertex with
+    // the smallest index.
+    std::vector<int> first(num_vertices);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> distinct;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 4096)
+#endif
+        for (int begin = 0; begin < num_vertices; begin++) {
+            if (begin > 0 && keys[begin] == keys[begin - 1]) {
+                continue;
+            }
+            distinct.clear();
+            for (int k = begin; k < num_vertices && keys[k] == keys[begin];
+                 k++) {
+                int v = int(order[k]);
+                first[v] = v;
+                for (int d : distinct) {
+                    if (vertices[d] == vertices[v]) {
+                        first[v] = d;
+                        break;
+                    }
+                }
+                if (first[v] == v) {
+                    distinct.push_back(v);
+                }
+            }
+        }
+    }
+    std::vector<uint64_t>().swap(keys);
+    std::vector<size_t>().swap(order);
+
+    vertex_to_unique.resize(num_vertices);
+    int num_unique = 0;
+    for (int v = 0; v < num_vertices; v++) {
+        if (first[v] == v) {
+            vertex_to_unique[v] = num_unique++;
+        }
+    }
+    unique_vertices.resize(num_unique);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < num_vertices; v++) {
+        vertex_to_unique[v] = vertex_to_unique[first[v]];
+        if (first[v] == v) {
+            unique_vertices[vertex_to_unique[v]] = vertices[v].cast<double>();
+        }
+    }
+}
+
+}  // unnamed namespace
+
 namespace io {
 
 bool ReadTriangleMeshFromSTL(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress) {
+    return ReadTriangleMeshFromSTL(filename, mesh, false, print_progress);
+}
+
+bool ReadTriangleMeshFromSTL(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             bool weld_vertices,
+                             bool print_progress) {
     FILE *myFile = utility::filesystem::FOpen(filename.c_str(), "rb");
 
     if (!myFile) {
         utility::LogWarning("Read STL failed: unable to open file.");
-        fclose(myFile);
         return false;
     }
 
-    int num_of_triangles;
-    if (myFile) {
-        char header[80] = "";
-        fread(header, sizeof(char), 80, myFile);
-        fread(&num_of_triangles, sizeof(unsigned int), 1, myFile);
-    } else {
+    char header[80] = "";
+    uint32_t num_of_triangles = 0;
+    if (fread(header, sizeof(char), 80, myFile) != 80 ||
+        fread(&num_of_triangles, sizeof(uint32_t), 1, myFile) != 1) {
         utility::LogWarning("Read STL failed: unable to read header.");
         fclose(myFile);
         return false;
@@ -62,42 +175,70 @@ bool ReadTriangleMeshFromSTL(const std::string &filename,
         return false;
     }
 
-    mesh.vertices_.clear();
-    mesh.triangles_.clear();
-    mesh.triangle_normals_.clear();
-    mesh.vertices_.resize(num_of_triangles * 3);
+    mesh.Clear();
+    std::vector<Eigen::Vector3f> float_vertices;
+    if (weld_vertices) {
+        float_vertices.resize(size_t(num_of_triangles) * 3);
+    } else {
+        mesh.vertices_.resize(size_t(num_of_triangles) * 3);
+    }
     mesh.triangles_.resize(num_of_triangles);
     mesh.triangle_normals_.resize(num_of_triangles);
 
     utility::ConsoleProgressBar progress_bar(num_of_triangles,
                                              "Reading STL: ", print_progress);
-    for (int i = 0; i < num_of_triangles; i++) {
-        char buffer[50];
-        float *float_buffer;
-        if (myFile) {
-            fread(buffer, sizeof(char), 50, myFile);
-            float_buffer = reinterpret_cast<float *>(buffer);
-            mesh.triangle_normals_[i] =
-                    Eigen::Map<Eigen::Vector3f>(float_buffer).cast<double>();
-            for (int j = 0; j < 3; j++) {
-                float_buffer = reinterpret_cast<float *>(buffer + 12 * (j + 1));
-                mesh.vertices_[i * 3 + j] =
-                        Eigen::Map<Eigen::Vector3f>(float_buffer)
-                                .cast<double>();
-            }
-            mesh.triangles_[i] =
-                    Eigen::Vector3i(i * 3 + 0, i * 3 + 1, i * 3 + 2);
-            // ignore buffer[48] and buffer [49] because it is rarely used.
-
-        } else {
+    std::vector<char> buffer(
+            std::min<size_t>(num_of_triangles, kTrianglesPerBlock) * 50);
+    for (size_t block_begin = 0; block_begin < num_of_triangles;
+         block_begin += kTrianglesPerBlock) {
+        int block_size = int(std::min<size_t>(num_of_triangles - block_begin,
+                                              kTrianglesPerBlock));
+        if (fread(buffer.data(), 50, block_size, myFile) !=
+            size_t(block_size)) {
             utility::LogWarning("Read STL failed: not enough triangles.");
             fclose(myFile);
+            mesh.Clear();
             return false;
         }
-        ++progress_bar;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int k = 0; k < block_size; k++) {
+            const char *record = buffer.data() + size_t(k) * 50;
+            size_t i = block_begin + k;
+            mesh.triangle_normals_[i] = DecodeVector(record).cast<double>();
+            for (int j = 0; j < 3; j++) {
+                Eigen::Vector3f vertex = DecodeVector(record + 12 * (j + 1));
+                if (weld_vertices) {
+                    float_vertices[i * 3 + j] = vertex;
+                } else {
+                    mesh.vertices_[i * 3 + j] = vertex.cast<double>();
+                }
+            }
+            mesh.triangles_[i] = Eigen::Vector3i(int(i * 3 + 0), int(i * 3 + 1),
+                                                 int(i * 3 + 2));
+            // ignore record[48] and record[49] because it is rarely used.
+        }
+        for (int k = 0; k < block_size; k++) {
+            ++progress_bar;
+        }
     }
-
     fclose(myFile);
+
+    if (weld_vertices) {
+        std::vector<int> vertex_to_unique;
+        WeldVertices(float_vertices, mesh.vertices_, vertex_to_unique);
+        std::vector<Eigen::Vector3f>().swap(float_vertices);
+        int num_triangles = int(num_of_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < num_triangles; i++) {
+            for (int j = 0; j < 3; j++) {
+                mesh.triangles_[i](j) = vertex_to_unique[i * 3 + j];
+            }
+        }
+    }
     return true;
 }
 
@@ -0,0 +1,679 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <liblzf/lzf.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/RadixSort.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// TPC (tiled point cloud) is an Open3D-native format that supports reading a
+// spatial region or a level of detail without reading the whole file. The
+// layout, in little-endian byte order, is
+//
+//   header       magic "O3DTPC01", uint32 num_levels, uint32 attributes,
+//                uint64 num_points, uint64 num_tiles, double bounds[6]
+//   tile table   num_tiles x double bounds[6]
+//   block table  num_tiles x num_levels x {uint64 offset, uint32 num_points,
+//                uint32 compressed_size}
+//   blocks
+//
+// where bounds are the minimum x, y, z followed by the maximum x, y, z. Tiles
+// are the leaves of an octree over the cloud and are stored in Morton order.
+// Block k of a tile holds the points of level k of the tile. Each block is
+// compressed with LZF on its own and holds the x, y and z coordinates as
+// doubles, the normals as floats and the colors as bytes, field by field. A
+// block whose compressed size equals its raw size is stored uncompressed.
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+const char kTPCMagic[8] = {'O', '3', 'D', 'T', 'P', 'C', '0', '1'};
+const std::uint32_t kTPCHasNormals = 1;
+const std::uint32_t kTPCHasColors = 2;
+const int kTPCMaxLevels = 32;
+const size_t kTPCHeaderSize = 80;
+
+/// Points are sorted by Morton codes of this many bits per axis.
+const int kMortonDepth = 21;
+
+struct TPCHeader {
+    std::uint32_t num_levels = 0;
+    std::uint32_t attributes = 0;
+    std::uint64_t num_points = 0;
+    std::uint64_t num_tiles = 0;
+    double bounds[6] = {0, 0, 0, 0, 0, 0};
+};
+
+struct TPCBlock {
+    std::uint64_t offset;
+    std::uint32_t num_points;
+    std::uint32_t compressed_size;
+};
+static_assert(sizeof(TPCBlock) == 16, "TPCBlock must not be padded.");
+
+size_t TPCPointSize(std::uint32_t attributes) {
+    size_t size = 3 * sizeof(double);
+    if (attributes & kTPCHasNormals) {
+        size += 3 * sizeof(float);
+    }
+    if (attributes & kTPCHasColors) {
+        size += 3;
+    }
+    return size;
+}
+
+bool SeekTPC(FILE *file, std::uint64_t offset) {
+#ifdef _WIN32
+    return _fseeki64(file, (__int64)offset, SEEK_SET) == 0;
+#else
+    return fseeko(file, (off_t)offset, SEEK_SET) == 0;
+#endif
+}
+
+uint64_t SpreadBits(uint64_t x) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffffULL;
+    x = (x | x << 16) & 0x1f0000ff0000ffULL;
+    x = (x | x << 8) & 0x100f00f00f00f00fULL;
+    x = (x | x << 4) & 0x10c30c30c30c30c3ULL;
+    x = (x | x << 2) & 0x1249249249249249ULL;
+    return x;
+}
+
+/// Returns the Morton code of the cell of depth \p depth containing the point
+/// with Morton code \p code.
+uint64_t CellCode(uint64_t code, int depth) {
+    if (depth >= kMortonDepth) {
+        return code;
+    }
+    return code >> (3 * (kMortonDepth - depth));
+}
+
+/// Appends the ranges of the octree leaves with at most \p max_points_per_tile
+/// points below the cell [begin, end) of depth \p depth, in Morton order.
+void SplitTiles(const std::vector<uint64_t> &codes,
+                size_t begin,
+                size_t end,
+                int depth,
+                size_t max_points_per_tile,
+                std::vector<std::pair<size_t, size_t>> &tiles) {
+    if (end - begin <= max_points_per_tile || depth >= kMortonDepth) {
+        tiles.emplace_back(begin, end);
+        return;
+    }
+    for (size_t k = begin; k < end;) {
+        uint64_t cell = CellCode(codes[k], depth + 1);
+        size_t child_end = size_t(
+                std::partition_point(codes.begin() + k, codes.begin() + end,
+                                     [cell, depth](uint64_t code) {
+                                         return CellCode(code, depth + 1) ==
+                                                cell;
+                                     }) -
+                codes.begin());
+        SplitTiles(codes, k, child_end, depth + 1, max_points_per_tile, tiles);
+        k = child_end;
+    }
+}
+
+/// Assigns the points [begin, end) of a cell of depth sampling_depth to
+/// levels. Level k keeps the first point of every cell of depth
+/// sampling_depth + k that has no point of a coarser level, and the last level
+/// keeps the remaining points.
+void AssignTPCLevels(const std::vector<uint64_t> &codes,
+                     size_t begin,
+                     size_t end,
+                     int num_levels,
+                     int sampling_depth,
+                     std::vector<std::uint8_t> &levels) {
+    for (int k = 0; k + 1 < num_levels; k++) {
+        const int depth = sampling_depth + k;
+        for (size_t i = begin; i < end;) {
+            uint64_t cell = CellCode(codes[i], depth);
+            size_t cell_end = i;
+            bool occupied = false;
+            while (cell_end < end && CellCode(codes[cell_end], depth) == cell) {
+                occupied = occupied || levels[cell_end] < k;
+                cell_end++;
+            }
+            if (!occupied) {
+                levels[i] = std::uint8_t(k);
+            }
+            i = cell_end;
+        }
+    }
+}
+
+/// Packs the points \p indices of \p pointcloud field by field.
+void EncodeTPCBlock(const geometry::PointCloud &pointcloud,
+                    const std::vector<size_t> &indices,
+                    std::uint32_t attributes,
+                    std::vector<char> &raw) {
+    const size_t n = indices.size();
+    raw.resize(n * TPCPointSize(attributes));
+    char *ptr = raw.data();
+    for (int axis = 0; axis < 3; axis++) {
+        for (size_t i = 0; i < n; i++) {
+            double value = pointcloud.points_[indices[i]](axis);
+            memcpy(ptr, &value, sizeof(value));
+            ptr += sizeof(value);
+        }
+    }
+    if (attributes & kTPCHasNormals) {
+        for (int axis = 0; axis < 3; axis++) {
+            for (size_t i = 0; i < n; i++) {
+                float value = float(pointcloud.normals_[indices[i]](axis));
+                memcpy(ptr, &value, sizeof(value));
+                ptr += sizeof(value);
+            }
+        }
+    }
+    if (attributes & kTPCHasColors) {
+        for (int channel = 0; channel < 3; channel++) {
+            for (size_t i = 0; i < n; i++) {
+                double value = pointcloud.colors_[indices[i]](channel);
+                *ptr++ = char(std::uint8_t(
+                        std::min(255.0, std::max(0.0, value * 255.0 + 0.5))));
+            }
+        }
+    }
+}
+
+/// Unpacks a block of \p num_points points into \p pointcloud, starting at
+/// point \p offset.
+void DecodeTPCBlock(const char *raw,
+                    size_t num_points,
+                    std::uint32_t attributes,
+                    geometry::PointCloud &pointcloud,
+                    size_t offset) {
+    const char *ptr = raw;
+    for (int axis = 0; axis < 3; axis++) {
+        for (size_t i = 0; i < num_points; i++) {
+            double value;
+            memcpy(&value, ptr, sizeof(value));
+            pointcloud.points_[offset + i](axis) = value;
+            ptr += sizeof(value);
+        }
+    }
+    if (attributes & kTPCHasNormals) {
+        for (int axis = 0; axis < 3; axis++) {
+            for (size_t i = 0; i < num_points; i++) {
+                float value;
+                memcpy(&value, ptr, sizeof(value));
+                pointcloud.normals_[offset + i](axis) = value;
+                ptr += sizeof(value);
+            }
+        }
+    }
+    if (attributes & kTPCHasColors) {
+        for (int channel = 0; channel < 3; channel++) {
+            for (size_t i = 0; i < num_points; i++) {
+                pointcloud.colors_[offset + i](channel) =
+                        std::uint8_t(*ptr++) / 255.0;
+            }
+        }
+    }
+}
+
+bool WriteTPCIndex(FILE *file,
+                   const TPCHeader &header,
+                   const std::vector<double> &tile_bounds,
+                   const std::vector<TPCBlock> &blocks) {
+    return fwrite(kTPCMagic, 1, sizeof(kTPCMagic), file) ==
+                   sizeof(kTPCMagic) &&
+           fwrite(&header.num_levels, 4, 1, file) == 1 &&
+           fwrite(&header.attributes, 4, 1, file) == 1 &&
+           fwrite(&header.num_points, 8, 1, file) == 1 &&
+           fwrite(&header.num_tiles, 8, 1, file) == 1 &&
+           fwrite(header.bounds, 8, 6, file) == 6 &&
+           fwrite(tile_bounds.data(), 8, tile_bounds.size(), file) ==
+                   tile_bounds.size() &&
+           fwrite(blocks.data(), sizeof(TPCBlock), blocks.size(), file) ==
+                   blocks.size();
+}
+
+bool ReadTPCIndex(FILE *file,
+                  TPCHeader &header,
+                  std::vector<double> &tile_bounds,
+                  std::vector<TPCBlock> &blocks) {
+    char magic[sizeof(kTPCMagic)];
+    if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) ||
+        memcmp(magic, kTPCMagic, sizeof(magic)) != 0) {
+        utility::LogWarning("Read TPC failed: not a TPC file.");
+        return false;
+    }
+    if (fread(&header.num_levels, 4, 1, file) != 1 ||
+        fread(&header.attributes, 4, 1, file) != 1 ||
+        fread(&header.num_points, 8, 1, file) != 1 ||
+        fread(&header.num_tiles, 8, 1, file) != 1 ||
+        fread(header.bounds, 8, 6, file) != 6 || header.num_levels == 0 ||
+        header.num_levels > kTPCMaxLevels ||
+        header.num_tiles > header.num_points) {
+        utility::LogWarning("Read TPC failed: invalid header.");
+        return false;
+    }
+    tile_bounds.resize(header.num_tiles * 6);
+    blocks.resize(header.num_tiles * header.num_levels);
+    if (fread(tile_bounds.data(), 8, tile_bounds.size(), file) !=
+                tile_bounds.size() ||
+        fread(blocks.data(), sizeof(TPCBlock), blocks.size(), file) !=
+                blocks.size()) {
+        utility::LogWarning("Read TPC failed: unable to read the index.");
+        return false;
+    }
+    std::uint64_t num_points = 0;
+    for (const auto &block : blocks) {
+        num_points += block.num_points;
+    }
+    if (num_points != header.num_points) {
+        utility::LogWarning("Read TPC failed: invalid index.");
+        return false;
+    }
+    return true;
+}
+
+/// Reads the blocks of levels up to \p level of the tiles intersecting \p bbox,
+/// or of all tiles if \p bbox is null, and keeps the points inside \p bbox.
+bool ReadTPC(const std::string &filename,
+             geometry::PointCloud &pointcloud,
+             const geometry::AxisAlignedBoundingBox *bbox,
+             int level,
+             bool print_progress) {
+    pointcloud.Clear();
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read TPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    TPCHeader header;
+    std::vector<double> tile_bounds;
+    std::vector<TPCBlock> blocks;
+    bool success = ReadTPCIndex(file, header, tile_bounds, blocks);
+    fclose(file);
+    if (!success) {
+        return false;
+    }
+    const int num_levels = int(header.num_levels);
+    const int max_level =
+            level < 0 || level >= num_levels ? num_levels - 1 : level;
+
+    // Blocks to read, in file order, and whether their points need to be
+    // tested against the box.
+    std::vector<size_t> selected_blocks;
+    std::vector<size_t> offsets(1, 0);
+    bool crop = false;
+    for (size_t t = 0; t < header.num_tiles; t++) {
+        const double *bounds = tile_bounds.data() + 6 * t;
+        if (bbox != nullptr) {
+            bool intersects = true, inside = true;
+            for (int axis = 0; axis < 3; axis++) {
+                intersects = intersects &&
+                             !(bounds[axis] > bbox->max_bound_(axis)) &&
+                             !(bounds[axis + 3] < bbox->min_bound_(axis));
+                inside = inside && bounds[axis] >= bbox->min_bound_(axis) &&
+                         bounds[axis + 3] <= bbox->max_bound_(axis);
+            }
+            if (!intersects) {
+                continue;
+            }
+            crop = crop || !inside;
+        }
+        for (int k = 0; k <= max_level; k++) {
+            const TPCBlock &block = blocks[t * num_levels + k];
+            if (block.num_points == 0) {
+                continue;
+            }
+            selected_blocks.push_back(t * num_levels + k);
+            offsets.push_back(offsets.back() + block.num_points);
+        }
+    }
+    utility::LogDebug("Read TPC: {:d} of {:d} blocks selected.",
+                      selected_blocks.size(), blocks.size());
+
+    const size_t num_points = offsets.back();
+    pointcloud.points_.resize(num_points);
+    if (header.attributes & kTPCHasNormals) {
+        pointcloud.normals_.resize(num_points);
+    }
+    if (header.attributes & kTPCHasColors) {
+        pointcloud.colors_.resize(num_points);
+    }
+    const size_t point_size = TPCPointSize(header.attributes);
+    utility::ConsoleProgressBar progress_bar(selected_blocks.size(),
+                                             "Reading TPC: ", print_progress);
+    std::atomic<bool> blocks_read(true);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        FILE *block_file = utility::filesystem::FOpen(filename, "rb");
+        std::vector<char> compressed, raw;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int i = 0; i < int(selected_blocks.size()); i++) {
+            if (block_file == NULL || !blocks_read) {
+                blocks_read = false;
+                continue;
+            }
+            const TPCBlock &block = blocks[selected_blocks[i]];
+            const size_t raw_size = block.num_points * point_size;
+            compressed.resize(block.compressed_size);
+            raw.resize(raw_size);
+            if (!SeekTPC(block_file, block.offset) ||
+                fread(compressed.data(), 1, compressed.size(), block_file) !=
+                        compressed.size()) {
+                blocks_read = false;
+                continue;
+            }
+            const char *data = compressed.data();
+            if (block.compressed_size != raw_size) {
+                if (lzf_decompress(compressed.data(), block.compressed_size,
+                                   raw.data(), (unsigned int)raw_size) !=
+                    raw_size) {
+                    blocks_read = false;
+                    continue;
+                }
+                data = raw.data();
+            }
+            DecodeTPCBlock(data, block.num_points, header.attributes,
+                           pointcloud, offsets[i]);
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            { ++progress_bar; }
+        }
+        if (block_file != NULL) {
+            fclose(block_file);
+        }
+    }
+    if (!blocks_read) {
+        utility::LogWarning("Read TPC failed: unable to read the data.");
+        pointcloud.Clear();
+        return false;
+    }
+
+    if (crop) {
+        const bool has_normals = pointcloud.HasNormals();
+        const bool has_colors = pointcloud.HasColors();
+        size_t kept = 0;
+        for (size_t i = 0; i < num_points; i++) {
+            const Eigen::Vector3d &point = pointcloud.points_[i];
+            if (point(0) >= bbox->min_bound_(0) &&
+                point(0) <= bbox->max_bound_(0) &&
+                point(1) >= bbox->min_bound_(1) &&
+                point(1) <= bbox->max_bound_(1) &&
+                point(2) >= bbox->min_bound_(2) &&
+                point(2) <= bbox->max_bound_(2)) {
+                pointcloud.points_[kept] = point;
+                if (has_normals) {
+                    pointcloud.normals_[kept] = pointcloud.normals_[i];
+                }
+                if (has_colors) {
+                    pointcloud.colors_[kept] = pointcloud.colors_[i];
+                }
+                kept++;
+            }
+        }
+        pointcloud.points_.resize(kept);
+        if (has_normals) {
+            pointcloud.normals_.resize(kept);
+        }
+        if (has_colors) {
+            pointcloud.colors_.resize(kept);
+        }
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadPointCloudFromTPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           bool print_progress) {
+    return ReadTPC(filename, pointcloud, nullptr, -1, print_progress);
+}
+
+bool ReadPointCloudFromTPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const geometry::AxisAlignedBoundingBox &bbox,
+                           int level /* = -1*/,
+                           bool print_progress /* = false*/) {
+    return ReadTPC(filename, pointcloud, &bbox, level, print_progress);
+}
+
+bool ReadPointCloudFromTPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           int level,
+                           bool print_progress /* = false*/) {
+    return ReadTPC(filename, pointcloud, nullptr, level, print_progress);
+}
+
+bool WritePointCloudToTPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          bool write_ascii /* = false*/,
+                          bool compressed /* = false*/,
+                          bool print_progress) {
+    return WritePointCloudToTPC(filename, pointcloud, TPCWriteOption(),
+                                print_progress);
+}
+
+bool WritePointCloudToTPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const TPCWriteOption &option,
+                          bool print_progress) {
+    if (option.max_points_per_tile_ == 0 || option.num_levels_ < 1 ||
+        option.num_levels_ > kTPCMaxLevels || option.sampling_depth_ < 0 ||
+        option.sampling_depth_ > kMortonDepth) {
+        utility::LogWarning("Write TPC failed: invalid option.");
+        return false;
+    }
+    const size_t n = pointcloud.points_.size();
+    const int num_levels = option.num_levels_;
+    TPCHeader header;
+    header.num_levels = std::uint32_t(num_levels);
+    header.attributes = (pointcloud.HasNormals() ? kTPCHasNormals : 0) |
+                        (pointcloud.HasColors() ? kTPCHasColors : 0);
+    header.num_points = n;
+
+    // Sort the points by Morton code and split them into tiles.
+    std::vector<uint64_t> codes(n);
+    std::vector<size_t> indices;
+    std::vector<std::pair<size_t, size_t>> tiles;
+    if (n > 0) {
+        const Eigen::Vector3d min_bound = pointcloud.GetMinBound();
+        const Eigen::Vector3d max_bound = pointcloud.GetMaxBound();
+        for (int axis = 0; axis < 3; axis++) {
+            header.bounds[axis] = min_bound(axis);
+            header.bounds[axis + 3] = max_bound(axis);
+        }
+        double size = (max_bound - min_bound).maxCoeff();
+        if (!(size > 0)) {
+            size = 1;
+        }
+        const double max_coordinate = double((int64_t(1) << kMortonDepth) - 1);
+        const double scale = double(int64_t(1) << kMortonDepth) / size;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(n); i++) {
+            Eigen::Vector3d q = (pointcloud.points_[i] - min_bound) * scale;
+            uint64_t code = 0;
+            for (int axis = 0; axis < 3; axis++) {
+                // Non-finite coordinates end up in the first or last cell.
+                double c = q(axis) > 0 ? std::min(max_coordinate, q(axis)) : 0;
+                code |= SpreadBits(uint64_t(c)) << axis;
+            }
+            codes[i] = code;
+        }
+        utility::RadixSortWithIndices(codes, indices);
+        SplitTiles(codes, 0, n, 0, option.max_points_per_tile_, tiles);
+    }
+
+    // Levels are assigned per cell of the coarsest sampling grid rather than
+    // per tile, so that a level holds one point per cell even where tiles are
+    // smaller than the cells. Finer cells nest in these cells, which are
+    // processed in parallel.
+    std::vector<std::uint8_t> levels(n, std::uint8_t(num_levels - 1));
+    std::vector<size_t> cell_begins;
+    for (size_t i = 0; i < n; i++) {
+        if (i == 0 || CellCode(codes[i], option.sampling_depth_) !=
+                              CellCode(codes[i - 1], option.sampling_depth_)) {
+            cell_begins.push_back(i);
+        }
+    }
+    cell_begins.push_back(n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int c = 0; c < int(cell_begins.size()) - 1; c++) {
+        AssignTPCLevels(codes, cell_begins[c], cell_begins[c + 1], num_levels,
+                        option.sampling_depth_, levels);
+    }
+    header.num_tiles = tiles.size();
+
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write TPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    // The index is written once with placeholder offsets to reserve its
+    // space, and again when the blocks are written.
+    std::vector<double> tile_bounds(tiles.size() * 6, 0.0);
+    std::vector<TPCBlock> blocks(tiles.size() * num_levels, {0, 0, 0});
+    if (!WriteTPCIndex(file, header, tile_bounds, blocks)) {
+        utility::LogWarning("Write TPC failed: unable to write the index.");
+        fclose(file);
+        return false;
+    }
+    std::uint64_t offset = kTPCHeaderSize + tile_bounds.size() * 8 +
+                           blocks.size() * sizeof(TPCBlock);
+
+    // Tiles are encoded and compressed in parallel in batches, and written in
+    // order.
+    const size_t point_size = TPCPointSize(header.attributes);
+    const int batch_size = 256;
+    std::vector<std::vector<char>> batch_data(size_t(batch_size) * num_levels);
+    utility::ConsoleProgressBar progress_bar(tiles.size(),
+                                             "Writing TPC: ", print_progress);
+    std::atomic<bool> success(true);
+    for (size_t batch = 0; batch < tiles.size() && success;
+         batch += batch_size) {
+        const int num_batch_tiles =
+                int(std::min(tiles.size() - batch, size_t(batch_size)));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int b = 0; b < num_batch_tiles; b++) {
+            const size_t t = batch + b;
+            const size_t begin = tiles[t].first, end = tiles[t].second;
+            double *bounds = tile_bounds.data() + 6 * t;
+            for (int axis = 0; axis < 3; axis++) {
+                bounds[axis] = std::numeric_limits<double>::infinity();
+                bounds[axis + 3] = -std::numeric_limits<double>::infinity();
+            }
+            std::vector<std::vector<size_t>> level_indices(num_levels);
+            for (size_t i = begin; i < end; i++) {
+                const Eigen::Vector3d &point = pointcloud.points_[indices[i]];
+                for (int axis = 0; axis < 3; axis++) {
+                    bounds[axis] = std::min(bounds[axis], point(axis));
+                    bounds[axis + 3] = std::max(bounds[axis + 3], point(axis));
+                }
+                level_indices[levels[i]].push_back(indices[i]);
+            }
+            std::vector<char> raw;
+            for (int k = 0; k < num_levels; k++) {
+                TPCBlock &block = blocks[t * num_levels + k];
+                std::vector<char> &data = batch_data[b * num_levels + k];
+                block.num_points = std::uint32_t(level_indices[k].size());
+                if (level_indices[k].size() * point_size >
+                    std::numeric_limits<std::uint32_t>::max()) {
+                    success = false;
+                    continue;
+                }
+                EncodeTPCBlock(pointcloud, level_indices[k],
+                               header.attributes, raw);
+                data.resize(raw.size());
+                unsigned int size = 0;
+                if (raw.size() > 1) {
+                    size = lzf_compress(raw.data(), (unsigned int)raw.size(),
+                                        data.data(),
+                                        (unsigned int)raw.size() - 1);
+                }
+                if (size == 0) {
+                    data.swap(raw);
+                } else {
+                    data.resize(size);
+                }
+                block.compressed_size = std::uint32_t(data.size());
+            }
+        }
+        for (int b = 0; b < num_batch_tiles && success; b++) {
+            for (int k = 0; k < num_levels; k++) {
+                TPCBlock &block = blocks[(batch + b) * num_levels + k];
+                std::vector<char> &data = batch_data[b * num_levels + k];
+                block.offset = offset;
+                if (fwrite(data.data(), 1, data.size(), file) != data.size()) {
+                    success = false;
+                    break;
+                }
+                offset += data.size();
+                std::vector<char>().swap(data);
+            }
+            ++progress_bar;
+        }
+    }
+    if (!success || !SeekTPC(file, 0) ||
+        !WriteTPCIndex(file, header, tile_bounds, blocks)) {
+        utility::LogWarning("Write TPC failed: unable to write the data.");
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -25,10 +25,12 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <iterator>
 
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/ParallelTextIO.h"
 
 namespace open3d {
 namespace io {
@@ -43,20 +45,26 @@ bool ReadPointCloudFromXYZN(const std::string &filename,
         return false;
     }
 
-    char line_buffer[DEFAULT_IO_BUFFER_SIZE];
-    double x, y, z, nx, ny, nz;
     pointcloud.Clear();
-
-    while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
-        if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &nx, &ny,
-                   &nz) == 6) {
-            pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-            pointcloud.normals_.push_back(Eigen::Vector3d(nx, ny, nz));
-        }
+    bool success = utility::ReadNumericLines(
+            file, 6,
+            [&](size_t num_points) {
+                pointcloud.points_.resize(num_points);
+                pointcloud.normals_.resize(num_points);
+            },
+            [&](size_t i, const double *values) {
+                pointcloud.points_[i] =
+                        Eigen::Vector3d(values[0], values[1], values[2]);
+                pointcloud.normals_[i] =
+                        Eigen::Vector3d(values[3], values[4], values[5]);
+            });
+    if (!success) {
+        utility::LogWarning("Read XYZN failed: unable to read file: {}",
+                            filename);
     }
 
     fclose(file);
-    return true;
+    return success;
 }
 
 bool WritePointCloudToXYZN(const std::string &filename,
@@ -75,20 +83,24 @@ bool WritePointCloudToXYZN(const std::string &filename,
         return false;
     }
 
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const Eigen::Vector3d &point = pointcloud.points_[i];
-        const Eigen::Vector3d &normal = pointcloud.normals_[i];
-        if (fprintf(file, "%.10f %.10f %.10f %.10f %.10f %.10f\n", point(0),
-                    point(1), point(2), normal(0), normal(1), normal(2)) < 0) {
-            utility::LogWarning("Write XYZN failed: unable to write file: {}",
-                                filename);
-            fclose(file);
-            return false;  // error happens during writing.
-        }
+    bool success = utility::WriteLines(
+            file, pointcloud.points_.size(),
+            [&](size_t i, std::string &buffer) {
+                const Eigen::Vector3d &point = pointcloud.points_[i];
+                const Eigen::Vector3d &normal = pointcloud.normals_[i];
+                fmt::format_to(std::back_inserter(buffer),
+                               "{:.10f} {:.10f} {:.10f} {:.10f} {:.10f} "
+                               "{:.10f}\n",
+                               point(0), point(1), point(2), normal(0),
+                               normal(1), normal(2));
+            });
+    if (!success) {
+        utility::LogWarning("Write XYZN failed: unable to write file: {}",
+                            filename);
     }
 
     fclose(file);
-    return true;
+    return success;
 }
 
 }  // namespace io
@@ -0,0 +1,188 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4267)
+#endif
+
+#include "Open3D/Registration/FeatureMatching.h"
+
+#include <flann/flann.hpp>
+#include <limits>
+#include <utility>
+
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Utility/Console.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace open3d {
+namespace registration {
+
+FeatureIndex::FeatureIndex(int num_trees /* = 4*/) : num_trees_(num_trees) {}
+
+FeatureIndex::FeatureIndex(const Feature &feature, int num_trees /* = 4*/)
+    : num_trees_(num_trees) {
+    SetFeature(feature);
+}
+
+FeatureIndex::~FeatureIndex() {}
+
+bool FeatureIndex::SetFeature(const Feature &feature) {
+    size_t dimension = feature.Dimension();
+    size_t dataset_size = feature.Num();
+    if (dimension == 0 || dataset_size == 0) {
+        utility::LogWarning(
+                "[FeatureIndex::SetFeature] Failed due to no data.");
+        return false;
+    }
+    if (num_trees_ < 1) {
+        utility::LogWarning(
+                "[FeatureIndex::SetFeature] Invalid number of trees {:d}.",
+                num_trees_);
+        return false;
+    }
+    // Feature data is column major with one feature per column, which is the
+    // row major layout flann expects. The index is built before any member is
+    // changed, so a failed call keeps the previous dataset.
+    std::vector<double> data(feature.data_.data(),
+                             feature.data_.data() + dataset_size * dimension);
+    std::unique_ptr<flann::Matrix<double>> flann_dataset(
+            new flann::Matrix<double>(data.data(), dataset_size, dimension));
+    std::unique_ptr<flann::Index<flann::L2<double>>> flann_index(
+            new flann::Index<flann::L2<double>>(
+                    *flann_dataset, flann::KDTreeIndexParams(num_trees_)));
+    flann_index->buildIndex();
+    // Moving the vector keeps its buffer, which flann_dataset points to.
+    data_ = std::move(data);
+    flann_dataset_ = std::move(flann_dataset);
+    flann_index_ = std::move(flann_index);
+    dimension_ = dimension;
+    dataset_size_ = dataset_size;
+    return true;
+}
+
+int FeatureIndex::SearchKNN(const Eigen::VectorXd &query,
+                            int knn,
+                            std::vector<int> &indices,
+                            std::vector<double> &distance2,
+                            int checks /* = 128*/) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(query.rows()) != dimension_ || knn < 0) {
+        return -1;
+    }
+    flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
+    indices.resize(knn);
+    distance2.resize(knn);
+    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, knn);
+    flann::Matrix<double> dists_flann(distance2.data(), query_flann.rows, knn);
+    int k = flann_index_->knnSearch(query_flann, indices_flann, dists_flann,
+                                    knn, flann::SearchParams(checks, 0.0));
+    indices.resize(k);
+    distance2.resize(k);
+    return k;
+}
+
+int FeatureIndex::SearchKNNBatch(const Feature &query,
+                                 int knn,
+                                 Eigen::MatrixXi &indices,
+                                 Eigen::MatrixXd &distance2,
+                                 int checks /* = 128*/) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        query.Dimension() != dimension_ || knn <= 0) {
+        return -1;
+    }
+    size_t num_queries = query.Num();
+    // Unfound neighbors are left as -1.
+    indices.setConstant(knn, num_queries, -1);
+    distance2.setConstant(knn, num_queries,
+                          std::numeric_limits<double>::infinity());
+    if (num_queries == 0) {
+        return 0;
+    }
+    flann::Matrix<double> query_flann((double *)query.data_.data(),
+                                      num_queries, dimension_);
+    flann::Matrix<int> indices_flann(indices.data(), num_queries, knn);
+    flann::Matrix<double> dists_flann(distance2.data(), num_queries, knn);
+    flann::SearchParams param(checks, 0.0);
+#ifdef _OPENMP
+    param.cores = omp_get_max_threads();
+#endif
+    return flann_index_->knnSearch(query_flann, indices_flann, dists_flann, knn,
+                                   param);
+}
+
+CorrespondenceSet ComputeFeatureCorrespondences(
+        const Feature &source_feature,
+        const Feature &target_feature,
+        const FeatureMatchingOption &option /* = FeatureMatchingOption()*/) {
+    CorrespondenceSet corres;
+    if (source_feature.Dimension() != target_feature.Dimension()) {
+        utility::LogWarning(
+                "[ComputeFeatureCorrespondences] Feature dimensions do not "
+                "match ({:d} vs {:d}).",
+                source_feature.Dimension(), target_feature.Dimension());
+        return corres;
+    }
+    if (source_feature.Num() == 0 || target_feature.Num() == 0) {
+        return corres;
+    }
+
+    FeatureIndex target_index(target_feature, option.num_trees_);
+    Eigen::MatrixXi source_to_target;
+    Eigen::MatrixXd dists;
+    target_index.SearchKNNBatch(source_feature, 1, source_to_target, dists,
+                                option.checks_);
+
+    Eigen::MatrixXi target_to_source;
+    if (option.mutual_filter_) {
+        FeatureIndex source_index(source_feature, option.num_trees_);
+        source_index.SearchKNNBatch(target_feature, 1, target_to_source, dists,
+                                    option.checks_);
+    }
+
+    int num_source = int(source_feature.Num());
+    corres.reserve(num_source);
+    for (int i = 0; i < num_source; i++) {
+        int j = source_to_target(0, i);
+        if (j < 0) continue;
+        if (option.mutual_filter_ && target_to_source(0, j) != i) continue;
+        corres.push_back(Eigen::Vector2i(i, j));
+    }
+    utility::LogDebug("[ComputeFeatureCorrespondences] {:d} correspondences.",
+                      corres.size());
+    return corres;
+}
+
+}  // namespace registration
+}  // namespace open3d
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Registration/TransformationEstimation.h"
+
+namespace flann {
+template <typename T>
+class Matrix;
+template <typename T>
+struct L2;
+template <typename T>
+class Index;
+}  // namespace flann
+
+namespace open3d {
+namespace registration {
+
+class Feature;
+
+/// \class FeatureMatchingOption
+///
+/// \brief Options for approximate feature matching.
+class FeatureMatchingOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param num_trees Number of randomized KD-trees in the forest.
+    /// \param checks Number of leaves visited per query. Higher values give
+    /// higher recall at lower throughput, -1 makes the search exact.
+    /// \param mutual_filter Set to `true` to keep only correspondences that
+    /// are nearest neighbors of each other in both directions.
+    FeatureMatchingOption(int num_trees = 4,
+                          int checks = 128,
+                          bool mutual_filter = false)
+        : num_trees_(num_trees),
+          checks_(checks),
+          mutual_filter_(mutual_filter) {}
+    ~FeatureMatchingOption() {}
+
+public:
+    /// Number of randomized KD-trees in the forest.
+    int num_trees_;
+    /// Number of leaves visited per query, -1 for exact search.
+    int checks_;
+    /// Keep only mutual nearest neighbor correspondences.
+    bool mutual_filter_;
+};
+
+/// \class FeatureIndex
+///
+/// \brief Approximate nearest neighbor index in feature space.
+///
+/// Exact KD-trees degrade to near linear scans for high dimensional features
+/// such as the 33-dimensional FPFH. FeatureIndex builds a forest of randomized
+/// KD-trees with FLANN and bounds the number of visited leaves per query, which
+/// trades a small loss in recall for a large gain in throughput.
+class FeatureIndex {
+public:
+    /// \brief Default Constructor.
+    ///
+    /// \param num_trees Number of randomized KD-trees in the forest.
+    FeatureIndex(int num_trees = 4);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param feature Features from which the index is constructed.
+    /// \param num_trees Number of randomized KD-trees in the forest.
+    FeatureIndex(const Feature &feature, int num_trees = 4);
+    ~FeatureIndex();
+    FeatureIndex(const FeatureIndex &) = delete;
+    FeatureIndex &operator=(const FeatureIndex &) = delete;
+
+public:
+    /// Sets the data for the index from the feature data.
+    ///
+    /// \param feature Set of features for index construction.
+    bool SetFeature(const Feature &feature);
+
+    /// \brief Searches the approximate \p knn nearest neighbors of \p query.
+    ///
+    /// \param query Query feature vector.
+    /// \param knn Number of neighbors to search.
+    /// \param indices Output indices of the neighbors.
+    /// \param distance2 Output squared distances of the neighbors.
+    /// \param checks Number of leaves visited, -1 for exact search.
+    /// \return Number of neighbors found, -1 on invalid input.
+    int SearchKNN(const Eigen::VectorXd &query,
+                  int knn,
+                  std::vector<int> &indices,
+                  std::vector<double> &distance2,
+                  int checks = 128) const;
+
+    /// \brief Searches the approximate \p knn nearest neighbors of every
+    /// column of \p query in parallel.
+    ///
+    /// \param query Query features, must have the dimension of the index.
+    /// \param knn Number of neighbors to search.
+    /// \param indices Output `knn x n` matrix of neighbor indices.
+    /// \param distance2 Output `knn x n` matrix of squared distances.
+    /// \param checks Number of leaves visited, -1 for exact search.
+    /// \return Total number of neighbors found, -1 on invalid input.
+    int SearchKNNBatch(const Feature &query,
+                       int knn,
+                       Eigen::MatrixXi &indices,
+                       Eigen::MatrixXd &distance2,
+                       int checks = 128) const;
+
+    /// Returns feature dimensions of the index.
+    size_t Dimension() const { return dimension_; }
+    /// Returns number of indexed features.
+    size_t Num() const { return dataset_size_; }
+
+protected:
+    std::vector<double> data_;
+    std::unique_ptr<flann::Matrix<double>> flann_dataset_;
+    std::unique_ptr<flann::Index<flann::L2<double>>> flann_index_;
+    int num_trees_ = 4;
+    size_t dimension_ = 0;
+    size_t dataset_size_ = 0;
+};
+
+/// \brief Function to compute correspondences between two feature sets by
+/// approximate nearest neighbor matching.
+///
+/// For each source feature the nearest target feature is found with a
+/// FeatureIndex. If \p option.mutual_filter_ is set, only pairs that are also
+/// nearest neighbors from target to source are kept.
+///
+/// \param source_feature Source point cloud feature.
+/// \param target_feature Target point cloud feature.
+/// \param option Feature matching options.
+/// \return Correspondences as (source index, target index) pairs.
+CorrespondenceSet ComputeFeatureCorrespondences(
+        const Feature &source_feature,
+        const Feature &target_feature,
+        const FeatureMatchingOption &option = FeatureMatchingOption());
+
+}  // namespace registration
+}  // namespace open3d
@@ -32,6 +32,7 @@
 #ifdef WINDOWS
 #include <direct.h>
 #include <dirent/dirent.h>
+#include <io.h>
 #include <windows.h>
 #ifndef PATH_MAX
 #define PATH_MAX MAX_PATH
@@ -218,6 +219,17 @@ FILE *FOpen(const std::string &filename, const std::string &mode) {
     return fp;
 }
 
+bool TruncateFile(FILE *file, size_t size) {
+    if (fflush(file) != 0) {
+        return false;
+    }
+#ifdef WINDOWS
+    return _chsize_s(_fileno(file), (__int64)size) == 0;
+#else
+    return ftruncate(fileno(file), (off_t)size) == 0;
+#endif
+}
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
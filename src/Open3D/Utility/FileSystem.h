@@ -69,6 +69,9 @@ bool ListFilesInDirectoryWithExtension(const std::string &directory,
 // wrapper for fopen that enables unicode paths on Windows
 FILE *FOpen(const std::string &filename, const std::string &mode);
 
+// truncates or extends an open file to size bytes
+bool TruncateFile(FILE *file, size_t size);
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
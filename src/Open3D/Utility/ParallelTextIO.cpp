@@ -0,0 +1,391 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/ParallelTextIO.h"
+
+#include <algorithm>
+#include <clocale>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+// Size of the blocks a text file is read in.
+const size_t kReadBlockSize = size_t(64) << 20;
+// Number of lines formatted by one thread at a time.
+const size_t kWriteChunkLines = 1 << 16;
+
+const double kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                         1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                         1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+bool IsBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' ||
+           c == '\f';
+}
+
+bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+// Case-insensitive check for a prefix.
+bool StartsWith(const char *begin, const char *end, const char *prefix) {
+    for (; *prefix != '\0'; ++begin, ++prefix) {
+        if (begin == end || (*begin | 0x20) != *prefix) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#ifdef __SIZEOF_INT128__
+typedef unsigned __int128 uint128;
+
+int CountLeadingZeros(uint128 value) {
+    uint64_t high = uint64_t(value >> 64);
+    if (high != 0) {
+        return __builtin_clzll(high);
+    }
+    return 64 + __builtin_clzll(uint64_t(value));
+}
+
+// Rounds value * 2^exp2 to the nearest double, ties to even. sticky marks
+// nonzero bits below value.
+double RoundToDouble(uint128 value, int exp2, bool sticky) {
+    int shift = 128 - CountLeadingZeros(value) - 53;
+    if (shift <= 0) {
+        return std::ldexp(double(uint64_t(value)), exp2);
+    }
+    uint64_t mantissa = uint64_t(value >> shift);
+    uint128 rest = value & ((uint128(1) << shift) - 1);
+    uint128 half = uint128(1) << (shift - 1);
+    if (rest > half || (rest == half && (sticky || (mantissa & 1)))) {
+        mantissa++;
+    }
+    return std::ldexp(double(mantissa), exp2 + shift);
+}
+
+// Correctly rounded mantissa * 10^exp10 for |exp10| <= 19.
+double ScaleByPow10(uint64_t mantissa, int exp10) {
+    uint64_t pow10 = 1;
+    for (int i = 0; i < std::abs(exp10); ++i) {
+        pow10 *= 10;
+    }
+    if (exp10 >= 0) {
+        return RoundToDouble(uint128(mantissa) * pow10, 0, false);
+    }
+    // Normalize the numerator so that the quotient keeps at least 64 bits.
+    int lz = __builtin_clzll(mantissa);
+    uint128 numerator = uint128(mantissa << lz) << 64;
+    uint128 quotient = numerator / pow10;
+    bool sticky = quotient * pow10 != numerator;
+    return RoundToDouble(quotient, -64 - lz, sticky);
+}
+#endif
+
+// Parses [begin, end) with strtod, replacing the decimal point by the one of
+// the current locale.
+double ParseWithStrtod(const char *begin, const char *end) {
+    std::string text(begin, end);
+    char decimal_point = *std::localeconv()->decimal_point;
+    std::replace(text.begin(), text.end(), '.', decimal_point);
+    return std::strtod(text.c_str(), nullptr);
+}
+
+}  // unnamed namespace
+
+bool ParseDouble(const char *&ptr, const char *end, double &value) {
+    const char *p = ptr;
+    while (p < end && IsBlank(*p)) {
+        ++p;
+    }
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        ++p;
+    }
+
+    if (p < end && !IsDigit(*p) && *p != '.') {
+        if (StartsWith(p, end, "infinity")) {
+            p += 8;
+            value = std::numeric_limits<double>::infinity();
+        } else if (StartsWith(p, end, "inf")) {
+            p += 3;
+            value = std::numeric_limits<double>::infinity();
+        } else if (StartsWith(p, end, "nan")) {
+            p += 3;
+            value = std::numeric_limits<double>::quiet_NaN();
+        } else {
+            return false;
+        }
+        value = negative ? -value : value;
+        ptr = p;
+        return true;
+    }
+
+    const char *number_begin = p;
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exp10 = 0;
+    bool truncated = false;
+    bool any_digit = false;
+    for (; p < end && IsDigit(*p); ++p) {
+        any_digit = true;
+        if (num_digits < 19) {
+            mantissa = mantissa * 10 + uint64_t(*p - '0');
+            num_digits += mantissa != 0 ? 1 : 0;
+        } else {
+            exp10++;
+            truncated = truncated || *p != '0';
+        }
+    }
+    if (p < end && *p == '.') {
+        ++p;
+        for (; p < end && IsDigit(*p); ++p) {
+            any_digit = true;
+            if (num_digits < 19) {
+                mantissa = mantissa * 10 + uint64_t(*p - '0');
+                num_digits += mantissa != 0 ? 1 : 0;
+                exp10--;
+            } else {
+                truncated = truncated || *p != '0';
+            }
+        }
+    }
+    if (!any_digit) {
+        return false;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool exp_negative = false;
+        if (q < end && (*q == '+' || *q == '-')) {
+            exp_negative = *q == '-';
+            ++q;
+        }
+        if (q < end && IsDigit(*q)) {
+            int exp = 0;
+            for (; q < end && IsDigit(*q); ++q) {
+                exp = std::min(exp * 10 + (*q - '0'), 100000);
+            }
+            exp10 += exp_negative ? -exp : exp;
+            p = q;
+        }
+    }
+
+    if (mantissa == 0 && !truncated) {
+        value = 0.0;
+    } else if (!truncated && mantissa < (uint64_t(1) << 53) && exp10 >= -22 &&
+               exp10 <= 22) {
+        // Both operands are exact, so the single rounding is correct.
+        value = exp10 < 0 ? double(mantissa) / kPow10[-exp10]
+                          : double(mantissa) * kPow10[exp10];
+#ifdef __SIZEOF_INT128__
+    } else if (!truncated && exp10 >= -19 && exp10 <= 19) {
+        value = ScaleByPow10(mantissa, exp10);
+#endif
+    } else {
+        value = ParseWithStrtod(number_begin, p);
+    }
+    value = negative ? -value : value;
+    ptr = p;
+    return true;
+}
+
+bool ReadNumericLines(
+        FILE *file,
+        int num_values,
+        const std::function<void(size_t)> &resize,
+        const std::function<void(size_t, const double *)> &store,
+        size_t max_lines /* = 0*/,
+        bool keep_invalid_lines /* = false*/) {
+    int num_chunks = 1;
+#ifdef _OPENMP
+    num_chunks = omp_get_max_threads() * 4;
+#endif
+    std::vector<char> buffer(kReadBlockSize);
+    std::vector<const char *> chunk_begin(num_chunks + 1);
+    std::vector<std::vector<double>> chunk_values(num_chunks);
+    std::vector<std::vector<uint8_t>> chunk_valid(num_chunks);
+    std::vector<size_t> chunk_rows(num_chunks + 1);
+    size_t num_lines = 0;
+    size_t num_rows = 0;
+    size_t carry = 0;
+    bool eof = false;
+    while (!eof && (max_lines == 0 || num_lines < max_lines)) {
+        size_t count =
+                fread(buffer.data() + carry, 1, buffer.size() - carry, file);
+        if (ferror(file)) {
+            return false;
+        }
+        size_t size = carry + count;
+        eof = size < buffer.size();
+        const char *data = buffer.data();
+        const char *data_end = data + size;
+        if (!eof) {
+            // Only complete lines, the rest is carried over.
+            while (data_end > data && data_end[-1] != '\n') {
+                --data_end;
+            }
+            if (data_end == data) {
+                // A single line fills the buffer.
+                carry = size;
+                buffer.resize(buffer.size() * 2);
+                continue;
+            }
+        }
+
+        if (max_lines > 0) {
+            // Cut the block after the last requested line.
+            const char *p = data;
+            while (p < data_end && num_lines < max_lines) {
+                p = static_cast<const char *>(memchr(p, '\n', data_end - p));
+                p = p == nullptr ? data_end : p + 1;
+                num_lines++;
+            }
+            if (num_lines == max_lines) {
+                data_end = p;
+                eof = true;
+            }
+        }
+
+        // Split the block into chunks of complete lines.
+        chunk_begin[0] = data;
+        for (int c = 1; c < num_chunks; ++c) {
+            const char *p = std::max(chunk_begin[c - 1],
+                                     data + (data_end - data) * c / num_chunks);
+            if (p > data && p < data_end && p[-1] != '\n') {
+                p = static_cast<const char *>(
+                        memchr(p, '\n', data_end - p));
+                p = p == nullptr ? data_end : p + 1;
+            }
+            chunk_begin[c] = p;
+        }
+        chunk_begin[num_chunks] = data_end;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for (int c = 0; c < num_chunks; ++c) {
+            std::vector<double> &values = chunk_values[c];
+            std::vector<uint8_t> &valid = chunk_valid[c];
+            values.clear();
+            valid.clear();
+            const char *p = chunk_begin[c];
+            const char *chunk_end = chunk_begin[c + 1];
+            size_t num_chunk_lines =
+                    std::count(p, chunk_end, '\n') +
+                    (chunk_end > p && chunk_end[-1] != '\n' ? 1 : 0);
+            values.reserve(num_chunk_lines * num_values);
+            valid.reserve(num_chunk_lines);
+            while (p < chunk_end) {
+                const char *line_end = static_cast<const char *>(
+                        memchr(p, '\n', chunk_end - p));
+                line_end = line_end == nullptr ? chunk_end : line_end;
+                size_t row = values.size();
+                values.resize(row + num_values);
+                int i = 0;
+                while (i < num_values &&
+                       ParseDouble(p, line_end, values[row + i])) {
+                    ++i;
+                }
+                if (i < num_values && !keep_invalid_lines) {
+                    values.resize(row);
+                } else {
+                    valid.push_back(i == num_values ? 1 : 0);
+                }
+                p = line_end + 1;
+            }
+            chunk_rows[c + 1] = valid.size();
+        }
+
+        chunk_rows[0] = 0;
+        for (int c = 0; c < num_chunks; ++c) {
+            chunk_rows[c + 1] += chunk_rows[c];
+        }
+        size_t block_rows = chunk_rows[num_chunks];
+        resize(num_rows + block_rows);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for (int c = 0; c < num_chunks; ++c) {
+            for (size_t r = 0; r < chunk_valid[c].size(); ++r) {
+                size_t row = chunk_rows[c] + r;
+                if (chunk_valid[c][r]) {
+                    store(num_rows + row,
+                          chunk_values[c].data() + r * num_values);
+                }
+            }
+        }
+        num_rows += block_rows;
+
+        carry = size - (data_end - data);
+        std::memmove(buffer.data(), data_end, carry);
+    }
+    return true;
+}
+
+bool WriteLines(FILE *file,
+                size_t num_lines,
+                const std::function<void(size_t, std::string &)> &append_line) {
+    int num_chunks = 1;
+#ifdef _OPENMP
+    num_chunks = omp_get_max_threads() * 2;
+#endif
+    std::vector<std::string> chunk_text(num_chunks);
+    for (size_t begin = 0; begin < num_lines;
+         begin += num_chunks * kWriteChunkLines) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for (int c = 0; c < num_chunks; ++c) {
+            chunk_text[c].clear();
+            size_t chunk_begin = begin + c * kWriteChunkLines;
+            size_t chunk_end =
+                    std::min(num_lines, chunk_begin + kWriteChunkLines);
+            for (size_t i = chunk_begin; i < chunk_end; ++i) {
+                append_line(i, chunk_text[c]);
+            }
+        }
+        for (const auto &text : chunk_text) {
+            if (fwrite(text.data(), 1, text.size(), file) != text.size()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <string>
+
+namespace open3d {
+namespace utility {
+
+/// \brief Parses a floating point number independently of the locale.
+///
+/// Accepts the same decimal syntax as strtod in the C locale, including inf
+/// and nan. Leading blanks are skipped. Numbers with up to 19 significant
+/// digits and a decimal exponent of magnitude up to 19 are converted with
+/// integer arithmetic, all others fall back to strtod. The result is
+/// correctly rounded in both cases.
+///
+/// \param ptr Start of the text, advanced past the number on success.
+/// \param end End of the text.
+/// \param value Parsed number.
+/// \return true if a number was parsed.
+bool ParseDouble(const char *&ptr, const char *end, double &value);
+
+/// \brief Reads the lines of a text file that start with num_values numbers.
+///
+/// The file is read from its current position in large blocks that are cut at
+/// the last newline. Each block is split into newline-aligned chunks that are
+/// parsed in parallel, then the rows are handed out in file order.
+///
+/// \param file File opened for reading.
+/// \param num_values Number of leading numbers per line.
+/// \param resize Called with the total number of rows before the rows of a
+/// block are stored.
+/// \param store Called concurrently with the index and the values of each
+/// row.
+/// \param max_lines If not 0, only this many lines are read.
+/// \param keep_invalid_lines If true, every line gets a row and store is not
+/// called for the lines that do not start with num_values numbers. Otherwise
+/// those lines are skipped.
+/// \return false if reading the file failed.
+bool ReadNumericLines(
+        FILE *file,
+        int num_values,
+        const std::function<void(size_t)> &resize,
+        const std::function<void(size_t, const double *)> &store,
+        size_t max_lines = 0,
+        bool keep_invalid_lines = false);
+
+/// \brief Writes num_lines lines to a text file, formatting blocks of lines in
+/// parallel.
+///
+/// \param file File opened for writing.
+/// \param num_lines Number of lines to write.
+/// \param append_line Called concurrently with the index of a line and the
+/// buffer to append the line, including its newline, to.
+/// \return false if writing the file failed.
+bool WriteLines(FILE *file,
+                size_t num_lines,
+                const std::function<void(size_t, std::string &)> &append_line);
+
+}  // namespace utility
+}  // namespace open3d
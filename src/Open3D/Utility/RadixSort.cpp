@@ -0,0 +1,141 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/RadixSort.h"
+
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+// Below this size a single thread is faster than the per-block histograms.
+const size_t kMinElementsPerBlock = 1 << 16;
+const int kRadixBits = 8;
+const size_t kRadixSize = size_t(1) << kRadixBits;
+
+// Sorts keys and, if indices is not null, permutes indices along with them.
+void RadixSortImpl(std::vector<uint64_t> &keys, std::vector<size_t> *indices) {
+    const int n = int(keys.size());
+    if (n < 2) {
+        return;
+    }
+
+    int num_blocks = 1;
+#ifdef _OPENMP
+    num_blocks = std::max(
+            1, std::min(omp_get_max_threads(),
+                        int(keys.size() / kMinElementsPerBlock)));
+#endif
+    const int block_size = (n + num_blocks - 1) / num_blocks;
+
+    std::vector<uint64_t> block_max(num_blocks, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for (int b = 0; b < num_blocks; b++) {
+        int end = std::min(n, (b + 1) * block_size);
+        for (int i = b * block_size; i < end; i++) {
+            block_max[b] = std::max(block_max[b], keys[i]);
+        }
+    }
+    uint64_t max_key = *std::max_element(block_max.begin(), block_max.end());
+    int num_bits = 0;
+    while (num_bits < 64 && (max_key >> num_bits) != 0) {
+        num_bits++;
+    }
+    int num_passes = (num_bits + kRadixBits - 1) / kRadixBits;
+
+    std::vector<uint64_t> keys_tmp(keys.size());
+    std::vector<size_t> indices_tmp(indices != nullptr ? keys.size() : 0);
+    std::vector<size_t> offsets(num_blocks * kRadixSize);
+    for (int pass = 0; pass < num_passes; pass++) {
+        const int shift = pass * kRadixBits;
+        std::fill(offsets.begin(), offsets.end(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for (int b = 0; b < num_blocks; b++) {
+            size_t *histogram = offsets.data() + b * kRadixSize;
+            int end = std::min(n, (b + 1) * block_size);
+            for (int i = b * block_size; i < end; i++) {
+                histogram[(keys[i] >> shift) & (kRadixSize - 1)]++;
+            }
+        }
+        // Digit-major, block-minor exclusive prefix sum keeps the sort stable.
+        size_t offset = 0;
+        for (size_t d = 0; d < kRadixSize; d++) {
+            for (int b = 0; b < num_blocks; b++) {
+                size_t count = offsets[b * kRadixSize + d];
+                offsets[b * kRadixSize + d] = offset;
+                offset += count;
+            }
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for (int b = 0; b < num_blocks; b++) {
+            size_t *position = offsets.data() + b * kRadixSize;
+            int end = std::min(n, (b + 1) * block_size);
+            for (int i = b * block_size; i < end; i++) {
+                size_t dst = position[(keys[i] >> shift) & (kRadixSize - 1)]++;
+                keys_tmp[dst] = keys[i];
+                if (indices != nullptr) {
+                    indices_tmp[dst] = (*indices)[i];
+                }
+            }
+        }
+        keys.swap(keys_tmp);
+        if (indices != nullptr) {
+            indices->swap(indices_tmp);
+        }
+    }
+}
+
+}  // unnamed namespace
+
+void RadixSort(std::vector<uint64_t> &keys) { RadixSortImpl(keys, nullptr); }
+
+void RadixSortWithIndices(std::vector<uint64_t> &keys,
+                          std::vector<size_t> &indices) {
+    const int n = int(keys.size());
+    indices.resize(keys.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < n; i++) {
+        indices[i] = size_t(i);
+    }
+    RadixSortImpl(keys, &indices);
+}
+
+}  // namespace utility
+}  // namespace open3d
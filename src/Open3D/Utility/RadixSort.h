@@ -0,0 +1,57 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+
+/// \brief Sorts 64-bit keys with a parallel LSD radix sort.
+///
+/// Only the digits up to the highest set bit of the largest key are sorted,
+/// so keys from a small range sort in few passes.
+///
+/// \param keys Keys to be sorted, sorted in place.
+void RadixSort(std::vector<uint64_t> &keys);
+
+/// \brief Sorts 64-bit keys with a stable, parallel LSD radix sort.
+///
+/// Only the digits up to the highest set bit of the largest key are sorted,
+/// so keys from a small range sort in few passes. Keys that compare equal
+/// keep their original relative order.
+///
+/// \param keys Keys to be sorted, sorted in place.
+/// \param indices Output permutation, `indices[i]` is the original position
+/// of the key stored at `keys[i]` after sorting.
+void RadixSortWithIndices(std::vector<uint64_t> &keys,
+                          std::vector<size_t> &indices);
+
+}  // namespace utility
+}  // namespace open3d
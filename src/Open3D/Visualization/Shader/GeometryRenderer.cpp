@@ -79,6 +79,14 @@ bool PointCloudRenderer::UpdateGeometry() {
     return true;
 }
 
+bool PointCloudRenderer::NotifyGeometryChange(const GeometryChange &change) {
+    simple_point_shader_.InvalidateGeometry(change);
+    phong_point_shader_.InvalidateGeometry(change);
+    normal_point_shader_.InvalidateGeometry(change);
+    simpleblack_normal_shader_.InvalidateGeometry(change);
+    return true;
+}
+
 bool PointCloudPickingRenderer::Render(const RenderOption &option,
                                        const ViewControl &view) {
     if (is_visible_ == false || geometry_ptr_->IsEmpty()) return true;
@@ -65,6 +65,13 @@ public:
     /// Programmer must call this function to notify a change of the geometry
     virtual bool UpdateGeometry() = 0;
 
+    /// Function to update part of the geometry
+    /// Renderers that support incremental updates upload only the elements
+    /// described by \p change, others update the whole geometry.
+    virtual bool NotifyGeometryChange(const GeometryChange &change) {
+        return UpdateGeometry();
+    }
+
     bool HasGeometry() const { return bool(geometry_ptr_); }
     std::shared_ptr<const geometry::Geometry> GetGeometry() const {
         return geometry_ptr_;
@@ -92,6 +99,7 @@ public:
     bool AddGeometry(
             std::shared_ptr<const geometry::Geometry> geometry_ptr) override;
     bool UpdateGeometry() override;
+    bool NotifyGeometryChange(const GeometryChange &change) override;
 
 protected:
     SimpleShaderForPointCloud simple_point_shader_;
@@ -69,11 +69,9 @@ bool PhongShader::BindGeometry(const geometry::Geometry &geometry,
                                const RenderOption &option,
                                const ViewControl &view) {
     // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace UnbindGeometry() with Buffer Object
-    // Streaming mechanisms.
+    // We use GL_STATIC_DRAW. When the whole geometry changes, we clear buffers
+    // and rebind the geometry. Partial changes are uploaded by UpdateBinding()
+    // where the shader supports it.
     UnbindGeometry();
 
     // Prepare data to be passed to GPU
@@ -99,10 +97,38 @@ bool PhongShader::BindGeometry(const geometry::Geometry &geometry,
     glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
     glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
                  colors.data(), GL_STATIC_DRAW);
+    buffer_size_ = buffer_capacity_ = points.size();
     bound_ = true;
     return true;
 }
 
+bool PhongShader::UpdateBinding(const geometry::Geometry &geometry,
+                                const RenderOption &option,
+                                const ViewControl &view,
+                                const GeometryChange &change) {
+    size_t size = 0;
+    std::vector<std::pair<size_t, size_t>> ranges;
+    std::vector<Eigen::Vector3f> points;
+    std::vector<Eigen::Vector3f> normals;
+    std::vector<Eigen::Vector3f> colors;
+    if (PrepareBindingUpdate(geometry, option, view, change, size, ranges,
+                             points, normals, colors) == false) {
+        return false;
+    }
+    size_t capacity = GrowBufferCapacity(buffer_capacity_, size);
+    size_t kept = std::min(buffer_size_, size);
+    UpdateArrayBuffer(vertex_position_buffer_, kept, buffer_capacity_,
+                      capacity, ranges, points);
+    UpdateArrayBuffer(vertex_normal_buffer_, kept, buffer_capacity_, capacity,
+                      ranges, normals);
+    UpdateArrayBuffer(vertex_color_buffer_, kept, buffer_capacity_, capacity,
+                      ranges, colors);
+    buffer_size_ = size;
+    buffer_capacity_ = capacity;
+    draw_arrays_size_ = GLsizei(size);
+    return true;
+}
+
 bool PhongShader::RenderGeometry(const geometry::Geometry &geometry,
                                  const RenderOption &option,
                                  const ViewControl &view) {
@@ -226,7 +252,10 @@ bool PhongShaderForPointCloud::PrepareBinding(
     points.resize(pointcloud.points_.size());
     normals.resize(pointcloud.points_.size());
     colors.resize(pointcloud.points_.size());
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(pointcloud.points_.size()); i++) {
         const auto &point = pointcloud.points_[i];
         const auto &normal = pointcloud.normals_[i];
         points[i] = point.cast<float>();
@@ -263,6 +292,39 @@ bool PhongShaderForPointCloud::PrepareBinding(
     return true;
 }
 
+bool PhongShaderForPointCloud::PrepareBindingUpdate(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view,
+        const GeometryChange &change,
+        size_t &size,
+        std::vector<std::pair<size_t, size_t>> &ranges,
+        std::vector<Eigen::Vector3f> &points,
+        std::vector<Eigen::Vector3f> &normals,
+        std::vector<Eigen::Vector3f> &colors) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::PointCloud) {
+        return false;
+    }
+    const geometry::PointCloud &pointcloud =
+            (const geometry::PointCloud &)geometry;
+    // Colors mapped from coordinates depend on the bounding box, which may
+    // have changed for all points.
+    if (pointcloud.HasPoints() == false || pointcloud.HasNormals() == false ||
+        pointcloud.HasColors() == false ||
+        (option.point_color_option_ != RenderOption::PointColorOption::Color &&
+         option.point_color_option_ !=
+                 RenderOption::PointColorOption::Default)) {
+        return false;
+    }
+    size = pointcloud.points_.size();
+    ranges = change.GetDirtyRanges(buffer_size_, size);
+    ConvertDirtyElements(pointcloud.points_, ranges, points);
+    ConvertDirtyElements(pointcloud.normals_, ranges, normals);
+    ConvertDirtyElements(pointcloud.colors_, ranges, colors);
+    return true;
+}
+
 bool PhongShaderForTriangleMesh::PrepareRendering(
         const geometry::Geometry &geometry,
         const RenderOption &option,
@@ -40,6 +40,11 @@ bool ShaderWrapper::Render(const geometry::Geometry &geometry,
     if (compiled_ == false) {
         Compile();
     }
+    if (bound_ && has_pending_change_ &&
+        UpdateBinding(geometry, option, view, pending_change_) == false) {
+        UnbindGeometry();
+    }
+    has_pending_change_ = false;
     if (bound_ == false) {
         BindGeometry(geometry, option, view);
     }
@@ -54,6 +59,21 @@ void ShaderWrapper::InvalidateGeometry() {
     if (bound_) {
         UnbindGeometry();
     }
+    has_pending_change_ = false;
+}
+
+void ShaderWrapper::InvalidateGeometry(const GeometryChange &change) {
+    // Unbound geometry is bound in full by the next Render() anyway.
+    if (bound_ == false || change.IsAll()) {
+        InvalidateGeometry();
+        return;
+    }
+    if (has_pending_change_) {
+        pending_change_.Merge(change);
+    } else {
+        pending_change_ = change;
+        has_pending_change_ = true;
+    }
 }
 
 void ShaderWrapper::PrintShaderWarning(const std::string &message) const {
@@ -135,6 +155,39 @@ void ShaderWrapper::ReleaseProgram() {
     }
 }
 
+void ShaderWrapper::UpdateArrayBuffer(
+        GLuint &buffer,
+        size_t kept,
+        size_t capacity,
+        size_t new_capacity,
+        const std::vector<std::pair<size_t, size_t>> &ranges,
+        const std::vector<Eigen::Vector3f> &data) {
+    const size_t element_size = sizeof(Eigen::Vector3f);
+    if (new_capacity != capacity) {
+        GLuint new_buffer;
+        glGenBuffers(1, &new_buffer);
+        glBindBuffer(GL_ARRAY_BUFFER, new_buffer);
+        glBufferData(GL_ARRAY_BUFFER, new_capacity * element_size, NULL,
+                     GL_DYNAMIC_DRAW);
+        // Copy the kept elements on the GPU instead of uploading them again.
+        glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_ARRAY_BUFFER, 0, 0,
+                            kept * element_size);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        glDeleteBuffers(1, &buffer);
+        buffer = new_buffer;
+    } else {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    }
+    size_t offset = 0;
+    for (const auto &range : ranges) {
+        size_t count = range.second - range.first;
+        glBufferSubData(GL_ARRAY_BUFFER, range.first * element_size,
+                        count * element_size, data.data() + offset);
+        offset += count;
+    }
+}
+
 bool ShaderWrapper::ValidateShader(GLuint shader_index) {
     GLint result = GL_FALSE;
     int info_log_length;
@@ -27,8 +27,11 @@
 #pragma once
 
 #include <GL/glew.h>
+#include <Eigen/Core>
+#include <vector>
 
 #include "Open3D/Geometry/Geometry.h"
+#include "Open3D/Visualization/Utility/GeometryChange.h"
 #include "Open3D/Visualization/Visualizer/RenderOption.h"
 #include "Open3D/Visualization/Visualizer/ViewControl.h"
 
@@ -59,6 +62,11 @@ public:
     /// geometry resource)
     void InvalidateGeometry();
 
+    /// Function to invalidate the elements of the geometry described by
+    /// \p change. Shaders that support incremental updates upload only these
+    /// elements in the next Render(), other shaders bind the geometry again.
+    void InvalidateGeometry(const GeometryChange &change);
+
     const std::string &GetShaderName() const { return shader_name_; }
 
     void PrintShaderWarning(const std::string &message) const;
@@ -82,6 +90,16 @@ protected:
                                 const ViewControl &view) = 0;
     virtual void UnbindGeometry() = 0;
 
+    /// Function to upload the elements in \p change into the bound buffers.
+    /// Returns false if the shader cannot update its buffers incrementally,
+    /// in which case the geometry is bound again.
+    virtual bool UpdateBinding(const geometry::Geometry &geometry,
+                               const RenderOption &option,
+                               const ViewControl &view,
+                               const GeometryChange &change) {
+        return false;
+    }
+
 protected:
     bool ValidateShader(GLuint shader_index);
     bool ValidateProgram(GLuint program_index);
@@ -90,6 +108,18 @@ protected:
                         const char *const fragment_shader_code);
     void ReleaseProgram();
 
+    /// Function to update an array buffer of Eigen::Vector3f elements. If
+    /// \p new_capacity differs from \p capacity, the buffer is replaced by
+    /// one of \p new_capacity elements holding its first \p kept elements.
+    /// Then the elements in \p ranges are uploaded from \p data, which holds
+    /// them concatenated.
+    void UpdateArrayBuffer(GLuint &buffer,
+                           size_t kept,
+                           size_t capacity,
+                           size_t new_capacity,
+                           const std::vector<std::pair<size_t, size_t>> &ranges,
+                           const std::vector<Eigen::Vector3f> &data);
+
 protected:
     GLuint vertex_shader_;
     GLuint geometry_shader_;
@@ -99,6 +129,13 @@ protected:
     GLsizei draw_arrays_size_ = 0;
     bool compiled_ = false;
     bool bound_ = false;
+    /// Number of elements in the bound buffers, and number of elements they
+    /// can hold without being reallocated.
+    size_t buffer_size_ = 0;
+    size_t buffer_capacity_ = 0;
+    /// Changes accumulated since the last Render().
+    GeometryChange pending_change_;
+    bool has_pending_change_ = false;
 
     void SetShaderName(const std::string &shader_name) {
         shader_name_ = shader_name;
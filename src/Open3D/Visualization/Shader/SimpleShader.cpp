@@ -87,11 +87,9 @@ bool SimpleShader::BindGeometry(const geometry::Geometry &geometry,
                                 const RenderOption &option,
                                 const ViewControl &view) {
     // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace InvalidateGeometry() with Buffer Object
-    // Streaming mechanisms.
+    // We use GL_STATIC_DRAW. When the whole geometry changes, we clear buffers
+    // and rebind the geometry. Partial changes are uploaded by UpdateBinding()
+    // where the shader supports it.
     UnbindGeometry();
 
     // Prepare data to be passed to GPU
@@ -111,10 +109,35 @@ bool SimpleShader::BindGeometry(const geometry::Geometry &geometry,
     glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
     glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
                  colors.data(), GL_STATIC_DRAW);
+    buffer_size_ = buffer_capacity_ = points.size();
     bound_ = true;
     return true;
 }
 
+bool SimpleShader::UpdateBinding(const geometry::Geometry &geometry,
+                                 const RenderOption &option,
+                                 const ViewControl &view,
+                                 const GeometryChange &change) {
+    size_t size = 0;
+    std::vector<std::pair<size_t, size_t>> ranges;
+    std::vector<Eigen::Vector3f> points;
+    std::vector<Eigen::Vector3f> colors;
+    if (PrepareBindingUpdate(geometry, option, view, change, size, ranges,
+                             points, colors) == false) {
+        return false;
+    }
+    size_t capacity = GrowBufferCapacity(buffer_capacity_, size);
+    size_t kept = std::min(buffer_size_, size);
+    UpdateArrayBuffer(vertex_position_buffer_, kept, buffer_capacity_,
+                      capacity, ranges, points);
+    UpdateArrayBuffer(vertex_color_buffer_, kept, buffer_capacity_, capacity,
+                      ranges, colors);
+    buffer_size_ = size;
+    buffer_capacity_ = capacity;
+    draw_arrays_size_ = GLsizei(size);
+    return true;
+}
+
 bool SimpleShader::RenderGeometry(const geometry::Geometry &geometry,
                                   const RenderOption &option,
                                   const ViewControl &view) {
@@ -179,7 +202,10 @@ bool SimpleShaderForPointCloud::PrepareBinding(
     const ColorMap &global_color_map = *GetGlobalColorMap();
     points.resize(pointcloud.points_.size());
     colors.resize(pointcloud.points_.size());
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(pointcloud.points_.size()); i++) {
         const auto &point = pointcloud.points_[i];
         points[i] = point.cast<float>();
         Eigen::Vector3d color;
@@ -214,6 +240,36 @@ bool SimpleShaderForPointCloud::PrepareBinding(
     return true;
 }
 
+bool SimpleShaderForPointCloud::PrepareBindingUpdate(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view,
+        const GeometryChange &change,
+        size_t &size,
+        std::vector<std::pair<size_t, size_t>> &ranges,
+        std::vector<Eigen::Vector3f> &points,
+        std::vector<Eigen::Vector3f> &colors) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::PointCloud) {
+        return false;
+    }
+    const geometry::PointCloud &pointcloud =
+            (const geometry::PointCloud &)geometry;
+    // Colors mapped from coordinates depend on the bounding box, which may
+    // have changed for all points.
+    if (pointcloud.HasPoints() == false || pointcloud.HasColors() == false ||
+        (option.point_color_option_ != RenderOption::PointColorOption::Color &&
+         option.point_color_option_ !=
+                 RenderOption::PointColorOption::Default)) {
+        return false;
+    }
+    size = pointcloud.points_.size();
+    ranges = change.GetDirtyRanges(buffer_size_, size);
+    ConvertDirtyElements(pointcloud.points_, ranges, points);
+    ConvertDirtyElements(pointcloud.colors_, ranges, colors);
+    return true;
+}
+
 bool SimpleShaderForLineSet::PrepareRendering(
         const geometry::Geometry &geometry,
         const RenderOption &option,
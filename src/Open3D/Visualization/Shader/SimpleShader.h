@@ -53,6 +53,10 @@ protected:
                         const RenderOption &option,
                         const ViewControl &view) final;
     void UnbindGeometry() final;
+    bool UpdateBinding(const geometry::Geometry &geometry,
+                       const RenderOption &option,
+                       const ViewControl &view,
+                       const GeometryChange &change) final;
 
 protected:
     virtual bool PrepareRendering(const geometry::Geometry &geometry,
@@ -63,6 +67,21 @@ protected:
                                 const ViewControl &view,
                                 std::vector<Eigen::Vector3f> &points,
                                 std::vector<Eigen::Vector3f> &colors) = 0;
+    /// Function to prepare the elements in \p change only. \p ranges
+    /// receives the ranges of elements in \p points and \p colors, and
+    /// \p size the new number of elements. Returns false if the buffers
+    /// cannot be updated incrementally.
+    virtual bool PrepareBindingUpdate(
+            const geometry::Geometry &geometry,
+            const RenderOption &option,
+            const ViewControl &view,
+            const GeometryChange &change,
+            size_t &size,
+            std::vector<std::pair<size_t, size_t>> &ranges,
+            std::vector<Eigen::Vector3f> &points,
+            std::vector<Eigen::Vector3f> &colors) {
+        return false;
+    }
 
 protected:
     GLuint vertex_position_;
@@ -85,6 +104,14 @@ protected:
                         const ViewControl &view,
                         std::vector<Eigen::Vector3f> &points,
                         std::vector<Eigen::Vector3f> &colors) final;
+    bool PrepareBindingUpdate(const geometry::Geometry &geometry,
+                              const RenderOption &option,
+                              const ViewControl &view,
+                              const GeometryChange &change,
+                              size_t &size,
+                              std::vector<std::pair<size_t, size_t>> &ranges,
+                              std::vector<Eigen::Vector3f> &points,
+                              std::vector<Eigen::Vector3f> &colors) final;
 };
 
 class SimpleShaderForLineSet : public SimpleShader {
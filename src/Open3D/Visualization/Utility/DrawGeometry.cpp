@@ -27,7 +27,9 @@
 #include "Open3D/Visualization/Utility/DrawGeometry.h"
 
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudLOD.h"
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Visualization/Utility/PointCloudLODStreamer.h"
 #include "Open3D/Visualization/Visualizer/ViewControlWithCustomAnimation.h"
 #include "Open3D/Visualization/Visualizer/ViewControlWithEditing.h"
 #include "Open3D/Visualization/Visualizer/Visualizer.h"
@@ -252,5 +254,47 @@ bool DrawGeometriesWithVertexSelection(
     return true;
 }
 
+bool DrawPointCloudLOD(std::shared_ptr<const geometry::PointCloudLOD> lod,
+                       size_t point_budget /* = 3000000*/,
+                       const std::string &window_name /* = "Open3D"*/,
+                       int width /* = 640*/,
+                       int height /* = 480*/,
+                       int left /* = 50*/,
+                       int top /* = 50*/) {
+    Visualizer visualizer;
+    if (visualizer.CreateVisualizerWindow(window_name, width, height, left,
+                                          top) == false) {
+        utility::LogWarning(
+                "[DrawPointCloudLOD] Failed creating OpenGL window.");
+        return false;
+    }
+    PointCloudLODStreamer streamer(lod, point_budget);
+    auto pointcloud = streamer.GetPointCloud();
+    if (visualizer.AddGeometry(pointcloud) == false) {
+        utility::LogWarning("[DrawPointCloudLOD] Failed adding geometry.");
+        return false;
+    }
+    visualizer.RegisterAnimationCallback([&](Visualizer *vis) {
+        camera::PinholeCameraParameters camera;
+        if (vis->GetViewControl().ConvertToPinholeCameraParameters(camera)) {
+            streamer.RequestSelection(camera);
+        }
+        GeometryChange change;
+        if (streamer.UpdatePointCloud(change)) {
+            vis->NotifyGeometryChange(pointcloud, change);
+            utility::LogDebug(
+                    "[DrawPointCloudLOD] {:d} points selected in {:.2f} ms, "
+                    "{:d} points resident.",
+                    streamer.GetSelectedPointCount(),
+                    streamer.GetLastSelectionTime(),
+                    pointcloud->points_.size());
+        }
+        return false;
+    });
+    visualizer.Run();
+    visualizer.DestroyVisualizerWindow();
+    return true;
+}
+
 }  // namespace visualization
 }  // namespace open3d
@@ -35,6 +35,11 @@
 #include "Open3D/Geometry/Geometry.h"
 
 namespace open3d {
+
+namespace geometry {
+class PointCloudLOD;
+}  // namespace geometry
+
 namespace visualization {
 
 class Visualizer;
@@ -157,5 +162,26 @@ bool DrawGeometriesWithVertexSelection(
         int left = 50,
         int top = 50);
 
+/// \brief Function to draw a level of detail point cloud.
+///
+/// Every frame, the nodes of \p lod fitting \p point_budget are selected for
+/// the current view on a worker thread, and newly selected points are
+/// appended to the uploaded point cloud.
+///
+/// \param lod The level of detail hierarchy to be visualized.
+/// \param point_budget Maximum number of points selected for a view.
+/// \param window_name The displayed title of the visualization window.
+/// \param width The width of the visualization window.
+/// \param height The height of the visualization window.
+/// \param left margin of the visualization window.
+/// \param top The top margin of the visualization window.
+bool DrawPointCloudLOD(std::shared_ptr<const geometry::PointCloudLOD> lod,
+                       size_t point_budget = 3000000,
+                       const std::string &window_name = "Open3D",
+                       int width = 640,
+                       int height = 480,
+                       int left = 50,
+                       int top = 50);
+
 }  // namespace visualization
 }  // namespace open3d
@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Utility/GeometryChange.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace open3d {
+namespace visualization {
+
+GeometryChange GeometryChange::Appended(size_t begin) {
+    GeometryChange change;
+    change.all_ = false;
+    change.appended_begin_ = begin;
+    return change;
+}
+
+GeometryChange GeometryChange::Modified(const std::vector<size_t> &indices) {
+    GeometryChange change;
+    change.all_ = false;
+    change.modified_ = indices;
+    std::sort(change.modified_.begin(), change.modified_.end());
+    change.modified_.erase(
+            std::unique(change.modified_.begin(), change.modified_.end()),
+            change.modified_.end());
+    return change;
+}
+
+void GeometryChange::Merge(const GeometryChange &other) {
+    if (all_) return;
+    if (other.all_) {
+        *this = other;
+        return;
+    }
+    appended_begin_ = std::min(appended_begin_, other.appended_begin_);
+    std::vector<size_t> modified;
+    modified.reserve(modified_.size() + other.modified_.size());
+    std::set_union(modified_.begin(), modified_.end(), other.modified_.begin(),
+                   other.modified_.end(), std::back_inserter(modified));
+    modified_.swap(modified);
+}
+
+std::vector<std::pair<size_t, size_t>> GeometryChange::GetDirtyRanges(
+        size_t uploaded_size, size_t size) const {
+    std::vector<std::pair<size_t, size_t>> ranges;
+    if (all_) {
+        if (size > 0) ranges.push_back(std::make_pair(size_t(0), size));
+        return ranges;
+    }
+    size_t tail = std::min({appended_begin_, uploaded_size, size});
+    for (size_t index : modified_) {
+        if (index >= tail) break;
+        if (!ranges.empty() && ranges.back().second == index) {
+            ranges.back().second++;
+        } else {
+            ranges.push_back(std::make_pair(index, index + 1));
+        }
+    }
+    if (tail < size) {
+        if (!ranges.empty() && ranges.back().second == tail) {
+            ranges.back().second = size;
+        } else {
+            ranges.push_back(std::make_pair(tail, size));
+        }
+    }
+    return ranges;
+}
+
+size_t GrowBufferCapacity(size_t capacity, size_t size) {
+    if (size <= capacity) return capacity;
+    return std::max(size, capacity * 2);
+}
+
+void ConvertDirtyElements(const std::vector<Eigen::Vector3d> &elements,
+                          const std::vector<std::pair<size_t, size_t>> &ranges,
+                          std::vector<Eigen::Vector3f> &converted) {
+    // offsets[r] is the position of range r in the output.
+    std::vector<size_t> offsets(ranges.size() + 1, 0);
+    for (size_t r = 0; r < ranges.size(); r++) {
+        offsets[r + 1] = offsets[r] + ranges[r].second - ranges[r].first;
+    }
+    converted.resize(offsets.back());
+    // The output is split into fixed chunks so that a few long ranges and
+    // many short ones are balanced alike.
+    const size_t chunk_size = 65536;
+    const int num_chunks =
+            int((converted.size() + chunk_size - 1) / chunk_size);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        size_t k = size_t(c) * chunk_size;
+        size_t end = std::min(converted.size(), k + chunk_size);
+        size_t r = std::upper_bound(offsets.begin(), offsets.end(), k) -
+                   offsets.begin() - 1;
+        while (k < end) {
+            size_t count = std::min(end, offsets[r + 1]) - k;
+            const Eigen::Vector3d *src =
+                    elements.data() + ranges[r].first + (k - offsets[r]);
+            for (size_t j = 0; j < count; j++) {
+                converted[k + j] = src[j].cast<float>();
+            }
+            k += count;
+            r++;
+        }
+    }
+}
+
+}  // namespace visualization
+}  // namespace open3d
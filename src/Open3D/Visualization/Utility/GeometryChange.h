@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace open3d {
+namespace visualization {
+
+/// \class GeometryChange
+///
+/// \brief Describes which elements of a geometry changed since it was last
+/// uploaded to the GPU, so that renderers only convert and upload these.
+///
+/// Elements are points for point clouds. A default constructed
+/// GeometryChange marks every element as changed.
+class GeometryChange {
+public:
+    GeometryChange() {}
+    ~GeometryChange() {}
+
+public:
+    /// \brief Elements from \p begin to the end were appended or changed.
+    static GeometryChange Appended(size_t begin);
+
+    /// \brief The elements in \p indices changed.
+    static GeometryChange Modified(const std::vector<size_t> &indices);
+
+    /// Returns true if every element is marked as changed.
+    bool IsAll() const { return all_; }
+
+    /// \brief Adds the elements marked in \p other, e.g. to accumulate the
+    /// changes made between two renders.
+    void Merge(const GeometryChange &other);
+
+    /// \brief Function to compute the ranges of elements to upload.
+    ///
+    /// \param uploaded_size Number of elements uploaded before. Elements at
+    /// or after it are always included.
+    /// \param size Current number of elements of the geometry.
+    /// \return Sorted, disjoint and non-empty [begin, end) ranges.
+    std::vector<std::pair<size_t, size_t>> GetDirtyRanges(
+            size_t uploaded_size, size_t size) const;
+
+private:
+    bool all_ = true;
+    size_t appended_begin_ = std::numeric_limits<size_t>::max();
+    /// Sorted and unique.
+    std::vector<size_t> modified_;
+};
+
+/// \brief Function to compute the capacity of a buffer that must hold \p size
+/// elements and currently holds \p capacity.
+///
+/// The capacity at least doubles when the buffer grows, so that appending n
+/// elements costs amortized O(n) copies.
+size_t GrowBufferCapacity(size_t capacity, size_t size);
+
+/// \brief Function to convert the elements of \p elements in \p ranges to
+/// float in parallel.
+///
+/// \param elements Elements of the geometry, e.g. PointCloud::points_.
+/// \param ranges Ranges returned by GeometryChange::GetDirtyRanges().
+/// \param converted Output, the converted elements of all ranges
+/// concatenated in order.
+void ConvertDirtyElements(const std::vector<Eigen::Vector3d> &elements,
+                          const std::vector<std::pair<size_t, size_t>> &ranges,
+                          std::vector<Eigen::Vector3f> &converted);
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,172 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Utility/PointCloudLODStreamer.h"
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudLOD.h"
+#include "Open3D/Utility/Timer.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace {
+
+bool IsSameCamera(const camera::PinholeCameraParameters &a,
+                  const camera::PinholeCameraParameters &b) {
+    return a.intrinsic_.width_ == b.intrinsic_.width_ &&
+           a.intrinsic_.height_ == b.intrinsic_.height_ &&
+           a.intrinsic_.intrinsic_matrix_ == b.intrinsic_.intrinsic_matrix_ &&
+           a.extrinsic_ == b.extrinsic_;
+}
+
+}  // unnamed namespace
+
+PointCloudLODStreamer::PointCloudLODStreamer(
+        std::shared_ptr<const geometry::PointCloudLOD> lod,
+        size_t point_budget,
+        double min_pixel_spacing /* = 1.0*/,
+        double max_stale_ratio /* = 0.25*/)
+    : lod_(lod),
+      point_budget_(point_budget),
+      min_pixel_spacing_(min_pixel_spacing),
+      max_stale_ratio_(max_stale_ratio) {
+    // Start with the root so that the rendered cloud spans the whole extent
+    // before the first selection.
+    if (lod_->nodes_.empty() == false) {
+        resident_nodes_.push_back(0);
+    }
+    pointcloud_ = lod_->ExtractPointCloud(resident_nodes_);
+    worker_ = std::thread(&PointCloudLODStreamer::RunWorker, this);
+}
+
+PointCloudLODStreamer::~PointCloudLODStreamer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    condition_.notify_all();
+    worker_.join();
+}
+
+void PointCloudLODStreamer::RequestSelection(
+        const camera::PinholeCameraParameters &camera) {
+    if (has_last_camera_ && IsSameCamera(camera, last_camera_)) return;
+    last_camera_ = camera;
+    has_last_camera_ = true;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        request_ = camera;
+        has_request_ = true;
+    }
+    condition_.notify_all();
+}
+
+void PointCloudLODStreamer::WaitForSelection() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this] { return !has_request_ && !busy_; });
+}
+
+bool PointCloudLODStreamer::UpdatePointCloud(GeometryChange &change) {
+    std::vector<int> selected;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (has_result_ == false) return false;
+        selected.swap(result_);
+        has_result_ = false;
+    }
+    selected_points_ = lod_->GetPointCount(selected);
+
+    std::vector<bool> is_resident(lod_->nodes_.size(), false);
+    for (int node : resident_nodes_) {
+        is_resident[node] = true;
+    }
+    std::vector<int> added;
+    for (int node : selected) {
+        if (is_resident[node] == false) added.push_back(node);
+    }
+    if (added.empty()) return false;
+
+    size_t old_size = pointcloud_->points_.size();
+    size_t max_size = size_t((1.0 + max_stale_ratio_) * point_budget_);
+    if (old_size + lod_->GetPointCount(added) <= max_size) {
+        auto added_pointcloud = lod_->ExtractPointCloud(added);
+        auto append = [](std::vector<Eigen::Vector3d> &dst,
+                         const std::vector<Eigen::Vector3d> &src) {
+            dst.insert(dst.end(), src.begin(), src.end());
+        };
+        append(pointcloud_->points_, added_pointcloud->points_);
+        append(pointcloud_->colors_, added_pointcloud->colors_);
+        append(pointcloud_->normals_, added_pointcloud->normals_);
+        resident_nodes_.insert(resident_nodes_.end(), added.begin(),
+                               added.end());
+        change = GeometryChange::Appended(old_size);
+    } else {
+        *pointcloud_ = *lod_->ExtractPointCloud(selected);
+        resident_nodes_ = selected;
+        change = GeometryChange();
+    }
+    return true;
+}
+
+double PointCloudLODStreamer::GetLastSelectionTime() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return selection_time_;
+}
+
+size_t PointCloudLODStreamer::GetNumSelections() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_selections_;
+}
+
+void PointCloudLODStreamer::RunWorker() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        condition_.wait(lock, [this] { return stop_ || has_request_; });
+        if (stop_) return;
+        camera::PinholeCameraParameters camera = request_;
+        has_request_ = false;
+        busy_ = true;
+        lock.unlock();
+
+        utility::Timer timer;
+        timer.Start();
+        std::vector<int> selected = lod_->SelectNodes(camera, point_budget_,
+                                                      min_pixel_spacing_);
+        timer.Stop();
+
+        lock.lock();
+        result_.swap(selected);
+        has_result_ = true;
+        selection_time_ = timer.GetDuration();
+        num_selections_++;
+        busy_ = false;
+        condition_.notify_all();
+    }
+}
+
+}  // namespace visualization
+}  // namespace open3d
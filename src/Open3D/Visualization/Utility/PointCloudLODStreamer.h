@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Visualization/Utility/GeometryChange.h"
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+class PointCloudLOD;
+}  // namespace geometry
+
+namespace visualization {
+
+/// \class PointCloudLODStreamer
+///
+/// \brief Keeps a point cloud for rendering filled with the nodes of a
+/// PointCloudLOD selected for the current camera.
+///
+/// Nodes are selected on a worker thread, so the render thread only hands
+/// over the camera and applies finished selections. The selection for an
+/// unchanged camera is reused. Newly selected nodes are appended to the
+/// rendered cloud, which can then be uploaded with a GeometryChange;
+/// deselected nodes are only removed once they exceed a share of the budget.
+class PointCloudLODStreamer {
+public:
+    /// \param lod The level of detail hierarchy.
+    /// \param point_budget Maximum number of points selected for a camera.
+    /// \param min_pixel_spacing See geometry::PointCloudLOD::SelectNodes().
+    /// \param max_stale_ratio Deselected nodes are kept in the rendered cloud
+    /// as long as it holds at most (1 + max_stale_ratio) * point_budget
+    /// points.
+    PointCloudLODStreamer(std::shared_ptr<const geometry::PointCloudLOD> lod,
+                          size_t point_budget,
+                          double min_pixel_spacing = 1.0,
+                          double max_stale_ratio = 0.25);
+    ~PointCloudLODStreamer();
+    PointCloudLODStreamer(const PointCloudLODStreamer &) = delete;
+    PointCloudLODStreamer &operator=(const PointCloudLODStreamer &) = delete;
+
+public:
+    /// \brief Function to request the selection for \p camera. Returns
+    /// immediately, a pending request that has not started is replaced.
+    void RequestSelection(const camera::PinholeCameraParameters &camera);
+
+    /// \brief Function to block until the last requested selection is
+    /// computed.
+    void WaitForSelection();
+
+    /// \brief Function to apply the last computed selection to the rendered
+    /// point cloud.
+    ///
+    /// \param change Output, the points of the rendered cloud that changed.
+    /// \return true if the rendered point cloud changed.
+    bool UpdatePointCloud(GeometryChange &change);
+
+    /// Returns the rendered point cloud. It is only modified by
+    /// UpdatePointCloud().
+    std::shared_ptr<geometry::PointCloud> GetPointCloud() const {
+        return pointcloud_;
+    }
+
+    /// Returns the number of points of the last applied selection.
+    size_t GetSelectedPointCount() const { return selected_points_; }
+
+    /// Returns the time in milliseconds the last selection took.
+    double GetLastSelectionTime() const;
+
+    /// Returns the number of selections computed by the worker thread.
+    size_t GetNumSelections() const;
+
+private:
+    void RunWorker();
+
+private:
+    std::shared_ptr<const geometry::PointCloudLOD> lod_;
+    size_t point_budget_;
+    double min_pixel_spacing_;
+    double max_stale_ratio_;
+
+    // Shared with the worker thread.
+    mutable std::mutex mutex_;
+    std::condition_variable condition_;
+    std::thread worker_;
+    bool stop_ = false;
+    bool has_request_ = false;
+    bool busy_ = false;
+    camera::PinholeCameraParameters request_;
+    bool has_result_ = false;
+    std::vector<int> result_;
+    double selection_time_ = 0;
+    size_t num_selections_ = 0;
+
+    // Owned by the render thread.
+    bool has_last_camera_ = false;
+    camera::PinholeCameraParameters last_camera_;
+    std::shared_ptr<geometry::PointCloud> pointcloud_;
+    /// Nodes stored in pointcloud_, in order.
+    std::vector<int> resident_nodes_;
+    size_t selected_points_ = 0;
+};
+
+}  // namespace visualization
+}  // namespace open3d
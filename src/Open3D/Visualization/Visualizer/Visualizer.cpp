@@ -441,6 +441,20 @@ bool Visualizer::UpdateGeometry(
     return success;
 }
 
+bool Visualizer::NotifyGeometryChange(
+        std::shared_ptr<const geometry::Geometry> geometry_ptr,
+        const GeometryChange &change) {
+    glfwMakeContextCurrent(window_);
+    bool success = true;
+    for (const auto &renderer_ptr : geometry_renderer_ptrs_) {
+        if (renderer_ptr->HasGeometry(geometry_ptr)) {
+            success = (success && renderer_ptr->NotifyGeometryChange(change));
+        }
+    }
+    UpdateRender();
+    return success;
+}
+
 void Visualizer::UpdateRender() { is_redraw_required_ = true; }
 
 bool Visualizer::HasGeometry() const { return !geometry_ptrs_.empty(); }
@@ -42,6 +42,7 @@
 #include "Open3D/Geometry/Geometry.h"
 #include "Open3D/Visualization/Shader/GeometryRenderer.h"
 #include "Open3D/Visualization/Utility/ColorMap.h"
+#include "Open3D/Visualization/Utility/GeometryChange.h"
 #include "Open3D/Visualization/Visualizer/RenderOption.h"
 #include "Open3D/Visualization/Visualizer/ViewControl.h"
 
@@ -174,6 +175,15 @@ public:
     /// updates the geometry specified.
     virtual bool UpdateGeometry(
             std::shared_ptr<const geometry::Geometry> geometry_ptr = nullptr);
+
+    /// \brief Function to update part of a geometry.
+    ///
+    /// Like UpdateGeometry(), but only the elements described by \p change
+    /// are converted and uploaded where the renderer supports it, e.g. points
+    /// appended to a point cloud with colors.
+    virtual bool NotifyGeometryChange(
+            std::shared_ptr<const geometry::Geometry> geometry_ptr,
+            const GeometryChange &change);
     virtual bool HasGeometry() const;
 
     /// Function to inform render needed to be updated.
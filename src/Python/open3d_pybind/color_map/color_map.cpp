@@ -26,6 +26,7 @@
 
 #include "Open3D/Camera/PinholeCameraTrajectory.h"
 #include "Open3D/ColorMap/ColorMapOptimization.h"
+#include "Open3D/ColorMap/KeyframeProvider.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
@@ -143,6 +144,29 @@ void pybind_color_map_classes(py::module &m) {
                     "visible vertices to fill the invisible vertex. Set to "
                     "``0`` to disable this feature and all invisible vertices "
                     "will be black.")
+            .def_readwrite(
+                    "use_zbuffer_for_visibility_check",
+                    &color_map::ColorMapOptimizationOption::
+                            use_zbuffer_for_visibility_check_,
+                    "bool: (Default ``False``) Parameter for point visibility "
+                    "check. If ``True``, the mesh is rendered into a z-buffer "
+                    "for every camera and vertices occluded by the mesh "
+                    "itself are marked as invisible, in addition to the "
+                    "depth image check.")
+            .def_readwrite(
+                    "keyframe_batch_size",
+                    &color_map::ColorMapOptimizationOption::
+                            keyframe_batch_size_,
+                    "int: (Default ``64``) Number of keyframes that are "
+                    "loaded and processed together. Set to ``0`` to process "
+                    "all keyframes in one batch.")
+            .def_readwrite(
+                    "keyframe_cache_size_mb",
+                    &color_map::ColorMapOptimizationOption::
+                            keyframe_cache_size_mb_,
+                    "float: (Default ``0``) Budget in megabytes for the cache "
+                    "of keyframe gradient images reused across iterations. "
+                    "Set to ``0`` for an unlimited cache.")
             .def("__repr__", [](const color_map::ColorMapOptimizationOption
                                         &to) {
                 // clang-format off
@@ -157,7 +181,10 @@ void pybind_color_map_classes(py::module &m) {
                     "- depth_threshold_for_discontinuity_check: {}\n"
                     "- half_dilation_kernel_size_for_discontinuity_map: {}\n"
                     "- image_boundary_margin: {}\n"
-                    "- invisible_vertex_color_knn: {}\n",
+                    "- invisible_vertex_color_knn: {}\n"
+                    "- use_zbuffer_for_visibility_check: {}\n"
+                    "- keyframe_batch_size: {}\n"
+                    "- keyframe_cache_size_mb: {}\n",
                     to.non_rigid_camera_coordinate_,
                     to.number_of_vertical_anchors_,
                     to.non_rigid_anchor_point_weight_,
@@ -167,14 +194,62 @@ void pybind_color_map_classes(py::module &m) {
                     to.depth_threshold_for_discontinuity_check_,
                     to.half_dilation_kernel_size_for_discontinuity_map_,
                     to.image_boundary_margin_,
-                    to.invisible_vertex_color_knn_
+                    to.invisible_vertex_color_knn_,
+                    to.use_zbuffer_for_visibility_check_,
+                    to.keyframe_batch_size_,
+                    to.keyframe_cache_size_mb_
                 );
                 // clang-format on
             });
+
+    py::class_<color_map::KeyframeProvider,
+               std::shared_ptr<color_map::KeyframeProvider>>
+            keyframe_provider(m, "KeyframeProvider",
+                              "Source of RGBD keyframes for color map "
+                              "optimization.");
+    keyframe_provider
+            .def("num_keyframes", &color_map::KeyframeProvider::NumKeyframes,
+                 "Returns the number of keyframes.")
+            .def("load_keyframe", &color_map::KeyframeProvider::LoadKeyframe,
+                 "Returns the keyframe at the given index.", "index"_a);
+
+    py::class_<color_map::RGBDImageFileKeyframeProvider,
+               std::shared_ptr<color_map::RGBDImageFileKeyframeProvider>,
+               color_map::KeyframeProvider>
+            file_provider(m, "RGBDImageFileKeyframeProvider",
+                          "Keyframe provider reading color and depth image "
+                          "files on demand.");
+    file_provider
+            .def(py::init<const std::vector<std::string> &,
+                          const std::vector<std::string> &, double, double>(),
+                 "color_filenames"_a, "depth_filenames"_a,
+                 "depth_scale"_a = 1000.0, "depth_trunc"_a = 3.0)
+            .def_readwrite("color_filenames",
+                           &color_map::RGBDImageFileKeyframeProvider::
+                                   color_filenames_,
+                           "List[str]: Color image file of every keyframe.")
+            .def_readwrite("depth_filenames",
+                           &color_map::RGBDImageFileKeyframeProvider::
+                                   depth_filenames_,
+                           "List[str]: Depth image file of every keyframe.")
+            .def("__repr__",
+                 [](const color_map::RGBDImageFileKeyframeProvider &p) {
+                     return fmt::format(
+                             "color_map::RGBDImageFileKeyframeProvider with "
+                             "{} keyframes",
+                             p.NumKeyframes());
+                 });
 }
 
 void pybind_color_map_methods(py::module &m) {
-    m.def("color_map_optimization", &color_map::ColorMapOptimization,
+    m.def("color_map_optimization",
+          [](geometry::TriangleMesh &mesh,
+             const std::vector<std::shared_ptr<geometry::RGBDImage>>
+                     &imgs_rgbd,
+             camera::PinholeCameraTrajectory &camera,
+             const color_map::ColorMapOptimizationOption &option) {
+              color_map::ColorMapOptimization(mesh, imgs_rgbd, camera, option);
+          },
           "Function for color mapping of reconstructed scenes via "
           "optimization, "
           "This is implementation of following by paper Q-Y Zhou and V Koltun: "
@@ -189,6 +264,18 @@ void pybind_color_map_methods(py::module &m) {
              {"imgs_rgbd", "A list of RGBD images seen by cameras."},
              {"camera", "Cameras' parameters."},
              {"option", "The ColorMap optimization option."}});
+    m.def("color_map_optimization",
+          [](geometry::TriangleMesh &mesh,
+             const color_map::KeyframeProvider &keyframes,
+             camera::PinholeCameraTrajectory &camera,
+             const color_map::ColorMapOptimizationOption &option) {
+              color_map::ColorMapOptimization(mesh, keyframes, camera, option);
+          },
+          "Function for color mapping of reconstructed scenes via "
+          "optimization with keyframes loaded on demand from a "
+          "KeyframeProvider.",
+          "mesh"_a, "keyframes"_a, "camera"_a,
+          "option"_a = color_map::ColorMapOptimizationOption());
 }
 
 void pybind_color_map(py::module &m) {
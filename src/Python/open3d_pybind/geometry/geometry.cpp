@@ -208,4 +208,7 @@ void pybind_geometry(py::module &m) {
     pybind_octree_methods(m_submodule);
     pybind_octree(m_submodule);
     pybind_boundingvolume(m_submodule);
+    pybind_rasterizer(m_submodule);
+    pybind_pointcloudlod(m_submodule);
+    pybind_trianglemeshdeformation(m_submodule);
 }
@@ -48,3 +48,6 @@ void pybind_image_methods(py::module &m);
 void pybind_octree_methods(py::module &m);
 void pybind_octree(py::module &m);
 void pybind_boundingvolume(py::module &m);
+void pybind_rasterizer(py::module &m);
+void pybind_pointcloudlod(py::module &m);
+void pybind_trianglemeshdeformation(py::module &m);
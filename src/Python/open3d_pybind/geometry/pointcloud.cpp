@@ -71,6 +71,10 @@ void pybind_pointcloud(py::module &m) {
                  "Function to select points from input pointcloud into output "
                  "pointcloud.",
                  "indices"_a, "invert"_a = false)
+            .def("select_by_mask", &geometry::PointCloud::SelectByMask,
+                 "Function to select points from input pointcloud into output "
+                 "pointcloud by a boolean mask.",
+                 "mask"_a, "invert"_a = false)
             .def("voxel_down_sample", &geometry::PointCloud::VoxelDownSample,
                  "Function to downsample input pointcloud into output "
                  "pointcloud with "
@@ -119,6 +123,16 @@ void pybind_pointcloud(py::module &m) {
                  "Function to remove points that are further away from their "
                  "neighbors in average",
                  "nb_neighbors"_a, "std_ratio"_a)
+            .def("compute_radius_outlier_mask",
+                 &geometry::PointCloud::ComputeRadiusOutlierMask,
+                 "Function to compute the inlier mask of "
+                 "remove_radius_outlier without copying the point cloud",
+                 "nb_points"_a, "radius"_a)
+            .def("compute_statistical_outlier_mask",
+                 &geometry::PointCloud::ComputeStatisticalOutlierMask,
+                 "Function to compute the inlier mask of "
+                 "remove_statistical_outlier without copying the point cloud",
+                 "nb_neighbors"_a, "std_ratio"_a)
             .def("estimate_normals", &geometry::PointCloud::EstimateNormals,
                  "Function to compute the normals of a point cloud. Normals "
                  "are oriented with respect to the input point cloud if "
@@ -133,6 +147,11 @@ void pybind_pointcloud(py::module &m) {
                  &geometry::PointCloud::OrientNormalsTowardsCameraLocation,
                  "Function to orient the normals of a point cloud",
                  "camera_location"_a = Eigen::Vector3d(0.0, 0.0, 0.0))
+            .def("orient_normals_consistent_tangent_plane",
+                 &geometry::PointCloud::OrientNormalsConsistentTangentPlane,
+                 "Function to consistently orient the normals of a point "
+                 "cloud based on tangent planes",
+                 "k"_a)
             .def("compute_point_cloud_distance",
                  &geometry::PointCloud::ComputePointCloudDistance,
                  "For each point in the source point cloud, compute the "
@@ -227,6 +246,11 @@ void pybind_pointcloud(py::module &m) {
             {{"indices", "Indices of points to be selected."},
              {"invert",
               "Set to ``True`` to invert the selection of indices."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "select_by_mask",
+            {{"mask", "Boolean mask with one entry per point."},
+             {"invert",
+              "Set to ``True`` to invert the selection of the mask."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "voxel_down_sample",
             {{"voxel_size", "Voxel size to downsample into."},
@@ -256,6 +280,14 @@ void pybind_pointcloud(py::module &m) {
             m, "PointCloud", "remove_statistical_outlier",
             {{"nb_neighbors", "Number of neighbors around the target point."},
              {"std_ratio", "Standard deviation ratio."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_radius_outlier_mask",
+            {{"nb_points", "Number of points within the radius."},
+             {"radius", "Radius of the sphere."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_statistical_outlier_mask",
+            {{"nb_neighbors", "Number of neighbors around the target point."},
+             {"std_ratio", "Standard deviation ratio."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "estimate_normals",
             {{"search_param",
@@ -272,6 +304,9 @@ void pybind_pointcloud(py::module &m) {
             m, "PointCloud", "orient_normals_towards_camera_location",
             {{"camera_location",
               "Normals are oriented with towards the camera_location."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "orient_normals_consistent_tangent_plane",
+            {{"k", "Number of neighbors used to build the graph."}});
     docstring::ClassMethodDocInject(m, "PointCloud",
                                     "compute_point_cloud_distance",
                                     {{"target", "The target point cloud."}});
@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloudLOD.h"
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/PointCloud.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/geometry/geometry.h"
+
+using namespace open3d;
+
+void pybind_pointcloudlod(py::module &m) {
+    // open3d.geometry.PointCloudLODNode
+    py::class_<geometry::PointCloudLODNode> node(
+            m, "PointCloudLODNode", "Node of a PointCloudLOD.");
+    py::detail::bind_copy_functions<geometry::PointCloudLODNode>(node);
+    node.def(py::init<>())
+            .def_readwrite("min_bound",
+                           &geometry::PointCloudLODNode::min_bound_,
+                           "Minimum corner of the cubic cell of the node.")
+            .def_readwrite("size", &geometry::PointCloudLODNode::size_,
+                           "Side length of the cell.")
+            .def_readwrite("depth", &geometry::PointCloudLODNode::depth_,
+                           "Depth of the node, 0 for the root.")
+            .def_readwrite("parent", &geometry::PointCloudLODNode::parent_,
+                           "Index of the parent node, -1 for the root.")
+            .def_readwrite("first_child",
+                           &geometry::PointCloudLODNode::first_child_,
+                           "Index of the first child, -1 for leaves.")
+            .def_readwrite("num_children",
+                           &geometry::PointCloudLODNode::num_children_,
+                           "Number of children, stored consecutively.")
+            .def_readwrite("begin", &geometry::PointCloudLODNode::begin_,
+                           "First point of the node in point_cloud.")
+            .def_readwrite("end", &geometry::PointCloudLODNode::end_,
+                           "End of the points of the node in point_cloud.")
+            .def("__repr__", [](const geometry::PointCloudLODNode &n) {
+                return fmt::format(
+                        "geometry::PointCloudLODNode with depth {:d} and "
+                        "{:d} points",
+                        n.depth_, n.end_ - n.begin_);
+            });
+
+    // open3d.geometry.PointCloudLOD
+    py::class_<geometry::PointCloudLOD,
+               std::shared_ptr<geometry::PointCloudLOD>>
+            lod(m, "PointCloudLOD",
+                "Level of detail hierarchy of a point cloud for rendering "
+                "clouds that do not fit into a point budget.");
+    lod.def(py::init<>())
+            .def("__repr__",
+                 [](const geometry::PointCloudLOD &l) {
+                     return fmt::format(
+                             "geometry::PointCloudLOD with {:d} nodes and "
+                             "{:d} points",
+                             l.nodes_.size(), l.pointcloud_.points_.size());
+                 })
+            .def_static("create_from_point_cloud",
+                        &geometry::PointCloudLOD::CreateFromPointCloud,
+                        "Function to build the hierarchy of a point cloud.",
+                        "pointcloud"_a, "max_points_per_node"_a = 20000,
+                        "sampling_depth"_a = 7, "max_depth"_a = 14)
+            .def("select_nodes", &geometry::PointCloudLOD::SelectNodes,
+                 "Function to select the nodes to render from a camera. "
+                 "Returns the indices of the selected nodes, parents before "
+                 "children.",
+                 "camera"_a, "point_budget"_a, "min_pixel_spacing"_a = 1.0)
+            .def("extract_point_cloud",
+                 &geometry::PointCloudLOD::ExtractPointCloud,
+                 "Function to extract the points of nodes.", "nodes"_a)
+            .def("get_point_count", &geometry::PointCloudLOD::GetPointCount,
+                 "Returns the number of points of nodes.", "nodes"_a)
+            .def_readonly("nodes", &geometry::PointCloudLOD::nodes_,
+                          "List of PointCloudLODNode, the root first.")
+            .def_readonly("point_cloud", &geometry::PointCloudLOD::pointcloud_,
+                          "The points sorted by node.")
+            .def_readonly("indices", &geometry::PointCloudLOD::indices_,
+                          "Index in the input cloud of each point.");
+    docstring::ClassMethodDocInject(
+            m, "PointCloudLOD", "create_from_point_cloud",
+            {{"pointcloud", "The point cloud."},
+             {"max_points_per_node",
+              "Nodes with at most this many points in their subtree are not "
+              "split."},
+             {"sampling_depth",
+              "Each node keeps at most one point per cell of a grid of "
+              "2^sampling_depth cells per side."},
+             {"max_depth", "Maximum depth of the nodes."}});
+    docstring::ClassMethodDocInject(m, "PointCloudLOD", "extract_point_cloud",
+                                    {{"nodes", "Indices of the nodes."}});
+    docstring::ClassMethodDocInject(m, "PointCloudLOD", "get_point_count",
+                                    {{"nodes", "Indices of the nodes."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloudLOD", "select_nodes",
+            {{"camera", "Intrinsic and extrinsic parameters of the camera."},
+             {"point_budget",
+              "Maximum number of points of the selected nodes."},
+             {"min_pixel_spacing",
+              "A node is only refined if the grid spacing of its children "
+              "projects to at least this many pixels."}});
+}
@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/Rasterizer.h"
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/geometry/geometry.h"
+
+using namespace open3d;
+
+void pybind_rasterizer(py::module &m) {
+    // open3d.geometry.RasterizerOption
+    py::class_<geometry::RasterizerOption> rasterizer_option(
+            m, "RasterizerOption", "Options for the CPU rasterizer.");
+    py::detail::bind_copy_functions<geometry::RasterizerOption>(
+            rasterizer_option);
+    rasterizer_option
+            .def(py::init([](int tile_size, int point_size,
+                             bool cull_back_faces, double near_plane) {
+                     return new geometry::RasterizerOption(
+                             tile_size, point_size, cull_back_faces,
+                             near_plane);
+                 }),
+                 "tile_size"_a = 32, "point_size"_a = 1,
+                 "cull_back_faces"_a = false, "near_plane"_a = 1e-3)
+            .def_readwrite("tile_size",
+                           &geometry::RasterizerOption::tile_size_,
+                           "int: Side length in pixels of the screen tiles "
+                           "that are rasterized in parallel.")
+            .def_readwrite("point_size",
+                           &geometry::RasterizerOption::point_size_,
+                           "int: Side length in pixels of the square drawn "
+                           "for each point.")
+            .def_readwrite("cull_back_faces",
+                           &geometry::RasterizerOption::cull_back_faces_,
+                           "bool: Set to ``True`` to skip triangles facing "
+                           "away from the camera.")
+            .def_readwrite("near_plane",
+                           &geometry::RasterizerOption::near_plane_,
+                           "float: Primitives with a vertex closer to the "
+                           "camera than near_plane are not drawn.")
+            .def("__repr__", [](const geometry::RasterizerOption &c) {
+                return fmt::format(
+                        "geometry::RasterizerOption class "
+                        "with \ntile_size={}"
+                        "\npoint_size={}"
+                        "\ncull_back_faces={}"
+                        "\nnear_plane={}",
+                        c.tile_size_, c.point_size_, c.cull_back_faces_,
+                        c.near_plane_);
+            });
+
+    m.def("rasterize_triangle_mesh", &geometry::RasterizeTriangleMesh,
+          "Function to render a triangle mesh on the CPU. Returns the depth "
+          "image (float, 0 where empty), the color image (uint8, 3 channels) "
+          "and the triangle index image (int, -1 where empty).",
+          "mesh"_a, "camera"_a, "option"_a = geometry::RasterizerOption());
+    docstring::FunctionDocInject(
+            m, "rasterize_triangle_mesh",
+            {{"mesh", "The mesh to render."},
+             {"camera", "Intrinsic and extrinsic parameters of the camera."},
+             {"option", "Rasterizer options."}});
+
+    m.def("rasterize_point_cloud", &geometry::RasterizePointCloud,
+          "Function to render a point cloud on the CPU. Returns the depth "
+          "image (float, 0 where empty), the color image (uint8, 3 channels) "
+          "and the point index image (int, -1 where empty).",
+          "pointcloud"_a, "camera"_a,
+          "option"_a = geometry::RasterizerOption());
+    docstring::FunctionDocInject(
+            m, "rasterize_point_cloud",
+            {{"pointcloud", "The point cloud to render."},
+             {"camera", "Intrinsic and extrinsic parameters of the camera."},
+             {"option", "Rasterizer options."}});
+}
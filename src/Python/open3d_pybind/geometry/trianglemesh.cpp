@@ -27,6 +27,8 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TetraMesh.h"
+#include "Open3D/Utility/Console.h"
 
 #include "open3d_pybind/docstring.h"
 #include "open3d_pybind/geometry/geometry.h"
@@ -35,6 +37,176 @@
 using namespace open3d;
 
 void pybind_trianglemesh(py::module &m) {
+    py::class_<geometry::PoissonReconstructionOption> poisson_option(
+            m, "PoissonReconstructionOption",
+            "Options for TriangleMesh.create_from_point_cloud_poisson.");
+    py::detail::bind_copy_functions<geometry::PoissonReconstructionOption>(
+            poisson_option);
+    poisson_option
+            .def(py::init([](size_t depth, size_t width, float scale,
+                             bool linear_fit, int n_threads, int iters,
+                             float cg_solver_accuracy, float samples_per_node,
+                             float point_weight, int full_depth,
+                             double max_memory_mb) {
+                     return new geometry::PoissonReconstructionOption(
+                             depth, width, scale, linear_fit, n_threads, iters,
+                             cg_solver_accuracy, samples_per_node,
+                             point_weight, full_depth, max_memory_mb);
+                 }),
+                 "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
+                 "linear_fit"_a = false, "n_threads"_a = -1, "iters"_a = 8,
+                 "cg_solver_accuracy"_a = 1e-3, "samples_per_node"_a = 1.5,
+                 "point_weight"_a = 2.0, "full_depth"_a = 5,
+                 "max_memory_mb"_a = 0.0)
+            .def_readwrite("depth",
+                           &geometry::PoissonReconstructionOption::depth_,
+                           "int: Maximum depth of the tree used for surface "
+                           "reconstruction.")
+            .def_readwrite("width",
+                           &geometry::PoissonReconstructionOption::width_,
+                           "int: Target width of the finest level octree "
+                           "cells, ignored if 0.")
+            .def_readwrite("scale",
+                           &geometry::PoissonReconstructionOption::scale_,
+                           "float: Ratio between the diameter of the "
+                           "reconstruction cube and the samples' bounding "
+                           "cube.")
+            .def_readwrite("linear_fit",
+                           &geometry::PoissonReconstructionOption::linear_fit_,
+                           "bool: Use linear interpolation to estimate the "
+                           "positions of iso-vertices.")
+            .def_readwrite("n_threads",
+                           &geometry::PoissonReconstructionOption::n_threads_,
+                           "int: Number of threads, -1 uses all hardware "
+                           "threads.")
+            .def_readwrite("iters",
+                           &geometry::PoissonReconstructionOption::iters_,
+                           "int: Number of solver iterations at every depth.")
+            .def_readwrite("cg_solver_accuracy",
+                           &geometry::PoissonReconstructionOption::
+                                   cg_solver_accuracy_,
+                           "float: Accuracy of the conjugate gradient solver.")
+            .def_readwrite("samples_per_node",
+                           &geometry::PoissonReconstructionOption::
+                                   samples_per_node_,
+                           "float: Minimum number of samples per octree node.")
+            .def_readwrite("point_weight",
+                           &geometry::PoissonReconstructionOption::
+                                   point_weight_,
+                           "float: Importance of point interpolation, 0 "
+                           "disables the screening term.")
+            .def_readwrite("full_depth",
+                           &geometry::PoissonReconstructionOption::full_depth_,
+                           "int: Depth up to which the octree is complete.")
+            .def_readwrite("max_memory_mb",
+                           &geometry::PoissonReconstructionOption::
+                                   max_memory_mb_,
+                           "float: Memory limit of the reconstruction in "
+                           "megabytes, checked after every stage, 0 for no "
+                           "limit.")
+            .def("__repr__",
+                 [](const geometry::PoissonReconstructionOption &o) {
+                     return fmt::format(
+                             "geometry::PoissonReconstructionOption with "
+                             "depth={:d}, width={:d}, scale={:f}, "
+                             "n_threads={:d}, iters={:d}, and "
+                             "max_memory_mb={:f}",
+                             o.depth_, o.width_, o.scale_, o.n_threads_,
+                             o.iters_, o.max_memory_mb_);
+                 });
+
+    py::class_<geometry::PoissonReconstructionTimings> poisson_timings(
+            m, "PoissonReconstructionTimings",
+            "Wall clock time in seconds spent in the stages of "
+            "TriangleMesh.create_from_point_cloud_poisson.");
+    py::detail::bind_default_constructor<
+            geometry::PoissonReconstructionTimings>(poisson_timings);
+    py::detail::bind_copy_functions<geometry::PoissonReconstructionTimings>(
+            poisson_timings);
+    poisson_timings
+            .def_readonly("tree_build",
+                          &geometry::PoissonReconstructionTimings::tree_build_,
+                          "float: Octree construction, density estimation and "
+                          "normal field splatting.")
+            .def_readonly("solve",
+                          &geometry::PoissonReconstructionTimings::solve_,
+                          "float: Setting up the constraints and solving the "
+                          "linear system.")
+            .def_readonly("extraction",
+                          &geometry::PoissonReconstructionTimings::extraction_,
+                          "float: Iso-surface extraction.")
+            .def_readonly("total",
+                          &geometry::PoissonReconstructionTimings::total_,
+                          "float: Total reconstruction time.")
+            .def_readonly("peak_memory_mb",
+                          &geometry::PoissonReconstructionTimings::
+                                  peak_memory_mb_,
+                          "float: Largest memory added by the call over its "
+                          "usage when it started, in megabytes, sampled "
+                          "after every stage.")
+            .def("__repr__",
+                 [](const geometry::PoissonReconstructionTimings &t) {
+                     return fmt::format(
+                             "geometry::PoissonReconstructionTimings with "
+                             "tree_build={:f}, solve={:f}, extraction={:f}, "
+                             "and total={:f} (s)",
+                             t.tree_build_, t.solve_, t.extraction_,
+                             t.total_);
+                 });
+
+    py::class_<geometry::QuadricDecimationOption> decimation_option(
+            m, "QuadricDecimationOption",
+            "Options for the parallel "
+            "TriangleMesh.simplify_quadric_decimation.");
+    py::detail::bind_copy_functions<geometry::QuadricDecimationOption>(
+            decimation_option);
+    decimation_option
+            .def(py::init([](int partition_size, bool preserve_topology) {
+                     return new geometry::QuadricDecimationOption(
+                             partition_size, preserve_topology);
+                 }),
+                 "partition_size"_a = 100000, "preserve_topology"_a = true)
+            .def_readwrite(
+                    "partition_size",
+                    &geometry::QuadricDecimationOption::partition_size_,
+                    "int: Approximate number of triangles per spatial "
+                    "partition decimated in parallel, 0 for a single "
+                    "partition.")
+            .def_readwrite(
+                    "preserve_topology",
+                    &geometry::QuadricDecimationOption::preserve_topology_,
+                    "bool: Reject edge collapses that violate the link "
+                    "condition or pinch the boundary.")
+            .def("__repr__", [](const geometry::QuadricDecimationOption &o) {
+                return fmt::format(
+                        "geometry::QuadricDecimationOption with "
+                        "partition_size={:d} and preserve_topology={}",
+                        o.partition_size_, o.preserve_topology_);
+            });
+
+    py::class_<geometry::AlphaShapeOption> alpha_shape_option(
+            m, "AlphaShapeOption",
+            "Options for the tiled "
+            "TriangleMesh.create_from_point_cloud_alpha_shape.");
+    py::detail::bind_copy_functions<geometry::AlphaShapeOption>(
+            alpha_shape_option);
+    alpha_shape_option
+            .def(py::init([](int max_block_points) {
+                     return new geometry::AlphaShapeOption(max_block_points);
+                 }),
+                 "max_block_points"_a = 1000000)
+            .def_readwrite(
+                    "max_block_points",
+                    &geometry::AlphaShapeOption::max_block_points_,
+                    "int: Maximum number of points per spatial block "
+                    "tetrahedralized in parallel, 0 for a single block.")
+            .def("__repr__", [](const geometry::AlphaShapeOption &o) {
+                return fmt::format(
+                        "geometry::AlphaShapeOption with "
+                        "max_block_points={:d}",
+                        o.max_block_points_);
+            });
+
     py::class_<geometry::TriangleMesh, PyGeometry3D<geometry::TriangleMesh>,
                std::shared_ptr<geometry::TriangleMesh>, geometry::MeshBase>
             trianglemesh(m, "TriangleMesh",
@@ -276,11 +448,26 @@ void pybind_trianglemesh(py::module &m) {
                  "contraction"_a =
                          geometry::MeshBase::SimplificationContraction::Average)
             .def("simplify_quadric_decimation",
-                 &geometry::TriangleMesh::SimplifyQuadricDecimation,
+                 [](const geometry::TriangleMesh &mesh,
+                    int target_number_of_triangles) {
+                     return mesh.SimplifyQuadricDecimation(
+                             target_number_of_triangles);
+                 },
                  "Function to simplify mesh using Quadric Error Metric "
                  "Decimation by "
                  "Garland and Heckbert",
                  "target_number_of_triangles"_a)
+            .def("simplify_quadric_decimation",
+                 [](const geometry::TriangleMesh &mesh,
+                    int target_number_of_triangles,
+                    const geometry::QuadricDecimationOption &option) {
+                     return mesh.SimplifyQuadricDecimation(
+                             target_number_of_triangles, option);
+                 },
+                 "Function to simplify mesh using Quadric Error Metric "
+                 "Decimation by Garland and Heckbert. Spatial partitions are "
+                 "decimated in parallel before a final pass over the seams.",
+                 "target_number_of_triangles"_a, "option"_a)
             .def("compute_convex_hull",
                  &geometry::TriangleMesh::ComputeConvexHull,
                  "Computes the convex hull of the triangle mesh.")
@@ -337,12 +524,32 @@ void pybind_trianglemesh(py::module &m) {
                         "\"Three-Dimensional Alpha Shapes\", 1994.",
                         "pcd"_a, "alpha"_a)
             .def_static("create_from_point_cloud_alpha_shape",
-                        &geometry::TriangleMesh::CreateFromPointCloudAlphaShape,
+                        [](const geometry::PointCloud &pcd, double alpha,
+                           std::shared_ptr<geometry::TetraMesh> tetra_mesh,
+                           std::vector<size_t> *pt_map) {
+                            return geometry::TriangleMesh::
+                                    CreateFromPointCloudAlphaShape(
+                                            pcd, alpha, tetra_mesh, pt_map);
+                        },
                         "Alpha shapes are a generalization of the convex hull. "
                         "With decreasing alpha value the shape schrinks and "
                         "creates cavities. See Edelsbrunner and Muecke, "
                         "\"Three-Dimensional Alpha Shapes\", 1994.",
                         "pcd"_a, "alpha"_a, "tetra_mesh"_a, "pt_map"_a)
+            .def_static("create_from_point_cloud_alpha_shape",
+                        [](const geometry::PointCloud &pcd, double alpha,
+                           const geometry::AlphaShapeOption &option) {
+                            return geometry::TriangleMesh::
+                                    CreateFromPointCloudAlphaShape(pcd, alpha,
+                                                                   option);
+                        },
+                        "Alpha shapes are a generalization of the convex hull. "
+                        "With decreasing alpha value the shape schrinks and "
+                        "creates cavities. See Edelsbrunner and Muecke, "
+                        "\"Three-Dimensional Alpha Shapes\", 1994. The cloud "
+                        "is tetrahedralized block by block to bound the "
+                        "memory.",
+                        "pcd"_a, "alpha"_a, "option"_a)
             .def_static(
                     "create_from_point_cloud_ball_pivoting",
                     &geometry::TriangleMesh::CreateFromPointCloudBallPivoting,
@@ -357,16 +564,38 @@ void pybind_trianglemesh(py::module &m) {
                     "radius over the point cloud, whenever the ball touches "
                     "three points a triangle is created.",
                     "pcd"_a, "radii"_a)
-            .def_static("create_from_point_cloud_poisson",
-                        &geometry::TriangleMesh::CreateFromPointCloudPoisson,
-                        "Function that computes a triangle mesh from a "
-                        "oriented PointCloud pcd. This implements the Screened "
-                        "Poisson Reconstruction proposed in Kazhdan and Hoppe, "
-                        "\"Screened Poisson Surface Reconstruction\", 2013. "
-                        "This function uses the original implementation by "
-                        "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
-                        "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
-                        "linear_fit"_a = false)
+            .def_static(
+                    "create_from_point_cloud_poisson",
+                    [](const geometry::PointCloud &pcd, size_t depth,
+                       size_t width, float scale, bool linear_fit) {
+                        return geometry::TriangleMesh::
+                                CreateFromPointCloudPoisson(pcd, depth, width,
+                                                            scale, linear_fit);
+                    },
+                    "Function that computes a triangle mesh from a "
+                    "oriented PointCloud pcd. This implements the Screened "
+                    "Poisson Reconstruction proposed in Kazhdan and Hoppe, "
+                    "\"Screened Poisson Surface Reconstruction\", 2013. "
+                    "This function uses the original implementation by "
+                    "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
+                    "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
+                    "linear_fit"_a = false)
+            .def_static(
+                    "create_from_point_cloud_poisson",
+                    [](const geometry::PointCloud &pcd,
+                       const geometry::PoissonReconstructionOption &option) {
+                        geometry::PoissonReconstructionTimings timings;
+                        std::shared_ptr<geometry::TriangleMesh> mesh;
+                        std::vector<double> densities;
+                        std::tie(mesh, densities) = geometry::TriangleMesh::
+                                CreateFromPointCloudPoisson(pcd, option,
+                                                            &timings);
+                        return std::make_tuple(mesh, densities, timings);
+                    },
+                    "Screened Poisson Reconstruction with solver and thread "
+                    "options. Returns the mesh, the per vertex densities and "
+                    "the time spent per stage.",
+                    "pcd"_a, "option"_a)
             .def_static("create_box", &geometry::TriangleMesh::CreateBox,
                         "Factory function to create a box. The left bottom "
                         "corner on the "
@@ -618,7 +847,8 @@ void pybind_trianglemesh(py::module &m) {
             m, "TriangleMesh", "simplify_quadric_decimation",
             {{"target_number_of_triangles",
               "The number of triangles that the simplified mesh should have. "
-              "It is not guaranteed that this number will be reached."}});
+              "It is not guaranteed that this number will be reached."},
+             {"option", "Partitioning and topology options."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "compute_convex_hull");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "cluster_connected_triangles");
@@ -669,7 +899,9 @@ void pybind_trianglemesh(py::module &m) {
               "If not None, than uses this to construct the alpha shape. "
               "Otherwise, TetraMesh is computed from pcd."},
              {"pt_map",
-              "Optional map from tetra_mesh vertex indices to pcd points."}});
+              "Optional map from tetra_mesh vertex indices to pcd points."},
+             {"option",
+              "Controls the number of points per tetrahedralized block."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_ball_pivoting",
             {{"pcd",
@@ -698,7 +930,8 @@ void pybind_trianglemesh(py::module &m) {
               "reconstruction and the diameter of the samples' bounding cube."},
              {"linear_fit",
               "If true, the reconstructor use linear interpolation to estimate "
-              "the positions of iso-vertices."}});
+              "the positions of iso-vertices."},
+             {"option", "Reconstruction and solver options."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "create_box",
                                     {{"width", "x-directional length."},
                                      {"height", "y-directional length."},
@@ -0,0 +1,78 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshDeformation.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/geometry/geometry.h"
+
+using namespace open3d;
+
+void pybind_trianglemeshdeformation(py::module &m) {
+    // open3d.geometry.DeformAsRigidAsPossibleSession
+    py::class_<geometry::DeformAsRigidAsPossibleSession,
+               std::shared_ptr<geometry::DeformAsRigidAsPossibleSession>>
+            session(m, "DeformAsRigidAsPossibleSession",
+                    "Repeated As-Rigid-As-Possible deformations of a mesh "
+                    "with a fixed set of constrained vertices. The system is "
+                    "factorized once, and each deformation starts from the "
+                    "result of the previous one.");
+    session.def(py::init<const geometry::TriangleMesh &,
+                         const std::vector<int> &,
+                         geometry::MeshBase::DeformAsRigidAsPossibleEnergy,
+                         double>(),
+                "mesh"_a, "constraint_vertex_indices"_a,
+                "energy"_a = geometry::MeshBase::
+                        DeformAsRigidAsPossibleEnergy::Spokes,
+                "smoothed_alpha"_a = 0.01)
+            .def("__repr__",
+                 [](const geometry::DeformAsRigidAsPossibleSession &s) {
+                     return std::string(
+                             "geometry::DeformAsRigidAsPossibleSession");
+                 })
+            .def("deform", &geometry::DeformAsRigidAsPossibleSession::Deform,
+                 "Function to deform the mesh towards new constraint "
+                 "positions.",
+                 "constraint_vertex_positions"_a, "max_iter"_a)
+            .def("reset", &geometry::DeformAsRigidAsPossibleSession::Reset,
+                 "Function to restart the next deformation from the rest "
+                 "pose.")
+            .def("get_iteration_times",
+                 &geometry::DeformAsRigidAsPossibleSession::GetIterationTimes,
+                 "Returns the time in milliseconds of each iteration of the "
+                 "last deformation.")
+            .def("get_iteration_energies",
+                 &geometry::DeformAsRigidAsPossibleSession::
+                         GetIterationEnergies,
+                 "Returns the energy after each iteration of the last "
+                 "deformation.");
+    docstring::ClassMethodDocInject(
+            m, "DeformAsRigidAsPossibleSession", "deform",
+            {{"constraint_vertex_positions",
+              "Positions of the vertices in constraint_vertex_indices, in the "
+              "same order."},
+             {"max_iter", "Number of iterations."}});
+}
@@ -150,7 +150,7 @@ void pybind_voxelgrid(py::module &m) {
                         "color information is converted. The bounds of the "
                         "created VoxelGrid are computed from the  "
                         "TriangleMesh.",
-                        "input"_a, "voxel_size"_a)
+                        "input"_a, "voxel_size"_a, "fill_interior"_a = false)
             .def_static(
                     "create_from_triangle_mesh_within_bounds",
                     &geometry::VoxelGrid::CreateFromTriangleMeshWithinBounds,
@@ -158,7 +158,8 @@ void pybind_voxelgrid(py::module &m) {
                     "information is converted. The bounds "
                     "of the created VoxelGrid are defined by the given "
                     "parameters",
-                    "input"_a, "voxel_size"_a, "min_bound"_a, "max_bound"_a)
+                    "input"_a, "voxel_size"_a, "min_bound"_a, "max_bound"_a,
+                    "fill_interior"_a = false)
             .def_readwrite("origin", &geometry::VoxelGrid::origin_,
                            "``float64`` vector of length 3: Coorindate of the "
                            "origin point.")
@@ -216,7 +217,9 @@ void pybind_voxelgrid(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "VoxelGrid", "create_from_triangle_mesh",
             {{"input", "The input TriangleMesh"},
-             {"voxel_size", "Voxel size of of the VoxelGrid construction."}});
+             {"voxel_size", "Voxel size of of the VoxelGrid construction."},
+             {"fill_interior",
+              "If true, the voxels enclosed by the mesh are added as well."}});
     docstring::ClassMethodDocInject(
             m, "VoxelGrid", "create_from_triangle_mesh_within_bounds",
             {{"input", "The input TriangleMesh"},
@@ -224,7 +227,11 @@ void pybind_voxelgrid(py::module &m) {
              {"min_bound",
               "Minimum boundary point for the VoxelGrid to create."},
              {"max_bound",
-              "Maximum boundary point for the VoxelGrid to create."}});
+              "Maximum boundary point for the VoxelGrid to create."},
+             {"fill_interior",
+              "If true, the voxels that cannot be reached from the grid "
+              "boundary without crossing the surface are added as well. This "
+              "needs a closed mesh."}});
 }
 
 void pybind_voxelgrid_methods(py::module &m) {}
@@ -29,6 +29,8 @@
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/AsyncImageWriter.h"
 #include "Open3D/IO/ClassIO/FeatureIO.h"
 #include "Open3D/IO/ClassIO/IJsonConvertibleIO.h"
 #include "Open3D/IO/ClassIO/ImageIO.h"
@@ -36,6 +38,8 @@
 #include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "Open3D/IO/ClassIO/PoseGraphIO.h"
+#include "Open3D/IO/ClassIO/RGBDDatasetReader.h"
+#include "Open3D/IO/ClassIO/TensorMapIO.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/IO/ClassIO/VoxelGridIO.h"
 
@@ -65,6 +69,9 @@ static const std::unordered_map<std::string, std::string>
                 {"remove_infinite_points",
                  "If true, all points that include an infinite value are "
                  "removed from the PointCloud."},
+                {"option",
+                 "Format specific settings, e.g. vertex welding for STL "
+                 "files."},
                 {"quality", "Quality of the output file."},
                 {"write_ascii",
                  "Set to ``True`` to output in ascii format, otherwise binary "
@@ -82,6 +89,9 @@ static const std::unordered_map<std::string, std::string>
                 {"line_set", "The ``LineSet`` object for I/O"},
                 {"image", "The ``Image`` object for I/O"},
                 {"voxel_grid", "The ``VoxelGrid`` object for I/O"},
+                {"tensor_map",
+                 "A dict from attribute names to ``Tensor`` objects with one "
+                 "row per point"},
                 {"trajectory",
                  "The ``PinholeCameraTrajectory`` object for I/O"},
                 {"intrinsic", "The ``PinholeCameraIntrinsic`` object for I/O"},
@@ -170,14 +180,27 @@ void pybind_class_io(py::module &m_io) {
                                  map_shared_argument_docstrings);
 
     // open3d::geometry::TriangleMesh
+    // open3d.io.ReadTriangleMeshOption
+    py::class_<io::ReadTriangleMeshOption> read_triangle_mesh_option(
+            m_io, "ReadTriangleMeshOption",
+            "Format specific settings for reading a TriangleMesh.");
+    read_triangle_mesh_option
+            .def(py::init<bool>(), "weld_vertices"_a = false)
+            .def_readwrite("weld_vertices",
+                           &io::ReadTriangleMeshOption::weld_vertices_,
+                           "Merge STL vertices with equal coordinates while "
+                           "loading.");
+
     m_io.def("read_triangle_mesh",
-             [](const std::string &filename, bool print_progress) {
+             [](const std::string &filename, bool print_progress,
+                const io::ReadTriangleMeshOption &option) {
                  geometry::TriangleMesh mesh;
-                 io::ReadTriangleMesh(filename, mesh, print_progress);
+                 io::ReadTriangleMesh(filename, mesh, option, print_progress);
                  return mesh;
              },
              "Function to read TriangleMesh from file", "filename"_a,
-             "print_progress"_a = false);
+             "print_progress"_a = false,
+             "option"_a = io::ReadTriangleMeshOption());
     docstring::FunctionDocInject(m_io, "read_triangle_mesh",
                                  map_shared_argument_docstrings);
 
@@ -224,6 +247,36 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "write_voxel_grid",
                                  map_shared_argument_docstrings);
 
+    // open3d::io::TensorMap
+    m_io.def("read_tensor_map",
+             [](const std::string &filename, const std::string &format,
+                bool print_progress) {
+                 py::gil_scoped_release release;
+                 io::TensorMap tensor_map;
+                 io::ReadTensorMap(filename, tensor_map, format,
+                                   print_progress);
+                 return tensor_map;
+             },
+             "Function to read every vertex property of a PLY or PCD file "
+             "into a dict of Tensor in its own dtype. Use ``to_dlpack`` to "
+             "hand the tensors to other frameworks without copying.",
+             "filename"_a, "format"_a = "auto", "print_progress"_a = false);
+    docstring::FunctionDocInject(m_io, "read_tensor_map",
+                                 map_shared_argument_docstrings);
+
+    m_io.def("write_tensor_map",
+             [](const std::string &filename, const io::TensorMap &tensor_map,
+                bool write_ascii, bool compressed, bool print_progress) {
+                 py::gil_scoped_release release;
+                 return io::WriteTensorMap(filename, tensor_map, write_ascii,
+                                           compressed, print_progress);
+             },
+             "Function to write a dict of Tensor to a PLY or PCD file",
+             "filename"_a, "tensor_map"_a, "write_ascii"_a = false,
+             "compressed"_a = false, "print_progress"_a = false);
+    docstring::FunctionDocInject(m_io, "write_tensor_map",
+                                 map_shared_argument_docstrings);
+
     // open3d::camera
     m_io.def("read_pinhole_camera_intrinsic",
              [](const std::string &filename) {
@@ -327,6 +380,219 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "write_pose_graph",
                                  map_shared_argument_docstrings);
 
+    // open3d.io.RGBDDatasetFrame
+    py::class_<io::RGBDDatasetFrame> rgbd_dataset_frame(
+            m_io, "RGBDDatasetFrame", "Frame handed out by RGBDDatasetReader.");
+    rgbd_dataset_frame
+            .def_readonly("index", &io::RGBDDatasetFrame::index_,
+                          "Index of the frame in the file lists.")
+            .def_readonly("rgbd", &io::RGBDDatasetFrame::rgbd_,
+                          "The decoded frame, or None if a file could not be "
+                          "read.")
+            .def_property_readonly(
+                    "camera",
+                    [](const io::RGBDDatasetFrame &frame) -> py::object {
+                        if (!frame.camera_) return py::none();
+                        return py::cast(*frame.camera_);
+                    },
+                    "Camera of the frame if the reader was created with a "
+                    "trajectory, otherwise None.");
+
+    // open3d.io.RGBDDatasetReaderStatistics
+    py::class_<io::RGBDDatasetReaderStatistics> rgbd_dataset_statistics(
+            m_io, "RGBDDatasetReaderStatistics",
+            "Throughput and stall counters of an RGBDDatasetReader.");
+    rgbd_dataset_statistics
+            .def_readonly("num_decoded",
+                          &io::RGBDDatasetReaderStatistics::num_decoded_,
+                          "Number of frames decoded so far.")
+            .def_readonly("decode_seconds",
+                          &io::RGBDDatasetReaderStatistics::decode_seconds_,
+                          "Time spent decoding, summed over the worker "
+                          "threads, in seconds.")
+            .def_readonly("decode_throughput",
+                          &io::RGBDDatasetReaderStatistics::decode_throughput_,
+                          "Decoded frames per second.")
+            .def_readonly(
+                    "num_consumer_stalls",
+                    &io::RGBDDatasetReaderStatistics::num_consumer_stalls_,
+                    "Number of next_frame calls that waited for a frame.")
+            .def_readonly(
+                    "consumer_stall_seconds",
+                    &io::RGBDDatasetReaderStatistics::consumer_stall_seconds_,
+                    "Time next_frame spent waiting, in seconds.")
+            .def_readonly(
+                    "num_producer_stalls",
+                    &io::RGBDDatasetReaderStatistics::num_producer_stalls_,
+                    "Number of times a worker waited for a full queue.");
+
+    // open3d.io.RGBDDatasetReader
+    py::class_<io::RGBDDatasetReader> rgbd_dataset_reader(
+            m_io, "RGBDDatasetReader",
+            "Reads a sequence of color and depth images, decoding them on "
+            "background threads into a bounded queue.");
+    auto next_frame = [](io::RGBDDatasetReader &reader) {
+        io::RGBDDatasetFrame frame;
+        bool success;
+        {
+            py::gil_scoped_release release;
+            success = reader.NextFrame(frame);
+        }
+        return std::make_pair(success, frame);
+    };
+    rgbd_dataset_reader
+            .def(py::init<const std::vector<std::string> &,
+                          const std::vector<std::string> &, double, double,
+                          bool, size_t, int>(),
+                 "color_filenames"_a, "depth_filenames"_a,
+                 "depth_scale"_a = 1000.0, "depth_trunc"_a = 3.0,
+                 "convert_rgb_to_intensity"_a = true, "queue_size"_a = 8,
+                 "num_threads"_a = 0)
+            .def(py::init<const std::vector<std::string> &,
+                          const std::vector<std::string> &,
+                          const camera::PinholeCameraTrajectory &, double,
+                          double, bool, size_t, int>(),
+                 "color_filenames"_a, "depth_filenames"_a, "trajectory"_a,
+                 "depth_scale"_a = 1000.0, "depth_trunc"_a = 3.0,
+                 "convert_rgb_to_intensity"_a = true, "queue_size"_a = 8,
+                 "num_threads"_a = 0)
+            .def("next_frame",
+                 [next_frame](io::RGBDDatasetReader &reader) -> py::object {
+                     auto result = next_frame(reader);
+                     if (!result.first) return py::none();
+                     return py::cast(result.second);
+                 },
+                 "Returns the next frame, waiting until it is decoded, or "
+                 "None once all frames have been handed out.")
+            .def("__iter__", [](py::object reader) { return reader; })
+            .def("__next__",
+                 [next_frame](io::RGBDDatasetReader &reader) {
+                     auto result = next_frame(reader);
+                     if (!result.first) throw py::stop_iteration();
+                     return result.second;
+                 })
+            .def("__len__", &io::RGBDDatasetReader::NumFrames)
+            .def("num_frames", &io::RGBDDatasetReader::NumFrames,
+                 "Returns the number of frames.")
+            .def("get_statistics", &io::RGBDDatasetReader::GetStatistics,
+                 "Returns the throughput and stall counters.");
+
+    // open3d.io.PNGWriteOption
+    py::class_<io::PNGWriteOption> png_write_option(
+            m_io, "PNGWriteOption",
+            "Lossless compression settings for writing PNG files.");
+    py::enum_<io::PNGWriteOption::Filter>(png_write_option, "Filter",
+                                          "Row filter applied before "
+                                          "compression.")
+            .value("Adaptive", io::PNGWriteOption::Filter::Adaptive)
+            // None is a Python keyword.
+            .value("NoFilter", io::PNGWriteOption::Filter::None)
+            .value("Sub", io::PNGWriteOption::Filter::Sub)
+            .value("Up", io::PNGWriteOption::Filter::Up)
+            .value("Average", io::PNGWriteOption::Filter::Average)
+            .value("Paeth", io::PNGWriteOption::Filter::Paeth)
+            .export_values();
+    py::enum_<io::PNGWriteOption::Strategy>(png_write_option, "Strategy",
+                                            "zlib compression strategy.")
+            .value("Default", io::PNGWriteOption::Strategy::Default)
+            .value("Filtered", io::PNGWriteOption::Strategy::Filtered)
+            .value("HuffmanOnly", io::PNGWriteOption::Strategy::HuffmanOnly)
+            .value("RLE", io::PNGWriteOption::Strategy::RLE)
+            .export_values();
+    png_write_option
+            .def(py::init<int, io::PNGWriteOption::Filter,
+                          io::PNGWriteOption::Strategy>(),
+                 "compression_level"_a = -1,
+                 "filter"_a = io::PNGWriteOption::Filter::Adaptive,
+                 "strategy"_a = io::PNGWriteOption::Strategy::Default)
+            .def_static("fast_depth", &io::PNGWriteOption::FastDepth,
+                        "Fast lossless settings for 16-bit depth images.")
+            .def_readwrite("compression_level",
+                           &io::PNGWriteOption::compression_level_,
+                           "zlib level from 0 to 9, or -1 for the default.")
+            .def_readwrite("filter", &io::PNGWriteOption::filter_,
+                           "Row filter.")
+            .def_readwrite("strategy", &io::PNGWriteOption::strategy_,
+                           "zlib compression strategy.");
+
+    m_io.def("write_image_to_png",
+             [](const std::string &filename, const geometry::Image &image,
+                const io::PNGWriteOption &option) {
+                 py::gil_scoped_release release;
+                 return io::WriteImageToPNG(filename, image, option);
+             },
+             "Function to write Image to a PNG file with the given "
+             "compression settings",
+             "filename"_a, "image"_a, "option"_a = io::PNGWriteOption());
+    docstring::FunctionDocInject(m_io, "write_image_to_png",
+                                 map_shared_argument_docstrings);
+
+    // open3d.io.AsyncImageWriterStatistics
+    py::class_<io::AsyncImageWriterStatistics> async_image_writer_statistics(
+            m_io, "AsyncImageWriterStatistics",
+            "Throughput and stall counters of an AsyncImageWriter.");
+    async_image_writer_statistics
+            .def_readonly("num_written",
+                          &io::AsyncImageWriterStatistics::num_written_,
+                          "Number of images written so far.")
+            .def_readonly("num_failed",
+                          &io::AsyncImageWriterStatistics::num_failed_,
+                          "Number of images that could not be written.")
+            .def_readonly("encode_seconds",
+                          &io::AsyncImageWriterStatistics::encode_seconds_,
+                          "Time spent encoding and writing, summed over the "
+                          "worker threads, in seconds.")
+            .def_readonly("frames_per_second",
+                          &io::AsyncImageWriterStatistics::frames_per_second_,
+                          "Written images per second.")
+            .def_readonly(
+                    "num_producer_stalls",
+                    &io::AsyncImageWriterStatistics::num_producer_stalls_,
+                    "Number of write_image calls that waited for a full "
+                    "queue.")
+            .def_readonly(
+                    "producer_stall_seconds",
+                    &io::AsyncImageWriterStatistics::producer_stall_seconds_,
+                    "Time write_image spent waiting, in seconds.");
+
+    // open3d.io.AsyncImageWriter
+    py::class_<io::AsyncImageWriter> async_image_writer(
+            m_io, "AsyncImageWriter",
+            "Writes images on background threads from a bounded queue.");
+    async_image_writer
+            .def(py::init<size_t, int, const io::PNGWriteOption &, int>(),
+                 "queue_size"_a = 16, "num_threads"_a = 0,
+                 "png_option"_a = io::PNGWriteOption(),
+                 "jpeg_quality"_a = 90)
+            .def("write_image",
+                 [](io::AsyncImageWriter &writer, const std::string &filename,
+                    std::shared_ptr<geometry::Image> image) {
+                     py::gil_scoped_release release;
+                     writer.WriteImage(filename, image);
+                 },
+                 "Queues an image to be written in the format given by the "
+                 "file extension. The image must not be modified until it "
+                 "has been written.",
+                 "filename"_a, "image"_a)
+            .def("write_image",
+                 [](io::AsyncImageWriter &writer, const std::string &filename,
+                    std::shared_ptr<geometry::Image> image,
+                    const io::PNGWriteOption &png_option) {
+                     py::gil_scoped_release release;
+                     writer.WriteImage(filename, image, png_option);
+                 },
+                 "Queues an image with PNG settings that override the "
+                 "settings of the writer.",
+                 "filename"_a, "image"_a, "png_option"_a)
+            .def("flush",
+                 [](io::AsyncImageWriter &writer) {
+                     py::gil_scoped_release release;
+                     writer.Flush();
+                 },
+                 "Waits until all queued images have been written.")
+            .def("get_statistics", &io::AsyncImageWriter::GetStatistics,
+                 "Returns the throughput and stall counters.");
+
 #ifdef BUILD_AZURE_KINECT
     m_io.def("read_azure_kinect_sensor_config",
              [](const std::string &filename) {
@@ -26,6 +26,8 @@
 
 #include "Open3D/Registration/Feature.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/FeatureMatching.h"
+#include "Open3D/Utility/Console.h"
 
 #include "open3d_pybind/docstring.h"
 #include "open3d_pybind/registration/registration.h"
@@ -60,6 +62,37 @@ void pybind_feature(py::module &m) {
     docstring::ClassMethodDocInject(m, "Feature", "resize",
                                     {{"dim", "Feature dimension per point."},
                                      {"n", "Number of points."}});
+
+    // open3d.registration.FeatureMatchingOption
+    py::class_<registration::FeatureMatchingOption> matching_option(
+            m, "FeatureMatchingOption",
+            "Options for approximate feature matching.");
+    py::detail::bind_copy_functions<registration::FeatureMatchingOption>(
+            matching_option);
+    matching_option
+            .def(py::init([](int num_trees, int checks, bool mutual_filter) {
+                     return new registration::FeatureMatchingOption(
+                             num_trees, checks, mutual_filter);
+                 }),
+                 "num_trees"_a = 4, "checks"_a = 128, "mutual_filter"_a = false)
+            .def_readwrite("num_trees",
+                           &registration::FeatureMatchingOption::num_trees_,
+                           "int: Number of randomized KD-trees in the forest.")
+            .def_readwrite("checks",
+                           &registration::FeatureMatchingOption::checks_,
+                           "int: Number of leaves visited per query, -1 for "
+                           "exact search.")
+            .def_readwrite(
+                    "mutual_filter",
+                    &registration::FeatureMatchingOption::mutual_filter_,
+                    "bool: Keep only mutual nearest neighbor "
+                    "correspondences.")
+            .def("__repr__", [](const registration::FeatureMatchingOption &c) {
+                return fmt::format(
+                        "registration::FeatureMatchingOption class with "
+                        "\nnum_trees={}\nchecks={}\nmutual_filter={}",
+                        c.num_trees_, c.checks_, c.mutual_filter_);
+            });
 }
 
 void pybind_feature_methods(py::module &m) {
@@ -70,4 +103,16 @@ void pybind_feature_methods(py::module &m) {
             m, "compute_fpfh_feature",
             {{"input", "The Input point cloud."},
              {"search_param", "KDTree KNN search parameter."}});
+
+    m.def("compute_feature_correspondences",
+          &registration::ComputeFeatureCorrespondences,
+          "Function to compute correspondences between two feature sets by "
+          "approximate nearest neighbor matching",
+          "source_feature"_a, "target_feature"_a,
+          "option"_a = registration::FeatureMatchingOption());
+    docstring::FunctionDocInject(
+            m, "compute_feature_correspondences",
+            {{"source_feature", "Source point cloud feature."},
+             {"target_feature", "Target point cloud feature."},
+             {"option", "Feature matching options."}});
 }
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudLOD.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/IO/ClassIO/IJsonConvertibleIO.h"
 #include "Open3D/Utility/FileSystem.h"
@@ -99,8 +100,11 @@ static const std::unordered_map<std::string, std::string>
                 {"height", "The height of the visualization window."},
                 {"key_to_callback", "Map of key to call back functions."},
                 {"left", "The left margin of the visualization window."},
+                {"lod", "The level of detail hierarchy to be visualized."},
                 {"optional_view_trajectory_json_file",
                  "Camera trajectory json file path for custom animation."},
+                {"point_budget",
+                 "Maximum number of points selected for a view."},
                 {"top", "The top margin of the visualization window."},
                 {"width", "The width of the visualization window."},
                 {"point_show_normal",
@@ -231,6 +235,20 @@ void pybind_visualization_utility_methods(py::module &m) {
     docstring::FunctionDocInject(m, "draw_geometries_with_vertex_selection",
                                  map_shared_argument_docstrings);
 
+    m.def("draw_point_cloud_lod",
+          [](std::shared_ptr<const geometry::PointCloudLOD> lod,
+             size_t point_budget, const std::string &window_name, int width,
+             int height, int left, int top) {
+              visualization::DrawPointCloudLOD(lod, point_budget, window_name,
+                                               width, height, left, top);
+          },
+          "Function to draw a geometry::PointCloudLOD, streaming the points "
+          "selected for the current view within a point budget",
+          "lod"_a, "point_budget"_a = 3000000, "window_name"_a = "Open3D",
+          "width"_a = 1920, "height"_a = 1080, "left"_a = 50, "top"_a = 50);
+    docstring::FunctionDocInject(m, "draw_point_cloud_lod",
+                                 map_shared_argument_docstrings);
+
     m.def("read_selection_polygon_volume",
           [](const std::string &filename) {
               visualization::SelectionPolygonVolume vol;
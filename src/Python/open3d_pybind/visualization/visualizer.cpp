@@ -44,6 +44,7 @@ static const std::unordered_map<std::string, std::string>
                  "Scale depth value when capturing the depth image."},
                 {"do_render", "Set to ``True`` to do render."},
                 {"filename", "Path to file."},
+                {"change", "The changed points of the geometry."},
                 {"geometry", "The ``Geometry`` object."},
                 {"height", "Height of window."},
                 {"left", "Left margin of the window to the screen."},
@@ -57,6 +58,30 @@ static const std::unordered_map<std::string, std::string>
                  "Set to ``False`` to keep current viewpoint"}};
 
 void pybind_visualizer(py::module &m) {
+    py::class_<visualization::GeometryChange> geometry_change(
+            m, "GeometryChange",
+            "Describes which points of a geometry changed since it was last "
+            "rendered. The default constructor marks all points.");
+    py::detail::bind_default_constructor<visualization::GeometryChange>(
+            geometry_change);
+    py::detail::bind_copy_functions<visualization::GeometryChange>(
+            geometry_change);
+    geometry_change
+            .def_static("appended", &visualization::GeometryChange::Appended,
+                        "Points from ``begin`` to the end were appended or "
+                        "changed.",
+                        "begin"_a)
+            .def_static("modified", &visualization::GeometryChange::Modified,
+                        "The points in ``indices`` changed.", "indices"_a)
+            .def("is_all", &visualization::GeometryChange::IsAll,
+                 "Returns ``True`` if all points are marked as changed.")
+            .def("merge", &visualization::GeometryChange::Merge,
+                 "Adds the points marked in ``other``.", "other"_a)
+            .def("__repr__", [](const visualization::GeometryChange &c) {
+                return std::string("GeometryChange of ") +
+                       (c.IsAll() ? "all points" : "some points");
+            });
+
     py::class_<visualization::Visualizer, PyVisualizer<>,
                std::shared_ptr<visualization::Visualizer>>
             visualizer(m, "Visualizer", "The main Visualizer class.");
@@ -95,6 +120,11 @@ void pybind_visualizer(py::module &m) {
                  "when geometry has been changed. Otherwise the behavior of "
                  "Visualizer is undefined.",
                  "geometry"_a)
+            .def("notify_geometry_change",
+                 &visualization::Visualizer::NotifyGeometryChange,
+                 "Function to update part of a geometry. Only the changed "
+                 "points are uploaded where the renderer supports it.",
+                 "geometry"_a, "change"_a)
             .def("update_renderer", &visualization::Visualizer::UpdateRender,
                  "Function to inform render needed to be updated")
             .def("poll_events", &visualization::Visualizer::PollEvents,
@@ -261,6 +291,8 @@ void pybind_visualizer(py::module &m) {
                                     map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "get_window_name",
                                     map_visualizer_docstrings);
+    docstring::ClassMethodDocInject(m, "Visualizer", "notify_geometry_change",
+                                    map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "poll_events",
                                     map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer",
@@ -0,0 +1,233 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <string>
+
+#include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/ColorMap/ColorMapOptimization.h"
+#include "Open3D/ColorMap/KeyframeProvider.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+const int kWidth = 80;
+const int kHeight = 60;
+
+// Cameras on a circle around a unit sphere, all looking at the origin.
+camera::PinholeCameraTrajectory CreateCameras(int n_camera) {
+    camera::PinholeCameraTrajectory camera;
+    camera.parameters_.resize(n_camera);
+    for (int c = 0; c < n_camera; c++) {
+        double angle = 2.0 * M_PI * c / n_camera;
+        Eigen::Vector3d position(2.0 * cos(angle), 0.3, 2.0 * sin(angle));
+        Eigen::Vector3d z = -position.normalized();
+        Eigen::Vector3d x = z.cross(Eigen::Vector3d(0, 1, 0)).normalized();
+        Eigen::Vector3d y = z.cross(x);
+        Eigen::Matrix3d R;
+        R.row(0) = x;
+        R.row(1) = y;
+        R.row(2) = z;
+        Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+        extrinsic.block<3, 3>(0, 0) = R;
+        extrinsic.block<3, 1>(0, 3) = -R * position;
+        camera.parameters_[c].extrinsic_ = extrinsic;
+        camera.parameters_[c].intrinsic_.SetIntrinsics(
+                kWidth, kHeight, 60.0, 60.0, (kWidth - 1) / 2.0,
+                (kHeight - 1) / 2.0);
+    }
+    return camera;
+}
+
+// Ray casts the unit sphere, textured with sine stripes, into a color image
+// and a 16-bit depth image in millimeters.
+void RenderSphere(const camera::PinholeCameraParameters& param,
+                  geometry::Image& color,
+                  geometry::Image& depth) {
+    color.Prepare(kWidth, kHeight, 3, 1);
+    depth.Prepare(kWidth, kHeight, 1, 2);
+    Eigen::Matrix3d R = param.extrinsic_.block<3, 3>(0, 0);
+    Eigen::Vector3d origin =
+            -R.transpose() * param.extrinsic_.block<3, 1>(0, 3);
+    auto f = param.intrinsic_.GetFocalLength();
+    auto p = param.intrinsic_.GetPrincipalPoint();
+    for (int v = 0; v < kHeight; v++) {
+        for (int u = 0; u < kWidth; u++) {
+            Eigen::Vector3d dir = R.transpose() *
+                                  Eigen::Vector3d((u - p.first) / f.first,
+                                                  (v - p.second) / f.second, 1);
+            double b = origin.dot(dir);
+            double a = dir.squaredNorm();
+            double disc = b * b - a * (origin.squaredNorm() - 1.0);
+            uint8_t* rgb = color.PointerAt<uint8_t>(u, v, 0);
+            uint16_t* d = depth.PointerAt<uint16_t>(u, v);
+            if (disc < 0) {
+                rgb[0] = rgb[1] = rgb[2] = 0;
+                *d = 0;
+                continue;
+            }
+            double t = (-b - sqrt(disc)) / a;
+            Eigen::Vector3d q = origin + t * dir;
+            for (int k = 0; k < 3; k++) {
+                rgb[k] = uint8_t(128 + 100 * sin(8 * q(k)));
+            }
+            *d = uint16_t(std::round(t * 1000.0));
+        }
+    }
+}
+
+}  // unnamed namespace
+
+TEST(KeyframeGradientCache, EvictsLeastRecentlyUsed) {
+    auto camera = CreateCameras(3);
+    vector<shared_ptr<geometry::RGBDImage>> images;
+    for (const auto& param : camera.parameters_) {
+        geometry::Image color, depth;
+        RenderSphere(param, color, depth);
+        images.push_back(geometry::RGBDImage::CreateFromColorAndDepth(
+                color, depth, 1000.0, 3.0, false));
+    }
+    color_map::InMemoryKeyframeProvider provider(images);
+    size_t entry_bytes = size_t(kWidth) * kHeight * 4 * 3;
+
+    color_map::KeyframeGradientCache cache(provider, 2 * entry_bytes);
+    auto g0 = cache.GetGradients(0);
+    EXPECT_EQ(entry_bytes, g0->ByteSize());
+    cache.GetGradients(1);
+    EXPECT_EQ(g0, cache.GetGradients(0));
+    EXPECT_EQ(2u, cache.GetNumLoads());
+    // Keyframe 1 is the least recently used one and gets evicted.
+    cache.GetGradients(2);
+    EXPECT_EQ(3u, cache.GetNumLoads());
+    EXPECT_EQ(2 * entry_bytes, cache.GetResidentBytes());
+    EXPECT_EQ(g0, cache.GetGradients(0));
+    EXPECT_EQ(3u, cache.GetNumLoads());
+    cache.GetGradients(1);
+    EXPECT_EQ(4u, cache.GetNumLoads());
+
+    // Gradients are identical to the ones computed directly.
+    auto expected =
+            color_map::KeyframeGradients::CreateFromRGBDImage(*images[0]);
+    EXPECT_EQ(expected->gray_->data_, g0->gray_->data_);
+    EXPECT_EQ(expected->dx_->data_, g0->dx_->data_);
+    EXPECT_EQ(expected->dy_->data_, g0->dy_->data_);
+}
+
+TEST(KeyframeProvider, StreamingMatchesInMemory) {
+    const int n_camera = 6;
+    auto camera = CreateCameras(n_camera);
+    vector<string> color_files, depth_files;
+    for (int c = 0; c < n_camera; c++) {
+        geometry::Image color, depth;
+        RenderSphere(camera.parameters_[c], color, depth);
+        color_files.push_back("tmp_keyframe_color_" + to_string(c) + ".png");
+        depth_files.push_back("tmp_keyframe_depth_" + to_string(c) + ".png");
+        ASSERT_TRUE(io::WriteImage(color_files.back(), color));
+        ASSERT_TRUE(io::WriteImage(depth_files.back(), depth));
+    }
+    // Start the optimization from slightly perturbed poses.
+    for (int c = 0; c < n_camera; c++) {
+        Eigen::Matrix4d delta = Eigen::Matrix4d::Identity();
+        delta.block<3, 3>(0, 0) =
+                Eigen::AngleAxisd(0.01 * (c + 1), Eigen::Vector3d::UnitY())
+                        .toRotationMatrix();
+        camera.parameters_[c].extrinsic_ =
+                delta * camera.parameters_[c].extrinsic_;
+    }
+
+    color_map::RGBDImageFileKeyframeProvider provider(color_files,
+                                                      depth_files);
+    ASSERT_EQ(size_t(n_camera), provider.NumKeyframes());
+    vector<shared_ptr<geometry::RGBDImage>> images;
+    for (int c = 0; c < n_camera; c++) {
+        images.push_back(provider.LoadKeyframe(c));
+    }
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+
+    for (bool non_rigid : {false, true}) {
+        color_map::ColorMapOptimizationOption option;
+        option.non_rigid_camera_coordinate_ = non_rigid;
+        option.number_of_vertical_anchors_ = 4;
+        option.maximum_iteration_ = 5;
+        // The sphere is steep at this resolution; keep its depth edges.
+        option.depth_threshold_for_discontinuity_check_ = 1.0;
+
+        geometry::TriangleMesh mesh_ref = *sphere;
+        auto camera_ref = camera;
+        option.keyframe_batch_size_ = 0;
+        option.keyframe_cache_size_mb_ = 0.0;
+        color_map::ColorMapOptimization(mesh_ref, images, camera_ref, option);
+
+        // Batches of two keyframes with room for a single cached entry.
+        geometry::TriangleMesh mesh = *sphere;
+        auto camera_streamed = camera;
+        option.keyframe_batch_size_ = 2;
+        option.keyframe_cache_size_mb_ = 0.1;
+        color_map::ColorMapOptimization(mesh, provider, camera_streamed,
+                                        option);
+
+        EXPECT_FALSE(camera_ref.parameters_[0].extrinsic_ ==
+                     camera.parameters_[0].extrinsic_);
+        for (int c = 0; c < n_camera; c++) {
+            EXPECT_TRUE(camera_ref.parameters_[c].extrinsic_ ==
+                        camera_streamed.parameters_[c].extrinsic_);
+        }
+        ASSERT_EQ(mesh_ref.vertex_colors_.size(), mesh.vertex_colors_.size());
+        EXPECT_TRUE(mesh_ref.vertex_colors_ == mesh.vertex_colors_);
+        EXPECT_GT(mesh.vertex_colors_[0].norm(), 0.0);
+    }
+
+    for (int c = 0; c < n_camera; c++) {
+        std::remove(color_files[c].c_str());
+        std::remove(depth_files[c].c_str());
+    }
+}
+
+TEST(KeyframeProvider, GetKeyframeSizeFromHeader) {
+    // The sizes of PNG and JPEG files are read without decoding them.
+    const string data_dir = string(TEST_DATA_DIR);
+    vector<string> color_files = {data_dir + "/RGBD/color/00000.jpg",
+                                  data_dir + "/depth.png",
+                                  data_dir + "/lena_color.jpg"};
+    color_map::RGBDImageFileKeyframeProvider provider(color_files,
+                                                      color_files);
+    for (size_t i = 0; i < color_files.size(); i++) {
+        geometry::Image image;
+        ASSERT_TRUE(io::ReadImage(color_files[i], image));
+        int width = 0, height = 0;
+        provider.GetKeyframeSize(i, width, height);
+        EXPECT_EQ(image.width_, width);
+        EXPECT_EQ(image.height_, height);
+    }
+}
@@ -0,0 +1,145 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/ColorMap/TriangleMeshAndImageUtilities.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+// Appends an n x n grid of vertices in the plane z = depth, centered at the
+// origin with the given spacing, triangulated into quads.
+void AddGrid(geometry::TriangleMesh& mesh, int n, double step, double depth) {
+    int base = int(mesh.vertices_.size());
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            mesh.vertices_.push_back(Eigen::Vector3d((i - (n - 1) / 2.0) * step,
+                                                     (j - (n - 1) / 2.0) * step,
+                                                     depth));
+        }
+    }
+    for (int j = 0; j + 1 < n; j++) {
+        for (int i = 0; i + 1 < n; i++) {
+            int v = base + j * n + i;
+            mesh.triangles_.push_back(Eigen::Vector3i(v, v + 1, v + n));
+            mesh.triangles_.push_back(Eigen::Vector3i(v + 1, v + n + 1, v + n));
+        }
+    }
+}
+
+shared_ptr<geometry::Image> CreateConstantImage(int width,
+                                                int height,
+                                                int bytes_per_channel,
+                                                float value) {
+    auto image = make_shared<geometry::Image>();
+    image->Prepare(width, height, 1, bytes_per_channel);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            if (bytes_per_channel == 4) {
+                *image->PointerAt<float>(u, v) = value;
+            } else {
+                *image->PointerAt<uint8_t>(u, v) = uint8_t(value);
+            }
+        }
+    }
+    return image;
+}
+
+}  // unnamed namespace
+
+TEST(TriangleMeshAndImageUtilities, CreateVertexAndImageVisibility) {
+    // A small plane at z = 1 in front of a larger plane at z = 2. Camera 0
+    // sees depth 2 everywhere, camera 1 sees depth 1 everywhere.
+    geometry::TriangleMesh mesh;
+    AddGrid(mesh, 20, 0.1, 2.0);
+    AddGrid(mesh, 6, 0.1, 1.0);
+    const int n_back = 400;
+
+    const int width = 64;
+    const int height = 64;
+    camera::PinholeCameraTrajectory camera;
+    camera.parameters_.resize(2);
+    for (auto& param : camera.parameters_) {
+        param.intrinsic_.SetIntrinsics(width, height, 64.0, 64.0, 31.5, 31.5);
+        param.extrinsic_ = Eigen::Matrix4d::Identity();
+    }
+    vector<shared_ptr<geometry::Image>> depths = {
+            CreateConstantImage(width, height, 4, 2.0f),
+            CreateConstantImage(width, height, 4, 1.0f)};
+    vector<shared_ptr<geometry::Image>> masks = {
+            CreateConstantImage(width, height, 1, 0),
+            CreateConstantImage(width, height, 1, 0)};
+
+    for (bool use_zbuffer : {false, true}) {
+        color_map::VisibilityCSR vertex_to_image, image_to_vertex;
+        tie(vertex_to_image, image_to_vertex) =
+                color_map::CreateVertexAndImageVisibility(
+                        mesh, depths, masks, camera, 2.5, 0.03, use_zbuffer);
+        ASSERT_EQ(2u, image_to_vertex.NumRows());
+        ASSERT_EQ(mesh.vertices_.size(), vertex_to_image.NumRows());
+        EXPECT_EQ(image_to_vertex.indices_.size(),
+                  vertex_to_image.indices_.size());
+
+        // Camera 0 sees the back plane except, with the z-buffer, the
+        // 10 x 10 vertices hidden behind the front plane.
+        vector<int> expected0;
+        for (int v = 0; v < n_back; v++) {
+            double x = mesh.vertices_[v](0), y = mesh.vertices_[v](1);
+            if (!use_zbuffer || std::abs(x) > 0.5 || std::abs(y) > 0.5) {
+                expected0.push_back(v);
+            }
+        }
+        vector<int> expected1;
+        for (int v = n_back; v < int(mesh.vertices_.size()); v++) {
+            expected1.push_back(v);
+        }
+        ExpectEQ(expected0, vector<int>(image_to_vertex.RowBegin(0),
+                                        image_to_vertex.RowEnd(0)));
+        ExpectEQ(expected1, vector<int>(image_to_vertex.RowBegin(1),
+                                        image_to_vertex.RowEnd(1)));
+
+        // The vertex-to-image relation is the exact transpose.
+        for (size_t v = 0; v < vertex_to_image.NumRows(); v++) {
+            vector<int> expected;
+            for (int c = 0; c < 2; c++) {
+                if (std::binary_search(image_to_vertex.RowBegin(c),
+                                       image_to_vertex.RowEnd(c), int(v))) {
+                    expected.push_back(c);
+                }
+            }
+            ExpectEQ(expected, vector<int>(vertex_to_image.RowBegin(v),
+                                           vertex_to_image.RowEnd(v)));
+        }
+    }
+}
@@ -25,6 +25,9 @@
 // ----------------------------------------------------------------------------
 
 #include <algorithm>
+#include <map>
+#include <numeric>
+#include <tuple>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/BoundingVolume.h"
@@ -527,6 +530,109 @@ TEST(PointCloud, VoxelDownSample) {
     ExpectEQ(ref_colors, output_pc->colors_);
 }
 
+TEST(PointCloud, VoxelDownSampleMatchesReference) {
+    size_t size = 5000;
+    geometry::PointCloud pc;
+    pc.points_.resize(size);
+    pc.normals_.resize(size);
+    pc.colors_.resize(size);
+    Rand(pc.points_, Zero3d, Vector3d(10.0, 10.0, 10.0), 0);
+    Rand(pc.normals_, Zero3d, Vector3d(1.0, 1.0, 1.0), 0);
+    Rand(pc.colors_, Zero3d, Vector3d(1.0, 1.0, 1.0), 0);
+
+    // Voxels are expected in (z, y, x) order, with their points accumulated
+    // in the original order.
+    double voxel_size = 0.7;
+    Vector3d min_bound =
+            pc.GetMinBound() - Vector3d::Constant(voxel_size * 0.5);
+    map<tuple<int, int, int>, vector<size_t>> voxels;
+    for (size_t i = 0; i < size; i++) {
+        Vector3d ref_coord = (pc.points_[i] - min_bound) / voxel_size;
+        voxels[make_tuple(int(floor(ref_coord(2))), int(floor(ref_coord(1))),
+                          int(floor(ref_coord(0))))]
+                .push_back(i);
+    }
+
+    auto output_pc = pc.VoxelDownSample(voxel_size);
+    ASSERT_EQ(voxels.size(), output_pc->points_.size());
+    ASSERT_EQ(voxels.size(), output_pc->normals_.size());
+    ASSERT_EQ(voxels.size(), output_pc->colors_.size());
+    size_t k = 0;
+    for (const auto &voxel : voxels) {
+        Vector3d point = Zero3d, normal = Zero3d, color = Zero3d;
+        for (size_t i : voxel.second) {
+            point += pc.points_[i];
+            normal += pc.normals_[i];
+            color += pc.colors_[i];
+        }
+        double num = double(voxel.second.size());
+        EXPECT_EQ(point / num, output_pc->points_[k]);
+        EXPECT_EQ(normal.normalized(), output_pc->normals_[k]);
+        EXPECT_EQ(color / num, output_pc->colors_[k]);
+        k++;
+    }
+}
+
+TEST(PointCloud, VoxelDownSampleAndTrace) {
+    size_t size = 5000;
+    geometry::PointCloud pc;
+    pc.points_.resize(size);
+    pc.colors_.resize(size);
+    Rand(pc.points_, Vector3d(-5.0, -5.0, -5.0), Vector3d(5.0, 5.0, 5.0), 0);
+    for (size_t i = 0; i < size; i++) {
+        double label = double(i % 3);
+        pc.colors_[i] = Vector3d(label, label, label);
+    }
+
+    double voxel_size = 0.9;
+    Vector3d min_bound(-2.0, -2.0, -2.0);
+    Vector3d max_bound(2.0, 2.0, 2.0);
+    map<tuple<int, int, int>, vector<size_t>> voxels;
+    for (size_t i = 0; i < size; i++) {
+        Vector3d ref_coord = (pc.points_[i] - min_bound) / voxel_size;
+        voxels[make_tuple(int(floor(ref_coord(2))), int(floor(ref_coord(1))),
+                          int(floor(ref_coord(0))))]
+                .push_back(i);
+    }
+
+    shared_ptr<geometry::PointCloud> output_pc;
+    MatrixXi cubic_id;
+    vector<vector<int>> original_indices;
+    tie(output_pc, cubic_id, original_indices) =
+            pc.VoxelDownSampleAndTrace(voxel_size, min_bound, max_bound, true);
+    ASSERT_EQ(voxels.size(), output_pc->points_.size());
+    ASSERT_EQ(voxels.size(), original_indices.size());
+    ASSERT_EQ(int(voxels.size()), cubic_id.rows());
+    size_t k = 0;
+    for (const auto &voxel : voxels) {
+        Vector3d point = Zero3d;
+        int counts[3] = {0, 0, 0};
+        vector<int> cubic(8, -1);
+        vector<int> indices;
+        for (size_t i : voxel.second) {
+            point += pc.points_[i];
+            counts[i % 3]++;
+            Vector3d ref_coord = (pc.points_[i] - min_bound) / voxel_size;
+            int cid = 0;
+            for (int c = 0; c < 3; c++) {
+                if (ref_coord(c) - floor(ref_coord(c)) >= 0.5) {
+                    cid += 1 << c;
+                }
+            }
+            cubic[cid] = int(i);
+            indices.push_back(int(i));
+        }
+        double label = double(max_element(counts, counts + 3) - counts);
+        EXPECT_EQ(point / double(voxel.second.size()), output_pc->points_[k]);
+        EXPECT_EQ(Vector3d(label, label, label), output_pc->colors_[k]);
+        for (int c = 0; c < 8; c++) {
+            EXPECT_EQ(cubic[c], cubic_id(k, c));
+        }
+        EXPECT_EQ(indices, original_indices[k]);
+        k++;
+    }
+}
+
 TEST(PointCloud, UniformDownSample) {
     vector<Vector3d> ref = {{839.215686, 392.156863, 780.392157},
                             {364.705882, 509.803922, 949.019608},
@@ -588,6 +694,125 @@ TEST(PointCloud, CropPointCloud) {
     ExpectGE(maxBound, output_pc->points_);
 }
 
+TEST(PointCloud, SelectByMask) {
+    size_t size = 100;
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(1000.0, 1000.0, 1000.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+    pc.colors_.resize(size);
+    Rand(pc.colors_, Zero3d, Vector3d(1.0, 1.0, 1.0), 1);
+
+    vector<bool> mask(size);
+    vector<size_t> indices;
+    for (size_t i = 0; i < size; i++) {
+        mask[i] = (i % 3) == 0;
+        if (mask[i]) indices.push_back(i);
+    }
+
+    auto output_pc = pc.SelectByMask(mask);
+    auto ref_pc = pc.SelectByIndex(indices);
+    ExpectEQ(ref_pc->points_, output_pc->points_);
+    ExpectEQ(ref_pc->colors_, output_pc->colors_);
+
+    auto inverted_pc = pc.SelectByMask(mask, true);
+    auto ref_inverted_pc = pc.SelectByIndex(indices, true);
+    EXPECT_EQ(size - indices.size(), inverted_pc->points_.size());
+    ExpectEQ(ref_inverted_pc->points_, inverted_pc->points_);
+}
+
+TEST(PointCloud, RemoveRadiusOutliers) {
+    size_t size = 500;
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    size_t nb_points = 3;
+    double radius = 1.5;
+    vector<size_t> ref_indices;
+    for (size_t i = 0; i < size; i++) {
+        size_t count = 0;
+        for (size_t j = 0; j < size; j++) {
+            if ((pc.points_[i] - pc.points_[j]).squaredNorm() <
+                radius * radius) {
+                count++;
+            }
+        }
+        if (count > nb_points) ref_indices.push_back(i);
+    }
+
+    vector<bool> mask = pc.ComputeRadiusOutlierMask(nb_points, radius);
+    EXPECT_EQ(size, mask.size());
+    EXPECT_EQ(ref_indices.size(),
+              size_t(std::count(mask.begin(), mask.end(), true)));
+
+    shared_ptr<geometry::PointCloud> output_pc;
+    vector<size_t> indices;
+    std::tie(output_pc, indices) = pc.RemoveRadiusOutliers(nb_points, radius);
+    EXPECT_EQ(ref_indices, indices);
+    ExpectEQ(pc.SelectByIndex(ref_indices)->points_, output_pc->points_);
+}
+
+TEST(PointCloud, RemoveStatisticalOutliers) {
+    size_t size = 500;
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+    // A few far away points.
+    pc.points_.push_back(Vector3d(50.0, 50.0, 50.0));
+    pc.points_.push_back(Vector3d(-40.0, 5.0, 5.0));
+    size += 2;
+
+    size_t nb_neighbors = 8;
+    double std_ratio = 2.0;
+    vector<double> avg_distances(size);
+    for (size_t i = 0; i < size; i++) {
+        vector<double> dist(size);
+        for (size_t j = 0; j < size; j++) {
+            dist[j] = (pc.points_[i] - pc.points_[j]).norm();
+        }
+        std::sort(dist.begin(), dist.end());
+        avg_distances[i] =
+                std::accumulate(dist.begin(), dist.begin() + nb_neighbors,
+                                0.0) /
+                nb_neighbors;
+    }
+    double mean = std::accumulate(avg_distances.begin(), avg_distances.end(),
+                                  0.0) /
+                  size;
+    double sq_sum = 0.0;
+    for (double d : avg_distances) sq_sum += (d - mean) * (d - mean);
+    double threshold = mean + std_ratio * std::sqrt(sq_sum / (size - 1));
+    vector<size_t> ref_indices;
+    for (size_t i = 0; i < size; i++) {
+        if (avg_distances[i] < threshold) ref_indices.push_back(i);
+    }
+    EXPECT_LT(ref_indices.size(), size);
+
+    shared_ptr<geometry::PointCloud> output_pc;
+    vector<size_t> indices;
+    std::tie(output_pc, indices) =
+            pc.RemoveStatisticalOutliers(nb_neighbors, std_ratio);
+    EXPECT_EQ(ref_indices, indices);
+    EXPECT_EQ(ref_indices.size(), output_pc->points_.size());
+
+    vector<bool> mask =
+            pc.ComputeStatisticalOutlierMask(nb_neighbors, std_ratio);
+    EXPECT_FALSE(mask[size - 1]);
+    EXPECT_FALSE(mask[size - 2]);
+}
+
 TEST(PointCloud, EstimateNormals) {
     vector<Vector3d> ref = {
             {0.282003, 0.866394, 0.412111},   {0.550791, 0.829572, -0.091869},
@@ -734,6 +959,31 @@ TEST(PointCloud, OrientNormalsTowardsCameraLocation) {
     ExpectEQ(ref, pc.normals_);
 }
 
+TEST(PointCloud, OrientNormalsConsistentTangentPlane) {
+    // Two concentric spheres far enough apart to form separate components.
+    geometry::PointCloud pc;
+    int size = 2000;
+    double golden_angle = M_PI * (3.0 - sqrt(5.0));
+    for (double radius : {1.0, 5.0}) {
+        for (int i = 0; i < size; i++) {
+            double z = 1.0 - 2.0 * (i + 0.5) / size;
+            double r = sqrt(1.0 - z * z);
+            Vector3d n(r * cos(golden_angle * i), r * sin(golden_angle * i), z);
+            pc.points_.push_back(radius * n);
+            pc.normals_.push_back(i % 3 == 0 ? -n : n);
+        }
+    }
+
+    EXPECT_TRUE(pc.OrientNormalsConsistentTangentPlane(10));
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        EXPECT_GT(pc.normals_[i].dot(pc.points_[i]), 0.0);
+    }
+
+    geometry::PointCloud no_normals;
+    no_normals.points_ = pc.points_;
+    EXPECT_FALSE(no_normals.OrientNormalsConsistentTangentPlane(10));
+}
+
 TEST(PointCloud, ComputePointCloudToPointCloudDistance) {
     vector<double> ref = {
             157.498711, 127.737235, 113.386920, 192.476725, 134.367386,
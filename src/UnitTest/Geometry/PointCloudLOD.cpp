@@ -0,0 +1,169 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloudLOD.h"
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "TestUtility/UnitTest.h"
+
+#include <numeric>
+
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+// Terrain-like cloud covering [0, 10] x [0, 10] with colors.
+geometry::PointCloud CreateTerrain(size_t size) {
+    geometry::PointCloud pointcloud;
+    pointcloud.points_.resize(size);
+    Rand(pointcloud.points_, Eigen::Vector3d(0, 0, 0),
+         Eigen::Vector3d(10, 10, 0.5), 0);
+    pointcloud.colors_.resize(size);
+    Rand(pointcloud.colors_, Eigen::Vector3d(0, 0, 0),
+         Eigen::Vector3d(1, 1, 1), 1);
+    return pointcloud;
+}
+
+// Camera at \p position looking at \p target, with the y axis of the image
+// pointing down.
+camera::PinholeCameraParameters CreateCamera(const Eigen::Vector3d &position,
+                                             const Eigen::Vector3d &target) {
+    camera::PinholeCameraParameters camera;
+    camera.intrinsic_.SetIntrinsics(640, 480, 500.0, 500.0, 319.5, 239.5);
+    Eigen::Vector3d z = (target - position).normalized();
+    Eigen::Vector3d x = z.cross(Eigen::Vector3d(0, 0, 1)).normalized();
+    Eigen::Vector3d y = z.cross(x);
+    Eigen::Matrix3d R;
+    R << x.transpose(), y.transpose(), z.transpose();
+    camera.extrinsic_ = Eigen::Matrix4d::Identity();
+    camera.extrinsic_.block<3, 3>(0, 0) = R;
+    camera.extrinsic_.block<3, 1>(0, 3) = -R * position;
+    return camera;
+}
+
+}  // namespace
+
+TEST(PointCloudLOD, CreateFromPointCloud) {
+    geometry::PointCloud pointcloud = CreateTerrain(100000);
+    auto lod = geometry::PointCloudLOD::CreateFromPointCloud(pointcloud, 1000,
+                                                             4, 10);
+    ASSERT_GT(lod->nodes_.size(), 1u);
+
+    // Every point is stored exactly once.
+    ASSERT_EQ(lod->indices_.size(), pointcloud.points_.size());
+    vector<size_t> sorted = lod->indices_;
+    sort(sorted.begin(), sorted.end());
+    vector<size_t> expected(sorted.size());
+    iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(sorted, expected);
+    size_t mismatches = 0;
+    for (size_t k = 0; k < lod->indices_.size(); k++) {
+        if (lod->pointcloud_.points_[k] !=
+                    pointcloud.points_[lod->indices_[k]] ||
+            lod->pointcloud_.colors_[k] !=
+                    pointcloud.colors_[lod->indices_[k]]) {
+            mismatches++;
+        }
+    }
+    EXPECT_EQ(mismatches, 0u);
+
+    size_t total = 0, outside = 0;
+    for (size_t i = 0; i < lod->nodes_.size(); i++) {
+        const auto &node = lod->nodes_[i];
+        total += lod->GetNodePointCount(int(i));
+        // Own points lie in the cell of the node.
+        for (size_t k = node.begin_; k < node.end_; k++) {
+            Eigen::Vector3d p = lod->pointcloud_.points_[k] - node.min_bound_;
+            if (p.minCoeff() < -1e-9 || p.maxCoeff() > node.size_ + 1e-9) {
+                outside++;
+            }
+        }
+        // A node keeps at most one point per sampling cell.
+        EXPECT_LE(lod->GetNodePointCount(int(i)), 4096u);
+        if (node.num_children_ == 0) {
+            EXPECT_EQ(node.first_child_, -1);
+        }
+        for (int k = 0; k < node.num_children_; k++) {
+            const auto &child = lod->nodes_[node.first_child_ + k];
+            EXPECT_EQ(child.parent_, int(i));
+            EXPECT_EQ(child.depth_, node.depth_ + 1);
+            EXPECT_EQ(child.size_, node.size_ / 2);
+        }
+    }
+    EXPECT_EQ(total, pointcloud.points_.size());
+    EXPECT_EQ(outside, 0u);
+}
+
+TEST(PointCloudLOD, SelectNodes) {
+    geometry::PointCloud pointcloud = CreateTerrain(200000);
+    auto lod = geometry::PointCloudLOD::CreateFromPointCloud(pointcloud, 2000,
+                                                             4, 12);
+    auto overview = CreateCamera(Eigen::Vector3d(5, -10, 10),
+                                 Eigen::Vector3d(5, 5, 0));
+    vector<int> selected = lod->SelectNodes(overview, 30000);
+    ASSERT_FALSE(selected.empty());
+    EXPECT_EQ(selected[0], 0);
+    EXPECT_LE(lod->GetPointCount(selected), 30000u);
+    // Parents are selected before their children.
+    vector<bool> is_selected(lod->nodes_.size(), false);
+    for (int node : selected) {
+        if (node != 0) {
+            EXPECT_TRUE(is_selected[lod->nodes_[node].parent_]);
+        }
+        is_selected[node] = true;
+    }
+    auto extracted = lod->ExtractPointCloud(selected);
+    EXPECT_EQ(extracted->points_.size(), lod->GetPointCount(selected));
+    EXPECT_EQ(extracted->colors_.size(), extracted->points_.size());
+
+    // A larger budget refines further.
+    vector<int> refined = lod->SelectNodes(overview, 120000);
+    EXPECT_GT(lod->GetPointCount(refined), lod->GetPointCount(selected));
+
+    // Close to a corner of the terrain, the nodes near it are refined first
+    // and the nodes behind the camera are culled.
+    auto close_up = CreateCamera(Eigen::Vector3d(1, 1, 1),
+                                 Eigen::Vector3d(0, 0, 0));
+    vector<int> corner = lod->SelectNodes(close_up, 30000);
+    ASSERT_FALSE(corner.empty());
+    int max_depth = 0;
+    for (int node : corner) {
+        const auto &n = lod->nodes_[node];
+        max_depth = max(max_depth, n.depth_);
+        Eigen::Vector3d center =
+                n.min_bound_ + Eigen::Vector3d::Constant(n.size_ / 2);
+        if (n.depth_ >= 3) {
+            EXPECT_LT(center(0) + center(1), 4.0);
+        }
+    }
+    EXPECT_GE(max_depth, 3);
+
+    // Nothing is selected when looking away from the cloud.
+    auto away = CreateCamera(Eigen::Vector3d(5, -5, 1),
+                             Eigen::Vector3d(5, -20, 1));
+    EXPECT_TRUE(lod->SelectNodes(away, 30000).empty());
+}
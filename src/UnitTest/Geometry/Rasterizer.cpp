@@ -0,0 +1,195 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/Rasterizer.h"
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+// Camera at the origin looking along +z. With f = 40 and the principal
+// point at (32, 24), a point (x, y, 2) projects to (20 x + 32, 20 y + 24).
+camera::PinholeCameraParameters CreateCamera() {
+    camera::PinholeCameraParameters camera;
+    camera.intrinsic_.SetIntrinsics(64, 48, 40.0, 40.0, 32.0, 24.0);
+    camera.extrinsic_ = Eigen::Matrix4d::Identity();
+    return camera;
+}
+
+// An n x n grid of quads spanning [x0, x1] x [y0, y1] in the plane z = depth.
+geometry::TriangleMesh CreateGrid(
+        int n, double x0, double x1, double y0, double y1, double depth) {
+    geometry::TriangleMesh mesh;
+    for (int j = 0; j <= n; j++) {
+        for (int i = 0; i <= n; i++) {
+            mesh.vertices_.push_back(Eigen::Vector3d(
+                    x0 + (x1 - x0) * i / n, y0 + (y1 - y0) * j / n, depth));
+        }
+    }
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            int v = j * (n + 1) + i;
+            mesh.triangles_.push_back(Eigen::Vector3i(v, v + 1, v + n + 2));
+            mesh.triangles_.push_back(Eigen::Vector3i(v, v + n + 2, v + n + 1));
+        }
+    }
+    return mesh;
+}
+
+}  // unnamed namespace
+
+TEST(Rasterizer, TriangleMeshWatertight) {
+    // Grid vertices project exactly onto pixel centers, so many pixels lie on
+    // shared edges. The grid covers pixels [12, 52) x [14, 34) exactly.
+    geometry::TriangleMesh mesh = CreateGrid(8, -1.0, 1.0, -0.5, 0.5, 2.0);
+    shared_ptr<geometry::Image> depth, color, index;
+    tie(depth, color, index) =
+            geometry::RasterizeTriangleMesh(mesh, CreateCamera());
+    ASSERT_EQ(64, depth->width_);
+    ASSERT_EQ(48, depth->height_);
+    EXPECT_EQ(4, depth->bytes_per_channel_);
+    EXPECT_EQ(3, color->num_of_channels_);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            bool inside = u >= 12 && u < 52 && v >= 14 && v < 34;
+            int id = *index->PointerAt<int>(u, v);
+            if (inside) {
+                EXPECT_NEAR(2.0, *depth->PointerAt<float>(u, v), 1e-5);
+                EXPECT_GE(id, 0);
+                EXPECT_EQ(255, *color->PointerAt<uint8_t>(u, v, 0));
+            } else {
+                EXPECT_EQ(0.0f, *depth->PointerAt<float>(u, v));
+                EXPECT_EQ(-1, id);
+                EXPECT_EQ(0, *color->PointerAt<uint8_t>(u, v, 0));
+            }
+        }
+    }
+}
+
+TEST(Rasterizer, TriangleMeshOcclusionAndColor) {
+    // A red quad at z = 1 in front of a green quad at z = 2, listed last.
+    geometry::TriangleMesh back = CreateGrid(1, -1.0, 1.0, -1.0, 1.0, 2.0);
+    back.vertex_colors_.assign(back.vertices_.size(), Eigen::Vector3d(0, 1, 0));
+    geometry::TriangleMesh front = CreateGrid(1, -0.2, 0.2, -0.2, 0.2, 1.0);
+    front.vertex_colors_.assign(front.vertices_.size(),
+                                Eigen::Vector3d(1, 0, 0));
+    geometry::TriangleMesh mesh = back + front;
+
+    for (int tile_size : {4, 32}) {
+        geometry::RasterizerOption option(tile_size);
+        shared_ptr<geometry::Image> depth, color, index;
+        tie(depth, color, index) =
+                geometry::RasterizeTriangleMesh(mesh, CreateCamera(), option);
+        // Center: the front quad, pixels [24, 40) x [16, 32).
+        EXPECT_NEAR(1.0, *depth->PointerAt<float>(32, 24), 1e-6);
+        EXPECT_GE(*index->PointerAt<int>(32, 24), 2);
+        EXPECT_EQ(255, *color->PointerAt<uint8_t>(32, 24, 0));
+        EXPECT_EQ(0, *color->PointerAt<uint8_t>(32, 24, 1));
+        // Outside the front quad: the back quad.
+        EXPECT_NEAR(2.0, *depth->PointerAt<float>(20, 24), 1e-6);
+        EXPECT_LT(*index->PointerAt<int>(20, 24), 2);
+        EXPECT_EQ(0, *color->PointerAt<uint8_t>(20, 24, 0));
+        EXPECT_EQ(255, *color->PointerAt<uint8_t>(20, 24, 1));
+    }
+}
+
+TEST(Rasterizer, TriangleMeshSphereDepth) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 100);
+    camera::PinholeCameraParameters camera = CreateCamera();
+    camera.extrinsic_(2, 3) = 4.0;
+    shared_ptr<geometry::Image> depth, color, index;
+    tie(depth, color, index) = geometry::RasterizeTriangleMesh(*sphere, camera);
+
+    size_t n_checked = 0;
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            // Ray through the pixel center, intersected with the sphere.
+            Eigen::Vector3d dir((u - 32.0) / 40.0, (v - 24.0) / 40.0, 1.0);
+            Eigen::Vector3d origin(0, 0, -4);
+            double b = origin.dot(dir), a = dir.squaredNorm();
+            double disc = b * b - a * (origin.squaredNorm() - 1.0);
+            if (disc < 0.05 * a) {
+                // Outside or too close to the silhouette.
+                if (disc < -0.05 * a) {
+                    EXPECT_EQ(-1, *index->PointerAt<int>(u, v));
+                }
+                continue;
+            }
+            double t = (-b - std::sqrt(disc)) / a;
+            EXPECT_NEAR(t, *depth->PointerAt<float>(u, v), 5e-3);
+            n_checked++;
+        }
+    }
+    EXPECT_GT(n_checked, 100u);
+
+    // Back faces never win the depth test, so culling them changes nothing.
+    geometry::RasterizerOption option;
+    option.cull_back_faces_ = true;
+    shared_ptr<geometry::Image> depth_culled, color_culled, index_culled;
+    tie(depth_culled, color_culled, index_culled) =
+            geometry::RasterizeTriangleMesh(*sphere, camera, option);
+    EXPECT_EQ(depth->data_, depth_culled->data_);
+    EXPECT_EQ(index->data_, index_culled->data_);
+}
+
+TEST(Rasterizer, PointCloud) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {{0, 0, 2}, {0, 0, 1}, {0.5, 0.5, 2}, {0, 0, -1}};
+    pcd.colors_ = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 1}};
+    geometry::RasterizerOption option;
+    option.point_size_ = 3;
+    shared_ptr<geometry::Image> depth, color, index;
+    tie(depth, color, index) =
+            geometry::RasterizePointCloud(pcd, CreateCamera(), option);
+
+    int n_drawn = 0;
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            int id = *index->PointerAt<int>(u, v);
+            if (id < 0) continue;
+            n_drawn++;
+            if (std::abs(u - 32) <= 1 && std::abs(v - 24) <= 1) {
+                // The nearer point hides the one behind it.
+                EXPECT_EQ(1, id);
+                EXPECT_NEAR(1.0, *depth->PointerAt<float>(u, v), 1e-6);
+                EXPECT_EQ(255, *color->PointerAt<uint8_t>(u, v, 1));
+            } else {
+                EXPECT_EQ(2, id);
+                EXPECT_LE(std::abs(u - 42), 1);
+                EXPECT_LE(std::abs(v - 34), 1);
+                EXPECT_EQ(255, *color->PointerAt<uint8_t>(u, v, 2));
+            }
+        }
+    }
+    EXPECT_EQ(18, n_drawn);
+}
@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/StreamingOutlierFilter.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+// Splits the points into slabs along x and records the original index of
+// every point of every slab.
+void SplitIntoSlabs(const geometry::PointCloud &pc,
+                    int num_slabs,
+                    double slab_width,
+                    vector<geometry::PointCloud> &slabs,
+                    vector<vector<size_t>> &slab_indices) {
+    slabs.resize(num_slabs);
+    slab_indices.resize(num_slabs);
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        int s = min(int(pc.points_[i](0) / slab_width), num_slabs - 1);
+        slabs[s].points_.push_back(pc.points_[i]);
+        slab_indices[s].push_back(i);
+    }
+}
+
+vector<bool> StreamSlabs(geometry::StreamingOutlierFilter &filter,
+                         const vector<geometry::PointCloud> &slabs,
+                         const vector<vector<size_t>> &slab_indices,
+                         size_t size) {
+    vector<bool> mask(size, false);
+    size_t num_reported = 0;
+    filter.SetMaskCallback([&](size_t chunk, const vector<bool> &chunk_mask) {
+        EXPECT_EQ(slab_indices[chunk].size(), chunk_mask.size());
+        for (size_t i = 0; i < chunk_mask.size(); i++) {
+            mask[slab_indices[chunk][i]] = chunk_mask[i];
+        }
+        num_reported++;
+    });
+    for (int pass = 0; pass < filter.NumPasses(); pass++) {
+        for (const auto &slab : slabs) {
+            filter.AddChunk(slab);
+        }
+        filter.Finish();
+    }
+    EXPECT_EQ(slabs.size(), num_reported);
+    return mask;
+}
+
+}  // namespace
+
+TEST(StreamingOutlierFilter, Radius) {
+    size_t size = 2000;
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    size_t nb_points = 4;
+    double radius = 1.2;
+    vector<bool> ref_mask = pc.ComputeRadiusOutlierMask(nb_points, radius);
+
+    vector<geometry::PointCloud> slabs;
+    vector<vector<size_t>> slab_indices;
+    SplitIntoSlabs(pc, 5, 2.0, slabs, slab_indices);
+
+    geometry::StreamingOutlierFilter filter(
+            geometry::StreamingOutlierFilter::FilterType::Radius, nb_points,
+            radius);
+    EXPECT_EQ(1, filter.NumPasses());
+    vector<bool> mask = StreamSlabs(filter, slabs, slab_indices, size);
+    EXPECT_EQ(ref_mask, mask);
+}
+
+TEST(StreamingOutlierFilter, Statistical) {
+    size_t size = 2000;
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    size_t nb_neighbors = 10;
+    double std_ratio = 1.0;
+    vector<bool> ref_mask =
+            pc.ComputeStatisticalOutlierMask(nb_neighbors, std_ratio);
+
+    vector<geometry::PointCloud> slabs;
+    vector<vector<size_t>> slab_indices;
+    SplitIntoSlabs(pc, 5, 2.0, slabs, slab_indices);
+
+    // The halo covers the neighboring slabs entirely, so the result is exact.
+    geometry::StreamingOutlierFilter filter(
+            geometry::StreamingOutlierFilter::FilterType::Statistical,
+            nb_neighbors, std_ratio, 2.0);
+    EXPECT_EQ(2, filter.NumPasses());
+    vector<bool> mask = StreamSlabs(filter, slabs, slab_indices, size);
+    EXPECT_EQ(ref_mask, mask);
+    EXPECT_LT(std::count(mask.begin(), mask.end(), true), int(size));
+}
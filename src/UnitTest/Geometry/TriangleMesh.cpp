@@ -26,9 +26,12 @@
 
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "TestUtility/UnitTest.h"
 
+#include <random>
+
 using namespace Eigen;
 using namespace open3d;
 using namespace std;
@@ -1430,6 +1433,63 @@ TEST(TriangleMesh, DeformAsRigidAsPossible) {
     ExpectEQ(*mesh_deform, mesh_gt);
 }
 
+TEST(TriangleMesh, SimplifyQuadricDecimationPartitioned) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 50);
+    auto reference = sphere->SimplifyQuadricDecimation(1000);
+    auto MaxDeviation = [](const geometry::TriangleMesh &mesh) {
+        double deviation = 0;
+        for (const auto &tria : mesh.triangles_) {
+            Vector3d center = (mesh.vertices_[tria(0)] +
+                               mesh.vertices_[tria(1)] +
+                               mesh.vertices_[tria(2)]) /
+                              3.0;
+            deviation = std::max(deviation, std::abs(center.norm() - 1.0));
+        }
+        return deviation;
+    };
+
+    // A single partition and many small ones.
+    for (int partition_size : {0, 1000}) {
+        geometry::QuadricDecimationOption option(partition_size);
+        auto mesh = sphere->SimplifyQuadricDecimation(1000, option);
+        EXPECT_EQ(1000u, mesh->triangles_.size());
+        EXPECT_EQ(502u, mesh->vertices_.size());
+        EXPECT_TRUE(mesh->IsEdgeManifold(false));
+        EXPECT_TRUE(mesh->IsVertexManifold());
+        EXPECT_EQ(2, mesh->EulerPoincareCharacteristic());
+        EXPECT_LT(MaxDeviation(*mesh), 2 * MaxDeviation(*reference));
+    }
+}
+
+TEST(TriangleMesh, SimplifyQuadricDecimationBoundary) {
+    // A 40 x 40 grid of quads on the unit square.
+    geometry::TriangleMesh grid;
+    const int n = 40;
+    for (int j = 0; j <= n; j++) {
+        for (int i = 0; i <= n; i++) {
+            grid.vertices_.push_back(Vector3d(double(i) / n, double(j) / n, 0));
+        }
+    }
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            int v = j * (n + 1) + i;
+            grid.triangles_.push_back(Vector3i(v, v + 1, v + n + 2));
+            grid.triangles_.push_back(Vector3i(v, v + n + 2, v + n + 1));
+        }
+    }
+
+    geometry::QuadricDecimationOption option(400);
+    auto mesh = grid.SimplifyQuadricDecimation(200, option);
+    EXPECT_LE(mesh->triangles_.size(), 200u);
+    EXPECT_TRUE(mesh->IsEdgeManifold(true));
+    EXPECT_TRUE(mesh->IsVertexManifold());
+    EXPECT_EQ(1, mesh->EulerPoincareCharacteristic());
+    // The boundary quadrics keep the square.
+    ExpectEQ(Vector3d(0, 0, 0), mesh->GetMinBound());
+    ExpectEQ(Vector3d(1, 1, 0), mesh->GetMaxBound());
+    EXPECT_NEAR(1.0, mesh->GetSurfaceArea(), 1e-6);
+}
+
 TEST(TriangleMesh, SelectByIndex) {
     vector<Vector3d> ref_vertices = {{349.019608, 803.921569, 917.647059},
                                      {439.215686, 117.647059, 588.235294},
@@ -1871,6 +1931,75 @@ TEST(TriangleMesh, CreateFromPointCloudPoisson) {
     ExpectEQ(densities_es, densities_gt, 1e-4);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudPoissonOption) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {
+            {-0.215279, 0.121252, 0.965784},  {0.079266, 0.643799, 0.755848},
+            {0.001534, -0.691225, 0.720568},  {0.663793, 0.567055, 0.478929},
+            {-0.929397, -0.262081, 0.238929}, {0.741441, -0.628480, 0.209423},
+            {-0.844085, 0.510828, 0.131410},  {0.001478, -0.999346, 0.006834},
+            {-0.075616, 0.987936, -0.077669}, {-0.599516, -0.738522, -0.297292},
+            {0.952159, -0.061734, -0.284187}, {0.616751, -0.543117, -0.562931},
+            {-0.066283, 0.653032, -0.748836}, {0.408743, 0.133839, -0.900872},
+            {-0.165481, -0.187750, -0.964982}};
+    pcd.normals_ = pcd.points_;
+
+    std::shared_ptr<geometry::TriangleMesh> mesh_gt;
+    std::vector<double> densities_gt;
+    std::tie(mesh_gt, densities_gt) =
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(pcd, 2);
+
+    // Thread count and timings must not change the result.
+    geometry::PoissonReconstructionOption option;
+    option.depth_ = 2;
+    option.n_threads_ = 1;
+    geometry::PoissonReconstructionTimings timings;
+    std::shared_ptr<geometry::TriangleMesh> mesh_es;
+    std::vector<double> densities_es;
+    std::tie(mesh_es, densities_es) =
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(pcd, option,
+                                                                &timings);
+    ExpectEQ(*mesh_es, *mesh_gt, 1e-4);
+    ExpectEQ(densities_es, densities_gt, 1e-4);
+    EXPECT_GE(timings.tree_build_, 0.0);
+    EXPECT_GE(timings.solve_, 0.0);
+    EXPECT_GE(timings.extraction_, 0.0);
+    EXPECT_GE(timings.total_, timings.tree_build_ + timings.solve_);
+}
+
+TEST(TriangleMesh, CreateFromPointCloudBallPivoting) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 4);
+    geometry::PointCloud pcd;
+    pcd.points_ = sphere->vertices_;
+    pcd.normals_ = sphere->vertices_;
+
+    // The first radius seeds both caps, the second one closes the belt.
+    std::vector<Eigen::Vector3i> triangles_gt = {
+            {0, 2, 3},    {0, 9, 2},    {0, 8, 9},    {0, 7, 8},
+            {0, 6, 7},    {0, 5, 6},    {0, 4, 5},    {0, 3, 4},
+            {1, 18, 25},  {25, 24, 1},  {24, 23, 1},  {23, 22, 1},
+            {22, 21, 1},  {21, 20, 1},  {20, 19, 1},  {19, 18, 1},
+            {9, 17, 2},   {17, 10, 2},  {10, 3, 2},   {17, 18, 10},
+            {18, 19, 10}, {19, 11, 10}, {17, 25, 18}, {17, 24, 25},
+            {17, 16, 24}, {16, 23, 24}, {16, 15, 23}, {15, 14, 23},
+            {14, 22, 23}, {14, 13, 22}, {13, 21, 22}, {13, 12, 21},
+            {13, 4, 12},  {4, 3, 12},   {13, 5, 4},   {13, 6, 5},
+            {13, 14, 6},  {14, 7, 6},   {16, 8, 15},  {8, 7, 15},
+            {16, 9, 8},   {16, 9, 21},  {20, 12, 19}};
+
+    auto mesh_es = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, {0.5, 1.0});
+    ExpectEQ(mesh_es->vertices_, pcd.points_);
+    ExpectEQ(mesh_es->triangles_, triangles_gt);
+    ASSERT_EQ(mesh_es->triangle_normals_.size(), triangles_gt.size());
+
+    EXPECT_ANY_THROW(geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, {-1.0}));
+    pcd.normals_.clear();
+    EXPECT_ANY_THROW(geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, {0.5}));
+}
+
 TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     geometry::PointCloud pcd;
     pcd.points_ = {
@@ -1896,6 +2025,75 @@ TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     ExpectEQ(*mesh_es, mesh_gt);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudAlphaShapeTiled) {
+    geometry::PointCloud pcd;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    for (int pidx = 0; pidx < 1000; ++pidx) {
+        pcd.points_.push_back(Eigen::Vector3d(dist(rng), dist(rng), dist(rng)));
+    }
+
+    // Triangles in terms of pcd indices, sorted for comparison.
+    geometry::KDTreeFlann kdtree(pcd);
+    auto pcd_triangles = [&](const geometry::TriangleMesh &mesh) {
+        std::vector<Eigen::Vector3i> triangles;
+        for (const auto &triangle : mesh.triangles_) {
+            Eigen::Vector3i pcd_triangle;
+            for (int i = 0; i < 3; ++i) {
+                std::vector<int> indices;
+                std::vector<double> dists2;
+                kdtree.SearchKNN(mesh.vertices_[triangle(i)], 1, indices,
+                                 dists2);
+                pcd_triangle(i) = indices[0];
+            }
+            triangles.push_back(geometry::TriangleMesh::GetOrderedTriangle(
+                    pcd_triangle(0), pcd_triangle(1), pcd_triangle(2)));
+        }
+        std::sort(triangles.begin(), triangles.end(),
+                  [](const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+                      return std::lexicographical_compare(
+                              a.data(), a.data() + 3, b.data(), b.data() + 3);
+                  });
+        return triangles;
+    };
+
+    for (double alpha : {0.1, 0.2}) {
+        auto mesh_gt =
+                geometry::TriangleMesh::CreateFromPointCloudAlphaShape(pcd,
+                                                                       alpha);
+        auto mesh_es = geometry::TriangleMesh::CreateFromPointCloudAlphaShape(
+                pcd, alpha, geometry::AlphaShapeOption(100));
+        EXPECT_GT(mesh_gt->triangles_.size(), 0u);
+        ExpectEQ(pcd_triangles(*mesh_es), pcd_triangles(*mesh_gt));
+        EXPECT_EQ(mesh_es->vertices_.size(), mesh_gt->vertices_.size());
+    }
+}
+
+TEST(TriangleMesh, CreateFromPointCloudAlphaShapeTiledPlanarBlock) {
+    // The first 200 points fill a cube, the other 200 a distant plane that
+    // becomes a block of its own and cannot be tetrahedralized.
+    geometry::PointCloud pcd;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    for (int pidx = 0; pidx < 200; ++pidx) {
+        pcd.points_.push_back(Eigen::Vector3d(dist(rng), dist(rng), dist(rng)));
+    }
+    for (int pidx = 0; pidx < 200; ++pidx) {
+        pcd.points_.push_back(Eigen::Vector3d(dist(rng), dist(rng), 10));
+    }
+
+    double alpha = 0.3;
+    auto mesh_gt =
+            geometry::TriangleMesh::CreateFromPointCloudAlphaShape(pcd, alpha);
+    auto mesh_es = geometry::TriangleMesh::CreateFromPointCloudAlphaShape(
+            pcd, alpha, geometry::AlphaShapeOption(200));
+    EXPECT_GT(mesh_es->triangles_.size(), 0u);
+    EXPECT_EQ(mesh_es->triangles_.size(), mesh_gt->triangles_.size());
+    for (const auto &triangle : mesh_es->triangles_) {
+        EXPECT_LT(triangle.maxCoeff(), 200);
+    }
+}
+
 TEST(TriangleMesh, CreateMeshSphere) {
     vector<Vector3d> ref_vertices = {{0.000000, 0.000000, 1.000000},
                                      {0.000000, 0.000000, -1.000000},
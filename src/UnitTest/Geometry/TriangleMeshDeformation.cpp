@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshDeformation.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+// Pins the lowest ring of a sphere and drags its top vertex.
+void CreateConstraints(const geometry::TriangleMesh &mesh,
+                       vector<int> &constraint_ids,
+                       vector<Eigen::Vector3d> &constraint_pos) {
+    for (int i = 0; i < int(mesh.vertices_.size()); ++i) {
+        if (mesh.vertices_[i](2) < -0.9) {
+            constraint_ids.push_back(i);
+            constraint_pos.push_back(mesh.vertices_[i]);
+        }
+    }
+    // Vertex 0 of CreateSphere is the north pole.
+    constraint_ids.push_back(0);
+    constraint_pos.push_back(mesh.vertices_[0] + Eigen::Vector3d(0.3, 0, 0.2));
+}
+
+}  // unnamed namespace
+
+TEST(TriangleMeshDeformation, SessionMatchesGroundTruth) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    vector<int> constraint_ids;
+    vector<Eigen::Vector3d> constraint_pos;
+    CreateConstraints(*sphere, constraint_ids, constraint_pos);
+
+    // Free vertices after 10 iterations of the solver that built and
+    // factorized the system on every call, before the session existed.
+    const vector<int> ids = {5, 23, 47, 64, 91, 110, 137, 155};
+    const vector<Eigen::Vector3d> spokes_gt = {
+            {0.4599603171, 0.2583149309, 1.0735439591},
+            {0.8042410970, 0.1833205506, 0.8455434430},
+            {0.2101195255, 0.7974497978, 0.6642385905},
+            {0.9258819751, 0.5509618891, 0.2902915351},
+            {-0.7880156818, 0.3014826875, 0.1662204550},
+            {-0.6557806001, 0.5486177970, -0.1687160231},
+            {0.0574758228, -0.7996184045, -0.5389678748},
+            {-0.3197059228, -0.4769208083, -0.7528528824}};
+    const vector<Eigen::Vector3d> smoothed_gt = {
+            {0.4247753139, 0.2546004587, 1.0787502130},
+            {0.7728347000, 0.1850149449, 0.8833899320},
+            {0.1747679024, 0.8043848713, 0.6762843820},
+            {0.9103968255, 0.5575876983, 0.3365308417},
+            {-0.8193835386, 0.3059195205, 0.1255971483},
+            {-0.6735278659, 0.5563601025, -0.2051759605},
+            {0.0597319624, -0.8049553878, -0.5419535813},
+            {-0.3158540720, -0.4782775447, -0.7677766504}};
+
+    using Energy = geometry::MeshBase::DeformAsRigidAsPossibleEnergy;
+    for (auto energy : {Energy::Spokes, Energy::Smoothed}) {
+        const auto &vertices_gt =
+                energy == Energy::Spokes ? spokes_gt : smoothed_gt;
+        geometry::DeformAsRigidAsPossibleSession session(
+                *sphere, constraint_ids, energy);
+        auto mesh = session.Deform(constraint_pos, 10);
+        for (size_t k = 0; k < ids.size(); ++k) {
+            ExpectEQ(vertices_gt[k], mesh->vertices_[ids[k]]);
+        }
+        ExpectEQ(sphere->triangles_, mesh->triangles_);
+        for (size_t k = 0; k < constraint_ids.size(); ++k) {
+            ExpectEQ(constraint_pos[k], mesh->vertices_[constraint_ids[k]]);
+        }
+        EXPECT_EQ(10u, session.GetIterationTimes().size());
+        EXPECT_EQ(10u, session.GetIterationEnergies().size());
+    }
+}
+
+TEST(TriangleMeshDeformation, SessionWarmStart) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    vector<int> constraint_ids;
+    vector<Eigen::Vector3d> constraint_pos;
+    CreateConstraints(*sphere, constraint_ids, constraint_pos);
+
+    geometry::DeformAsRigidAsPossibleSession session(*sphere, constraint_ids);
+    session.Deform(constraint_pos, 5);
+    double cold_energy = session.GetIterationEnergies()[0];
+    double last_energy = session.GetIterationEnergies().back();
+    EXPECT_LE(last_energy, cold_energy);
+
+    // Continuing with the same handles starts where the last call ended.
+    session.Deform(constraint_pos, 5);
+    EXPECT_LE(session.GetIterationEnergies()[0], last_energy + 1e-9);
+
+    // Dragging the handle a little further stays close to that optimum.
+    constraint_pos.back() += Eigen::Vector3d(0.01, 0, 0);
+    session.Deform(constraint_pos, 1);
+    EXPECT_LT(session.GetIterationEnergies()[0], cold_energy);
+
+    // After a reset the first iteration starts from the rest pose again.
+    constraint_pos.back() -= Eigen::Vector3d(0.01, 0, 0);
+    session.Reset();
+    session.Deform(constraint_pos, 5);
+    EXPECT_NEAR(cold_energy, session.GetIterationEnergies()[0], 1e-9);
+}
+
+TEST(TriangleMeshDeformation, SessionInvalidConstraints) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    EXPECT_ANY_THROW(geometry::DeformAsRigidAsPossibleSession(
+            *sphere, {int(sphere->vertices_.size())}));
+    geometry::DeformAsRigidAsPossibleSession session(*sphere, {0, 1});
+    EXPECT_ANY_THROW(session.Deform({Eigen::Vector3d(0, 0, 1)}, 1));
+}
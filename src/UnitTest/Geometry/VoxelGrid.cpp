@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/Geometry/IntersectionTest.h"
 #include "Open3D/Geometry/LineSet.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Visualization/Utility/DrawGeometry.h"
@@ -61,6 +62,67 @@ TEST(VoxelGrid, GetVoxel) {
              Eigen::Vector3i(0, 1, 0));
 }
 
+TEST(VoxelGrid, CreateFromTriangleMesh) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 12);
+    mesh->Rotate(geometry::Geometry3D::GetRotationMatrixFromXYZ(
+                         Eigen::Vector3d(0.3, 0.2, 0.1)),
+                 true);
+    double voxel_size = 0.1;
+    auto voxel_grid =
+            geometry::VoxelGrid::CreateFromTriangleMesh(*mesh, voxel_size);
+
+    // Brute force reference testing every voxel against every triangle.
+    Eigen::Vector3d min_bound =
+            mesh->GetMinBound() - Eigen::Vector3d::Constant(voxel_size / 2);
+    Eigen::Vector3d max_bound =
+            mesh->GetMaxBound() + Eigen::Vector3d::Constant(voxel_size / 2);
+    Eigen::Vector3i num_voxels =
+            ((max_bound - min_bound) / voxel_size).array().round().cast<int>();
+    Eigen::Vector3d box_half_size = Eigen::Vector3d::Constant(voxel_size / 2);
+    size_t num_ref = 0;
+    for (int widx = 0; widx < num_voxels(0); widx++) {
+        for (int hidx = 0; hidx < num_voxels(1); hidx++) {
+            for (int didx = 0; didx < num_voxels(2); didx++) {
+                Eigen::Vector3d box_center =
+                        min_bound +
+                        Eigen::Vector3d(widx, hidx, didx) * voxel_size;
+                bool hit = false;
+                for (const auto &tria : mesh->triangles_) {
+                    if (geometry::IntersectionTest::TriangleAABB(
+                                box_center, box_half_size,
+                                mesh->vertices_[tria(0)],
+                                mesh->vertices_[tria(1)],
+                                mesh->vertices_[tria(2)])) {
+                        hit = true;
+                        break;
+                    }
+                }
+                Eigen::Vector3i grid_index(widx, hidx, didx);
+                EXPECT_EQ(hit, voxel_grid->voxels_.count(grid_index) == 1);
+                num_ref += hit ? 1 : 0;
+            }
+        }
+    }
+    EXPECT_EQ(num_ref, voxel_grid->voxels_.size());
+}
+
+TEST(VoxelGrid, CreateFromTriangleMeshFillInterior) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 12);
+    double voxel_size = 0.1;
+    auto surface =
+            geometry::VoxelGrid::CreateFromTriangleMesh(*mesh, voxel_size);
+    auto solid = geometry::VoxelGrid::CreateFromTriangleMesh(*mesh, voxel_size,
+                                                             true);
+    EXPECT_GT(solid->voxels_.size(), surface->voxels_.size());
+    for (const auto &voxel : surface->voxels_) {
+        EXPECT_EQ(1u, solid->voxels_.count(voxel.first));
+    }
+    // The center of the sphere is filled, the corners of the grid are not.
+    EXPECT_EQ(1u, solid->voxels_.count(solid->GetVoxel(Eigen::Vector3d(
+                          voxel_size / 2, voxel_size / 2, voxel_size / 2))));
+    EXPECT_EQ(0u, solid->voxels_.count(Eigen::Vector3i(0, 0, 0)));
+}
+
 TEST(VoxelGrid, Visualization) {
     auto voxel_grid = std::make_shared<geometry::VoxelGrid>();
     voxel_grid->origin_ = Eigen::Vector3d(0, 0, 0);
@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/IO/ClassIO/AsyncImageWriter.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+std::shared_ptr<geometry::Image> CreateDepthImage(int frame) {
+    auto depth = std::make_shared<geometry::Image>();
+    depth->Prepare(160, 120, 1, 2);
+    uint16_t *data = reinterpret_cast<uint16_t *>(depth->data_.data());
+    for (int i = 0; i < depth->width_ * depth->height_; i++) {
+        data[i] = uint16_t(500 + frame * 10 + (i % 160) + (i / 160) * 3);
+    }
+    return depth;
+}
+
+std::string GetFilename(int frame, const std::string &extension) {
+    return "test_async_image_writer_" + std::to_string(frame) + "." +
+           extension;
+}
+
+}  // unnamed namespace
+
+TEST(AsyncImageWriter, WriteImage) {
+    const int num_frames = 12;
+    std::vector<std::shared_ptr<geometry::Image>> depths;
+    auto color = std::make_shared<geometry::Image>();
+    color->Prepare(160, 120, 3, 1);
+    for (size_t i = 0; i < color->data_.size(); i++) {
+        color->data_[i] = uint8_t(i % 251);
+    }
+    {
+        io::AsyncImageWriter writer(4, 2, io::PNGWriteOption::FastDepth());
+        for (int i = 0; i < num_frames; i++) {
+            depths.push_back(CreateDepthImage(i));
+            writer.WriteImage(GetFilename(i, "png"), depths.back());
+            writer.WriteImage(GetFilename(i, "jpg"), color);
+        }
+        writer.Flush();
+        io::AsyncImageWriterStatistics statistics = writer.GetStatistics();
+        EXPECT_EQ(statistics.num_written_, size_t(num_frames * 2));
+        EXPECT_EQ(statistics.num_failed_, 0u);
+        EXPECT_GT(statistics.encode_seconds_, 0.0);
+        EXPECT_GT(statistics.frames_per_second_, 0.0);
+    }
+    for (int i = 0; i < num_frames; i++) {
+        geometry::Image depth;
+        EXPECT_TRUE(io::ReadImage(GetFilename(i, "png"), depth));
+        ExpectEQ(depths[i]->data_, depth.data_);
+        geometry::Image read_color;
+        EXPECT_TRUE(io::ReadImage(GetFilename(i, "jpg"), read_color));
+        EXPECT_EQ(read_color.width_, color->width_);
+        std::remove(GetFilename(i, "png").c_str());
+        std::remove(GetFilename(i, "jpg").c_str());
+    }
+}
+
+TEST(AsyncImageWriter, DestructorWritesQueuedImages) {
+    const int num_frames = 8;
+    {
+        // A single slot makes the producer wait for the worker.
+        io::AsyncImageWriter writer(1, 1);
+        for (int i = 0; i < num_frames; i++) {
+            writer.WriteImage(GetFilename(i, "png"), CreateDepthImage(i),
+                              io::PNGWriteOption(9));
+        }
+        EXPECT_GT(writer.GetStatistics().num_producer_stalls_, 0u);
+    }
+    for (int i = 0; i < num_frames; i++) {
+        geometry::Image depth;
+        EXPECT_TRUE(io::ReadImage(GetFilename(i, "png"), depth));
+        ExpectEQ(CreateDepthImage(i)->data_, depth.data_);
+        std::remove(GetFilename(i, "png").c_str());
+    }
+}
+
+TEST(AsyncImageWriter, WriteImageFailure) {
+    io::AsyncImageWriter writer(2, 1);
+    writer.WriteImage("test_async_image_writer.unknown", CreateDepthImage(0));
+    writer.WriteImage("test_async_image_writer.png", nullptr);
+    writer.Flush();
+    io::AsyncImageWriterStatistics statistics = writer.GetStatistics();
+    EXPECT_EQ(statistics.num_written_, 0u);
+    EXPECT_EQ(statistics.num_failed_, 2u);
+}
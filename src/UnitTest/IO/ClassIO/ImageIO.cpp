@@ -24,8 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+#include <string>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 TEST(ImageIO, DISABLED_CreateImageFromFile) { unit_test::NotImplemented(); }
 
 TEST(ImageIO, DISABLED_ReadImage) { unit_test::NotImplemented(); }
@@ -39,3 +47,39 @@ TEST(ImageIO, DISABLED_WriteImageToPNG) { unit_test::NotImplemented(); }
 TEST(ImageIO, DISABLED_ReadImageFromJPG) { unit_test::NotImplemented(); }
 
 TEST(ImageIO, DISABLED_WriteImageToJPG) { unit_test::NotImplemented(); }
+
+TEST(ImageIO, WriteImageToPNGWithOption) {
+    geometry::Image depth;
+    depth.Prepare(64, 48, 1, 2);
+    uint16_t *data = reinterpret_cast<uint16_t *>(depth.data_.data());
+    for (int i = 0; i < depth.width_ * depth.height_; i++) {
+        data[i] = uint16_t(1000 + (i % 64) * 7 + (i / 64) * 300);
+    }
+    geometry::Image color;
+    color.Prepare(64, 48, 3, 1);
+    for (size_t i = 0; i < color.data_.size(); i++) {
+        color.data_[i] = uint8_t(i * 31);
+    }
+
+    const std::string filename = "test_write_image_option.png";
+    for (const auto &option :
+         {io::PNGWriteOption(), io::PNGWriteOption::FastDepth(),
+          io::PNGWriteOption(0, io::PNGWriteOption::Filter::None),
+          io::PNGWriteOption(9, io::PNGWriteOption::Filter::Paeth,
+                             io::PNGWriteOption::Strategy::Filtered)}) {
+        for (const geometry::Image *image : {&depth, &color}) {
+            EXPECT_TRUE(io::WriteImageToPNG(filename, *image, option));
+            geometry::Image read_image;
+            EXPECT_TRUE(io::ReadImage(filename, read_image));
+            EXPECT_EQ(image->width_, read_image.width_);
+            EXPECT_EQ(image->height_, read_image.height_);
+            EXPECT_EQ(image->num_of_channels_, read_image.num_of_channels_);
+            EXPECT_EQ(image->bytes_per_channel_,
+                      read_image.bytes_per_channel_);
+            ExpectEQ(image->data_, read_image.data_);
+        }
+    }
+    EXPECT_FALSE(
+            io::WriteImageToPNG(filename, depth, io::PNGWriteOption(10)));
+    std::remove(filename.c_str());
+}
@@ -25,7 +25,9 @@
 // ----------------------------------------------------------------------------
 
 #include <json/json.h>
+#include <cmath>
 #include <cstdio>
+#include <vector>
 
 #include "Open3D/Geometry/Octree.h"
 #include "Open3D/Geometry/PointCloud.h"
@@ -39,16 +41,19 @@ using namespace unit_test;
 
 void WriteReadAndAssertEqual(const geometry::Octree& src_octree,
                              bool delete_temp = true) {
-    // Write to file
-    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_octree.json";
-    EXPECT_TRUE(io::WriteOctree(file_name, src_octree));
+    for (const std::string extension : {"json", "bin"}) {
+        // Write to file
+        std::string file_name =
+                std::string(TEST_DATA_DIR) + "/temp_octree." + extension;
+        EXPECT_TRUE(io::WriteOctree(file_name, src_octree));
 
-    // Read from file
-    geometry::Octree dst_octree;
-    EXPECT_TRUE(io::ReadOctree(file_name, dst_octree));
-    EXPECT_TRUE(src_octree == dst_octree);
-    if (delete_temp) {
-        EXPECT_EQ(std::remove(file_name.c_str()), 0);
+        // Read from file
+        geometry::Octree dst_octree;
+        EXPECT_TRUE(io::ReadOctree(file_name, dst_octree));
+        EXPECT_TRUE(src_octree == dst_octree);
+        if (delete_temp) {
+            EXPECT_EQ(std::remove(file_name.c_str()), 0);
+        }
     }
 }
 
@@ -102,3 +107,41 @@ TEST(OctreeIO, JsonFileIOSevenCubes) {
 
     WriteReadAndAssertEqual(octree);
 }
+
+TEST(OctreeIO, BINNumDecodedNodes) {
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 1000; i++) {
+        pcd.points_.push_back(Eigen::Vector3d(std::cos(i * 0.1), i * 0.001,
+                                              std::sin(i * 0.1)));
+        pcd.colors_.push_back(Eigen::Vector3d(i / 1000.0, 0.5, 0.25));
+    }
+    geometry::Octree octree(6);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+    size_t num_nodes = 0;
+    octree.Traverse(
+            [&num_nodes](const std::shared_ptr<geometry::OctreeNode>&,
+                         const std::shared_ptr<geometry::OctreeNodeInfo>&) {
+                num_nodes++;
+            });
+
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_octree.bin";
+    EXPECT_TRUE(io::WriteOctreeToBIN(file_name, octree));
+    geometry::Octree dst_octree;
+    size_t num_decoded_nodes = 0;
+    EXPECT_TRUE(io::ReadOctreeFromBIN(file_name, dst_octree,
+                                      &num_decoded_nodes));
+    EXPECT_GT(num_nodes, 1000u);
+    EXPECT_EQ(num_decoded_nodes, num_nodes);
+    EXPECT_TRUE(octree == dst_octree);
+
+    // A truncated file is rejected.
+    std::vector<char> buffer(1 << 24);
+    FILE* file = fopen(file_name.c_str(), "rb");
+    buffer.resize(fread(buffer.data(), 1, buffer.size(), file));
+    fclose(file);
+    file = fopen(file_name.c_str(), "wb");
+    fwrite(buffer.data(), 1, buffer.size() - 24, file);
+    fclose(file);
+    EXPECT_FALSE(io::ReadOctreeFromBIN(file_name, dst_octree));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
@@ -24,8 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+#include <vector>
+
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 TEST(PinholeCameraTrajectoryIO,
      DISABLED_CreatePinholeCameraTrajectoryFromFile) {
     unit_test::NotImplemented();
@@ -46,3 +53,82 @@ TEST(PinholeCameraTrajectoryIO, DISABLED_ReadPinholeCameraTrajectoryFromLOG) {
 TEST(PinholeCameraTrajectoryIO, DISABLED_WritePinholeCameraTrajectoryToLOG) {
     unit_test::NotImplemented();
 }
+
+TEST(PinholeCameraTrajectoryIO, WriteReadPinholeCameraTrajectoryBIN) {
+    const std::string filename = "test_trajectory.bin";
+    camera::PinholeCameraTrajectory trajectory;
+    for (int i = 0; i < 10; i++) {
+        camera::PinholeCameraParameters parameters;
+        parameters.intrinsic_.SetIntrinsics(640, 480, 525.0 + i, 525.0, 319.5,
+                                            239.5);
+        parameters.extrinsic_ = Eigen::Matrix4d::Identity();
+        parameters.extrinsic_(2, 3) = i * 0.1;
+        trajectory.parameters_.push_back(parameters);
+    }
+    std::remove(filename.c_str());
+    std::vector<camera::PinholeCameraParameters> first(
+            trajectory.parameters_.begin(), trajectory.parameters_.begin() + 4);
+    std::vector<camera::PinholeCameraParameters> second(
+            trajectory.parameters_.begin() + 4, trajectory.parameters_.end());
+    EXPECT_TRUE(io::AppendPinholeCameraTrajectoryToBIN(filename, first));
+    EXPECT_TRUE(io::AppendPinholeCameraTrajectoryToBIN(filename, second));
+
+    for (int pass = 0; pass < 2; pass++) {
+        camera::PinholeCameraTrajectory read_trajectory;
+        EXPECT_TRUE(io::ReadPinholeCameraTrajectory(filename, read_trajectory));
+        ASSERT_EQ(trajectory.parameters_.size(),
+                  read_trajectory.parameters_.size());
+        for (size_t i = 0; i < trajectory.parameters_.size(); i++) {
+            const auto &e = trajectory.parameters_[i];
+            const auto &a = read_trajectory.parameters_[i];
+            EXPECT_EQ(e.intrinsic_.width_, a.intrinsic_.width_);
+            EXPECT_EQ(e.intrinsic_.height_, a.intrinsic_.height_);
+            ExpectEQ(e.intrinsic_.intrinsic_matrix_,
+                     a.intrinsic_.intrinsic_matrix_);
+            ExpectEQ(e.extrinsic_, a.extrinsic_);
+        }
+        // The second pass reads a file written in one go.
+        EXPECT_TRUE(io::WritePinholeCameraTrajectory(filename, trajectory));
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(PinholeCameraTrajectoryIO, AppendPinholeCameraTrajectoryAfterTruncation) {
+    const std::string filename = "test_trajectory_truncated.bin";
+    std::vector<camera::PinholeCameraParameters> parameters(4);
+    for (int i = 0; i < 4; i++) {
+        parameters[i].intrinsic_.SetIntrinsics(640, 480, 525.0 + i, 525.0,
+                                               319.5, 239.5);
+        parameters[i].extrinsic_ = Eigen::Matrix4d::Identity();
+        parameters[i].extrinsic_(2, 3) = i * 0.1;
+    }
+    std::remove(filename.c_str());
+    EXPECT_TRUE(io::AppendPinholeCameraTrajectoryToBIN(
+            filename, {parameters[0], parameters[1]}));
+    EXPECT_TRUE(io::AppendPinholeCameraTrajectoryToBIN(filename,
+                                                       {parameters[2]}));
+    // Interrupt the second append within its only record, which drops the
+    // whole chunk.
+    FILE *file = fopen(filename.c_str(), "rb");
+    std::vector<char> buffer(1 << 16);
+    buffer.resize(fread(buffer.data(), 1, buffer.size(), file));
+    fclose(file);
+    file = fopen(filename.c_str(), "wb");
+    fwrite(buffer.data(), 1, buffer.size() - 64, file);
+    fclose(file);
+    EXPECT_TRUE(io::AppendPinholeCameraTrajectoryToBIN(filename,
+                                                       {parameters[3]}));
+
+    camera::PinholeCameraTrajectory read_trajectory;
+    EXPECT_TRUE(
+            io::ReadPinholeCameraTrajectoryFromBIN(filename, read_trajectory));
+    ASSERT_EQ(3u, read_trajectory.parameters_.size());
+    for (int i = 0; i < 3; i++) {
+        const auto &e = parameters[i < 2 ? i : 3];
+        const auto &a = read_trajectory.parameters_[i];
+        ExpectEQ(e.intrinsic_.intrinsic_matrix_,
+                 a.intrinsic_.intrinsic_matrix_);
+        ExpectEQ(e.extrinsic_, a.extrinsic_);
+    }
+    std::remove(filename.c_str());
+}
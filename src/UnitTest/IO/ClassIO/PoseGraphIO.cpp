@@ -24,12 +24,152 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+registration::PoseGraph CreateTestPoseGraph(int num_nodes) {
+    registration::PoseGraph pose_graph;
+    for (int i = 0; i < num_nodes; i++) {
+        Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+        pose.block<3, 1>(0, 3) = Eigen::Vector3d(i * 0.5, i * 0.25, -i);
+        pose(0, 1) = i * 0.125;
+        pose_graph.nodes_.push_back(registration::PoseGraphNode(pose));
+    }
+    for (int i = 0; i + 1 < num_nodes; i++) {
+        Eigen::Matrix6d information = Eigen::Matrix6d::Identity() * (i + 1);
+        information(0, 5) = 0.5;
+        pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                i, i + 1, pose_graph.nodes_[i + 1].pose_, information,
+                i % 2 == 1, 0.25 * i));
+    }
+    return pose_graph;
+}
+
+void ExpectPoseGraphEQ(const registration::PoseGraph &expected,
+                       const registration::PoseGraph &actual) {
+    ASSERT_EQ(expected.nodes_.size(), actual.nodes_.size());
+    ASSERT_EQ(expected.edges_.size(), actual.edges_.size());
+    for (size_t i = 0; i < expected.nodes_.size(); i++) {
+        ExpectEQ(expected.nodes_[i].pose_, actual.nodes_[i].pose_);
+    }
+    for (size_t i = 0; i < expected.edges_.size(); i++) {
+        const auto &e = expected.edges_[i];
+        const auto &a = actual.edges_[i];
+        EXPECT_EQ(e.source_node_id_, a.source_node_id_);
+        EXPECT_EQ(e.target_node_id_, a.target_node_id_);
+        EXPECT_EQ(e.uncertain_, a.uncertain_);
+        EXPECT_EQ(e.confidence_, a.confidence_);
+        ExpectEQ(e.transformation_, a.transformation_);
+        ExpectEQ(e.information_, a.information_);
+    }
+}
+
+// Cuts the last num_bytes bytes off a file, as an interrupted write would.
+void TruncateTestFile(const std::string &filename, size_t num_bytes) {
+    FILE *file = fopen(filename.c_str(), "rb");
+    std::vector<char> buffer(1 << 20);
+    buffer.resize(fread(buffer.data(), 1, buffer.size(), file));
+    fclose(file);
+    file = fopen(filename.c_str(), "wb");
+    fwrite(buffer.data(), 1, buffer.size() - num_bytes, file);
+    fclose(file);
+}
+
+}  // unnamed namespace
+
 TEST(PoseGraphIO, DISABLED_CreatePoseGraphFromFile) {
     unit_test::NotImplemented();
 }
 
-TEST(PoseGraphIO, DISABLED_ReadPoseGraph) { unit_test::NotImplemented(); }
+TEST(PoseGraphIO, WriteReadPoseGraph) {
+    const std::string filename = "test_pose_graph.bin";
+    registration::PoseGraph pose_graph = CreateTestPoseGraph(100);
+    EXPECT_TRUE(io::WritePoseGraph(filename, pose_graph));
 
-TEST(PoseGraphIO, DISABLED_WritePoseGraph) { unit_test::NotImplemented(); }
+    registration::PoseGraph read_pose_graph = CreateTestPoseGraph(3);
+    EXPECT_TRUE(io::ReadPoseGraph(filename, read_pose_graph));
+    ExpectPoseGraphEQ(pose_graph, read_pose_graph);
+    std::remove(filename.c_str());
+}
+
+TEST(PoseGraphIO, WritePoseGraphToBINFloatInformation) {
+    const std::string filename = "test_pose_graph_float.bin";
+    // Information values are exactly representable as floats.
+    registration::PoseGraph pose_graph = CreateTestPoseGraph(10);
+    EXPECT_TRUE(io::WritePoseGraphToBIN(filename, pose_graph, true));
+
+    registration::PoseGraph read_pose_graph;
+    EXPECT_TRUE(io::ReadPoseGraphFromBIN(filename, read_pose_graph));
+    ExpectPoseGraphEQ(pose_graph, read_pose_graph);
+    std::remove(filename.c_str());
+}
+
+TEST(PoseGraphIO, AppendPoseGraphToBIN) {
+    const std::string filename = "test_pose_graph_append.bin";
+    std::remove(filename.c_str());
+    registration::PoseGraph pose_graph = CreateTestPoseGraph(20);
+    // Log the graph one node and its edge at a time, mixing both information
+    // precisions.
+    for (size_t i = 0; i < pose_graph.nodes_.size(); i++) {
+        std::vector<registration::PoseGraphEdge> edges;
+        if (i > 0) edges.push_back(pose_graph.edges_[i - 1]);
+        EXPECT_TRUE(io::AppendPoseGraphToBIN(filename, {pose_graph.nodes_[i]},
+                                             edges, i % 2 == 0));
+    }
+    registration::PoseGraph read_pose_graph;
+    EXPECT_TRUE(io::ReadPoseGraphFromBIN(filename, read_pose_graph));
+    ExpectPoseGraphEQ(pose_graph, read_pose_graph);
+
+    // A truncated last record is dropped and the rest of the file is kept.
+    TruncateTestFile(filename, 8);
+    EXPECT_TRUE(io::ReadPoseGraphFromBIN(filename, read_pose_graph));
+    pose_graph.edges_.pop_back();
+    ExpectPoseGraphEQ(pose_graph, read_pose_graph);
+    std::remove(filename.c_str());
+}
+
+TEST(PoseGraphIO, AppendPoseGraphToBINAfterTruncation) {
+    const std::string filename = "test_pose_graph_truncated.bin";
+    std::remove(filename.c_str());
+    registration::PoseGraph pose_graph = CreateTestPoseGraph(9);
+    auto append = [&](int begin, int end) {
+        std::vector<registration::PoseGraphNode> nodes(
+                pose_graph.nodes_.begin() + begin,
+                pose_graph.nodes_.begin() + end);
+        std::vector<registration::PoseGraphEdge> edges(
+                pose_graph.edges_.begin() + std::max(begin - 1, 0),
+                pose_graph.edges_.begin() + end - 1);
+        EXPECT_TRUE(io::AppendPoseGraphToBIN(filename, nodes, edges));
+    };
+    append(0, 3);
+    append(3, 6);
+    // An interrupted append leaves the last edge incomplete. The next append
+    // keeps the complete records before it.
+    TruncateTestFile(filename, 64);
+    append(6, 9);
+    registration::PoseGraph read_pose_graph;
+    EXPECT_TRUE(io::ReadPoseGraphFromBIN(filename, read_pose_graph));
+    pose_graph.edges_.erase(pose_graph.edges_.begin() + 4);
+    ExpectPoseGraphEQ(pose_graph, read_pose_graph);
+    std::remove(filename.c_str());
+}
+
+TEST(PoseGraphIO, ReadPoseGraphFromBINInvalid) {
+    const std::string filename = "test_pose_graph_invalid.bin";
+    FILE *file = fopen(filename.c_str(), "wb");
+    fputs("not a pose graph", file);
+    fclose(file);
+    registration::PoseGraph pose_graph;
+    EXPECT_FALSE(io::ReadPoseGraphFromBIN(filename, pose_graph));
+    EXPECT_FALSE(io::AppendPoseGraphToBIN(filename, {}, {}));
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,169 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/IO/ClassIO/RGBDDatasetReader.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+void GetRGBDFilenames(std::vector<std::string> &color_filenames,
+                      std::vector<std::string> &depth_filenames) {
+    const std::string dir = std::string(TEST_DATA_DIR) + "/RGBD/";
+    for (int i = 0; i < 5; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "%05d", i);
+        color_filenames.push_back(dir + "color/" + name + ".jpg");
+        depth_filenames.push_back(dir + "depth/" + name + ".png");
+    }
+}
+
+}  // namespace
+
+TEST(RGBDDatasetReader, NextFrame) {
+    std::vector<std::string> color_filenames, depth_filenames;
+    GetRGBDFilenames(color_filenames, depth_filenames);
+    io::RGBDDatasetReader reader(color_filenames, depth_filenames, 1000.0,
+                                 3.0, false, 2, 3);
+    EXPECT_EQ(5u, reader.NumFrames());
+    io::RGBDDatasetFrame frame;
+    for (size_t i = 0; i < 5; i++) {
+        ASSERT_TRUE(reader.NextFrame(frame));
+        EXPECT_EQ(i, frame.index_);
+        EXPECT_TRUE(frame.camera_ == nullptr);
+        ASSERT_TRUE(frame.rgbd_ != nullptr);
+
+        geometry::Image color, depth;
+        EXPECT_TRUE(io::ReadImage(color_filenames[i], color));
+        EXPECT_TRUE(io::ReadImage(depth_filenames[i], depth));
+        auto rgbd = geometry::RGBDImage::CreateFromColorAndDepth(
+                color, depth, 1000.0, 3.0, false);
+        ExpectEQ(rgbd->color_.data_, frame.rgbd_->color_.data_);
+        ExpectEQ(rgbd->depth_.data_, frame.rgbd_->depth_.data_);
+    }
+    EXPECT_FALSE(reader.NextFrame(frame));
+
+    auto statistics = reader.GetStatistics();
+    EXPECT_EQ(5u, statistics.num_decoded_);
+    EXPECT_GT(statistics.decode_seconds_, 0.0);
+    EXPECT_GT(statistics.decode_throughput_, 0.0);
+}
+
+TEST(RGBDDatasetReader, NextFrameWithTrajectory) {
+    std::vector<std::string> color_filenames, depth_filenames;
+    GetRGBDFilenames(color_filenames, depth_filenames);
+    camera::PinholeCameraTrajectory trajectory;
+    EXPECT_TRUE(io::ReadPinholeCameraTrajectory(
+            std::string(TEST_DATA_DIR) + "/RGBD/trajectory.log", trajectory));
+    ASSERT_EQ(5u, trajectory.parameters_.size());
+
+    io::RGBDDatasetReader reader(color_filenames, depth_filenames, trajectory);
+    io::RGBDDatasetFrame frame;
+    for (size_t i = 0; i < 5; i++) {
+        ASSERT_TRUE(reader.NextFrame(frame));
+        ASSERT_TRUE(frame.camera_ != nullptr);
+        ExpectEQ(trajectory.parameters_[i].extrinsic_,
+                 frame.camera_->extrinsic_);
+    }
+    EXPECT_FALSE(reader.NextFrame(frame));
+}
+
+TEST(RGBDDatasetReader, BackPressure) {
+    std::vector<std::string> color_filenames, depth_filenames;
+    GetRGBDFilenames(color_filenames, depth_filenames);
+    const size_t queue_size = 1;
+    io::RGBDDatasetReader reader(color_filenames, depth_filenames, 1000.0,
+                                 3.0, true, queue_size, 2);
+    io::RGBDDatasetFrame frame;
+    ASSERT_TRUE(reader.NextFrame(frame));
+    // With a queue of one frame the workers fill it and then wait for the
+    // consumer. Poll until they do instead of relying on timing.
+    auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    io::RGBDDatasetReaderStatistics statistics = reader.GetStatistics();
+    while ((statistics.num_decoded_ < 1 + queue_size ||
+            statistics.num_producer_stalls_ == 0) &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        statistics = reader.GetStatistics();
+    }
+    // One frame has been handed out, the others are in the queue.
+    EXPECT_LE(statistics.num_decoded_, 1 + queue_size);
+    EXPECT_GT(statistics.num_producer_stalls_, 0u);
+    size_t num_frames = 1;
+    while (reader.NextFrame(frame)) {
+        num_frames++;
+    }
+    EXPECT_EQ(5u, num_frames);
+    EXPECT_EQ(5u, reader.GetStatistics().num_decoded_);
+}
+
+TEST(RGBDDatasetReader, MissingFile) {
+    std::vector<std::string> color_filenames, depth_filenames;
+    GetRGBDFilenames(color_filenames, depth_filenames);
+    color_filenames[1] = "missing.jpg";
+    io::RGBDDatasetReader reader(color_filenames, depth_filenames);
+    io::RGBDDatasetFrame frame;
+    for (size_t i = 0; i < 5; i++) {
+        ASSERT_TRUE(reader.NextFrame(frame));
+        EXPECT_EQ(i, frame.index_);
+        EXPECT_EQ(i == 1, frame.rgbd_ == nullptr);
+    }
+}
+
+TEST(RGBDDatasetReader, MismatchedSizes) {
+    std::vector<std::string> color_filenames, depth_filenames;
+    GetRGBDFilenames(color_filenames, depth_filenames);
+    color_filenames[2] = std::string(TEST_DATA_DIR) + "/lena_color.jpg";
+    io::RGBDDatasetReader reader(color_filenames, depth_filenames);
+    io::RGBDDatasetFrame frame;
+    for (size_t i = 0; i < 5; i++) {
+        ASSERT_TRUE(reader.NextFrame(frame));
+        EXPECT_EQ(i, frame.index_);
+        EXPECT_EQ(i == 2, frame.rgbd_ == nullptr);
+    }
+}
+
+TEST(RGBDDatasetReader, StopEarly) {
+    std::vector<std::string> color_filenames, depth_filenames;
+    GetRGBDFilenames(color_filenames, depth_filenames);
+    io::RGBDDatasetReader reader(color_filenames, depth_filenames, 1000.0,
+                                 3.0, true, 1, 4);
+    io::RGBDDatasetFrame frame;
+    EXPECT_TRUE(reader.NextFrame(frame));
+    // The destructor stops the waiting workers.
+}
@@ -0,0 +1,248 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/TensorMapIO.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+// A cloud of 5 points with the kinds of attributes of lidar scans.
+io::TensorMap CreateTensorMap() {
+    io::TensorMap tensor_map;
+    tensor_map["x"] = Tensor(std::vector<float>{0.5f, -1.25f, 3.f, 1e-3f, 7.f},
+                             {5}, Dtype::Float32);
+    tensor_map["y"] = Tensor(std::vector<float>{1.f, 2.f, 3.f, 4.f, 5.f}, {5},
+                             Dtype::Float32);
+    tensor_map["z"] = Tensor(std::vector<float>{-1.f, -2.f, 0.1f, 0.2f, 0.3f},
+                             {5}, Dtype::Float32);
+    tensor_map["intensity"] =
+            Tensor(std::vector<double>{0.1, 0.25, 1.0 / 3.0, 1e10, -2.5},
+                   {5}, Dtype::Float64);
+    tensor_map["label"] = Tensor(std::vector<int32_t>{-7, 0, 3, 100000, 42},
+                                 {5}, Dtype::Int32);
+    tensor_map["ring"] = Tensor(std::vector<uint8_t>{0, 1, 63, 127, 255}, {5},
+                                Dtype::UInt8);
+    tensor_map["timestamp"] =
+            Tensor(std::vector<int64_t>{0, 1, 4000000000, 17, 99}, {5},
+                   Dtype::Int64);
+    tensor_map["normal"] = Tensor(
+            std::vector<float>{1, 0, 0, 0, 1, 0, 0, 0, 1, 0.6f, 0.8f, 0, 0, 0,
+                               -1},
+            {5, 3}, Dtype::Float32);
+    return tensor_map;
+}
+
+template <typename T>
+void ExpectTensorEQ(const Tensor &expected, const Tensor &actual) {
+    EXPECT_EQ(expected.GetDtype(), actual.GetDtype());
+    EXPECT_EQ(expected.GetShape(), actual.GetShape());
+    EXPECT_EQ(expected.ToFlatVector<T>(), actual.ToFlatVector<T>());
+}
+
+}  // unnamed namespace
+
+TEST(TensorMapIO, PLYWriteRead) {
+    const io::TensorMap src = CreateTensorMap();
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_tensor.ply";
+    for (bool write_ascii : {false, true}) {
+        EXPECT_TRUE(io::WriteTensorMap(file_name, src, write_ascii));
+        io::TensorMap dst;
+        EXPECT_TRUE(io::ReadTensorMap(file_name, dst));
+        EXPECT_EQ(std::remove(file_name.c_str()), 0);
+
+        // Columns of the normals are read as separate attributes.
+        EXPECT_EQ(dst.size(), src.size() + 2);
+        for (const auto &name : {"x", "y", "z"}) {
+            ExpectTensorEQ<float>(src.at(name), dst.at(name));
+        }
+        ExpectTensorEQ<double>(src.at("intensity"), dst.at("intensity"));
+        ExpectTensorEQ<int32_t>(src.at("label"), dst.at("label"));
+        ExpectTensorEQ<uint8_t>(src.at("ring"), dst.at("ring"));
+        ExpectTensorEQ<int64_t>(src.at("timestamp"), dst.at("timestamp"));
+        std::vector<float> normals = src.at("normal").ToFlatVector<float>();
+        for (int j = 0; j < 3; j++) {
+            std::vector<float> column =
+                    dst.at("normal_" + std::to_string(j)).ToFlatVector<float>();
+            ASSERT_EQ(column.size(), 5u);
+            for (size_t i = 0; i < column.size(); i++) {
+                EXPECT_EQ(column[i], normals[i * 3 + j]);
+            }
+        }
+    }
+}
+
+TEST(TensorMapIO, PCDWriteRead) {
+    io::TensorMap src = CreateTensorMap();
+    src["valid"] = Tensor(std::vector<bool>{true, false, true, true, false},
+                          {5}, Dtype::Bool);
+    // Nanosecond timestamps need all 64 bits, also in ASCII files.
+    src["timestamp"] = Tensor(
+            std::vector<int64_t>{1700000000123456789, 1700000000123456790,
+                                 -1700000000123456789, 0,
+                                 std::numeric_limits<int64_t>::max()},
+            {5}, Dtype::Int64);
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_tensor.pcd";
+    for (int mode = 0; mode < 3; mode++) {
+        EXPECT_TRUE(io::WriteTensorMap(file_name, src, mode == 0, mode == 2));
+        io::TensorMap dst;
+        EXPECT_TRUE(io::ReadTensorMap(file_name, dst));
+        EXPECT_EQ(std::remove(file_name.c_str()), 0);
+
+        EXPECT_EQ(dst.size(), src.size());
+        for (const auto &name : {"x", "y", "z", "normal"}) {
+            ExpectTensorEQ<float>(src.at(name), dst.at(name));
+        }
+        ExpectTensorEQ<double>(src.at("intensity"), dst.at("intensity"));
+        ExpectTensorEQ<int32_t>(src.at("label"), dst.at("label"));
+        ExpectTensorEQ<uint8_t>(src.at("ring"), dst.at("ring"));
+        ExpectTensorEQ<int64_t>(src.at("timestamp"), dst.at("timestamp"));
+        // Bool is stored as U1.
+        EXPECT_EQ(dst.at("valid").GetDtype(), Dtype::UInt8);
+        EXPECT_EQ(dst.at("valid").ToFlatVector<uint8_t>(),
+                  std::vector<uint8_t>({1, 0, 1, 1, 0}));
+    }
+}
+
+TEST(TensorMapIO, PCDASCIIInt64) {
+    // 300 values per point make lines longer than the 1024-byte I/O buffer.
+    std::string values;
+    for (int i = 0; i < 300; i++) {
+        values += " 0.125";
+    }
+    std::string header =
+            "VERSION 0.7\nFIELDS x t\nSIZE 4 8\nTYPE F I\nCOUNT 300 1\n"
+            "WIDTH 2\nHEIGHT 1\nVIEWPOINT 0 0 0 1 0 0 0\nPOINTS 2\n"
+            "DATA ascii\n";
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_tensor.pcd";
+    FILE *file = fopen(file_name.c_str(), "w");
+    ASSERT_TRUE(file != nullptr);
+    fprintf(file, "%s%s 1700000000123456789\n%s -5\n", header.c_str(),
+            values.c_str(), values.c_str());
+    fclose(file);
+    io::TensorMap dst;
+    EXPECT_TRUE(io::ReadTensorMap(file_name, dst));
+    ExpectTensorEQ<float>(Tensor(std::vector<float>(600, 0.125f), {2, 300},
+                                 Dtype::Float32),
+                          dst.at("x"));
+    ExpectTensorEQ<int64_t>(
+            Tensor(std::vector<int64_t>{1700000000123456789, -5}, {2},
+                   Dtype::Int64),
+            dst.at("t"));
+
+    // Tokens that are not numbers as a whole fail the read.
+    for (const std::string &token :
+         {"12x", "99999999999999999999", "0x10", "abc"}) {
+        file = fopen(file_name.c_str(), "w");
+        ASSERT_TRUE(file != nullptr);
+        fprintf(file, "%s%s 1\n%s %s\n", header.c_str(), values.c_str(),
+                values.c_str(), token.c_str());
+        fclose(file);
+        EXPECT_FALSE(io::ReadTensorMap(file_name, dst)) << token;
+    }
+    file = fopen(file_name.c_str(), "w");
+    ASSERT_TRUE(file != nullptr);
+    fprintf(file, "%s%s 1\n%s 0.5z 2\n", header.c_str(), values.c_str(),
+            values.substr(6).c_str());
+    fclose(file);
+    EXPECT_FALSE(io::ReadTensorMap(file_name, dst));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
+
+TEST(TensorMapIO, PLYBigEndianWithLists) {
+    // A face element before the vertices, a vertex list property and types
+    // that are widened.
+    std::string file_name =
+            std::string(TEST_DATA_DIR) + "/temp_tensor_big_endian.ply";
+    FILE *file = fopen(file_name.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    fprintf(file,
+            "ply\nformat binary_big_endian 1.0\ncomment test\n"
+            "element face 1\nproperty list uchar int vertex_indices\n"
+            "element vertex 2\nproperty char a\nproperty list uchar short "
+            "neighbors\nproperty ushort b\nproperty uint c\nproperty float "
+            "x\nend_header\n");
+    const unsigned char body[] = {
+            // face: 3 indices
+            3, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1,
+            // vertex 0: a = -2, 1 neighbor, b = 65535, c = 4294967295,
+            // x = 1.5
+            0xfe, 1, 0, 1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xc0, 0,
+            0,
+            // vertex 1: a = 5, no neighbors, b = 258, c = 7, x = -2
+            5, 0, 1, 2, 0, 0, 0, 7, 0xc0, 0, 0, 0};
+    fwrite(body, 1, sizeof(body), file);
+    fclose(file);
+
+    io::TensorMap tensor_map;
+    EXPECT_TRUE(io::ReadTensorMapFromPLY(file_name, tensor_map));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+    EXPECT_EQ(tensor_map.size(), 4u);
+    EXPECT_EQ(tensor_map.count("neighbors"), 0u);
+    ExpectTensorEQ<int32_t>(
+            Tensor(std::vector<int32_t>{-2, 5}, {2}, Dtype::Int32),
+            tensor_map.at("a"));
+    ExpectTensorEQ<int32_t>(
+            Tensor(std::vector<int32_t>{65535, 258}, {2}, Dtype::Int32),
+            tensor_map.at("b"));
+    ExpectTensorEQ<int64_t>(
+            Tensor(std::vector<int64_t>{4294967295, 7}, {2}, Dtype::Int64),
+            tensor_map.at("c"));
+    ExpectTensorEQ<float>(
+            Tensor(std::vector<float>{1.5f, -2.f}, {2}, Dtype::Float32),
+            tensor_map.at("x"));
+}
+
+TEST(TensorMapIO, ReadPointCloudPCDToDLPack) {
+    geometry::PointCloud pointcloud;
+    pointcloud.points_ = {{1, 2, 3}, {4, 5, 6}};
+    pointcloud.colors_ = {{1, 0, 0}, {0, 0, 1}};
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_tensor.pcd";
+    EXPECT_TRUE(io::WritePointCloudToPCD(file_name, pointcloud, false, true));
+    io::TensorMap tensor_map;
+    EXPECT_TRUE(io::ReadTensorMap(file_name, tensor_map));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+    EXPECT_EQ(tensor_map.size(), 4u);
+    EXPECT_EQ(tensor_map.at("y").ToFlatVector<float>(),
+              std::vector<float>({2, 5}));
+    EXPECT_EQ(tensor_map.at("rgb").GetDtype(), Dtype::Float32);
+
+    // The tensors are handed over without copying.
+    const Tensor &z = tensor_map.at("z");
+    DLManagedTensor *dl_tensor = z.ToDLPack();
+    Tensor dst = Tensor::FromDLPack(dl_tensor);
+    EXPECT_EQ(dst.GetDataPtr(), z.GetDataPtr());
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>({3, 6}));
+}
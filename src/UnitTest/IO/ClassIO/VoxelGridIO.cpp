@@ -70,3 +70,37 @@ TEST(VoxelGridIO, PLYWriteRead) {
     // Uncomment the line below for visualization test
     // visualization::DrawGeometries({dst_voxel_grid});
 }
+
+TEST(VoxelGridIO, BINWriteRead) {
+    // Voxels on both sides of the origin, spanning several blocks.
+    geometry::VoxelGrid src_voxel_grid;
+    src_voxel_grid.origin_ = Eigen::Vector3d(-1, 2, 0.5);
+    src_voxel_grid.voxel_size_ = 0.25;
+    for (int z = -9; z < 9; z++) {
+        for (int y = -9; y < 9; y++) {
+            for (int x = -20; x < 20; x += 3) {
+                src_voxel_grid.AddVoxel(geometry::Voxel(
+                        Eigen::Vector3i(x, y, z),
+                        Eigen::Vector3d((x + 20) / 40.0, (y + 9) / 18.0,
+                                        (z + 9) / 18.0)));
+            }
+        }
+    }
+
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_voxel_grid.bin";
+    EXPECT_TRUE(io::WriteVoxelGrid(file_name, src_voxel_grid));
+    geometry::VoxelGrid dst_voxel_grid;
+    EXPECT_TRUE(io::ReadVoxelGrid(file_name, dst_voxel_grid));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+
+    EXPECT_EQ(src_voxel_grid.origin_, dst_voxel_grid.origin_);
+    EXPECT_EQ(src_voxel_grid.voxel_size_, dst_voxel_grid.voxel_size_);
+    EXPECT_EQ(src_voxel_grid.voxels_.size(), dst_voxel_grid.voxels_.size());
+    for (auto &src_it : src_voxel_grid.voxels_) {
+        auto dst_it = dst_voxel_grid.voxels_.find(src_it.first);
+        ASSERT_TRUE(dst_it != dst_voxel_grid.voxels_.end());
+        ExpectEQ(src_it.second.grid_index_, dst_it->second.grid_index_);
+        ExpectEQ(src_it.second.color_, dst_it->second.color_,
+                 0.5 / 255.0 + 1e-9);
+    }
+}
@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <string>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+void WriteText(const std::string &filename, const std::string &text) {
+    FILE *file = fopen(filename.c_str(), "w");
+    ASSERT_TRUE(file != nullptr);
+    fputs(text.c_str(), file);
+    fclose(file);
+}
+
+}  // namespace
+
+TEST(FileOBJ, ReadTriangleMeshFromOBJTextured) {
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMesh(
+            std::string(TEST_DATA_DIR) + "/crate/crate.obj", mesh));
+    EXPECT_EQ(8u, mesh.vertices_.size());
+    EXPECT_FALSE(mesh.HasVertexNormals());
+    EXPECT_FALSE(mesh.HasVertexColors());
+    // Quads are split into fans.
+    ASSERT_EQ(12u, mesh.triangles_.size());
+    ExpectEQ(Eigen::Vector3i(4, 5, 1), mesh.triangles_[0]);
+    ExpectEQ(Eigen::Vector3i(4, 1, 0), mesh.triangles_[1]);
+    ASSERT_EQ(36u, mesh.triangle_uvs_.size());
+    ExpectEQ(Eigen::Vector2d(0.0, 0.0), mesh.triangle_uvs_[0]);
+    ExpectEQ(Eigen::Vector2d(1.0, 0.0), mesh.triangle_uvs_[1]);
+    ExpectEQ(Eigen::Vector2d(1.0, 1.0), mesh.triangle_uvs_[2]);
+    ExpectEQ(Eigen::Vector2d(0.0, 0.0), mesh.triangle_uvs_[3]);
+    ExpectEQ(Eigen::Vector2d(1.0, 1.0), mesh.triangle_uvs_[4]);
+    ExpectEQ(Eigen::Vector2d(0.0, 1.0), mesh.triangle_uvs_[5]);
+    EXPECT_EQ(std::vector<int>(12, 0), mesh.triangle_material_ids_);
+    EXPECT_EQ(1u, mesh.textures_.size());
+}
+
+TEST(FileOBJ, ReadTriangleMeshFromOBJIndices) {
+    WriteText("tmp_indices.obj",
+              "# comment\n"
+              "v 0 0 0 1 0 0\n"
+              "v 2 0 0\n"
+              "v 2 2 0 0 0 1\n"
+              "v 1 0.5 0\n"
+              "v 0 2 0\n"
+              "vn 0 0 1\n"
+              "usemtl unknown\n"
+              "f 1//1 2//1 -3//1\n"
+              "\tf   -5//-1 -2//1 -1//1  \r\n"
+              "g concave\n"
+              "f 1 2 3 4 5\n"
+              "f 1 2\n");
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp_indices.obj", mesh));
+    ASSERT_EQ(5u, mesh.vertices_.size());
+    ExpectEQ(Eigen::Vector3d(2.0, 2.0, 0.0), mesh.vertices_[2]);
+    // Vertices without colors are white.
+    ASSERT_EQ(5u, mesh.vertex_colors_.size());
+    ExpectEQ(Eigen::Vector3d(1.0, 0.0, 0.0), mesh.vertex_colors_[0]);
+    ExpectEQ(Eigen::Vector3d(1.0, 1.0, 1.0), mesh.vertex_colors_[1]);
+    ExpectEQ(Eigen::Vector3d(0.0, 0.0, 1.0), mesh.vertex_colors_[2]);
+    // The polygon has a reflex corner at vertex 3, so it is not a fan.
+    std::vector<Eigen::Vector3i> triangles = {{0, 1, 2}, {0, 3, 4}, {1, 2, 3},
+                                              {3, 4, 0}, {0, 1, 3}};
+    ExpectEQ(triangles, mesh.triangles_);
+    EXPECT_EQ(std::vector<int>(5, -1), mesh.triangle_material_ids_);
+    EXPECT_FALSE(mesh.HasTriangleUvs());
+    ExpectEQ(std::vector<Eigen::Vector3d>(5, Eigen::Vector3d(0.0, 0.0, 1.0)),
+             mesh.vertex_normals_);
+    std::remove("tmp_indices.obj");
+
+    WriteText("tmp_indices.obj", "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 4\n");
+    EXPECT_FALSE(io::ReadTriangleMesh("tmp_indices.obj", mesh));
+    WriteText("tmp_indices.obj", "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 0 1 2\n");
+    EXPECT_FALSE(io::ReadTriangleMesh("tmp_indices.obj", mesh));
+    std::remove("tmp_indices.obj");
+}
+
+TEST(FileOBJ, ReadTriangleMeshFromOBJPositionsOnly) {
+    WriteText("tmp_positions.obj",
+              "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 1 1 0\nf 1 2 4 3\n");
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp_positions.obj", mesh));
+    EXPECT_EQ(4u, mesh.vertices_.size());
+    EXPECT_EQ(2u, mesh.triangles_.size());
+    // Nothing is allocated for colors, texture coordinates and normals.
+    EXPECT_EQ(0u, mesh.vertex_colors_.capacity());
+    EXPECT_EQ(0u, mesh.triangle_uvs_.capacity());
+    EXPECT_EQ(0u, mesh.vertex_normals_.capacity());
+    std::remove("tmp_positions.obj");
+}
+
+TEST(FileOBJ, WriteReadTriangleMeshFromOBJ) {
+    auto mesh_gt = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    mesh_gt->ComputeVertexNormals();
+    mesh_gt->triangle_uvs_.resize(3 * mesh_gt->triangles_.size());
+    for (size_t i = 0; i < mesh_gt->triangle_uvs_.size(); i++) {
+        mesh_gt->triangle_uvs_[i] = Eigen::Vector2d(i % 7, i % 11) / 16.0;
+    }
+    EXPECT_TRUE(io::WriteTriangleMesh("tmp_write.obj", *mesh_gt));
+
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp_write.obj", mesh));
+    ExpectEQ(mesh_gt->vertices_, mesh.vertices_);
+    ExpectEQ(mesh_gt->vertex_normals_, mesh.vertex_normals_);
+    ExpectEQ(mesh_gt->triangles_, mesh.triangles_);
+    ExpectEQ(mesh_gt->triangle_uvs_, mesh.triangle_uvs_);
+    EXPECT_FALSE(mesh.HasVertexColors());
+    std::remove("tmp_write.obj");
+    std::remove("tmp_write.mtl");
+}
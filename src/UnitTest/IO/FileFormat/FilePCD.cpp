@@ -24,8 +24,39 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+#include <vector>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+geometry::PointCloud CreatePCDTestCloud(int num_points) {
+    geometry::PointCloud pcd;
+    for (int i = 0; i < num_points; i++) {
+        // Values are exactly representable as floats.
+        pcd.points_.push_back(
+                Eigen::Vector3d(i * 0.25, (i % 97) * 0.5, -(i % 13) * 0.125));
+        pcd.normals_.push_back(Eigen::Vector3d(0.0, 0.0, i % 2 ? 1.0 : -1.0));
+        pcd.colors_.push_back(Eigen::Vector3d((i % 256) / 255.0, 0.0, 1.0));
+    }
+    return pcd;
+}
+
+void ExpectPCDEQ(const geometry::PointCloud &expected,
+                 const geometry::PointCloud &actual) {
+    ExpectEQ(expected.points_, actual.points_);
+    ExpectEQ(expected.normals_, actual.normals_);
+    ExpectEQ(expected.colors_, actual.colors_, 1.0 / 255.0 + 1e-9);
+}
+
+}  // unnamed namespace
+
 TEST(FilePCD, DISABLED_CheckHeader) { unit_test::NotImplemented(); }
 
 TEST(FilePCD, DISABLED_ReadPCDHeader) { unit_test::NotImplemented(); }
@@ -52,6 +83,59 @@ TEST(FilePCD, DISABLED_ConvertRGBToFloat) { unit_test::NotImplemented(); }
 
 TEST(FilePCD, DISABLED_WritePCDData) { unit_test::NotImplemented(); }
 
-TEST(FilePCD, DISABLED_ReadPointCloudFromPCD) { unit_test::NotImplemented(); }
-
-TEST(FilePCD, DISABLED_WritePointCloudToPCD) { unit_test::NotImplemented(); }
+TEST(FilePCD, WriteReadPointCloudFromPCD) {
+    auto pcd_gt = CreatePCDTestCloud(1000);
+    for (bool write_ascii : {true, false}) {
+        for (bool compressed : {true, false}) {
+            EXPECT_TRUE(io::WritePointCloudToPCD("tmp.pcd", pcd_gt,
+                                                 write_ascii, compressed));
+            geometry::PointCloud pcd_test;
+            EXPECT_TRUE(io::ReadPointCloudFromPCD("tmp.pcd", pcd_test));
+            ExpectPCDEQ(pcd_gt, pcd_test);
+        }
+    }
+    std::remove("tmp.pcd");
+}
+
+TEST(FilePCD, WriteReadPointCloudFromPCDChunked) {
+    const int num_points = 10000;
+    const int chunk_size = 4096;
+    auto pcd_gt = CreatePCDTestCloud(num_points);
+    EXPECT_TRUE(io::WritePointCloudToPCD(
+            "tmp_chunked.pcd", pcd_gt,
+            io::PCDWriteOption(false, true, true, chunk_size)));
+    geometry::PointCloud pcd_test;
+    EXPECT_TRUE(io::ReadPointCloudFromPCD("tmp_chunked.pcd", pcd_test));
+    ExpectPCDEQ(pcd_gt, pcd_test);
+
+    // Without the chunk table the data is read as a single LZF stream, as
+    // other PCD readers do.
+    FILE *file = fopen("tmp_chunked.pcd", "rb");
+    ASSERT_TRUE(file != nullptr);
+    std::vector<char> bytes;
+    char buffer[4096];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        bytes.insert(bytes.end(), buffer, buffer + read);
+    }
+    fclose(file);
+    size_t num_chunks = (num_points * 7 * 4 + chunk_size - 1) / chunk_size;
+    size_t table_size = 8 + 4 * num_chunks + 8;
+    ASSERT_GT(bytes.size(), table_size);
+    file = fopen("tmp_unchunked.pcd", "wb");
+    ASSERT_TRUE(file != nullptr);
+    fwrite(bytes.data(), 1, bytes.size() - table_size, file);
+    fclose(file);
+    geometry::PointCloud pcd_serial;
+    EXPECT_TRUE(io::ReadPointCloudFromPCD("tmp_unchunked.pcd", pcd_serial));
+    ExpectPCDEQ(pcd_gt, pcd_serial);
+    std::remove("tmp_chunked.pcd");
+    std::remove("tmp_unchunked.pcd");
+}
+
+TEST(FilePCD, WritePointCloudToPCDInvalidChunkSize) {
+    auto pcd_gt = CreatePCDTestCloud(10);
+    EXPECT_FALSE(io::WritePointCloudToPCD("tmp_invalid.pcd", pcd_gt,
+                                          io::PCDWriteOption(false, true,
+                                                             true, 0)));
+}
@@ -24,14 +24,55 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
-TEST(FilePTS, DISABLED_ReadPointCloudFromPTS) { unit_test::NotImplemented(); }
+using namespace open3d;
+
+TEST(FilePTS, ReadPointCloudFromPTS) {
+    const std::string filename = "tmp_read.pts";
+    FILE *file = fopen(filename.c_str(), "w");
+    ASSERT_TRUE(file != nullptr);
+    fprintf(file,
+            "2\r\n0.5 -1 2 0 0 51 255\r\n3 4.25 -5e-3 7 255 0 0\r\n"
+            "6 7 8 0 1 2 3\r\n");
+    fclose(file);
 
-TEST(FilePTS, DISABLED_ResetConsoleProgress) { unit_test::NotImplemented(); }
+    geometry::PointCloud pointcloud;
+    EXPECT_TRUE(io::ReadPointCloud(filename, pointcloud));
+    ASSERT_EQ(2u, pointcloud.points_.size());
+    ASSERT_EQ(2u, pointcloud.colors_.size());
+    EXPECT_EQ(Eigen::Vector3d(0.5, -1.0, 2.0), pointcloud.points_[0]);
+    EXPECT_EQ(Eigen::Vector3d(3.0, 4.25, -5e-3), pointcloud.points_[1]);
+    unit_test::ExpectEQ(Eigen::Vector3d(0.0, 0.2, 1.0), pointcloud.colors_[0]);
+    unit_test::ExpectEQ(Eigen::Vector3d(1.0, 0.0, 0.0), pointcloud.colors_[1]);
+    std::remove(filename.c_str());
+}
 
-TEST(FilePTS, DISABLED_SplitString) { unit_test::NotImplemented(); }
+TEST(FilePTS, WritePointCloudToPTS) {
+    geometry::PointCloud ref;
+    ref.points_.resize(100000);
+    unit_test::Rand(ref.points_, Eigen::Vector3d(-100.0, -100.0, -100.0),
+                    Eigen::Vector3d(100.0, 100.0, 100.0), 0);
+    const std::string filename = "tmp_write.pts";
+    EXPECT_TRUE(io::WritePointCloud(filename, ref));
 
-TEST(FilePTS, DISABLED_AdvanceConsoleProgress) { unit_test::NotImplemented(); }
+    geometry::PointCloud pointcloud;
+    EXPECT_TRUE(io::ReadPointCloud(filename, pointcloud));
+    unit_test::ExpectEQ(ref.points_, pointcloud.points_);
+    EXPECT_FALSE(pointcloud.HasColors());
 
-TEST(FilePTS, DISABLED_WritePointCloudToPTS) { unit_test::NotImplemented(); }
+    // Colors are stored as integers.
+    ref.colors_.resize(ref.points_.size());
+    for (size_t i = 0; i < ref.colors_.size(); i++) {
+        ref.colors_[i] = Eigen::Vector3d(i % 256, (i / 256) % 256, 17) / 255.0;
+    }
+    EXPECT_TRUE(io::WritePointCloud(filename, ref));
+    EXPECT_TRUE(io::ReadPointCloud(filename, pointcloud));
+    unit_test::ExpectEQ(ref.points_, pointcloud.points_);
+    unit_test::ExpectEQ(ref.colors_, pointcloud.colors_);
+    std::remove(filename.c_str());
+}
@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+#include <vector>
+
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "TestUtility/UnitTest.h"
@@ -45,3 +48,50 @@ TEST(FileSTL, WriteReadTriangleMeshFromSTL) {
     ExpectEQ(tm_gt.vertices_, tm_test.vertices_);
     ExpectEQ(tm_gt.triangles_, tm_test.triangles_);
 }
+
+TEST(FileSTL, ReadTriangleMeshFromSTLWeldVertices) {
+    auto tm_gt = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    tm_gt->ComputeTriangleNormals();
+    io::WriteTriangleMesh("tmp_weld.stl", *tm_gt);
+
+    geometry::TriangleMesh tm_ref;
+    EXPECT_TRUE(io::ReadTriangleMeshFromSTL("tmp_weld.stl", tm_ref, false,
+                                            false));
+    EXPECT_EQ(tm_gt->triangles_.size() * 3, tm_ref.vertices_.size());
+    tm_ref.RemoveDuplicatedVertices();
+
+    geometry::TriangleMesh tm_test;
+    EXPECT_TRUE(io::ReadTriangleMeshFromSTL("tmp_weld.stl", tm_test, true,
+                                            false));
+    EXPECT_EQ(tm_gt->vertices_.size(), tm_test.vertices_.size());
+    ExpectEQ(tm_ref.vertices_, tm_test.vertices_);
+    ExpectEQ(tm_ref.triangles_, tm_test.triangles_);
+    ExpectEQ(tm_ref.triangle_normals_, tm_test.triangle_normals_);
+
+    // The option reaches the STL reader through the extension dispatch.
+    geometry::TriangleMesh tm_dispatch;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp_weld.stl", tm_dispatch,
+                                     io::ReadTriangleMeshOption(true)));
+    ExpectEQ(tm_test.vertices_, tm_dispatch.vertices_);
+    ExpectEQ(tm_test.triangles_, tm_dispatch.triangles_);
+    std::remove("tmp_weld.stl");
+}
+
+TEST(FileSTL, ReadTriangleMeshFromSTLTruncated) {
+    auto tm_gt = geometry::TriangleMesh::CreateBox();
+    tm_gt->ComputeTriangleNormals();
+    io::WriteTriangleMesh("tmp_truncated.stl", *tm_gt);
+    // Drop the last record.
+    FILE *file = fopen("tmp_truncated.stl", "rb");
+    std::vector<char> data(84 + 50 * (tm_gt->triangles_.size() - 1));
+    ASSERT_EQ(data.size(), fread(data.data(), 1, data.size(), file));
+    fclose(file);
+    file = fopen("tmp_truncated.stl", "wb");
+    fwrite(data.data(), 1, data.size(), file);
+    fclose(file);
+
+    geometry::TriangleMesh tm_test;
+    EXPECT_FALSE(io::ReadTriangleMesh("tmp_truncated.stl", tm_test));
+    EXPECT_FALSE(tm_test.HasTriangles());
+    std::remove("tmp_truncated.stl");
+}
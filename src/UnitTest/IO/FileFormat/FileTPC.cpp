@@ -0,0 +1,191 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+// Points on a lattice, with normals and colors that are stored exactly.
+geometry::PointCloud CreateTPCTestCloud() {
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 20000; i++) {
+        pcd.points_.push_back(
+                Eigen::Vector3d(i % 40, (i / 40) % 25, i / 1000) * 0.25);
+        pcd.normals_.push_back(Eigen::Vector3d(0.5, -0.25, i % 2 ? 1.0 : 0.0));
+        pcd.colors_.push_back(
+                Eigen::Vector3d((i % 256) / 255.0, (i % 7) / 255.0, 1.0));
+    }
+    return pcd;
+}
+
+// Returns the point cloud with its points sorted lexicographically.
+geometry::PointCloud SortTPCPoints(const geometry::PointCloud &pcd) {
+    std::vector<size_t> indices(pcd.points_.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    std::sort(indices.begin(), indices.end(), [&pcd](size_t a, size_t b) {
+        const auto &pa = pcd.points_[a], &pb = pcd.points_[b];
+        return std::make_tuple(pa(0), pa(1), pa(2)) <
+               std::make_tuple(pb(0), pb(1), pb(2));
+    });
+    geometry::PointCloud sorted;
+    for (size_t i : indices) {
+        sorted.points_.push_back(pcd.points_[i]);
+        if (pcd.HasNormals()) sorted.normals_.push_back(pcd.normals_[i]);
+        if (pcd.HasColors()) sorted.colors_.push_back(pcd.colors_[i]);
+    }
+    return sorted;
+}
+
+void ExpectTPCEQ(const geometry::PointCloud &expected,
+                 const geometry::PointCloud &actual) {
+    auto sorted_expected = SortTPCPoints(expected);
+    auto sorted_actual = SortTPCPoints(actual);
+    ExpectEQ(sorted_expected.points_, sorted_actual.points_);
+    ExpectEQ(sorted_expected.normals_, sorted_actual.normals_);
+    ExpectEQ(sorted_expected.colors_, sorted_actual.colors_);
+}
+
+}  // namespace
+
+TEST(FileTPC, WriteReadPointCloudFromTPC) {
+    auto pcd_gt = CreateTPCTestCloud();
+    EXPECT_TRUE(io::WritePointCloudToTPC("tmp.tpc", pcd_gt,
+                                         io::TPCWriteOption(500, 3, 2)));
+    geometry::PointCloud pcd_test;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.tpc", pcd_test));
+    ExpectTPCEQ(pcd_gt, pcd_test);
+
+    // Default options and a cloud without attributes.
+    geometry::PointCloud points_only;
+    points_only.points_ = pcd_gt.points_;
+    EXPECT_TRUE(io::WritePointCloud("tmp.tpc", points_only));
+    EXPECT_TRUE(io::ReadPointCloudFromTPC("tmp.tpc", pcd_test));
+    EXPECT_FALSE(pcd_test.HasNormals());
+    EXPECT_FALSE(pcd_test.HasColors());
+    ExpectTPCEQ(points_only, pcd_test);
+
+    geometry::PointCloud empty;
+    EXPECT_TRUE(io::WritePointCloudToTPC("tmp.tpc", empty));
+    EXPECT_TRUE(io::ReadPointCloudFromTPC("tmp.tpc", pcd_test));
+    EXPECT_FALSE(pcd_test.HasPoints());
+    std::remove("tmp.tpc");
+}
+
+TEST(FileTPC, ReadPointCloudFromTPCBoundingBox) {
+    auto pcd_gt = CreateTPCTestCloud();
+    EXPECT_TRUE(io::WritePointCloudToTPC("tmp_bbox.tpc", pcd_gt,
+                                         io::TPCWriteOption(500, 3, 2)));
+    geometry::AxisAlignedBoundingBox bbox(Eigen::Vector3d(1.0, 0.5, 2.0),
+                                          Eigen::Vector3d(4.0, 3.0, 3.0));
+    geometry::PointCloud pcd_test;
+    EXPECT_TRUE(io::ReadPointCloud("tmp_bbox.tpc", pcd_test, bbox));
+    EXPECT_GT(pcd_test.points_.size(), 0u);
+    ExpectTPCEQ(*pcd_gt.Crop(bbox), pcd_test);
+
+    // A box outside of the cloud.
+    geometry::AxisAlignedBoundingBox outside(Eigen::Vector3d(20, 20, 20),
+                                             Eigen::Vector3d(21, 21, 21));
+    EXPECT_TRUE(io::ReadPointCloudFromTPC("tmp_bbox.tpc", pcd_test, outside));
+    EXPECT_FALSE(pcd_test.HasPoints());
+    std::remove("tmp_bbox.tpc");
+}
+
+TEST(FileTPC, ReadPointCloudFromTPCLevels) {
+    auto pcd_gt = CreateTPCTestCloud();
+    EXPECT_TRUE(io::WritePointCloudToTPC("tmp_levels.tpc", pcd_gt,
+                                         io::TPCWriteOption(500, 3, 2)));
+    std::vector<geometry::PointCloud> levels(3);
+    for (int level = 0; level < 3; level++) {
+        EXPECT_TRUE(io::ReadPointCloud("tmp_levels.tpc", levels[level],
+                                       level));
+    }
+    // The cloud spans a cube of side 9.75, so level 0 keeps at most one point
+    // per cell of a 4 x 4 x 4 grid and level 1 of an 8 x 8 x 8 grid.
+    EXPECT_GT(levels[0].points_.size(), 0u);
+    EXPECT_LE(levels[0].points_.size(), 64u);
+    EXPECT_GT(levels[1].points_.size(), levels[0].points_.size());
+    EXPECT_LE(levels[1].points_.size(), 512u);
+    ExpectTPCEQ(pcd_gt, levels[2]);
+
+    // Coarser levels are subsets of finer levels.
+    auto level0 = SortTPCPoints(levels[0]);
+    auto level1 = SortTPCPoints(levels[1]);
+    for (const auto &point : level0.points_) {
+        EXPECT_TRUE(std::find(level1.points_.begin(), level1.points_.end(),
+                              point) != level1.points_.end());
+    }
+
+    geometry::AxisAlignedBoundingBox bbox(Eigen::Vector3d(0, 0, 0),
+                                          Eigen::Vector3d(5, 5, 5));
+    geometry::PointCloud pcd_test;
+    EXPECT_TRUE(io::ReadPointCloudFromTPC("tmp_levels.tpc", pcd_test, bbox, 1));
+    ExpectTPCEQ(*levels[1].Crop(bbox), pcd_test);
+    std::remove("tmp_levels.tpc");
+}
+
+TEST(FileTPC, ReadPointCloudRemovesNonFinitePoints) {
+    geometry::PointCloud pcd;
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    pcd.points_ = {{0, 0, 0}, {nan, 1, 1}, {1, 1, 1}, {1, inf, 1}};
+    EXPECT_TRUE(io::WritePointCloudToTPC("tmp_nonfinite.tpc", pcd));
+    geometry::AxisAlignedBoundingBox bbox(Eigen::Vector3d(-1, -1, -1),
+                                          Eigen::Vector3d(2, 2, 2));
+    geometry::PointCloud pcd_test;
+    EXPECT_TRUE(io::ReadPointCloud("tmp_nonfinite.tpc", pcd_test, bbox));
+    EXPECT_EQ(2u, pcd_test.points_.size());
+    EXPECT_TRUE(io::ReadPointCloud("tmp_nonfinite.tpc", pcd_test, -1));
+    EXPECT_EQ(2u, pcd_test.points_.size());
+    std::remove("tmp_nonfinite.tpc");
+}
+
+TEST(FileTPC, ReadPointCloudFromTPCInvalid) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {{0, 0, 0}, {1, 1, 1}};
+    EXPECT_FALSE(io::WritePointCloudToTPC("tmp_invalid.tpc", pcd,
+                                          io::TPCWriteOption(0)));
+
+    FILE *file = fopen("tmp_invalid.tpc", "w");
+    ASSERT_TRUE(file != nullptr);
+    fputs("0 0 0\n", file);
+    fclose(file);
+    EXPECT_FALSE(io::ReadPointCloudFromTPC("tmp_invalid.tpc", pcd));
+    EXPECT_FALSE(pcd.HasPoints());
+    std::remove("tmp_invalid.tpc");
+}
@@ -24,8 +24,41 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
-TEST(FileXYZ, DISABLED_ReadPointCloudFromXYZ) { unit_test::NotImplemented(); }
+using namespace open3d;
+
+TEST(FileXYZ, ReadPointCloudFromXYZ) {
+    const std::string filename = "tmp_read.xyz";
+    FILE *file = fopen(filename.c_str(), "w");
+    ASSERT_TRUE(file != nullptr);
+    fprintf(file, "not a point\n0.5 -1 2\n3 4.25 -5e-3 trailing\r\nshort 1\n");
+    fclose(file);
+
+    geometry::PointCloud pointcloud;
+    EXPECT_TRUE(io::ReadPointCloud(filename, pointcloud));
+    ASSERT_EQ(2u, pointcloud.points_.size());
+    EXPECT_EQ(Eigen::Vector3d(0.5, -1.0, 2.0), pointcloud.points_[0]);
+    EXPECT_EQ(Eigen::Vector3d(3.0, 4.25, -5e-3), pointcloud.points_[1]);
+    std::remove(filename.c_str());
+
+    EXPECT_FALSE(io::ReadPointCloud("does_not_exist.xyz", pointcloud));
+}
+
+TEST(FileXYZ, WritePointCloudToXYZ) {
+    geometry::PointCloud ref;
+    ref.points_.resize(100000);
+    unit_test::Rand(ref.points_, Eigen::Vector3d(-100.0, -100.0, -100.0),
+                    Eigen::Vector3d(100.0, 100.0, 100.0), 0);
+    const std::string filename = "tmp_write.xyz";
+    EXPECT_TRUE(io::WritePointCloud(filename, ref));
 
-TEST(FileXYZ, DISABLED_WritePointCloudToXYZ) { unit_test::NotImplemented(); }
+    geometry::PointCloud pointcloud;
+    EXPECT_TRUE(io::ReadPointCloud(filename, pointcloud));
+    unit_test::ExpectEQ(ref.points_, pointcloud.points_);
+    std::remove(filename.c_str());
+}
@@ -24,8 +24,50 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
-TEST(FileXYZN, DISABLED_ReadPointCloudFromXYZN) { unit_test::NotImplemented(); }
+using namespace open3d;
+
+TEST(FileXYZN, ReadPointCloudFromXYZN) {
+    const std::string filename = "tmp_read.xyzn";
+    FILE *file = fopen(filename.c_str(), "w");
+    ASSERT_TRUE(file != nullptr);
+    fprintf(file,
+            "not a point\n0.5 -1 2 0 0 1\n"
+            "3 4.25 -5e-3 1 0 0 trailing\r\nshort 1\n");
+    fclose(file);
+
+    geometry::PointCloud pointcloud;
+    EXPECT_TRUE(io::ReadPointCloud(filename, pointcloud));
+    ASSERT_EQ(2u, pointcloud.points_.size());
+    EXPECT_EQ(Eigen::Vector3d(0.5, -1.0, 2.0), pointcloud.points_[0]);
+    EXPECT_EQ(Eigen::Vector3d(3.0, 4.25, -5e-3), pointcloud.points_[1]);
+    ASSERT_EQ(2u, pointcloud.normals_.size());
+    EXPECT_EQ(Eigen::Vector3d(0.0, 0.0, 1.0), pointcloud.normals_[0]);
+    EXPECT_EQ(Eigen::Vector3d(1.0, 0.0, 0.0), pointcloud.normals_[1]);
+    std::remove(filename.c_str());
+
+    EXPECT_FALSE(io::ReadPointCloud("does_not_exist.xyzn", pointcloud));
+}
+
+TEST(FileXYZN, WritePointCloudToXYZN) {
+    geometry::PointCloud ref;
+    ref.points_.resize(100000);
+    unit_test::Rand(ref.points_, Eigen::Vector3d(-100.0, -100.0, -100.0),
+                    Eigen::Vector3d(100.0, 100.0, 100.0), 0);
+    ref.normals_.resize(ref.points_.size());
+    unit_test::Rand(ref.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    const std::string filename = "tmp_write.xyzn";
+    EXPECT_TRUE(io::WritePointCloud(filename, ref));
 
-TEST(FileXYZN, DISABLED_WritePointCloudToXYZN) { unit_test::NotImplemented(); }
\ No newline at end of file
+    geometry::PointCloud pointcloud;
+    EXPECT_TRUE(io::ReadPointCloud(filename, pointcloud));
+    unit_test::ExpectEQ(ref.points_, pointcloud.points_);
+    unit_test::ExpectEQ(ref.normals_, pointcloud.normals_);
+    std::remove(filename.c_str());
+}
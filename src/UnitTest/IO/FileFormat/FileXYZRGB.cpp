@@ -24,12 +24,50 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
-TEST(FileXYZRGB, DISABLED_ReadPointCloudFromXYZRGB) {
-    unit_test::NotImplemented();
+using namespace open3d;
+
+TEST(FileXYZRGB, ReadPointCloudFromXYZRGB) {
+    const std::string filename = "tmp_read.xyzrgb";
+    FILE *file = fopen(filename.c_str(), "w");
+    ASSERT_TRUE(file != nullptr);
+    fprintf(file,
+            "not a point\n0.5 -1 2 0 0.5 1\n"
+            "3 4.25 -5e-3 1 0 0 trailing\r\nshort 1\n");
+    fclose(file);
+
+    geometry::PointCloud pointcloud;
+    EXPECT_TRUE(io::ReadPointCloud(filename, pointcloud));
+    ASSERT_EQ(2u, pointcloud.points_.size());
+    EXPECT_EQ(Eigen::Vector3d(0.5, -1.0, 2.0), pointcloud.points_[0]);
+    EXPECT_EQ(Eigen::Vector3d(3.0, 4.25, -5e-3), pointcloud.points_[1]);
+    ASSERT_EQ(2u, pointcloud.colors_.size());
+    EXPECT_EQ(Eigen::Vector3d(0.0, 0.5, 1.0), pointcloud.colors_[0]);
+    EXPECT_EQ(Eigen::Vector3d(1.0, 0.0, 0.0), pointcloud.colors_[1]);
+    std::remove(filename.c_str());
+
+    EXPECT_FALSE(io::ReadPointCloud("does_not_exist.xyzrgb", pointcloud));
 }
 
-TEST(FileXYZRGB, DISABLED_WritePointCloudToXYZRGB) {
-    unit_test::NotImplemented();
-}
\ No newline at end of file
+TEST(FileXYZRGB, WritePointCloudToXYZRGB) {
+    geometry::PointCloud ref;
+    ref.points_.resize(100000);
+    unit_test::Rand(ref.points_, Eigen::Vector3d(-100.0, -100.0, -100.0),
+                    Eigen::Vector3d(100.0, 100.0, 100.0), 0);
+    ref.colors_.resize(ref.points_.size());
+    unit_test::Rand(ref.colors_, Eigen::Vector3d(0.0, 0.0, 0.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    const std::string filename = "tmp_write.xyzrgb";
+    EXPECT_TRUE(io::WritePointCloud(filename, ref));
+
+    geometry::PointCloud pointcloud;
+    EXPECT_TRUE(io::ReadPointCloud(filename, pointcloud));
+    unit_test::ExpectEQ(ref.points_, pointcloud.points_);
+    unit_test::ExpectEQ(ref.colors_, pointcloud.colors_);
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/FeatureMatching.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Registration/Feature.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+registration::Feature CreateRandomFeature(int dim, int n, unsigned int seed) {
+    srand(seed);
+    registration::Feature feature;
+    feature.data_ = MatrixXd::Random(dim, n);
+    return feature;
+}
+
+}  // namespace
+
+TEST(FeatureMatching, FeatureIndexSearchKNNExact) {
+    registration::Feature feature = CreateRandomFeature(33, 500, 0);
+    registration::Feature query = CreateRandomFeature(33, 20, 1);
+
+    geometry::KDTreeFlann kdtree(feature);
+    registration::FeatureIndex index(feature, 4);
+    EXPECT_EQ(index.Dimension(), 33u);
+    EXPECT_EQ(index.Num(), 500u);
+
+    int knn = 5;
+    for (int i = 0; i < int(query.Num()); i++) {
+        VectorXd q = query.data_.col(i);
+        vector<int> ref_indices, indices;
+        vector<double> ref_distance2, distance2;
+        kdtree.SearchKNN(q, knn, ref_indices, ref_distance2);
+        int result = index.SearchKNN(q, knn, indices, distance2, -1);
+
+        EXPECT_EQ(result, knn);
+        ExpectEQ(ref_indices, indices);
+        ExpectEQ(ref_distance2, distance2);
+    }
+}
+
+TEST(FeatureMatching, FeatureIndexSearchKNNBatch) {
+    registration::Feature feature = CreateRandomFeature(33, 500, 0);
+    registration::Feature query = CreateRandomFeature(33, 50, 1);
+
+    registration::FeatureIndex index(feature);
+
+    int knn = 3;
+    MatrixXi indices;
+    MatrixXd distance2;
+    int result = index.SearchKNNBatch(query, knn, indices, distance2, -1);
+    EXPECT_EQ(result, knn * 50);
+    EXPECT_EQ(indices.rows(), knn);
+    EXPECT_EQ(indices.cols(), 50);
+
+    for (int i = 0; i < int(query.Num()); i++) {
+        vector<int> ref_indices;
+        vector<double> ref_distance2;
+        index.SearchKNN(query.data_.col(i), knn, ref_indices, ref_distance2,
+                        -1);
+        for (int k = 0; k < knn; k++) {
+            EXPECT_EQ(ref_indices[k], indices(k, i));
+            EXPECT_NEAR(ref_distance2[k], distance2(k, i), THRESHOLD_1E_6);
+        }
+    }
+
+    registration::Feature wrong_dim = CreateRandomFeature(10, 5, 2);
+    EXPECT_EQ(index.SearchKNNBatch(wrong_dim, knn, indices, distance2), -1);
+}
+
+TEST(FeatureMatching, FeatureIndexSetFeatureFailureKeepsDataset) {
+    registration::Feature feature = CreateRandomFeature(33, 500, 0);
+    registration::FeatureIndex index(feature);
+
+    registration::Feature empty;
+    EXPECT_FALSE(index.SetFeature(empty));
+    EXPECT_EQ(index.Dimension(), 33u);
+    EXPECT_EQ(index.Num(), 500u);
+
+    vector<int> indices;
+    vector<double> distance2;
+    EXPECT_EQ(index.SearchKNN(feature.data_.col(7), 1, indices, distance2, -1),
+              1);
+    EXPECT_EQ(indices[0], 7);
+}
+
+TEST(FeatureMatching, ComputeFeatureCorrespondences) {
+    int n = 200;
+    registration::Feature target = CreateRandomFeature(33, n, 0);
+
+    // Source is a permutation of the target, so every source feature has an
+    // exact mutual match.
+    registration::Feature source;
+    source.Resize(33, n);
+    vector<int> permutation(n);
+    for (int i = 0; i < n; i++) {
+        permutation[i] = (i * 7 + 3) % n;
+        source.data_.col(i) = target.data_.col(permutation[i]);
+    }
+
+    registration::FeatureMatchingOption option(4, -1, true);
+    registration::CorrespondenceSet corres =
+            registration::ComputeFeatureCorrespondences(source, target, option);
+    EXPECT_EQ(int(corres.size()), n);
+    for (const auto &c : corres) {
+        EXPECT_EQ(permutation[c(0)], c(1));
+    }
+
+    // Drop half of the target; the mutual filter must reject source features
+    // whose nearest target prefers another source feature.
+    registration::Feature half_target;
+    half_target.data_ = target.data_.leftCols(n / 2);
+    option.mutual_filter_ = false;
+    auto corres_all = registration::ComputeFeatureCorrespondences(
+            source, half_target, option);
+    option.mutual_filter_ = true;
+    auto corres_mutual = registration::ComputeFeatureCorrespondences(
+            source, half_target, option);
+    EXPECT_EQ(int(corres_all.size()), n);
+    EXPECT_EQ(int(corres_mutual.size()), n / 2);
+    for (const auto &c : corres_mutual) {
+        EXPECT_EQ(permutation[c(0)], c(1));
+    }
+}
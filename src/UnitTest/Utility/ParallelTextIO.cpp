@@ -0,0 +1,165 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Open3D/Utility/ParallelTextIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace std;
+
+namespace {
+
+double Parse(const string &text) {
+    const char *ptr = text.data();
+    double value = 0.0;
+    EXPECT_TRUE(utility::ParseDouble(ptr, text.data() + text.size(), value))
+            << text;
+    return value;
+}
+
+}  // namespace
+
+TEST(ParallelTextIO, ParseDoubleSyntax) {
+    EXPECT_EQ(0.0, Parse("0"));
+    EXPECT_EQ(-1.5, Parse("  -1.5"));
+    EXPECT_EQ(1.5, Parse("+1.5"));
+    EXPECT_EQ(0.25, Parse(".25"));
+    EXPECT_EQ(3.0, Parse("3."));
+    EXPECT_EQ(1.5e-3, Parse("1.5e-3"));
+    EXPECT_EQ(2e10, Parse("2E+10"));
+    EXPECT_EQ(1e300, Parse("1e300"));
+    EXPECT_EQ(4.9406564584124654e-324, Parse("4.9406564584124654e-324"));
+    EXPECT_TRUE(std::isinf(Parse("-inf")));
+    EXPECT_TRUE(std::isinf(Parse("Infinity")));
+    EXPECT_TRUE(std::isnan(Parse("nan")));
+
+    string text = "12.5e 7";
+    const char *ptr = text.data();
+    double value = 0.0;
+    EXPECT_TRUE(utility::ParseDouble(ptr, text.data() + text.size(), value));
+    EXPECT_EQ(12.5, value);
+    EXPECT_EQ('e', *ptr);
+    EXPECT_FALSE(utility::ParseDouble(ptr, text.data() + text.size(), value));
+
+    for (const string invalid : {"", "  ", "-", ".", "x1", "+.e1"}) {
+        ptr = invalid.data();
+        EXPECT_FALSE(utility::ParseDouble(ptr, invalid.data() + invalid.size(),
+                                          value))
+                << invalid;
+    }
+}
+
+TEST(ParallelTextIO, ParseDoubleMatchesStrtod) {
+    mt19937 rng(0);
+    uniform_real_distribution<double> mantissa(-1.0, 1.0);
+    uniform_int_distribution<int> exponent(-30, 30);
+    uniform_int_distribution<int> precision(1, 20);
+    char text[64];
+    for (int i = 0; i < 100000; i++) {
+        double x = mantissa(rng) * std::pow(10.0, exponent(rng));
+        if (i % 2 == 0) {
+            snprintf(text, sizeof(text), "%.*f", precision(rng) % 12, x);
+        } else {
+            snprintf(text, sizeof(text), "%.*e", precision(rng), x);
+        }
+        EXPECT_EQ(strtod(text, nullptr), Parse(text)) << text;
+    }
+}
+
+TEST(ParallelTextIO, ReadNumericLines) {
+    const string filename = "tmp_parallel_text_io.txt";
+    FILE *file = fopen(filename.c_str(), "w");
+    ASSERT_TRUE(file != nullptr);
+    fprintf(file, "# comment\n1 2 3\n\n4 5\n6 7 8 extra\r\n9 10 11");
+    fclose(file);
+
+    vector<vector<double>> rows;
+    // store runs concurrently, so the flags must not share bits.
+    vector<uint8_t> stored;
+    auto resize = [&](size_t n) {
+        rows.resize(n);
+        stored.resize(n, 0);
+    };
+    auto store = [&](size_t i, const double *values) {
+        rows[i].assign(values, values + 3);
+        stored[i] = 1;
+    };
+
+    file = fopen(filename.c_str(), "r");
+    ASSERT_TRUE(utility::ReadNumericLines(file, 3, resize, store));
+    fclose(file);
+    ASSERT_EQ(3u, rows.size());
+    EXPECT_EQ(vector<double>({1, 2, 3}), rows[0]);
+    EXPECT_EQ(vector<double>({6, 7, 8}), rows[1]);
+    EXPECT_EQ(vector<double>({9, 10, 11}), rows[2]);
+
+    rows.clear();
+    stored.clear();
+    file = fopen(filename.c_str(), "r");
+    ASSERT_TRUE(utility::ReadNumericLines(file, 3, resize, store, 4, true));
+    fclose(file);
+    ASSERT_EQ(4u, rows.size());
+    EXPECT_EQ(vector<uint8_t>({0, 1, 0, 0}), stored);
+    EXPECT_EQ(vector<double>({1, 2, 3}), rows[1]);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ParallelTextIO, WriteLines) {
+    const string filename = "tmp_parallel_text_io.txt";
+    const size_t num_lines = 200000;
+    FILE *file = fopen(filename.c_str(), "w");
+    ASSERT_TRUE(file != nullptr);
+    EXPECT_TRUE(utility::WriteLines(
+            file, num_lines, [](size_t i, string &buffer) {
+                buffer += to_string(i) + " " + to_string(2 * i) + "\n";
+            }));
+    fclose(file);
+
+    vector<double> values(2 * num_lines, -1.0);
+    file = fopen(filename.c_str(), "r");
+    ASSERT_TRUE(utility::ReadNumericLines(
+            file, 2, [&](size_t n) { EXPECT_EQ(num_lines, n); },
+            [&](size_t i, const double *v) {
+                values[2 * i] = v[0];
+                values[2 * i + 1] = v[1];
+            }));
+    fclose(file);
+    for (size_t i = 0; i < num_lines; i++) {
+        EXPECT_EQ(double(i), values[2 * i]);
+        EXPECT_EQ(double(2 * i), values[2 * i + 1]);
+    }
+
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "Open3D/Utility/RadixSort.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace std;
+
+namespace {
+
+void ExpectStableSorted(const vector<uint64_t> &original,
+                        const vector<uint64_t> &sorted,
+                        const vector<size_t> &indices) {
+    vector<size_t> ref(original.size());
+    iota(ref.begin(), ref.end(), 0);
+    stable_sort(ref.begin(), ref.end(), [&original](size_t a, size_t b) {
+        return original[a] < original[b];
+    });
+    ASSERT_EQ(ref.size(), indices.size());
+    ASSERT_EQ(ref.size(), sorted.size());
+    for (size_t i = 0; i < ref.size(); i++) {
+        EXPECT_EQ(ref[i], indices[i]);
+        EXPECT_EQ(original[ref[i]], sorted[i]);
+    }
+}
+
+}  // namespace
+
+TEST(RadixSort, Empty) {
+    vector<uint64_t> keys;
+    vector<size_t> indices(3, 0);
+    utility::RadixSortWithIndices(keys, indices);
+    EXPECT_TRUE(keys.empty());
+    EXPECT_TRUE(indices.empty());
+}
+
+TEST(RadixSort, SmallKeys) {
+    vector<uint64_t> keys = {5, 3, 5, 0, 3, 1, 5, 0};
+    vector<uint64_t> original = keys;
+    vector<size_t> indices;
+    utility::RadixSortWithIndices(keys, indices);
+    ExpectStableSorted(original, keys, indices);
+}
+
+TEST(RadixSort, LargeKeys) {
+    // Enough keys to be split across threads, with many duplicates and keys
+    // spanning all eight digits.
+    mt19937_64 rng(0);
+    vector<uint64_t> keys(300000);
+    for (auto &key : keys) {
+        key = rng() % 1000;
+        if (key % 7 == 0) {
+            key = rng();
+        }
+    }
+    vector<uint64_t> original = keys;
+    vector<size_t> indices;
+    utility::RadixSortWithIndices(keys, indices);
+    ExpectStableSorted(original, keys, indices);
+}
+
+TEST(RadixSort, KeysOnly) {
+    mt19937_64 rng(1);
+    vector<uint64_t> keys(100000);
+    for (auto &key : keys) {
+        key = rng() >> (rng() % 64);
+    }
+    vector<uint64_t> ref = keys;
+    sort(ref.begin(), ref.end());
+    utility::RadixSort(keys);
+    EXPECT_EQ(ref, keys);
+}
@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Utility/GeometryChange.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+using Ranges = vector<pair<size_t, size_t>>;
+
+TEST(GeometryChange, All) {
+    visualization::GeometryChange change;
+    EXPECT_TRUE(change.IsAll());
+    EXPECT_EQ(change.GetDirtyRanges(10, 12), Ranges({{0, 12}}));
+    EXPECT_EQ(change.GetDirtyRanges(10, 0), Ranges());
+
+    change.Merge(visualization::GeometryChange::Appended(5));
+    EXPECT_TRUE(change.IsAll());
+}
+
+TEST(GeometryChange, Appended) {
+    auto change = visualization::GeometryChange::Appended(10);
+    EXPECT_FALSE(change.IsAll());
+    EXPECT_EQ(change.GetDirtyRanges(10, 15), Ranges({{10, 15}}));
+    // Elements that were never uploaded are always dirty.
+    EXPECT_EQ(change.GetDirtyRanges(8, 15), Ranges({{8, 15}}));
+    EXPECT_EQ(change.GetDirtyRanges(10, 10), Ranges());
+}
+
+TEST(GeometryChange, ModifiedAndMerge) {
+    auto change = visualization::GeometryChange::Modified({7, 2, 3, 3, 20});
+    EXPECT_EQ(change.GetDirtyRanges(10, 10), Ranges({{2, 4}, {7, 8}}));
+
+    change.Merge(visualization::GeometryChange::Modified({4, 8}));
+    change.Merge(visualization::GeometryChange::Appended(9));
+    EXPECT_FALSE(change.IsAll());
+    EXPECT_EQ(change.GetDirtyRanges(10, 12), Ranges({{2, 5}, {7, 12}}));
+
+    change.Merge(visualization::GeometryChange());
+    EXPECT_TRUE(change.IsAll());
+}
+
+TEST(GeometryChange, GrowBufferCapacity) {
+    EXPECT_EQ(visualization::GrowBufferCapacity(100, 80), 100u);
+    EXPECT_EQ(visualization::GrowBufferCapacity(100, 101), 200u);
+    EXPECT_EQ(visualization::GrowBufferCapacity(100, 350), 350u);
+    EXPECT_EQ(visualization::GrowBufferCapacity(0, 1), 1u);
+}
+
+TEST(GeometryChange, ConvertDirtyElements) {
+    vector<Eigen::Vector3d> elements(200000);
+    for (size_t i = 0; i < elements.size(); i++) {
+        elements[i] = Eigen::Vector3d(double(i), 0.5, -double(i));
+    }
+    // Long ranges span several conversion chunks.
+    Ranges ranges = {{3, 4}, {10, 70000}, {70001, 70002}, {100000, 200000}};
+    vector<Eigen::Vector3f> converted;
+    visualization::ConvertDirtyElements(elements, ranges, converted);
+
+    size_t expected_size = 1 + 69990 + 1 + 100000;
+    ASSERT_EQ(converted.size(), expected_size);
+    size_t k = 0, mismatches = 0;
+    for (const auto &range : ranges) {
+        for (size_t i = range.first; i < range.second; i++, k++) {
+            if (converted[k] != elements[i].cast<float>()) mismatches++;
+        }
+    }
+    EXPECT_EQ(mismatches, 0u);
+}
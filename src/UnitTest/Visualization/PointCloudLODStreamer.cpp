@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Utility/PointCloudLODStreamer.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudLOD.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+using Ranges = vector<pair<size_t, size_t>>;
+
+namespace {
+
+// Camera at \p position looking at \p target, with the y axis of the image
+// pointing down.
+camera::PinholeCameraParameters CreateCamera(const Eigen::Vector3d &position,
+                                             const Eigen::Vector3d &target) {
+    camera::PinholeCameraParameters camera;
+    camera.intrinsic_.SetIntrinsics(640, 480, 500.0, 500.0, 319.5, 239.5);
+    Eigen::Vector3d z = (target - position).normalized();
+    Eigen::Vector3d x = z.cross(Eigen::Vector3d(0, 0, 1)).normalized();
+    Eigen::Vector3d y = z.cross(x);
+    Eigen::Matrix3d R;
+    R << x.transpose(), y.transpose(), z.transpose();
+    camera.extrinsic_ = Eigen::Matrix4d::Identity();
+    camera.extrinsic_.block<3, 3>(0, 0) = R;
+    camera.extrinsic_.block<3, 1>(0, 3) = -R * position;
+    return camera;
+}
+
+}  // namespace
+
+TEST(PointCloudLODStreamer, CameraPath) {
+    geometry::PointCloud pointcloud;
+    pointcloud.points_.resize(200000);
+    Rand(pointcloud.points_, Eigen::Vector3d(0, 0, 0),
+         Eigen::Vector3d(10, 10, 0.5), 0);
+    auto lod = geometry::PointCloudLOD::CreateFromPointCloud(pointcloud, 1000,
+                                                             4, 10);
+    const size_t budget = 20000;
+    const double stale_ratio = 0.25;
+    visualization::PointCloudLODStreamer streamer(lod, budget, 1.0,
+                                                  stale_ratio);
+
+    // The root is shown before the first selection.
+    auto rendered = streamer.GetPointCloud();
+    EXPECT_EQ(lod->GetNodePointCount(0), rendered->points_.size());
+
+    // Fly towards the terrain, each camera requested twice.
+    size_t num_appended = 0;
+    for (int i = 0; i < 20; i++) {
+        Eigen::Vector3d position(5.0 - 0.2 * i, 5.0, 15.0 - 0.7 * i);
+        auto camera = CreateCamera(position, Eigen::Vector3d(0, 5.0, 0));
+        for (int k = 0; k < 2; k++) {
+            streamer.RequestSelection(camera);
+            streamer.WaitForSelection();
+            EXPECT_EQ(size_t(i + 1), streamer.GetNumSelections());
+
+            size_t old_size = rendered->points_.size();
+            visualization::GeometryChange change;
+            bool changed = streamer.UpdatePointCloud(change);
+            if (k == 1) {
+                // The selection of an unchanged camera is reused.
+                EXPECT_FALSE(changed);
+            }
+            if (changed && !change.IsAll()) {
+                EXPECT_GT(rendered->points_.size(), old_size);
+                size_t new_size = rendered->points_.size();
+                Ranges expected = {{old_size, new_size}};
+                EXPECT_EQ(expected, change.GetDirtyRanges(old_size, new_size));
+                num_appended++;
+            }
+            if (!changed) {
+                EXPECT_EQ(old_size, rendered->points_.size());
+            }
+            EXPECT_EQ(rendered, streamer.GetPointCloud());
+            EXPECT_LE(streamer.GetSelectedPointCount(), budget);
+            EXPECT_LE(streamer.GetSelectedPointCount(),
+                      rendered->points_.size());
+            EXPECT_LE(rendered->points_.size(),
+                      size_t((1.0 + stale_ratio) * budget));
+            EXPECT_GE(streamer.GetLastSelectionTime(), 0.0);
+        }
+    }
+    // Close to the terrain the selection is refined past the root.
+    EXPECT_GT(streamer.GetSelectedPointCount(), lod->GetNodePointCount(0));
+    EXPECT_GT(num_appended, 0u);
+}
+
+TEST(PointCloudLODStreamer, Destroy) {
+    geometry::PointCloud pointcloud;
+    pointcloud.points_.resize(10000);
+    Rand(pointcloud.points_, Eigen::Vector3d(0, 0, 0),
+         Eigen::Vector3d(1, 1, 1), 0);
+    auto lod = geometry::PointCloudLOD::CreateFromPointCloud(pointcloud, 100);
+    // Destroying the streamer with a pending request joins the worker.
+    visualization::PointCloudLODStreamer streamer(lod, 1000);
+    streamer.RequestSelection(CreateCamera(Eigen::Vector3d(0.5, 0.5, 3),
+                                           Eigen::Vector3d(0.5, 0.5, 0)));
+}